@@ -12,7 +12,9 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/helics-config.h"
 #include "helics_benchmark_util.h"
 
+#include <cstdlib>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -24,7 +26,8 @@ class BenchmarkFederate {
   public:
     enum class OutputFormat {
         PLAIN_TEXT,
-        //          JSON
+        JSON,  //!< a single line json object keyed by the short result keys
+        CSV  //!< a header line of the short result keys followed by a line of values
     };
 
     // getters and setters for parameters
@@ -75,6 +78,11 @@ class BenchmarkFederate {
      */
     void setOutputFormat(OutputFormat f) { result_format = f; }
 
+    /** get the latencies of the time grants recorded by the federate*/
+    const LatencyRecorder& getGrantLatency() const { return grantLatency; }
+    /** get the latencies of the message or value round trips recorded by the federate*/
+    const LatencyRecorder& getRoundTripLatency() const { return roundTripLatency; }
+
     // protected to give derived classes more control
   protected:
     class Result {
@@ -87,6 +95,9 @@ class BenchmarkFederate {
 
     OutputFormat result_format{OutputFormat::PLAIN_TEXT};  //!< output format for printing results
 
+    LatencyRecorder grantLatency;  //!< the latencies of time requests made in the main loop
+    LatencyRecorder roundTripLatency;  //!< the latencies of values or messages sent and returned
+
     // variables to track current state, mainly for gbenchmark piecewise setup
     bool initialized{false};
     bool readyToRun{false};
@@ -97,6 +108,9 @@ class BenchmarkFederate {
     int maxIndex{0};  //<! the maximum index + 1 given to a benchmark federate in a run
     helics::Time deltaTime{helics::Time(10, time_units::ns)};  //<! sampling rate
     helics::Time finalTime{helics::Time(10000, time_units::ns)};  //<! final time
+    std::string coreThreadArgs;  //<! thread placement arguments passed to the created core
+    std::string cpuAffinity;  //<! the processors for all the threads of the process
+    int threadPriority{0};  //<! the real time priority for all the threads of the process
 
     std::unique_ptr<helics::CombinationFederate>
         fed;  //<! the federate object to use in derived classes
@@ -172,6 +186,41 @@ class BenchmarkFederate {
             "--print_systeminfo",
             []() { printHELICSsystemInfo(); },
             "prints the HELICS system info");
+
+        static const std::map<std::string, OutputFormat> formatMap{
+            {"plain", OutputFormat::PLAIN_TEXT},
+            {"text", OutputFormat::PLAIN_TEXT},
+            {"json", OutputFormat::JSON},
+            {"csv", OutputFormat::CSV}};
+        app->add_option("--output_format", result_format, "the format to print results in")
+            ->transform(CLI::CheckedTransformer(&formatMap, CLI::ignore_case))
+            ->ignore_underscore();
+
+        // thread placement options,  the federate uses the process wide settings unless the
+        // --federate_cpus or --federate_priority options are given
+        auto* thread_group = app->add_option_group("threads", "thread placement options");
+        thread_group
+            ->add_option("--cpu_affinity",
+                         cpuAffinity,
+                         "the processors (for example '0-3,8') all the threads run on")
+            ->ignore_underscore();
+        thread_group
+            ->add_option("--thread_priority",
+                         threadPriority,
+                         "the real time scheduling priority of all the threads")
+            ->ignore_underscore();
+        for (const auto* coreOption : {"--processing_cpus", "--comms_cpus", "--asio_cpus"}) {
+            std::string optionName(coreOption);
+            thread_group
+                ->add_option_function<std::string>(
+                    optionName,
+                    [this, optionName](const std::string& val) {
+                        coreThreadArgs.append(" " + optionName + "=" + val);
+                    },
+                    "the processors for the core " + optionName.substr(2, optionName.size() - 7) +
+                        " threads")
+                ->ignore_underscore();
+        }
     }
 
     /** starts execution of the federation
@@ -236,11 +285,60 @@ class BenchmarkFederate {
     void printResults()
     {
         doAddBenchmarkResults();
-        for (const auto& r : results) {
-            if (result_format == OutputFormat::PLAIN_TEXT) {
-                std::cout << r.name << ": " << r.value << std::endl;
-            }
+        addLatencyResults("TIME GRANT LATENCY", "grant_latency", grantLatency);
+        addLatencyResults("ROUND TRIP LATENCY", "round_trip_latency", roundTripLatency);
+        switch (result_format) {
+            case OutputFormat::PLAIN_TEXT:
+            default:
+                for (const auto& r : results) {
+                    std::cout << r.name << ": " << r.value << '\n';
+                }
+                break;
+            case OutputFormat::JSON: {
+                std::string separator;
+                std::cout << '{';
+                for (const auto& r : results) {
+                    std::cout << separator << '"' << r.key << "\":" << jsonValue(r.value);
+                    separator = ",";
+                }
+                std::cout << "}\n";
+            } break;
+            case OutputFormat::CSV: {
+                std::string separator;
+                for (const auto& r : results) {
+                    std::cout << separator << csvValue(r.key);
+                    separator = ",";
+                }
+                separator.clear();
+                std::cout << '\n';
+                for (const auto& r : results) {
+                    std::cout << separator << csvValue(r.value);
+                    separator = ",";
+                }
+                std::cout << '\n';
+            } break;
+        }
+        std::cout << std::flush;
+    }
+
+    /** add the percentiles of a set of latencies to the results if any were recorded
+     * @param name the name of the latency measurement
+     * @param key the short key prefix for the results
+     * @param latency the recorded latencies
+     */
+    void addLatencyResults(const std::string& name,
+                           const std::string& key,
+                           const LatencyRecorder& latency)
+    {
+        if (latency.count() == 0) {
+            return;
         }
+        addResult(name + " COUNT", key + "_count", latency.count());
+        auto nanoseconds = [](double value) { return static_cast<std::int64_t>(value); };
+        addResult(name + " P50 (ns)", key + "_p50_ns", nanoseconds(latency.percentile(0.5)));
+        addResult(name + " P90 (ns)", key + "_p90_ns", nanoseconds(latency.percentile(0.9)));
+        addResult(name + " P99 (ns)", key + "_p99_ns", nanoseconds(latency.percentile(0.99)));
+        addResult(name + " MAX (ns)", key + "_max_ns", nanoseconds(latency.max()));
     }
 
     /** add a named result to the list of results to output
@@ -271,6 +369,44 @@ class BenchmarkFederate {
     }
 
   private:
+    /** format a result value for json output,  numerical values are left unquoted*/
+    static std::string jsonValue(const std::string& value)
+    {
+        if (!value.empty() && value.find_first_not_of("0123456789+-.eE") == std::string::npos) {
+            char* end{nullptr};
+            std::strtod(value.c_str(), &end);
+            if (end == value.c_str() + value.size()) {
+                return value;
+            }
+        }
+        std::string quoted{"\""};
+        for (auto c : value) {
+            if (c == '"' || c == '\\') {
+                quoted.push_back('\\');
+            }
+            quoted.push_back(c);
+        }
+        quoted.push_back('"');
+        return quoted;
+    }
+
+    /** format a result value for csv output,  values with separators or quotes are quoted*/
+    static std::string csvValue(const std::string& value)
+    {
+        if (value.find_first_of(",\"\n") == std::string::npos) {
+            return value;
+        }
+        std::string quoted{"\""};
+        for (auto c : value) {
+            if (c == '"') {
+                quoted.push_back('"');
+            }
+            quoted.push_back(c);
+        }
+        quoted.push_back('"');
+        return quoted;
+    }
+
     /** call federate finalize() and handle before/after callbacks*/
     void finalize()
     {
@@ -295,9 +431,23 @@ class BenchmarkFederate {
             return parseArgsResult;
         }
         fi.loadInfoFromArgs(app->remainArgs());
+        if (!cpuAffinity.empty()) {
+            coreThreadArgs.append(" --cpu_affinity=" + cpuAffinity);
+            if (fi.cpuAffinity.empty()) {
+                fi.cpuAffinity = cpuAffinity;
+            }
+        }
+        if (threadPriority != 0) {
+            coreThreadArgs.append(" --thread_priority=" + std::to_string(threadPriority));
+            if (fi.threadPriority == 0) {
+                fi.threadPriority = threadPriority;
+            }
+        }
+        fi.coreInitString.append(coreThreadArgs);
 
         doParamInit(fi);
         std::string name = getName();
+        addResult("FEDERATE NAME", "federate_name", name);
         fed = std::make_unique<helics::CombinationFederate>(name, fi);
         doFedInit();
         initialized = true;
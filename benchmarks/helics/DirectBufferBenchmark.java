@@ -0,0 +1,93 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+
+import com.java.helics.*;
+
+/**
+ * Compares publishing and reading large vectors through java arrays with the
+ * java.nio direct buffer functions of the Java interface.
+ *
+ * Build and run against the helics jar with
+ *   javac -classpath helics.jar DirectBufferBenchmark.java
+ *   java -Djava.library.path=[helicsJava dir] -classpath helics.jar:. DirectBufferBenchmark [steps]
+ */
+public class DirectBufferBenchmark {
+
+    static final int[] VECTOR_SIZES = { 1000, 100000, 1000000 };
+
+    static SWIGTYPE_p_void createFederate(String name) {
+        SWIGTYPE_p_void fedInfo = helics.helicsCreateFederateInfo();
+        helics.helicsFederateInfoSetCoreTypeFromString(fedInfo, "inproc");
+        helics.helicsFederateInfoSetCoreInitString(fedInfo, "--autobroker --federates=1");
+        SWIGTYPE_p_void fed = helics.helicsCreateValueFederate(name, fedInfo);
+        helics.helicsFederateInfoFree(fedInfo);
+        return fed;
+    }
+
+    /** run a federate publishing a vector to itself and return the mean time per step in us */
+    static double runSteps(int size, int steps, boolean direct) {
+        SWIGTYPE_p_void fed = createFederate(direct ? "directFed" : "arrayFed");
+        SWIGTYPE_p_void pub = helics.helicsFederateRegisterGlobalPublication(fed, "vec",
+                HelicsDataTypes.HELICS_DATA_TYPE_VECTOR, null);
+        SWIGTYPE_p_void sub = helics.helicsFederateRegisterSubscription(fed, "vec", null);
+        helics.helicsFederateEnterExecutingMode(fed);
+
+        double[] array = new double[size];
+        DoubleBuffer buffer = ByteBuffer.allocateDirect(size * Double.BYTES).order(ByteOrder.nativeOrder())
+                .asDoubleBuffer();
+        DoubleBuffer readBuffer = ByteBuffer.allocateDirect(size * Double.BYTES)
+                .order(ByteOrder.nativeOrder()).asDoubleBuffer();
+        for (int ii = 0; ii < size; ++ii) {
+            array[ii] = ii;
+            buffer.put(ii, ii);
+        }
+        double checksum = 0.0;
+        long start = System.nanoTime();
+        for (int step = 1; step <= steps; ++step) {
+            array[0] = step;
+            buffer.put(0, step);
+            if (direct) {
+                helics.helicsPublicationPublishVectorDirect(pub, buffer, size);
+            } else {
+                helics.helicsPublicationPublishVector(pub, array);
+            }
+            helics.helicsFederateRequestTime(fed, step);
+            // the array path has no vector read into java memory so both paths read into the direct buffer
+            int count = helics.helicsInputGetVectorDirect(sub, readBuffer);
+            checksum += readBuffer.get(0) + count;
+        }
+        long elapsed = System.nanoTime() - start;
+
+        helics.helicsFederateFinalize(fed);
+        helics.helicsFederateFree(fed);
+        helics.helicsCleanupLibrary();
+        if (checksum <= 0.0) {
+            System.out.println("no data received");
+        }
+        return elapsed / 1000.0 / steps;
+    }
+
+    public static void main(String[] args) {
+        System.loadLibrary("helicsJava");
+        int steps = (args.length > 0) ? Integer.parseInt(args[0]) : 100;
+        System.out.println("HELICS_BENCHMARK: DirectBufferBenchmark");
+        System.out.println("HELICS Version: " + helics.helicsGetVersion());
+        System.out.println(String.format("%12s %16s %16s", "size", "array (us/step)", "direct (us/step)"));
+        for (int size : VECTOR_SIZES) {
+            // warm up both paths before measuring
+            runSteps(size, 5, false);
+            runSteps(size, 5, true);
+            double arrayTime = runSteps(size, steps, false);
+            double directTime = runSteps(size, steps, true);
+            System.out.println(String.format("%12d %16.1f %16.1f", size, arrayTime, directTime));
+        }
+    }
+}
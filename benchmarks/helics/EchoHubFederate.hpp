@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/application_api/Publications.hpp"
 #include "helics/application_api/Subscriptions.hpp"
 
+#include <chrono>
 #include <string>
 #include <vector>
 
@@ -57,7 +58,9 @@ class EchoHub: public BenchmarkFederate {
                     pubs[ii].publish(val);
                 }
             }
+            auto requestTime = std::chrono::steady_clock::now();
             cTime = fed->requestTime(finalTime + 0.05);
+            grantLatency.recordSince(requestTime);
         }
     }
 };
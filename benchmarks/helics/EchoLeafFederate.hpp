@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/application_api/Publications.hpp"
 #include "helics/application_api/Subscriptions.hpp"
 
+#include <chrono>
 #include <string>
 
 /* class implementing a leaf for the echo message benchmark*/
@@ -39,17 +40,24 @@ class EchoLeaf: public BenchmarkFederate {
         // sufficient length to get beyond SSO
         const std::string txstring = std::to_string(100000 + index) + std::string(100, '1');
         const int iter = 5000;
+        grantLatency.reserve(iter + 2);
+        roundTripLatency.reserve(iter);
+        std::chrono::steady_clock::time_point sendTime;
         while (cnt <= iter + 1) {
+            auto requestTime = std::chrono::steady_clock::now();
             fed->requestNextStep();
+            grantLatency.recordSince(requestTime);
             ++cnt;
-            if (cnt <= iter) {
-                pub.publish(txstring);
-            }
             while (fed->isUpdated(sub)) {
                 auto& nstring = sub.getString();
                 if (nstring != txstring) {
                     throw("incorrect string");
                 }
+                roundTripLatency.recordSince(sendTime);
+            }
+            if (cnt <= iter) {
+                sendTime = std::chrono::steady_clock::now();
+                pub.publish(txstring);
             }
         }
     }
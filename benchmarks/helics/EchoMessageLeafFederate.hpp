@@ -10,6 +10,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/application_api/Endpoints.hpp"
 #include "helics/core/ActionMessage.hpp"
 
+#include <chrono>
 #include <string>
 
 /* class implementing a leaf for the echo message benchmark*/
@@ -37,17 +38,24 @@ class EchoMessageLeaf: public BenchmarkFederate {
         // sufficient length to get beyond SSO
         const std::string txstring = std::to_string(100000 + index) + std::string(100, '1');
         const int iter = 5000;
+        grantLatency.reserve(iter + 2);
+        roundTripLatency.reserve(iter);
+        std::chrono::steady_clock::time_point sendTime;
         while (cnt <= iter + 1) {
+            auto requestTime = std::chrono::steady_clock::now();
             fed->requestNextStep();
+            grantLatency.recordSince(requestTime);
             ++cnt;
-            if (cnt <= iter) {
-                ept.sendTo(txstring, "echo");
-            }
             while (ept.hasMessage()) {
                 auto m = ept.getMessage();
                 if (m->data.to_string() != txstring) {
                     throw("incorrect string");
                 }
+                roundTripLatency.recordSince(sendTime);
+            }
+            if (cnt <= iter) {
+                sendTime = std::chrono::steady_clock::now();
+                ept.sendTo(txstring, "echo");
             }
         }
     }
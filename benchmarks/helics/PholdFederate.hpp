@@ -12,6 +12,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/core/ActionMessage.hpp"
 #include "helics/helics-config.h"
 
+#include <map>
 #include <random>
 #include <string>
 #include <utility>
@@ -45,6 +46,10 @@ class PholdFederate: public BenchmarkFederate {
     std::uniform_real_distribution<double> rand_uniform_double;
     std::uniform_int_distribution<unsigned int> rand_uniform_int;
 
+    // optimistic execution with rollback
+    bool optimistic_{false};
+    std::map<helics::Time, std::pair<int, std::mt19937>> checkpoints;
+
   public:
     PholdFederate(): BenchmarkFederate("PHOLD") {}
 
@@ -55,6 +60,7 @@ class PholdFederate: public BenchmarkFederate {
     void setInitialEventCount(unsigned int count) { initEvCount_ = count; }
     void setLocalProbability(double p) { localProbability_ = p; }
     void setLookahead(double v) { lookahead_ = v; }
+    void setOptimistic(bool b) { optimistic_ = b; }
 
     std::string getName() override { return "phold_" + std::to_string(index); }
 
@@ -70,6 +76,9 @@ class PholdFederate: public BenchmarkFederate {
         app->add_flag("--gen_rand_seed", generateRandomSeed, "enable generating a random seed");
         app->add_option("--set_rand_seed", seed, "set the random seed");
         app->add_option("--set_phold_lookahead", lookahead_, "set the lookahead used by phold");
+        app->add_flag("--optimistic",
+                      optimistic_,
+                      "run the federate optimistically with rollback instead of conservatively");
     }
 
     void doAddBenchmarkResults() override
@@ -77,8 +86,11 @@ class PholdFederate: public BenchmarkFederate {
         addResult("EVENT COUNT", "EvCount", std::to_string(evCount));
     }
 
-    void doParamInit(helics::FederateInfo& /*fi*/) override
+    void doParamInit(helics::FederateInfo& fi) override
     {
+        if (optimistic_) {
+            fi.setFlagOption(HELICS_FLAG_ROLLBACK);
+        }
         if (app->get_option("--set_rand_seed")->count() == 0) {
             std::mt19937 random_engine(0x600d5eed);  // NOLINT
             std::uniform_int_distribution<unsigned int> rand_seed_uniform;
@@ -105,7 +117,28 @@ class PholdFederate: public BenchmarkFederate {
         }
     }
 
-    void doFedInit() override { ept = &fed->registerEndpoint("ept"); }
+    void doFedInit() override
+    {
+        ept = &fed->registerEndpoint("ept");
+        if (optimistic_) {
+            // the event count and the random number generator are the only state to checkpoint
+            fed->setOptimisticCallbacks(
+                [this](helics::Time grantTime) {
+                    checkpoints[grantTime] = std::make_pair(evCount, rand_gen);
+                },
+                [this](helics::Time rollbackTime) {
+                    auto checkpoint = checkpoints.lower_bound(rollbackTime);
+                    if (checkpoint != checkpoints.end()) {
+                        evCount = checkpoint->second.first;
+                        rand_gen = checkpoint->second.second;
+                        checkpoints.erase(checkpoint, checkpoints.end());
+                    }
+                },
+                [this](helics::Time committedTime) {
+                    checkpoints.erase(checkpoints.begin(), checkpoints.lower_bound(committedTime));
+                });
+        }
+    }
 
     void doMakeReady() override
     {
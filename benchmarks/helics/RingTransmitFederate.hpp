@@ -12,6 +12,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/application_api/Subscriptions.hpp"
 #include "helics/application_api/ValueFederate.hpp"
 
+#include <chrono>
 #include <string>
 
 /** class implementing a token ring using a value being passed as the token*/
@@ -53,6 +54,8 @@ class RingTransmit: public BenchmarkFederate {
 
     void doMainLoop() override
     {
+        // the first federate measures the time for the token to travel around the ring
+        auto sendTime = std::chrono::steady_clock::now();
         if (index == 0) {
             std::string txstring(100, '1');
             pub->publish(txstring);
@@ -61,9 +64,15 @@ class RingTransmit: public BenchmarkFederate {
         auto nextTime = deltaTime;
 
         while (nextTime < finalTime) {
+            auto requestTime = std::chrono::steady_clock::now();
             nextTime = fed->requestTime(finalTime);
+            grantLatency.recordSince(requestTime);
             if (fed->isUpdated(*sub)) {
                 auto& nstring = sub->getString();
+                if (index == 0) {
+                    roundTripLatency.recordSince(sendTime);
+                    sendTime = std::chrono::steady_clock::now();
+                }
                 pub->publish(nstring);
                 ++loopCount;
             }
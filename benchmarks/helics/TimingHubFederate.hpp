@@ -12,6 +12,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/application_api/Subscriptions.hpp"
 #include "helics/core/ActionMessage.hpp"
 
+#include <chrono>
 #include <string>
 #include <vector>
 
@@ -51,7 +52,9 @@ class TimingHub: public BenchmarkFederate {
     {
         helics::Time cTime{0.0};
         while (cTime <= finalTime) {
+            auto requestTime = std::chrono::steady_clock::now();
             cTime = fed->requestTime(finalTime + 0.05);
+            grantLatency.recordSince(requestTime);
         }
     }
 };
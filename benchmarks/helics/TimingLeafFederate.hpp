@@ -12,6 +12,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/application_api/Subscriptions.hpp"
 #include "helics/core/ActionMessage.hpp"
 
+#include <chrono>
 #include <string>
 
 /** class implementing the leaf for a timing test*/
@@ -37,8 +38,11 @@ class TimingLeaf: public BenchmarkFederate {
     {
         int cnt = 0;
         const int iter = 5000;
+        grantLatency.reserve(iter + 2);
         while (cnt <= iter + 1) {
+            auto requestTime = std::chrono::steady_clock::now();
             fed->requestNextStep();
+            grantLatency.recordSince(requestTime);
             ++cnt;
         }
     }
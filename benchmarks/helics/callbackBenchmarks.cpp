@@ -0,0 +1,150 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/CallbackFederate.hpp"
+#include "helics/application_api/CombinationFederate.hpp"
+#include "helics/application_api/Inputs.hpp"
+#include "helics/application_api/Publications.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics/helics-config.h"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using helics::CoreType;
+
+/// the number of time steps each federate executes
+static constexpr int stepCount{10};
+
+/** generate the core initialization string for a number of federates*/
+static std::string coreInit(int feds)
+{
+    return std::string("--autobroker --log_level=no_print --federates=") + std::to_string(feds);
+}
+
+/** connect the federates in a ring where each federate subscribes to the next one*/
+template<class FedType>
+static void connectRing(std::vector<std::unique_ptr<FedType>>& feds)
+{
+    const auto count = feds.size();
+    for (std::size_t ii = 0; ii < count; ++ii) {
+        feds[ii]->template registerGlobalPublication<double>("cb_pub" + std::to_string(ii));
+        feds[ii]->registerSubscription("cb_pub" + std::to_string((ii + 1) % count));
+    }
+}
+
+/** execute one step of a ring federate, read the neighbor value and publish an update*/
+static void ringStep(helics::CombinationFederate& fed)
+{
+    auto& sub = fed.getInput(0);
+    double value = sub.isUpdated() ? sub.getValue<double>() : 0.0;
+    fed.getPublication(0).publish(value + 1.0);
+}
+
+/** federates driven by callbacks on the worker pool of a single inproc core*/
+static void BMcallback_federates(benchmark::State& state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        int feds = static_cast<int>(state.range(0));
+        auto wcore = helics::CoreFactory::create(CoreType::INPROC, coreInit(feds));
+        std::vector<std::unique_ptr<helics::CallbackFederate>> fedList;
+        fedList.reserve(feds);
+        for (int ii = 0; ii < feds; ++ii) {
+            fedList.push_back(
+                std::make_unique<helics::CallbackFederate>("cbfed" + std::to_string(ii), wcore));
+        }
+        connectRing(fedList);
+        for (auto& fed : fedList) {
+            auto* fedPtr = fed.get();
+            fed->setStepCallback([fedPtr](helics::Time granted) {
+                ringStep(*fedPtr);
+                return (granted < stepCount) ? granted + 1.0 : helics::Time::maxVal();
+            });
+        }
+        state.ResumeTiming();
+        for (auto& fed : fedList) {
+            fed->enterInitializingMode();
+        }
+        for (auto& fed : fedList) {
+            fed->waitForCompletion();
+        }
+        state.PauseTiming();
+        fedList.clear();
+        wcore.reset();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+    state.counters["threads"] = static_cast<double>(std::thread::hardware_concurrency());
+    state.counters["steps"] = benchmark::Counter(static_cast<double>(state.range(0) * stepCount),
+                                                 benchmark::Counter::kIsIterationInvariantRate);
+}
+
+/** the same ring executed with a thread for each federate for comparison*/
+static void BMthread_federates(benchmark::State& state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        int feds = static_cast<int>(state.range(0));
+        auto wcore = helics::CoreFactory::create(CoreType::INPROC, coreInit(feds));
+        std::vector<std::unique_ptr<helics::CombinationFederate>> fedList;
+        fedList.reserve(feds);
+        for (int ii = 0; ii < feds; ++ii) {
+            fedList.push_back(
+                std::make_unique<helics::CombinationFederate>("thfed" + std::to_string(ii), wcore));
+        }
+        connectRing(fedList);
+        state.ResumeTiming();
+        std::vector<std::thread> threadList;
+        threadList.reserve(feds);
+        for (auto& fed : fedList) {
+            threadList.emplace_back([&fed]() {
+                fed->enterExecutingMode();
+                helics::Time granted = helics::timeZero;
+                while (granted <= stepCount) {
+                    ringStep(*fed);
+                    granted = (granted < stepCount) ? fed->requestTime(granted + 1.0) :
+                                                      helics::Time::maxVal();
+                }
+                fed->finalize();
+            });
+        }
+        for (auto& thrd : threadList) {
+            thrd.join();
+        }
+        state.PauseTiming();
+        fedList.clear();
+        wcore.reset();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+    state.counters["threads"] = static_cast<double>(state.range(0));
+    state.counters["steps"] = benchmark::Counter(static_cast<double>(state.range(0) * stepCount),
+                                                 benchmark::Counter::kIsIterationInvariantRate);
+}
+
+static constexpr int64_t maxscale{1 << (9 + HELICS_BENCHMARK_SHIFT_FACTOR)};
+
+BENCHMARK(BMcallback_federates)
+    ->RangeMultiplier(4)
+    ->Range(16, maxscale * 16)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BMthread_federates)
+    ->RangeMultiplier(4)
+    ->Range(16, maxscale)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+HELICS_BENCHMARK_MAIN(callbackBenchmark);
@@ -0,0 +1,233 @@
+# -*- coding: utf-8 -*-
+"""
+Compares two sets of HELICS benchmark results and flags regressions.
+
+Each result set is one or more files containing any of
+  * the json output of a google benchmark executable
+    (--benchmark_out=file.json or --benchmark_format=json),  the HELICS
+    system information printed ahead of the json is skipped
+  * the json lines printed by benchmark federates run with
+    --output_format=json
+  * the csv output printed by benchmark federates run with
+    --output_format=csv
+
+Repeated measurements of the same metric (benchmark repetitions or multiple
+files) form a sample.  The medians of the baseline and candidate samples are
+compared and a two sided Mann-Whitney U test checks if the difference is
+statistically significant.  Only time and latency metrics, where larger values
+are worse, are considered for regressions.  Metrics with fewer than min_samples
+values on either side are reported as having insufficient samples and are never
+counted as regressions.
+
+Example:
+    python compare_benchmarks.py --baseline base.json --candidate new.json --alpha 0.05
+
+The script exits with 1 if any regression is found.
+
+SPDX-License-Identifier: BSD-3-Clause
+"""
+
+import argparse
+import csv
+import io
+import json
+import math
+import re
+import sys
+from collections import defaultdict
+
+# metrics where a larger value is a worse result
+TIME_METRIC = re.compile(r"(^real_time$|^cpu_time$|_time$|_ns$|_us$|_ms$|jitter|latency)")
+
+
+def _add_value(results, benchmark, metric, value):
+    try:
+        number = float(value)
+    except (TypeError, ValueError):
+        return
+    if math.isfinite(number):
+        results[(benchmark, metric)].append(number)
+
+
+def _parse_gbench(data, results):
+    for bench in data.get("benchmarks", []):
+        if bench.get("run_type") == "aggregate":
+            # use the individual repetitions rather than their summaries
+            continue
+        name = bench.get("run_name", bench.get("name"))
+        for metric, value in bench.items():
+            if metric in ("name", "run_name", "run_type", "time_unit", "family_index"):
+                continue
+            if metric in ("iterations", "repetitions", "repetition_index", "threads"):
+                continue
+            _add_value(results, name, metric, value)
+
+
+def _parse_federate(record, results):
+    name = str(record.get("federate_name", "federate"))
+    for metric, value in record.items():
+        if metric != "federate_name":
+            _add_value(results, name, metric, value)
+
+
+def load_results(files):
+    """load a set of result files into a dictionary of (benchmark, metric) -> [values]"""
+    results = defaultdict(list)
+    for filename in files:
+        with open(filename, "r") as infile:
+            text = infile.read()
+        start = text.find("{")
+        if start >= 0:
+            # a google benchmark json object spans several lines
+            try:
+                data = json.loads(text[start:])
+                if isinstance(data, dict) and "benchmarks" in data:
+                    _parse_gbench(data, results)
+                    continue
+            except ValueError:
+                pass
+            for line in text.splitlines():
+                line = line.strip()
+                if line.startswith("{"):
+                    try:
+                        _parse_federate(json.loads(line), results)
+                    except ValueError:
+                        pass
+            continue
+        lines = [line for line in text.splitlines() if "," in line]
+        reader = csv.reader(io.StringIO("\n".join(lines)))
+        header = None
+        for row in reader:
+            if header is None or row == header:
+                header = row
+                continue
+            _parse_federate(dict(zip(header, row)), results)
+            header = None
+    return results
+
+
+def median(values):
+    ordered = sorted(values)
+    mid = len(ordered) // 2
+    if len(ordered) % 2 == 1:
+        return ordered[mid]
+    return (ordered[mid - 1] + ordered[mid]) / 2.0
+
+
+def mann_whitney_p(first, second):
+    """two sided p value of the Mann-Whitney U test using the normal approximation"""
+    n1 = len(first)
+    n2 = len(second)
+    combined = sorted([(v, 0) for v in first] + [(v, 1) for v in second])
+    ranks = [0.0] * len(combined)
+    tie_term = 0.0
+    index = 0
+    while index < len(combined):
+        end = index
+        while end + 1 < len(combined) and combined[end + 1][0] == combined[index][0]:
+            end += 1
+        count = end - index + 1
+        for tied in range(index, end + 1):
+            ranks[tied] = (index + end) / 2.0 + 1.0
+        tie_term += count ** 3 - count
+        index = end + 1
+    rank_sum = sum(rank for rank, (_, group) in zip(ranks, combined) if group == 0)
+    u_value = rank_sum - n1 * (n1 + 1) / 2.0
+    total = n1 + n2
+    variance = n1 * n2 / 12.0 * ((total + 1) - tie_term / (total * (total - 1)))
+    if variance <= 0:
+        return 1.0
+    # continuity correction
+    z_value = (abs(u_value - n1 * n2 / 2.0) - 0.5) / math.sqrt(variance)
+    return min(1.0, math.erfc(max(z_value, 0.0) / math.sqrt(2.0)))
+
+
+def compare(baseline, candidate, alpha, threshold, min_samples):
+    """compare two sets of results and return a list of rows and the number of regressions"""
+    rows = []
+    regressions = 0
+    for key in sorted(set(baseline) & set(candidate)):
+        benchmark, metric = key
+        if not TIME_METRIC.search(metric):
+            continue
+        base = baseline[key]
+        cand = candidate[key]
+        base_median = median(base)
+        cand_median = median(cand)
+        if base_median == 0:
+            change = 0.0 if cand_median == 0 else math.inf
+        else:
+            change = (cand_median - base_median) / abs(base_median)
+        if len(base) >= min_samples and len(cand) >= min_samples:
+            p_value = mann_whitney_p(base, cand)
+            significant = p_value < alpha
+            note = ""
+        else:
+            # too few samples to judge the change,  report it without a status
+            p_value = math.nan
+            significant = False
+            note = "insufficient samples"
+        status = ""
+        if change > threshold and significant:
+            status = "REGRESSION"
+            regressions += 1
+        elif change < -threshold and significant:
+            status = "improvement"
+        rows.append((benchmark, metric, base_median, cand_median, change, p_value, status, note))
+    return rows, regressions
+
+
+def main(args):
+    baseline = load_results(args.baseline)
+    candidate = load_results(args.candidate)
+    rows, regressions = compare(baseline, candidate, args.alpha, args.threshold, args.min_samples)
+    if not rows:
+        print("no common time or latency metrics found")
+        return 0
+    print(
+        "{:<48} {:<24} {:>14} {:>14} {:>9} {:>8}  {}".format(
+            "benchmark", "metric", "baseline", "candidate", "change", "p", "status"
+        )
+    )
+    for benchmark, metric, base, cand, change, p_value, status, note in rows:
+        if args.only_changes and not status:
+            continue
+        p_text = "-" if math.isnan(p_value) else "{:.4f}".format(p_value)
+        print(
+            "{:<48} {:<24} {:>14.4g} {:>14.4g} {:>+8.1f}% {:>8}  {} {}".format(
+                benchmark[:48], metric[:24], base, cand, change * 100.0, p_text, status, note
+            ).rstrip()
+        )
+    print("{} regression(s) found in {} metrics".format(regressions, len(rows)))
+    return 1 if regressions > 0 else 0
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Compare two sets of HELICS benchmark results and flag regressions"
+    )
+    parser.add_argument(
+        "--baseline", nargs="+", required=True, help="result files of the baseline"
+    )
+    parser.add_argument(
+        "--candidate", nargs="+", required=True, help="result files to compare to the baseline"
+    )
+    parser.add_argument(
+        "--alpha", type=float, default=0.05, help="significance level of the comparison"
+    )
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.05,
+        help="minimum relative increase of the median to report as a regression",
+    )
+    parser.add_argument(
+        "--min_samples",
+        type=int,
+        default=3,
+        help="minimum number of samples in each set for the significance test",
+    )
+    parser.add_argument(
+        "--only_changes", action="store_true", help="only print regressions and improvements"
+    )
+    sys.exit(main(parser.parse_args()))
@@ -0,0 +1,110 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/FederateInfo.hpp"
+#include "helics/application_api/ValueFederate.hpp"
+#include "helics/common/InterfaceConfigReader.hpp"
+#include "helics/common/JsonProcessingFunctions.hpp"
+#include "helics/core/Core.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <string>
+
+using helics::CoreType;
+
+static constexpr int interfaceCount{100000};
+static const std::string configFile{"configLoadBenchmark_interfaces.json"};
+static const std::string manifestFile{"configLoadBenchmark_interfaces.hifm"};
+
+/** generate a configuration file with half publications and half inputs*/
+static void generateConfigFile()
+{
+    std::ofstream out(configFile);
+    out << "{\n  \"publications\": [\n";
+    for (int ii = 0; ii < interfaceCount / 2; ++ii) {
+        out << "    {\"key\": \"pub" << ii << R"(", "type": "double", "units": "kW"})";
+        out << ((ii + 1 < interfaceCount / 2) ? ",\n" : "\n");
+    }
+    out << "  ],\n  \"inputs\": [\n";
+    for (int ii = 0; ii < interfaceCount / 2; ++ii) {
+        out << "    {\"key\": \"input" << ii << R"(", "type": "double", "units": "W", "targets": ")"
+            << "pub" << ii << "\"}";
+        out << ((ii + 1 < interfaceCount / 2) ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+}
+
+// parse the full configuration into a DOM
+static void BMconfig_parse_dom(benchmark::State& state)
+{
+    for (auto _ : state) {
+        auto doc = loadJson(configFile);
+        benchmark::DoNotOptimize(doc);
+    }
+}
+BENCHMARK(BMconfig_parse_dom)->Unit(benchmark::TimeUnit::kMillisecond)->UseRealTime();
+
+// parse the configuration one interface at a time
+static void BMconfig_parse_sections(benchmark::State& state, const std::string& file)
+{
+    for (auto _ : state) {
+        helics::InterfaceConfigReader reader(file);
+        std::size_t count{0};
+        for (const auto* section : {"publications", "inputs"}) {
+            count += reader.forEachElement(section, [](const Json::Value& element) {
+                benchmark::DoNotOptimize(element);
+            });
+        }
+        benchmark::DoNotOptimize(count);
+    }
+}
+BENCHMARK_CAPTURE(BMconfig_parse_sections, json, configFile)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BMconfig_parse_sections, manifest, manifestFile)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+// the time to register all the interfaces of the configuration in a federate
+static void BMconfig_register(benchmark::State& state, const std::string& file)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto wcore = helics::CoreFactory::create(CoreType::INPROC,
+                                                 "--autobroker --federates=1 --log_level=no_print");
+        helics::FederateInfo fi(CoreType::INPROC);
+        fi.coreName = wcore->getIdentifier();
+        helics::ValueFederate vFed("configfed", fi);
+        state.ResumeTiming();
+        vFed.registerInterfaces(file);
+        state.PauseTiming();
+        vFed.finalize();
+        wcore.reset();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+}
+BENCHMARK_CAPTURE(BMconfig_register, json, configFile)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BMconfig_register, manifest, manifestFile)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+// generate the configuration files before any of the benchmarks run
+static const bool configFilesGenerated = []() {
+    generateConfigFile();
+    helics::generateInterfaceManifest(configFile, manifestFile);
+    return true;
+}();
+
+HELICS_BENCHMARK_MAIN(configLoadBenchmark);
@@ -0,0 +1,152 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/Inputs.hpp"
+#include "helics/application_api/Publications.hpp"
+#include "helics/application_api/ValueFederate.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics/helics-config.h"
+#include "helics_benchmark_main.h"
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using helics::CoreType;
+
+/// the number of time steps each federate executes
+static constexpr int stepCount{10};
+/// the tolerance for a value to be considered converged
+static constexpr double tolerance{1e-6};
+
+/** generate the core initialization string for a number of federates*/
+static std::string coreInit(int feds)
+{
+    return std::string("--autobroker --log_level=no_print --federates=") + std::to_string(feds);
+}
+
+/** the fixed point equation each federate solves,  converges to 2*(1+time)*/
+static double ringUpdate(helics::Time granted, double input)
+{
+    return 1.0 + static_cast<double>(granted) + 0.5 * input;
+}
+
+/** create a ring of federates iterating to a fixed point at each time step
+@param coreDetection set to true to let the core detect convergence from the input tolerance,
+false to compare the values in the federate and only publish changes
+*/
+static std::vector<std::unique_ptr<helics::ValueFederate>>
+    createRing(const std::shared_ptr<helics::Core>& wcore, int feds, bool coreDetection)
+{
+    std::vector<std::unique_ptr<helics::ValueFederate>> fedList;
+    fedList.reserve(feds);
+    for (int ii = 0; ii < feds; ++ii) {
+        fedList.push_back(
+            std::make_unique<helics::ValueFederate>("cvfed" + std::to_string(ii), wcore));
+        auto& fed = *fedList.back();
+        fed.setProperty(HELICS_PROPERTY_INT_MAX_ITERATIONS, 1000);
+        fed.registerGlobalPublication<double>("cv_pub" + std::to_string(ii));
+        auto& inp = fed.registerSubscription("cv_pub" + std::to_string((ii + 1) % feds));
+        inp.setDefault(0.0);
+        if (coreDetection) {
+            inp.setMinimumChange(tolerance);
+            fed.setFlagOption(HELICS_FLAG_DETECT_CONVERGENCE);
+        }
+    }
+    return fedList;
+}
+
+/** run a federate through the time steps and return the number of iterations*/
+static int runRingFederate(helics::ValueFederate& fed, bool coreDetection)
+{
+    auto& pub = fed.getPublication(0);
+    auto& inp = fed.getInput(0);
+    int iterations{0};
+    double lastValue{-1.0};
+    fed.enterExecutingMode();
+    helics::iteration_time result{helics::timeZero, helics::IterationResult::NEXT_STEP};
+    while (result.grantedTime <= stepCount) {
+        double value = ringUpdate(result.grantedTime, inp.getValue<double>());
+        // without core detection the federate compares the values and only publishes changes
+        if (coreDetection || std::abs(value - lastValue) > tolerance) {
+            pub.publish(value);
+            lastValue = value;
+        }
+        result = fed.requestTimeIterative(result.grantedTime + 1.0,
+                                          helics::IterationRequest::ITERATE_IF_NEEDED);
+        if (result.state == helics::IterationResult::ITERATING) {
+            ++iterations;
+        }
+    }
+    fed.finalize();
+    return iterations;
+}
+
+/** benchmark the ring with or without core convergence detection*/
+static void BMconvergence(benchmark::State& state, bool coreDetection)
+{
+    std::atomic<int> totalIterations{0};
+    for (auto _ : state) {
+        state.PauseTiming();
+        int feds = static_cast<int>(state.range(0));
+        auto wcore = helics::CoreFactory::create(CoreType::INPROC, coreInit(feds));
+        auto fedList = createRing(wcore, feds, coreDetection);
+        state.ResumeTiming();
+        std::vector<std::thread> threadList;
+        threadList.reserve(feds);
+        for (auto& fed : fedList) {
+            threadList.emplace_back([&fed, &totalIterations, coreDetection]() {
+                totalIterations += runRingFederate(*fed, coreDetection);
+            });
+        }
+        for (auto& thrd : threadList) {
+            thrd.join();
+        }
+        state.PauseTiming();
+        fedList.clear();
+        wcore.reset();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+    state.counters["iterations"] =
+        static_cast<double>(totalIterations.load()) /
+        static_cast<double>(state.range(0) * stepCount * state.iterations());
+}
+
+/** the core detects convergence using the minimum change of the inputs*/
+static void BMconvergence_core(benchmark::State& state)
+{
+    BMconvergence(state, true);
+}
+
+/** the federates compare the values and only publish changes*/
+static void BMconvergence_user(benchmark::State& state)
+{
+    BMconvergence(state, false);
+}
+
+static constexpr int64_t maxscale{1 << (5 + HELICS_BENCHMARK_SHIFT_FACTOR)};
+
+BENCHMARK(BMconvergence_core)
+    ->RangeMultiplier(2)
+    ->Range(2, maxscale)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BMconvergence_user)
+    ->RangeMultiplier(2)
+    ->Range(2, maxscale)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+HELICS_BENCHMARK_MAIN(convergenceBenchmark);
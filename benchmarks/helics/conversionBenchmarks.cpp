@@ -5,10 +5,27 @@ Energy, LLC.  See the top-level NOTICE for additional details. All rights reserv
 SPDX-License-Identifier: BSD-3-Clause
 */
 
+#include "helics/application_api/HelicsPrimaryTypes.hpp"
 #include "helics/application_api/ValueConverter.hpp"
 #include "helics_benchmark_main.h"
 
 #include <benchmark/benchmark.h>
+#include <string>
+#include <tuple>
+#include <vector>
+
+/** generate a vector of strings with a mix of lengths*/
+static std::vector<std::string> generateStringVector(int count)
+{
+    std::vector<std::string> strings;
+    strings.reserve(count);
+    for (int ii = 0; ii < count; ++ii) {
+        strings.push_back("bus_" + std::to_string(ii) + std::string(ii % 24, 'x'));
+    }
+    return strings;
+}
+
+static const std::vector<std::string> stringVector1k = generateStringVector(1000);
 
 template<class T>
 static void BMconversion(benchmark::State& state, const T& arg)
@@ -37,6 +54,8 @@ BENCHMARK_CAPTURE(BMconversion,
 
 BENCHMARK_CAPTURE(BMconversion, vector_conv, std::vector<double>{26.5, 18.6, -48.5, -5.4e-12});
 
+BENCHMARK_CAPTURE(BMconversion, string_vector_conv_1k, stringVector1k);
+
 template<class T>
 static void BMinterpret(benchmark::State& state, const T& arg)
 {
@@ -67,4 +86,105 @@ BENCHMARK_CAPTURE(BMinterpret,
 
 BENCHMARK_CAPTURE(BMinterpret, vector_interp, std::vector<double>{26.5, 18.6, -48.5, -5.4e-12});
 
+BENCHMARK_CAPTURE(BMinterpret, string_vector_interp_1k, stringVector1k);
+
+// interpret a string vector sent in the JSON string form
+static void BMinterpret_string_vector_json(benchmark::State& state)
+{
+    helics::SmallBuffer store;
+    helics::ValueConverter<std::vector<std::string>>::convert(stringVector1k, store);
+    auto json = helics::ValueConverter<std::string>::interpret(helics::data_view{store});
+    helics::ValueConverter<std::string>::convert(json, store);
+    helics::data_view stv{store};
+    std::vector<std::string> val2;
+    for (auto _ : state) {
+        helics::ValueConverter<std::vector<std::string>>::interpret(stv, val2);
+    }
+}
+BENCHMARK(BMinterpret_string_vector_json);
+
+/** source data for the type pair conversion benchmarks*/
+struct ConversionSource {
+    std::string name;
+    helics::DataType type;
+    helics::SmallBuffer data;
+};
+
+static const std::vector<ConversionSource> conversionSources{
+    {"double", helics::DataType::HELICS_DOUBLE, helics::ValueConverter<double>::convert(-356.56)},
+    {"int", helics::DataType::HELICS_INT, helics::ValueConverter<int64_t>::convert(-12351341)},
+    {"string",
+     helics::DataType::HELICS_STRING,
+     helics::ValueConverter<std::string_view>::convert("-356.56")},
+    {"complex",
+     helics::DataType::HELICS_COMPLEX,
+     helics::ValueConverter<std::complex<double>>::convert({45.7, -19.5})},
+    {"vector",
+     helics::DataType::HELICS_VECTOR,
+     helics::ValueConverter<std::vector<double>>::convert({26.5, 18.6, -48.5, -5.4e-12})},
+    {"complex_vector",
+     helics::DataType::HELICS_COMPLEX_VECTOR,
+     helics::ValueConverter<std::vector<std::complex<double>>>::convert(
+         {{45.7, -19.5}, {26.5, 18.6}})},
+    {"named_point",
+     helics::DataType::HELICS_NAMED_POINT,
+     helics::ValueConverter<helics::NamedPoint>::convert({"point", 45.7})},
+    {"bool", helics::DataType::HELICS_BOOL, helics::ValueConverter<std::string_view>::convert("1")},
+    {"time", helics::DataType::HELICS_TIME, helics::ValueConverter<int64_t>::convert(1250000000)}};
+
+// extract a value through the runtime dispatch on the source type
+template<class X>
+static void BMextract(benchmark::State& state, const ConversionSource& source)
+{
+    helics::data_view dv{source.data};
+    X val{};
+    for (auto _ : state) {
+        helics::valueExtract(dv, source.type, val);
+        benchmark::DoNotOptimize(val);
+    }
+}
+
+// extract a value through the conversion kernel resolved for the source type
+template<class X>
+static void BMkernel(benchmark::State& state, const ConversionSource& source)
+{
+    auto kernel = std::get<helics::ConversionKernel<X>>(helics::getConversionKernels(source.type));
+    helics::data_view dv{source.data};
+    X val{};
+    for (auto _ : state) {
+        kernel(dv, val);
+        benchmark::DoNotOptimize(val);
+    }
+}
+
+template<class X>
+static void registerConversionPairs(const std::string& targetName)
+{
+    for (const auto& source : conversionSources) {
+        auto pairName = source.name + "_to_" + targetName;
+        benchmark::RegisterBenchmark(("BMextract/" + pairName).c_str(),
+                                     [&source](benchmark::State& state) {
+                                         BMextract<X>(state, source);
+                                     });
+        benchmark::RegisterBenchmark(("BMkernel/" + pairName).c_str(),
+                                     [&source](benchmark::State& state) {
+                                         BMkernel<X>(state, source);
+                                     });
+    }
+}
+
+// register every source/target pair of the primary types
+static const bool conversionPairsRegistered = []() {
+    registerConversionPairs<double>("double");
+    registerConversionPairs<int64_t>("int");
+    registerConversionPairs<std::string>("string");
+    registerConversionPairs<std::complex<double>>("complex");
+    registerConversionPairs<std::vector<double>>("vector");
+    registerConversionPairs<std::vector<std::complex<double>>>("complex_vector");
+    registerConversionPairs<helics::NamedPoint>("named_point");
+    registerConversionPairs<bool>("bool");
+    registerConversionPairs<helics::Time>("time");
+    return true;
+}();
+
 HELICS_BENCHMARK_MAIN(conversionBenchmark);
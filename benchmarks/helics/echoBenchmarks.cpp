@@ -17,20 +17,29 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <fstream>
 #include <gmlc/concurrency/Barrier.hpp>
 #include <iostream>
+#include <mutex>
+#include <string_view>
 #include <thread>
 
 using helics::CoreType;
 
-static void BMecho_singleCore(benchmark::State& state)
+/** generate the initialization string for a single core, the root core has no broker to start*/
+static std::string singleCoreInit(CoreType cType, int feds)
+{
+    return std::string((cType == CoreType::ROOT) ? "" : "--autobroker ") +
+        "--federates=" + std::to_string(feds);
+}
+
+static void echoSingleCore(benchmark::State& state, CoreType cType)
 {
+    LatencyRecorder grants;
+    LatencyRecorder roundTrips;
     for (auto _ : state) {
         state.PauseTiming();
 
         int feds = static_cast<int>(state.range(0));
         gmlc::concurrency::Barrier brr(static_cast<size_t>(feds) + 1);
-        auto wcore = helics::CoreFactory::create(CoreType::INPROC,
-                                                 std::string("--autobroker --federates=") +
-                                                     std::to_string(feds + 1));
+        auto wcore = helics::CoreFactory::create(cType, singleCoreInit(cType, feds + 1));
         EchoHub hub;
         hub.initialize(wcore->getIdentifier(), "--num_leafs=" + std::to_string(feds));
         std::vector<EchoLeaf> leafs(feds);
@@ -52,10 +61,28 @@ static void BMecho_singleCore(benchmark::State& state)
         for (auto& thrd : threadlist) {
             thrd.join();
         }
+        for (const auto& fed : leafs) {
+            grants.merge(fed.getGrantLatency());
+            roundTrips.merge(fed.getRoundTripLatency());
+        }
         wcore.reset();
         helics::cleanupHelicsLibrary();
         state.ResumeTiming();
     }
+    addLatencyCounters(state, "grant", grants);
+    addLatencyCounters(state, "round_trip", roundTrips);
+}
+
+/** echo through an inproc core connected to a separate inproc broker*/
+static void BMecho_singleCore(benchmark::State& state)
+{
+    echoSingleCore(state, CoreType::INPROC);
+}
+
+/** echo through a root core acting as the root of the federation without a broker*/
+static void BMecho_rootCore(benchmark::State& state)
+{
+    echoSingleCore(state, CoreType::ROOT);
 }
 // Register the function as a benchmark
 BENCHMARK(BMecho_singleCore)
@@ -65,8 +92,86 @@ BENCHMARK(BMecho_singleCore)
     ->Iterations(1)
     ->UseRealTime();
 
-static void BMecho_multiCore(benchmark::State& state, CoreType cType)
+BENCHMARK(BMecho_rootCore)
+    ->RangeMultiplier(2)
+    ->Range(1, 1U << 8)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+// the single core echo benchmark with data level logging sent to a file through a logging callback
+static void BMecho_logging(benchmark::State& state, const std::string& coreArgs)
+{
+    double dropped{0.0};
+    for (auto _ : state) {
+        state.PauseTiming();
+
+        int feds = static_cast<int>(state.range(0));
+        gmlc::concurrency::Barrier brr(static_cast<size_t>(feds) + 1);
+        std::mutex logLock;
+        std::ofstream logOutput("echoLoggingBenchmark.log");
+        auto wcore = helics::CoreFactory::create(CoreType::INPROC,
+                                                 std::string("--autobroker --federates=") +
+                                                     std::to_string(feds + 1) + coreArgs);
+        wcore->setLoggingCallback(
+            helics::gLocalCoreId,
+            [&logLock, &logOutput](int level, std::string_view ident, std::string_view message) {
+                std::lock_guard<std::mutex> lock(logLock);
+                logOutput << level << "::" << ident << "::" << message << '\n';
+            });
+        EchoHub hub;
+        hub.initialize(wcore->getIdentifier(),
+                       "--num_leafs=" + std::to_string(feds) + " --log_level=data");
+        std::vector<EchoLeaf> leafs(feds);
+        for (int ii = 0; ii < feds; ++ii) {
+            std::string bmInit = "--index=" + std::to_string(ii) + " --log_level=data";
+            leafs[ii].initialize(wcore->getIdentifier(), bmInit);
+        }
+
+        std::vector<std::thread> threadlist(static_cast<size_t>(feds));
+        for (int ii = 0; ii < feds; ++ii) {
+            threadlist[ii] = std::thread([&](EchoLeaf& lf) { lf.run([&brr]() { brr.wait(); }); },
+                                         std::ref(leafs[ii]));
+        }
+        hub.makeReady();
+        brr.wait();
+        state.ResumeTiming();
+        hub.run([]() {});
+        state.PauseTiming();
+        for (auto& thrd : threadlist) {
+            thrd.join();
+        }
+        auto counts = wcore->query("core", "command_counts", HELICS_QUERY_MODE_FAST);
+        dropped += getQueryCount(counts, "log_dropped");
+        wcore.reset();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+    // log messages discarded because the asynchronous logging queue was full
+    state.counters["log_dropped"] = benchmark::Counter(dropped, benchmark::Counter::kAvgIterations);
+}
+// Register the logging benchmarks,  the data level messages are only generated if the library is
+// built with HELICS_ENABLE_DEBUG_LOGGING
+BENCHMARK_CAPTURE(BMecho_logging, synchronous, std::string(" --loglevel=data"))
+    ->RangeMultiplier(4)
+    ->Range(1, 1U << 6)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BMecho_logging, asynchronous, std::string(" --loglevel=data --async_logging"))
+    ->RangeMultiplier(4)
+    ->Range(1, 1U << 6)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+static void BMecho_multiCore(benchmark::State& state,
+                             CoreType cType,
+                             const std::string& brokerArgs = std::string{})
 {
+    LatencyRecorder grants;
+    LatencyRecorder roundTrips;
     for (auto _ : state) {
         state.PauseTiming();
 
@@ -76,7 +181,8 @@ static void BMecho_multiCore(benchmark::State& state, CoreType cType)
         auto broker =
             helics::BrokerFactory::create(cType,
                                           "brokerb",
-                                          std::string("--federates=") + std::to_string(feds + 1));
+                                          std::string("--federates=") + std::to_string(feds + 1) +
+                                              brokerArgs);
         broker->setLoggingLevel(HELICS_LOG_LEVEL_NO_PRINT);
         auto wcore =
             helics::CoreFactory::create(cType, std::string("--federates=1 --log_level=no_print"));
@@ -105,6 +211,10 @@ static void BMecho_multiCore(benchmark::State& state, CoreType cType)
         for (auto& thrd : threadlist) {
             thrd.join();
         }
+        for (const auto& fed : leafs) {
+            grants.merge(fed.getGrantLatency());
+            roundTrips.merge(fed.getRoundTripLatency());
+        }
         broker->disconnect();
         broker.reset();
         cores.clear();
@@ -113,6 +223,8 @@ static void BMecho_multiCore(benchmark::State& state, CoreType cType)
 
         state.ResumeTiming();
     }
+    addLatencyCounters(state, "grant", grants);
+    addLatencyCounters(state, "round_trip", roundTrips);
 }
 
 static constexpr int64_t maxscale{1U << (4 + HELICS_BENCHMARK_SHIFT_FACTOR)};
@@ -123,6 +235,33 @@ BENCHMARK_CAPTURE(BMecho_multiCore, inprocCore, CoreType::INPROC)
     ->Unit(benchmark::TimeUnit::kMillisecond)
     ->UseRealTime();
 
+// Register the inproc core benchmarks with direct core to core routes
+BENCHMARK_CAPTURE(BMecho_multiCore,
+                  inprocCoreDirect,
+                  CoreType::INPROC,
+                  std::string(" --direct_route_threshold=10"))
+    ->RangeMultiplier(2)
+    ->Range(1, maxscale)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+// Register the inproc core benchmarks comparing a flat broker with an automatically split
+// broker hierarchy
+BENCHMARK_CAPTURE(BMecho_multiCore, inprocCoreFlat, CoreType::INPROC)
+    ->Arg(256)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BMecho_multiCore,
+                  inprocCoreAutoSplit,
+                  CoreType::INPROC,
+                  std::string(" --auto_split=16"))
+    ->Arg(256)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
 #ifdef ENABLE_ZMQ_CORE
 // Register the ZMQ benchmarks
 BENCHMARK_CAPTURE(BMecho_multiCore, zmqCore, CoreType::ZMQ)
@@ -132,6 +271,25 @@ BENCHMARK_CAPTURE(BMecho_multiCore, zmqCore, CoreType::ZMQ)
     ->Unit(benchmark::TimeUnit::kMillisecond)
     ->UseRealTime();
 
+// Register the ZMQ benchmarks with direct core to core routes
+BENCHMARK_CAPTURE(BMecho_multiCore,
+                  zmqCoreDirect,
+                  CoreType::ZMQ,
+                  std::string(" --direct_route_threshold=10"))
+    ->RangeMultiplier(2)
+    ->Range(1, maxscale)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+// Register the ZMQ benchmarks with data forwarded by the comms of the broker
+BENCHMARK_CAPTURE(BMecho_multiCore, zmqCoreCutThrough, CoreType::ZMQ, std::string(" --cut_through"))
+    ->RangeMultiplier(2)
+    ->Range(1, maxscale)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
 // Register the ZMQ benchmarks
 BENCHMARK_CAPTURE(BMecho_multiCore, zmqssCore, CoreType::ZMQ_SS)
     ->RangeMultiplier(2)
@@ -162,6 +320,44 @@ BENCHMARK_CAPTURE(BMecho_multiCore, tcpCore, CoreType::TCP)
     ->Unit(benchmark::TimeUnit::kMillisecond)
     ->UseRealTime();
 
+// Register the TCP benchmarks with direct core to core routes
+BENCHMARK_CAPTURE(BMecho_multiCore,
+                  tcpCoreDirect,
+                  CoreType::TCP,
+                  std::string(" --direct_route_threshold=10"))
+    ->RangeMultiplier(2)
+    ->Range(1, maxscale)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+// Register the TCP benchmarks comparing a flat broker with an automatically split broker
+// hierarchy
+BENCHMARK_CAPTURE(BMecho_multiCore, tcpCoreFlat, CoreType::TCP)
+    ->Arg(256)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BMecho_multiCore,
+                  tcpCoreAutoSplit,
+                  CoreType::TCP,
+                  std::string(" --auto_split=16"))
+    ->Arg(256)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+// the broker hierarchy with data forwarded by the comms of the intermediate brokers
+BENCHMARK_CAPTURE(BMecho_multiCore,
+                  tcpCoreAutoSplitCutThrough,
+                  CoreType::TCP,
+                  std::string(" --auto_split=16 --cut_through"))
+    ->Arg(256)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
 // Register the TCP SS benchmarks
 BENCHMARK_CAPTURE(BMecho_multiCore, tcpssCore, CoreType::TCP_SS)
     ->RangeMultiplier(2)
@@ -25,6 +25,8 @@ using helics::CoreType;
 
 static void BMecho_singleCore(benchmark::State& state)
 {
+    LatencyRecorder grants;
+    LatencyRecorder roundTrips;
     for (auto _ : state) {
         state.PauseTiming();
 
@@ -55,10 +57,16 @@ static void BMecho_singleCore(benchmark::State& state)
         for (auto& thrd : threadlist) {
             thrd.join();
         }
+        for (const auto& fed : leafs) {
+            grants.merge(fed.getGrantLatency());
+            roundTrips.merge(fed.getRoundTripLatency());
+        }
         wcore.reset();
         helics::cleanupHelicsLibrary();
         state.ResumeTiming();
     }
+    addLatencyCounters(state, "grant", grants);
+    addLatencyCounters(state, "round_trip", roundTrips);
 }
 // Register the function as a benchmark
 BENCHMARK(BMecho_singleCore)
@@ -70,6 +78,8 @@ BENCHMARK(BMecho_singleCore)
 
 static void BMecho_multiCore(benchmark::State& state, CoreType cType)
 {
+    LatencyRecorder grants;
+    LatencyRecorder roundTrips;
     for (auto _ : state) {
         state.PauseTiming();
 
@@ -109,6 +119,10 @@ static void BMecho_multiCore(benchmark::State& state, CoreType cType)
         for (auto& thrd : threadlist) {
             thrd.join();
         }
+        for (const auto& fed : leafs) {
+            grants.merge(fed.getGrantLatency());
+            roundTrips.merge(fed.getRoundTripLatency());
+        }
         broker->disconnect();
         broker.reset();
         cores.clear();
@@ -117,6 +131,8 @@ static void BMecho_multiCore(benchmark::State& state, CoreType cType)
 
         state.ResumeTiming();
     }
+    addLatencyCounters(state, "grant", grants);
+    addLatencyCounters(state, "round_trip", roundTrips);
 }
 
 static constexpr int64_t maxscale{1 << (5 + HELICS_BENCHMARK_SHIFT_FACTOR)};
@@ -7,7 +7,9 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "EchoMessageHubFederate.hpp"
 #include "EchoMessageLeafFederate.hpp"
+#include "helics/application_api/FilterOperations.hpp"
 #include "helics/application_api/Filters.hpp"
+#include "helics/application_api/MessageOperators.hpp"
 #include "helics/core/BrokerFactory.hpp"
 #include "helics/core/CoreFactory.hpp"
 #include "helics/helics-config.h"
@@ -15,6 +17,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include <benchmark/benchmark.h>
 #include <chrono>
+#include <cstdint>
 #include <fstream>
 #include <gmlc/concurrency/Barrier.hpp>
 #include <iostream>
@@ -206,4 +209,141 @@ BENCHMARK_CAPTURE(BMfilter_multiCore, udpCore, CoreType::UDP)
     ->UseRealTime();
 #endif
 
+// run messages from a set of leaf federates through a filter with an expensive custom operation
+static void BMfilter_expensive(benchmark::State& state, int filterThreads)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+
+        int feds = static_cast<int>(state.range(0));
+        gmlc::concurrency::Barrier brr(static_cast<size_t>(feds) + 1);
+        auto wcore = helics::CoreFactory::create(
+            CoreType::INPROC,
+            std::string("--autobroker --federates=") + std::to_string(feds + 1) +
+                " --filter_threads=" + std::to_string(filterThreads));
+        EchoMessageHub hub;
+        hub.initialize(wcore->getIdentifier(), "");
+        std::vector<EchoMessageLeaf> leafs(feds);
+        for (int ii = 0; ii < feds; ++ii) {
+            std::string bmInit = "--index=" + std::to_string(ii);
+            leafs[ii].initialize(wcore->getIdentifier(), bmInit);
+        }
+        auto filt1 = make_filter(helics::FilterTypes::CUSTOM, wcore.get());
+        auto op = std::make_shared<helics::CustomMessageOperator>();
+        op->setMessageFunction([](std::unique_ptr<helics::Message> m) {
+            // simulate an expensive operation on the message payload
+            std::uint32_t hash{2166136261U};
+            for (int jj = 0; jj < 2000; ++jj) {
+                for (auto c : m->data.to_string()) {
+                    hash = (hash ^ static_cast<std::uint8_t>(c)) * 16777619U;
+                }
+            }
+            benchmark::DoNotOptimize(hash);
+            return m;
+        });
+        filt1->setOperator(op);
+        for (int ii = 0; ii < feds; ++ii) {
+            filt1->addSourceTarget("echoleaf_" + std::to_string(ii) + "/leaf");
+        }
+
+        std::vector<std::thread> threadlist(static_cast<size_t>(feds));
+        for (int ii = 0; ii < feds; ++ii) {
+            threadlist[ii] =
+                std::thread([&](EchoMessageLeaf& lf) { lf.run([&brr]() { brr.wait(); }); },
+                            std::ref(leafs[ii]));
+        }
+        hub.makeReady();
+        brr.wait();
+        state.ResumeTiming();
+        hub.run([]() {});
+        state.PauseTiming();
+        for (auto& thrd : threadlist) {
+            thrd.join();
+        }
+        wcore.reset();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+}
+// Register the expensive filter benchmarks with the operators run inline and on worker threads
+BENCHMARK_CAPTURE(BMfilter_expensive, inline, 0)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BMfilter_expensive, filterThreads, 4)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+static constexpr int rerouteMessageCount{1000000};
+
+// process a set of messages through the reroute operator with a number of regex conditions
+static void BMfilter_reroute(benchmark::State& state)
+{
+    auto conditionCount = static_cast<int>(state.range(0));
+    helics::RerouteFilterOperation reroute;
+    reroute.setString("newdestination", "reroute_${dest}");
+    for (int ii = 0; ii < conditionCount; ++ii) {
+        reroute.setString("condition", "^leaf" + std::to_string(ii) + "_[0-9]+$");
+    }
+    auto op = reroute.getOperator();
+    std::vector<std::string> destinations;
+    for (int ii = 0; ii < 64; ++ii) {
+        destinations.push_back("leaf" + std::to_string(ii % 16) + '_' + std::to_string(ii));
+    }
+    for (auto _ : state) {
+        for (int ii = 0; ii < rerouteMessageCount; ++ii) {
+            auto mess = std::make_unique<helics::Message>();
+            mess->source = "echo";
+            mess->dest = destinations[ii & 63];
+            mess = op->process(std::move(mess));
+            benchmark::DoNotOptimize(mess);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * rerouteMessageCount);
+}
+BENCHMARK(BMfilter_reroute)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+// process a set of messages through a firewall with allow and block rules
+static void BMfilter_firewall(benchmark::State& state)
+{
+    auto ruleCount = static_cast<int>(state.range(0));
+    helics::FirewallFilterOperation firewall;
+    for (int ii = 0; ii < ruleCount; ++ii) {
+        firewall.setString("allow", "dest:^leaf" + std::to_string(ii) + "_[0-9]+$");
+    }
+    firewall.setString("block", "source:^blocked");
+    auto op = firewall.getOperator();
+    std::vector<std::string> destinations;
+    for (int ii = 0; ii < 64; ++ii) {
+        destinations.push_back("leaf" + std::to_string(ii % 16) + '_' + std::to_string(ii));
+    }
+    for (auto _ : state) {
+        for (int ii = 0; ii < rerouteMessageCount; ++ii) {
+            auto mess = std::make_unique<helics::Message>();
+            mess->source = ((ii & 7) == 0) ? "blocked" : "echo";
+            mess->dest = destinations[ii & 63];
+            mess = op->process(std::move(mess));
+            benchmark::DoNotOptimize(mess);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * rerouteMessageCount);
+}
+BENCHMARK(BMfilter_firewall)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
 HELICS_BENCHMARK_MAIN(filterBenchmark);
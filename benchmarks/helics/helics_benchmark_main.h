@@ -10,6 +10,25 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include <benchmark/benchmark.h>
 #include <iostream>
+#include <string>
+
+/** add the distribution of latencies recorded by benchmark federates to the counters of a
+benchmark
+@param state the benchmark state to add the counters to
+@param prefix the prefix of the counter names
+@param latency the recorded latencies in nanoseconds,  the counters are in microseconds*/
+inline void addLatencyCounters(benchmark::State& state,
+                               const std::string& prefix,
+                               const LatencyRecorder& latency)
+{
+    if (latency.count() == 0) {
+        return;
+    }
+    state.counters[prefix + "_p50_us"] = latency.percentile(0.5) / 1000.0;
+    state.counters[prefix + "_p90_us"] = latency.percentile(0.9) / 1000.0;
+    state.counters[prefix + "_p99_us"] = latency.percentile(0.99) / 1000.0;
+    state.counters[prefix + "_max_us"] = latency.max() / 1000.0;
+}
 
 // Helper macro to create a main routine in a test that runs the benchmarks
 #define HELICS_BENCHMARK_MAIN(label)                                                               \
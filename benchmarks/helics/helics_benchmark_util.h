@@ -8,9 +8,15 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "helics/core/helicsVersion.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
 #include <string>
 #include <thread>
+#include <vector>
 
 #if defined(ENABLE_ZMQ_CORE) && !defined(USING_HELICS_C_SHARED_LIB)
 #    include "helics/network/zmq/ZmqCommsCommon.h"
@@ -116,3 +122,73 @@ inline void printHELICSsystemInfo()
     std::cout << "NUM CPU:" << std::thread::hardware_concurrency() << '\n';
     std::cout << "-------------------------------------------" << std::endl;
 }
+
+/** extract a numerical field from the flat json object returned by a query such as
+"command_counts"
+@return the value of the field or 0 if the field is not present*/
+inline double getQueryCount(const std::string& queryResult, const std::string& field)
+{
+    auto loc = queryResult.find('"' + field + '"');
+    if (loc == std::string::npos) {
+        return 0.0;
+    }
+    loc = queryResult.find_first_of(':', loc);
+    if (loc == std::string::npos) {
+        return 0.0;
+    }
+    return std::strtod(queryResult.c_str() + loc + 1, nullptr);
+}
+
+/** storage for the latencies of individual operations in a benchmark such as time grants or message
+round trips with summary statistics for reporting the distribution*/
+class LatencyRecorder {
+  public:
+    /** reserve space for an expected number of samples so recording does not allocate*/
+    void reserve(std::size_t sampleCount) { samples.reserve(sampleCount); }
+    /** record the latency of a single operation*/
+    void record(std::chrono::nanoseconds latency)
+    {
+        samples.push_back(latency.count());
+        sorted = false;
+    }
+    /** record the time elapsed since a starting point*/
+    void recordSince(std::chrono::steady_clock::time_point start)
+    {
+        record(std::chrono::steady_clock::now() - start);
+    }
+    /** add the samples from another recorder*/
+    void merge(const LatencyRecorder& other)
+    {
+        samples.insert(samples.end(), other.samples.begin(), other.samples.end());
+        sorted = false;
+    }
+    /** get the number of recorded samples*/
+    std::size_t count() const { return samples.size(); }
+    /** get a percentile of the recorded latencies in nanoseconds using the nearest rank method
+    @param fraction the percentile as a fraction in [0,1]*/
+    double percentile(double fraction) const
+    {
+        if (samples.empty()) {
+            return 0.0;
+        }
+        sort();
+        auto rank = static_cast<std::size_t>(std::ceil(fraction * static_cast<double>(count())));
+        rank = std::clamp<std::size_t>(rank, 1, count());
+        return static_cast<double>(samples[rank - 1]);
+    }
+    /** get the maximum recorded latency in nanoseconds*/
+    double max() const { return percentile(1.0); }
+    /** remove all the samples*/
+    void clear() { samples.clear(); }
+
+  private:
+    void sort() const
+    {
+        if (!sorted) {
+            std::sort(samples.begin(), samples.end());
+            sorted = true;
+        }
+    }
+    mutable std::vector<std::int64_t> samples;  //!< the latencies in nanoseconds
+    mutable bool sorted{true};  //!< the samples are in increasing order
+};
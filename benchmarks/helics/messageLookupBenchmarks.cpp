@@ -10,6 +10,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/core/ActionMessage.hpp"
 #include "helics/core/BrokerFactory.hpp"
 #include "helics/core/CoreFactory.hpp"
+#include "helics/core/DenseIdTable.hpp"
 #include "helics/helics-config.h"
 #include "helics_benchmark_main.h"
 
@@ -18,8 +19,12 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <fstream>
 #include <gmlc/concurrency/Barrier.hpp>
 #include <iostream>
+#include <map>
 #include <random>
 #include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 /** class implementing the hub for an echo test*/
 class messageGenerator {
@@ -283,4 +288,55 @@ BENCHMARK_CAPTURE (BM_ring_multiCore, udpCore, CoreType::UDP)
   ->UseRealTime ();
   */
 
+/** look up a route in one of the containers used for routing tables*/
+template<class Table>
+static helics::route_id findRoute(const Table& table, helics::GlobalFederateId fedid)
+{
+    if constexpr (std::is_same_v<Table, helics::GlobalIdTable<helics::route_id>>) {
+        const auto* route = table.find(fedid);
+        return (route != nullptr) ? *route : helics::parent_route_id;
+    } else {
+        auto fnd = table.find(fedid);
+        return (fnd != table.end()) ? fnd->second : helics::parent_route_id;
+    }
+}
+
+/** time the route lookup of a routing table with state.range(0) federates
+@details the lookups follow a random sequence of the federates with one in eight ids unknown to
+the table,  matching the mix of local and remote destinations in a core*/
+template<class Table>
+static void BMlookup_routes(benchmark::State& state)
+{
+    const auto feds = static_cast<int32_t>(state.range(0));
+    Table table;
+    for (int32_t ii = 0; ii < feds; ++ii) {
+        table.emplace(helics::GlobalFederateId(helics::gGlobalFederateIdShift + ii),
+                      helics::route_id(ii % 16 + 1));
+    }
+    std::mt19937 gen(feds);
+    std::uniform_int_distribution<int32_t> dist(0, feds + feds / 8);
+    std::vector<helics::GlobalFederateId> lookups(4096);
+    for (auto& fedid : lookups) {
+        fedid = helics::GlobalFederateId(helics::gGlobalFederateIdShift + dist(gen));
+    }
+    for (auto _ : state) {
+        for (const auto& fedid : lookups) {
+            benchmark::DoNotOptimize(findRoute(table, fedid));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(lookups.size()));
+}
+
+// Register the routing table lookup benchmarks
+BENCHMARK_TEMPLATE(BMlookup_routes, std::map<helics::GlobalFederateId, helics::route_id>)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 15);
+BENCHMARK_TEMPLATE(BMlookup_routes,
+                   std::unordered_map<helics::GlobalFederateId, helics::route_id>)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 15);
+BENCHMARK_TEMPLATE(BMlookup_routes, helics::GlobalIdTable<helics::route_id>)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 15);
+
 HELICS_BENCHMARK_MAIN(messageLookupBenchmark);
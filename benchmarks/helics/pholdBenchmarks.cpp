@@ -20,7 +20,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 using helics::CoreType;
 // static constexpr helics::Time tend = 3600.0_t;  // simulation end time
-static void BMphold_singleCore(benchmark::State& state)
+static void BMphold_singleCore(benchmark::State& state, bool optimistic)
 {
     for (auto _ : state) {
         state.PauseTiming();
@@ -36,6 +36,9 @@ static void BMphold_singleCore(benchmark::State& state)
             feds[ii].setGenerateRandomSeed(false);
             std::string bmInit =
                 "--index=" + std::to_string(ii) + " --max_index=" + std::to_string(fed_count);
+            if (optimistic) {
+                bmInit += " --optimistic";
+            }
             feds[ii].initialize(wcore->getIdentifier(), bmInit);
         }
 
@@ -64,6 +67,10 @@ static void BMphold_singleCore(benchmark::State& state)
         state.ResumeTiming();
     }
 }
+static void BMphold_singleCore(benchmark::State& state)
+{
+    BMphold_singleCore(state, false);
+}
 // Register the function as a benchmark
 BENCHMARK(BMphold_singleCore)
     ->RangeMultiplier(2)
@@ -72,7 +79,15 @@ BENCHMARK(BMphold_singleCore)
     ->Iterations(1)
     ->UseRealTime();
 
-static void BMphold_multiCore(benchmark::State& state, CoreType cType)
+// Register the optimistic (rollback) version of the single core benchmark
+BENCHMARK_CAPTURE(BMphold_singleCore, optimistic, true)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+static void BMphold_multiCore(benchmark::State& state, CoreType cType, bool optimistic = false)
 {
     for (auto _ : state) {
         state.PauseTiming();
@@ -98,6 +113,9 @@ static void BMphold_multiCore(benchmark::State& state, CoreType cType)
             feds[ii].setGenerateRandomSeed(false);
             std::string bmInit =
                 "--index=" + std::to_string(ii) + " --max_index=" + std::to_string(fed_count);
+            if (optimistic) {
+                bmInit += " --optimistic";
+            }
             feds[ii].initialize(cores[ii]->getIdentifier(), bmInit);
         }
 
@@ -139,6 +157,13 @@ BENCHMARK_CAPTURE(BMphold_multiCore, inprocCore, CoreType::INPROC)
     ->Unit(benchmark::TimeUnit::kMillisecond)
     ->UseRealTime();
 
+// Register the optimistic inproc core benchmarks
+BENCHMARK_CAPTURE(BMphold_multiCore, inprocCoreOptimistic, CoreType::INPROC, true)
+    ->RangeMultiplier(2)
+    ->Range(1, maxscale * 2)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
 #ifdef ENABLE_ZMQ_CORE
 // Register the ZMQ benchmarks
 BENCHMARK_CAPTURE(BMphold_multiCore, zmqCore, CoreType::ZMQ)
@@ -0,0 +1,99 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/FederateInfo.hpp"
+#include "helics/application_api/ValueFederate.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics/helics-config.h"
+#include "helics_benchmark_main.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using helics::CoreType;
+
+/** run a single real time federate and report the deviation of the wall clock time at each grant
+from the granted simulation time
+@param spinWindow the rt_spin property of the federate, zero uses the default sleep based pacing*/
+static void BMrealtime_jitter(benchmark::State& state, helics::Time spinWindow)
+{
+    const int steps = static_cast<int>(state.range(1));
+    const helics::Time period(static_cast<double>(state.range(0)) / 1000.0);
+    std::vector<std::int64_t> jitter;
+    jitter.reserve(static_cast<std::size_t>(steps) * state.max_iterations);
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto wcore = helics::CoreFactory::create(CoreType::INPROC,
+                                                 "--autobroker --federates=1 --log_level=no_print");
+        helics::FederateInfo fi(CoreType::INPROC);
+        fi.coreName = wcore->getIdentifier();
+        fi.setFlagOption(HELICS_FLAG_REALTIME);
+        fi.setProperty(HELICS_PROPERTY_TIME_PERIOD, period);
+        fi.setProperty(HELICS_PROPERTY_TIME_RT_SPIN, spinWindow);
+        helics::ValueFederate fed("rtfed", fi);
+        fed.enterExecutingMode();
+        auto start = std::chrono::steady_clock::now();
+        state.ResumeTiming();
+        for (int ii = 1; ii <= steps; ++ii) {
+            auto granted = fed.requestTime(period * ii);
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            auto deviation = std::chrono::duration_cast<std::chrono::microseconds>(
+                elapsed - granted.to_ns());
+            jitter.push_back(std::abs(deviation.count()));
+        }
+        state.PauseTiming();
+        fed.finalize();
+        wcore.reset();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+    if (jitter.empty()) {
+        return;
+    }
+    std::sort(jitter.begin(), jitter.end());
+    auto percentile = [&jitter](double fraction) {
+        auto index = static_cast<std::size_t>(fraction * static_cast<double>(jitter.size() - 1));
+        return static_cast<double>(jitter[index]);
+    };
+    // grant time deviation from the wall clock in microseconds
+    state.counters["jitter_p50_us"] = percentile(0.5);
+    state.counters["jitter_p99_us"] = percentile(0.99);
+    state.counters["jitter_max_us"] = static_cast<double>(jitter.back());
+    // histogram of the deviations with bucket upper limits in microseconds
+    const std::vector<std::int64_t> bucketLimits{50, 200, 1000, 5000};
+    auto lower = jitter.begin();
+    for (auto limit : bucketLimits) {
+        auto upper = std::lower_bound(lower, jitter.end(), limit);
+        state.counters["hist_lt" + std::to_string(limit) + "us"] =
+            static_cast<double>(upper - lower);
+        lower = upper;
+    }
+    state.counters["hist_ge" + std::to_string(bucketLimits.back()) + "us"] =
+        static_cast<double>(jitter.end() - lower);
+}
+
+// the arguments are the period in milliseconds and the number of time steps
+BENCHMARK_CAPTURE(BMrealtime_jitter, sleepPacing, helics::timeZero)
+    ->Args({1, 500})
+    ->Args({10, 100})
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BMrealtime_jitter, precisePacing, helics::Time(0.001))
+    ->Args({1, 500})
+    ->Args({10, 100})
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+HELICS_BENCHMARK_MAIN(realtimeBenchmark);
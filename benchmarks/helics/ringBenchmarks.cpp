@@ -19,14 +19,19 @@ SPDX-License-Identifier: BSD-3-Clause
 
 using helics::CoreType;
 
-static void BMring2_singleCore(benchmark::State& state)
+static void ring2SingleCore(benchmark::State& state, CoreType cType)
 {
+    LatencyRecorder grants;
+    LatencyRecorder roundTrips;
     for (auto _ : state) {
         state.PauseTiming();
         int feds = 2;
         gmlc::concurrency::Barrier brr(feds);
-        auto wcore = helics::CoreFactory::create(CoreType::INPROC,
-                                                 std::string("--autobroker --federates=2"));
+        // the root core has no broker to start
+        auto wcore = helics::CoreFactory::create(cType,
+                                                 (cType == CoreType::ROOT) ?
+                                                     std::string("--federates=2") :
+                                                     std::string("--autobroker --federates=2"));
 
         std::vector<RingTransmit> links(feds);
         for (int ii = 0; ii < feds; ++ii) {
@@ -45,6 +50,10 @@ static void BMring2_singleCore(benchmark::State& state)
         links[0].run();
         state.PauseTiming();
         rthread.join();
+        for (const auto& fed : links) {
+            grants.merge(fed.getGrantLatency());
+            roundTrips.merge(fed.getRoundTripLatency());
+        }
 
         if (links[0].loopCount != 5000) {
             std::cout << "incorrect loop count received (" << links[0].loopCount
@@ -54,6 +63,20 @@ static void BMring2_singleCore(benchmark::State& state)
         helics::cleanupHelicsLibrary();
         state.ResumeTiming();
     }
+    addLatencyCounters(state, "grant", grants);
+    addLatencyCounters(state, "round_trip", roundTrips);
+}
+
+/** ring through an inproc core connected to a separate inproc broker*/
+static void BMring2_singleCore(benchmark::State& state)
+{
+    ring2SingleCore(state, CoreType::INPROC);
+}
+
+/** ring through a root core acting as the root of the federation without a broker*/
+static void BMring2_rootCore(benchmark::State& state)
+{
+    ring2SingleCore(state, CoreType::ROOT);
 }
 // Register the function as a benchmark
 BENCHMARK(BMring2_singleCore)
@@ -61,15 +84,25 @@ BENCHMARK(BMring2_singleCore)
     ->UseRealTime()
     ->Iterations(1);
 
-static void BMring_multiCore(benchmark::State& state, CoreType cType)
+BENCHMARK(BMring2_rootCore)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime()
+    ->Iterations(1);
+
+static void BMring_multiCore(benchmark::State& state,
+                             CoreType cType,
+                             const std::string& brokerArgs = std::string{})
 {
+    LatencyRecorder grants;
+    LatencyRecorder roundTrips;
     for (auto _ : state) {
         state.PauseTiming();
         int feds = static_cast<int>(state.range(0));
         gmlc::concurrency::Barrier brr(feds);
         auto broker =
             helics::BrokerFactory::create(cType,
-                                          std::string("--federates=") + std::to_string(feds));
+                                          std::string("--federates=") + std::to_string(feds) +
+                                              brokerArgs);
         broker->setLoggingLevel(HELICS_LOG_LEVEL_NO_PRINT);
 
         std::vector<RingTransmit> links(feds);
@@ -100,6 +133,10 @@ static void BMring_multiCore(benchmark::State& state, CoreType cType)
         for (auto& thrd : threadlist) {
             thrd.join();
         }
+        for (const auto& fed : links) {
+            grants.merge(fed.getGrantLatency());
+            roundTrips.merge(fed.getRoundTripLatency());
+        }
 
         if (links[0].loopCount != 5000) {
             std::cout << "incorrect loop count received (" << links[0].loopCount
@@ -111,6 +148,8 @@ static void BMring_multiCore(benchmark::State& state, CoreType cType)
         helics::cleanupHelicsLibrary();
         state.ResumeTiming();
     }
+    addLatencyCounters(state, "grant", grants);
+    addLatencyCounters(state, "round_trip", roundTrips);
 }
 
 // Register the test core benchmarks
@@ -135,6 +174,19 @@ BENCHMARK_CAPTURE(BMring_multiCore, zmqCore, CoreType::ZMQ)
     ->Arg(10)
     ->UseRealTime();
 
+// Register the ZMQ benchmarks with direct core to core routes
+BENCHMARK_CAPTURE(BMring_multiCore,
+                  zmqCoreDirect,
+                  CoreType::ZMQ,
+                  std::string(" --direct_route_threshold=10"))
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Arg(2)
+    ->Arg(3)
+    ->Arg(4)
+    ->Arg(6)
+    ->Arg(10)
+    ->UseRealTime();
+
 // Register the ZMQ benchmarks
 BENCHMARK_CAPTURE(BMring_multiCore, zmqssCore, CoreType::ZMQ_SS)
     ->Unit(benchmark::TimeUnit::kMillisecond)
@@ -167,6 +219,19 @@ BENCHMARK_CAPTURE(BMring_multiCore, tcpCore, CoreType::TCP)
     ->Arg(10)
     ->UseRealTime();
 
+// Register the TCP benchmarks with direct core to core routes
+BENCHMARK_CAPTURE(BMring_multiCore,
+                  tcpCoreDirect,
+                  CoreType::TCP,
+                  std::string(" --direct_route_threshold=10"))
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Arg(2)
+    ->Arg(3)
+    ->Arg(4)
+    ->Arg(6)
+    ->Arg(10)
+    ->UseRealTime();
+
 // Register the TCP SS benchmarks
 BENCHMARK_CAPTURE(BMring_multiCore, tcpssCore, CoreType::TCP_SS)
     ->Unit(benchmark::TimeUnit::kMillisecond)
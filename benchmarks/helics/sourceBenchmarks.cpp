@@ -0,0 +1,125 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/FederateInfo.hpp"
+#include "helics/apps/Source.hpp"
+#include "helics/core/Core.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using helics::CoreType;
+
+/** add a set of signal generators and publications to a source*/
+static void loadSource(helics::apps::Source& src, int pubs, const std::string& genType)
+{
+    for (int ii = 0; ii < pubs; ++ii) {
+        auto genName = "gen" + std::to_string(ii);
+        auto genIndex = src.addSignalGenerator(genName, genType);
+        auto gen = src.getGenerator(genIndex);
+        gen->set("frequency", 0.05 + 0.0001 * ii);
+        gen->set("amplitude", 1.0);
+        gen->set("level", 0.01 * ii);
+        gen->set("ramp", 0.1);
+        src.addPublication("sig" + std::to_string(ii),
+                           genName,
+                           (genType == "phasor") ? helics::DataType::HELICS_COMPLEX :
+                                                   helics::DataType::HELICS_DOUBLE,
+                           1.0);
+    }
+}
+
+// compare the generation of the signal values alone one at a time vs in a block
+static void BMsource_generators(benchmark::State& state, const std::string& genType, bool block)
+{
+    int pubs = static_cast<int>(state.range(0));
+    auto wcore = helics::CoreFactory::create(CoreType::INPROC, "--autobroker --federates=1");
+    helics::FederateInfo fi(CoreType::INPROC);
+    helics::apps::Source src("source", wcore, fi);
+    loadSource(src, pubs, genType);
+    std::vector<helics::apps::SignalGenerator*> gens;
+    for (int ii = 0; ii < pubs; ++ii) {
+        gens.push_back(src.getGenerator(ii).get());
+    }
+    std::vector<double> values(gens.size() * gens.front()->blockWidth());
+    helics::Time signalTime = helics::timeZero;
+    for (auto _ : state) {
+        signalTime += 1.0;
+        if (block) {
+            gens.front()->generateBlock(gens.data(), gens.size(), signalTime, values.data());
+        } else {
+            for (auto* gen : gens) {
+                benchmark::DoNotOptimize(gen->generate(signalTime));
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * pubs);
+    src.finalize();
+    wcore.reset();
+    helics::cleanupHelicsLibrary();
+}
+
+BENCHMARK_CAPTURE(BMsource_generators, sine_point, std::string("sine"), false)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 15);
+BENCHMARK_CAPTURE(BMsource_generators, sine_block, std::string("sine"), true)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 15);
+BENCHMARK_CAPTURE(BMsource_generators, ramp_point, std::string("ramp"), false)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 15);
+BENCHMARK_CAPTURE(BMsource_generators, ramp_block, std::string("ramp"), true)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 15);
+BENCHMARK_CAPTURE(BMsource_generators, phasor_point, std::string("phasor"), false)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 15);
+BENCHMARK_CAPTURE(BMsource_generators, phasor_block, std::string("phasor"), true)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 15);
+
+// run a full source federate with the publications generated per point or in blocks
+static void BMsource_run(benchmark::State& state, bool block)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        int pubs = static_cast<int>(state.range(0));
+        auto wcore = helics::CoreFactory::create(CoreType::INPROC, "--autobroker --federates=1");
+        helics::FederateInfo fi(CoreType::INPROC);
+        helics::apps::Source src("source", wcore, fi);
+        src.setBlockGeneration(block);
+        loadSource(src, pubs, "sine");
+        src.initialize();
+        state.ResumeTiming();
+        src.runTo(20.0);
+        state.PauseTiming();
+        src.finalize();
+        wcore.reset();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+}
+
+BENCHMARK_CAPTURE(BMsource_run, point, false)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 12)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BMsource_run, block, true)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 12)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+HELICS_BENCHMARK_MAIN(sourceBenchmark);
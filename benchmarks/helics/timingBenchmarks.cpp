@@ -20,16 +20,23 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <thread>
 
 using helics::CoreType;
-static void BMtiming_singleCore(benchmark::State& state)
+
+/** generate the initialization string for a single core, the root core has no broker to start*/
+static std::string singleCoreInit(CoreType cType, int feds)
 {
+    return std::string((cType == CoreType::ROOT) ? "" : "--autobroker ") +
+        "--federates=" + std::to_string(feds);
+}
+
+static void timingSingleCore(benchmark::State& state, CoreType cType)
+{
+    LatencyRecorder grants;
     for (auto _ : state) {
         state.PauseTiming();
 
         int feds = static_cast<int>(state.range(0));
         gmlc::concurrency::Barrier brr(static_cast<size_t>(feds) + 1);
-        auto wcore = helics::CoreFactory::create(CoreType::INPROC,
-                                                 std::string("--autobroker --federates=") +
-                                                     std::to_string(feds + 1));
+        auto wcore = helics::CoreFactory::create(cType, singleCoreInit(cType, feds + 1));
         TimingHub hub;
         std::string bmInit = "--num_leafs=" + std::to_string(feds);
         hub.initialize(wcore->getIdentifier(), bmInit);
@@ -52,10 +59,26 @@ static void BMtiming_singleCore(benchmark::State& state)
         for (auto& thrd : threadlist) {
             thrd.join();
         }
+        for (const auto& fed : leafs) {
+            grants.merge(fed.getGrantLatency());
+        }
         wcore.reset();
         helics::cleanupHelicsLibrary();
         state.ResumeTiming();
     }
+    addLatencyCounters(state, "grant", grants);
+}
+
+/** time coordination through an inproc core connected to a separate inproc broker*/
+static void BMtiming_singleCore(benchmark::State& state)
+{
+    timingSingleCore(state, CoreType::INPROC);
+}
+
+/** time coordination through a root core acting as the root of the federation without a broker*/
+static void BMtiming_rootCore(benchmark::State& state)
+{
+    timingSingleCore(state, CoreType::ROOT);
 }
 // Register the function as a benchmark
 BENCHMARK(BMtiming_singleCore)
@@ -65,8 +88,19 @@ BENCHMARK(BMtiming_singleCore)
     ->Iterations(1)
     ->UseRealTime();
 
-static void BMtiming_multiCore(benchmark::State& state, CoreType cType)
+BENCHMARK(BMtiming_rootCore)
+    ->RangeMultiplier(2)
+    ->Range(1, 1 << 8)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+static void BMtiming_multiCore(benchmark::State& state, CoreType cType, bool coalesce = false)
 {
+    LatencyRecorder grants;
+    const std::string coalesceOption = (coalesce) ? std::string(" --coalesce") : std::string{};
+    double processed{0.0};
+    double superseded{0.0};
     for (auto _ : state) {
         state.PauseTiming();
 
@@ -76,10 +110,12 @@ static void BMtiming_multiCore(benchmark::State& state, CoreType cType)
         auto broker =
             helics::BrokerFactory::create(cType,
                                           "brokerb",
-                                          std::string("--federates=") + std::to_string(feds + 1));
+                                          std::string("--federates=") + std::to_string(feds + 1) +
+                                              coalesceOption);
         broker->setLoggingLevel(HELICS_LOG_LEVEL_NO_PRINT);
-        auto wcore =
-            helics::CoreFactory::create(cType, std::string("--federates=1 --log_level=no_print"));
+        auto wcore = helics::CoreFactory::create(cType,
+                                                 std::string("--federates=1 --log_level=no_print") +
+                                                     coalesceOption);
         // this is to delay until the threads are ready
         TimingHub hub;
         std::string bmInit = "--num_leafs=" + std::to_string(feds);
@@ -87,7 +123,8 @@ static void BMtiming_multiCore(benchmark::State& state, CoreType cType)
         std::vector<TimingLeaf> leafs(feds);
         std::vector<std::shared_ptr<helics::Core>> cores(feds);
         for (int ii = 0; ii < feds; ++ii) {
-            cores[ii] = helics::CoreFactory::create(cType, "-f 1 --log_level=no_print");
+            cores[ii] =
+                helics::CoreFactory::create(cType, "-f 1 --log_level=no_print" + coalesceOption);
             cores[ii]->connect();
             bmInit = "--index=" + std::to_string(ii);
             leafs[ii].initialize(cores[ii]->getIdentifier(), bmInit);
@@ -106,6 +143,12 @@ static void BMtiming_multiCore(benchmark::State& state, CoreType cType)
         for (auto& thrd : threadlist) {
             thrd.join();
         }
+        for (const auto& fed : leafs) {
+            grants.merge(fed.getGrantLatency());
+        }
+        auto counts = broker->query("broker", "command_counts");
+        processed += getQueryCount(counts, "processed");
+        superseded += getQueryCount(counts, "superseded");
         broker->disconnect();
         broker.reset();
         cores.clear();
@@ -114,6 +157,11 @@ static void BMtiming_multiCore(benchmark::State& state, CoreType cType)
 
         state.ResumeTiming();
     }
+    // commands processed by the broker and queued time requests skipped as superseded
+    state.counters["processed"] = benchmark::Counter(processed, benchmark::Counter::kAvgIterations);
+    state.counters["superseded"] =
+        benchmark::Counter(superseded, benchmark::Counter::kAvgIterations);
+    addLatencyCounters(state, "grant", grants);
 }
 
 static constexpr int64_t maxscale{1 << (4 + HELICS_BENCHMARK_SHIFT_FACTOR)};
@@ -124,6 +172,13 @@ BENCHMARK_CAPTURE(BMtiming_multiCore, inprocCore, CoreType::INPROC)
     ->Unit(benchmark::TimeUnit::kMillisecond)
     ->UseRealTime();
 
+// the same inproc benchmark skipping superseded time requests for comparison
+BENCHMARK_CAPTURE(BMtiming_multiCore, inprocCore_coalesce, CoreType::INPROC, true)
+    ->RangeMultiplier(2)
+    ->Range(1, maxscale)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
 #ifdef ENABLE_ZMQ_CORE
 // Register the ZMQ benchmarks
 BENCHMARK_CAPTURE(BMtiming_multiCore, zmqCore, CoreType::ZMQ)
@@ -0,0 +1,120 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/FederateInfo.hpp"
+#include "helics/application_api/Inputs.hpp"
+#include "helics/application_api/Publications.hpp"
+#include "helics/application_api/ValueConverter.hpp"
+#include "helics/application_api/ValueFederate.hpp"
+#include "helics/core/Core.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics/core/deltaEncoding.hpp"
+#include "helics/core/helics_definitions.hpp"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+using helics::CoreType;
+
+static constexpr std::size_t vectorSize{100000};
+
+/** modify a sparse set of elements in a vector*/
+static void modifyVector(std::vector<double>& vec, int changes, int step)
+{
+    auto stride = vec.size() / static_cast<std::size_t>(changes);
+    auto shift = static_cast<std::size_t>(step) * 17U;
+    for (std::size_t ii = 0; ii < static_cast<std::size_t>(changes); ++ii) {
+        vec[(ii * stride + shift) % vec.size()] += 1.0;
+    }
+}
+
+// the cost of generating and applying a delta for a large vector with sparse changes
+static void BMvector_delta_encode(benchmark::State& state)
+{
+    int changes = static_cast<int>(state.range(0));
+    std::vector<double> vec(vectorSize, 1.0);
+    helics::SmallBuffer base;
+    helics::SmallBuffer next;
+    helics::SmallBuffer delta;
+    helics::SmallBuffer result;
+    helics::ValueConverter<std::vector<double>>::convert(vec, base);
+    int step{0};
+    std::size_t deltaBytes{0};
+    for (auto _ : state) {
+        modifyVector(vec, changes, ++step);
+        helics::ValueConverter<std::vector<double>>::convert(vec, next);
+        if (helics::generateDataDelta(base.to_string(), next.to_string(), delta)) {
+            helics::applyDataDelta(base.to_string(), delta.to_string(), result);
+            deltaBytes += delta.size();
+        } else {
+            deltaBytes += next.size();
+        }
+        std::swap(base, next);
+    }
+    state.counters["full_bytes"] = static_cast<double>(base.size());
+    state.counters["delta_bytes"] =
+        benchmark::Counter(static_cast<double>(deltaBytes), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(BMvector_delta_encode)->RangeMultiplier(10)->Range(1, 10000);
+
+// transmit a large vector with sparse changes between two federates with or without deltas
+static void BMvector_publish(benchmark::State& state, bool deltas)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        int changes = static_cast<int>(state.range(0));
+        auto wcore = helics::CoreFactory::create(CoreType::INPROC,
+                                                 "--autobroker --federates=2 --log_level=no_print");
+        helics::FederateInfo fi(CoreType::INPROC);
+        fi.coreName = wcore->getIdentifier();
+        helics::ValueFederate pubFed("pubfed", fi);
+        helics::ValueFederate subFed("subfed", fi);
+        auto& pub = pubFed.registerGlobalPublication<std::vector<double>>("vec");
+        if (deltas) {
+            pub.setOption(helics::defs::Options::TRANSMIT_DELTAS);
+        }
+        auto& sub = subFed.registerSubscription("vec");
+        pubFed.enterExecutingModeAsync();
+        subFed.enterExecutingMode();
+        pubFed.enterExecutingModeComplete();
+        std::vector<double> vec(vectorSize, 1.0);
+        std::vector<double> received;
+        state.ResumeTiming();
+        for (int step = 1; step <= 100; ++step) {
+            modifyVector(vec, changes, step);
+            pub.publish(vec);
+            pubFed.requestTimeAsync(step);
+            subFed.requestTime(step);
+            pubFed.requestTimeComplete();
+            sub.getValue(received);
+        }
+        state.PauseTiming();
+        pubFed.finalize();
+        subFed.finalize();
+        wcore.reset();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+}
+
+BENCHMARK_CAPTURE(BMvector_publish, full, false)
+    ->RangeMultiplier(10)
+    ->Range(1, 10000)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BMvector_publish, delta, true)
+    ->RangeMultiplier(10)
+    ->Range(1, 10000)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+HELICS_BENCHMARK_MAIN(vectorPublicationBenchmark);
@@ -82,8 +82,12 @@ BENCHMARK(BM_wattsStrogatz2_singleCore)
     ->UseRealTime()
     ->Iterations(3);
 
-static void BM_wattsStrogatz_multiCore(benchmark::State& state, CoreType cType)
+static void
+    BM_wattsStrogatz_multiCore(benchmark::State& state, CoreType cType, bool coalesce = false)
 {
+    const std::string coalesceOption = (coalesce) ? std::string(" --coalesce") : std::string{};
+    double processed{0.0};
+    double superseded{0.0};
     for (auto _ : state) {
         state.PauseTiming();
 
@@ -96,7 +100,7 @@ static void BM_wattsStrogatz_multiCore(benchmark::State& state, CoreType cType)
         auto broker =
             helics::BrokerFactory::create(cType,
                                           std::string("--restrictive_time_policy --federates=") +
-                                              std::to_string(feds));
+                                              std::to_string(feds) + coalesceOption);
         broker->setLoggingLevel(0);
 
         std::vector<WattsStrogatzFederate> links(feds);
@@ -105,7 +109,7 @@ static void BM_wattsStrogatz_multiCore(benchmark::State& state, CoreType cType)
             cores[ii] = helics::CoreFactory::create(
                 cType,
                 std::string("--restrictive_time_policy --federates=1 --broker=" +
-                            broker->getIdentifier()));
+                            broker->getIdentifier() + coalesceOption));
             cores[ii]->connect();
             std::string bmInit = "--index=" + std::to_string(ii) +
                 " --max_index=" + std::to_string(feds) + " --degree=" + std::to_string(degree) +
@@ -127,6 +131,9 @@ static void BM_wattsStrogatz_multiCore(benchmark::State& state, CoreType cType)
         for (auto& thrd : threadlist) {
             thrd.join();
         }
+        auto counts = broker->query("broker", "command_counts");
+        processed += getQueryCount(counts, "processed");
+        superseded += getQueryCount(counts, "superseded");
 
         broker->disconnect();
         broker.reset();
@@ -134,6 +141,10 @@ static void BM_wattsStrogatz_multiCore(benchmark::State& state, CoreType cType)
         helics::cleanupHelicsLibrary();
         state.ResumeTiming();
     }
+    // commands processed by the broker and queued time requests skipped as superseded
+    state.counters["processed"] = benchmark::Counter(processed, benchmark::Counter::kAvgIterations);
+    state.counters["superseded"] =
+        benchmark::Counter(superseded, benchmark::Counter::kAvgIterations);
 }
 
 // Register the test core benchmarks
@@ -142,6 +153,12 @@ BENCHMARK_CAPTURE(BM_wattsStrogatz_multiCore, inprocCore, CoreType::INPROC)
     ->Apply(WattsStrogatzArguments)
     ->UseRealTime();
 
+// the same inproc benchmark skipping superseded time requests for comparison
+BENCHMARK_CAPTURE(BM_wattsStrogatz_multiCore, inprocCore_coalesce, CoreType::INPROC, true)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Apply(WattsStrogatzArguments)
+    ->UseRealTime();
+
 #ifdef ENABLE_ZMQ_CORE
 // Register the ZMQ benchmarks
 BENCHMARK_CAPTURE(BM_wattsStrogatz_multiCore, zmqCore, CoreType::ZMQ)
@@ -5,3 +5,4 @@
 %include "java_maps.i"
 
 %include "../helics.i"
+%include "java_nio.i"
@@ -30,6 +30,7 @@ endif()
       ${CMAKE_CURRENT_SOURCE_DIR}/helicsJava.i
       ${SHARED_LIB_HEADERS}
       ${CMAKE_CURRENT_SOURCE_DIR}/java_maps.i
+      ${CMAKE_CURRENT_SOURCE_DIR}/java_nio.i
   )
 
   if(HELICS_OVERWRITE_INTERFACE_FILES)
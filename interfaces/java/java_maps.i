@@ -83,6 +83,25 @@
     }
 }
 
+// typemap for vector input functions, the elements of the java array are used directly and the
+// length of the array is passed as the vector length
+%typemap(in) (const double *vectorInput, int vectorLength) {
+  if (!$input) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "array null");
+    return $null;
+  }
+  $2 = (int)JCALL1(GetArrayLength, jenv, $input);
+  $1 = (double *)JCALL2(GetDoubleArrayElements, jenv, $input, 0);
+}
+
+%typemap(freearg) (const double *vectorInput, int vectorLength) {
+  JCALL3(ReleaseDoubleArrayElements, jenv, $input, (jdouble *)$1, JNI_ABORT);
+}
+
+%typemap(jni) (const double *vectorInput, int vectorLength) "jdoubleArray"
+%typemap(jtype) (const double *vectorInput, int vectorLength) "double[]"
+%typemap(jstype) (const double *vectorInput, int vectorLength) "double[]"
+%typemap(javain) (const double *vectorInput, int vectorLength) "$javainput"
 
 //
 //// typemap for vector input functions
@@ -0,0 +1,100 @@
+// typemaps and functions for exchanging values through java.nio direct buffers
+// the native memory behind a direct buffer is passed straight to the HELICS C API so no JNI array
+// pinning or intermediate copies are involved,  buffers holding doubles must use the native byte
+// order, for example ByteBuffer.allocateDirect(n*8).order(ByteOrder.nativeOrder()).asDoubleBuffer()
+
+%typemap(in) (double *directBuffer, int bufferLength), (const double *directBuffer, int bufferLength) {
+  $1 = (double *)JCALL1(GetDirectBufferAddress, jenv, $input);
+  if ($1 == NULL) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "a direct DoubleBuffer is required");
+    return $null;
+  }
+  $2 = (int)JCALL1(GetDirectBufferCapacity, jenv, $input);
+}
+
+%typemap(jni) (double *directBuffer, int bufferLength), (const double *directBuffer, int bufferLength) "jobject"
+%typemap(jtype) (double *directBuffer, int bufferLength), (const double *directBuffer, int bufferLength) "java.nio.DoubleBuffer"
+%typemap(jstype) (double *directBuffer, int bufferLength), (const double *directBuffer, int bufferLength) "java.nio.DoubleBuffer"
+%typemap(javain) (double *directBuffer, int bufferLength), (const double *directBuffer, int bufferLength) "$javainput"
+
+%typemap(in) (void *directBuffer, int bufferLength), (const void *directBuffer, int bufferLength) {
+  $1 = JCALL1(GetDirectBufferAddress, jenv, $input);
+  if ($1 == NULL) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "a direct ByteBuffer is required");
+    return $null;
+  }
+  $2 = (int)JCALL1(GetDirectBufferCapacity, jenv, $input);
+}
+
+%typemap(jni) (void *directBuffer, int bufferLength), (const void *directBuffer, int bufferLength) "jobject"
+%typemap(jtype) (void *directBuffer, int bufferLength), (const void *directBuffer, int bufferLength) "java.nio.ByteBuffer"
+%typemap(jstype) (void *directBuffer, int bufferLength), (const void *directBuffer, int bufferLength) "java.nio.ByteBuffer"
+%typemap(javain) (void *directBuffer, int bufferLength), (const void *directBuffer, int bufferLength) "$javainput"
+
+%{
+static int helicsDirectBufferCheck(int dataLength, int bufferLength, HelicsError *err)
+{
+    if (dataLength < 0 || dataLength > bufferLength) {
+        err->error_code = HELICS_ERROR_INVALID_ARGUMENT;
+        err->message = "the data length exceeds the capacity of the buffer";
+        return 0;
+    }
+    return 1;
+}
+%}
+
+%inline %{
+/** read a vector value from an input into a direct DoubleBuffer
+@return the number of elements written to the start of the buffer*/
+int helicsInputGetVectorDirect(HelicsInput ipt, double *directBuffer, int bufferLength, HelicsError *err)
+{
+    int actualSize = 0;
+    helicsInputGetVector(ipt, directBuffer, bufferLength, &actualSize, err);
+    return actualSize;
+}
+
+/** read the raw data of an input into a direct ByteBuffer
+@return the number of bytes written to the start of the buffer*/
+int helicsInputGetBytesDirect(HelicsInput ipt, void *directBuffer, int bufferLength, HelicsError *err)
+{
+    int actualSize = 0;
+    helicsInputGetBytes(ipt, directBuffer, bufferLength, &actualSize, err);
+    return actualSize;
+}
+
+/** publish the first vectorLength elements of a direct DoubleBuffer*/
+void helicsPublicationPublishVectorDirect(HelicsPublication pub,
+                                          const double *directBuffer,
+                                          int bufferLength,
+                                          int vectorLength,
+                                          HelicsError *err)
+{
+    if (helicsDirectBufferCheck(vectorLength, bufferLength, err)) {
+        helicsPublicationPublishVector(pub, directBuffer, vectorLength, err);
+    }
+}
+
+/** publish the first dataLength bytes of a direct ByteBuffer*/
+void helicsPublicationPublishBytesDirect(HelicsPublication pub,
+                                         const void *directBuffer,
+                                         int bufferLength,
+                                         int dataLength,
+                                         HelicsError *err)
+{
+    if (helicsDirectBufferCheck(dataLength, bufferLength, err)) {
+        helicsPublicationPublishBytes(pub, directBuffer, dataLength, err);
+    }
+}
+
+/** send the first dataLength bytes of a direct ByteBuffer from an endpoint*/
+void helicsEndpointSendBytesDirect(HelicsEndpoint endpoint,
+                                   const void *directBuffer,
+                                   int bufferLength,
+                                   int dataLength,
+                                   HelicsError *err)
+{
+    if (helicsDirectBufferCheck(dataLength, bufferLength, err)) {
+        helicsEndpointSendBytes(endpoint, directBuffer, dataLength, err);
+    }
+}
+%}
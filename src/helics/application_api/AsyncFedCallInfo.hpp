@@ -5,6 +5,7 @@ Energy, LLC.  See the top-level NOTICE for additional details. All rights reserv
 SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
+#include "../common/ThreadPlacement.hpp"
 #include "../core/helicsTime.hpp"
 
 #include <future>
@@ -24,5 +25,6 @@ class AsyncFedCallInfo {
     std::atomic<int> queryCounter{0};  //!< counter for the number of queries
     std::map<int, std::future<std::string>>
         inFlightQueries;  //!< the queries that are actually in flight at a given time
+    ThreadPlacement threadPlacement;  //!< processors and priority of the asynchronous calls
 };
 }  // namespace helics
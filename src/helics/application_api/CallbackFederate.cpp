@@ -0,0 +1,182 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "CallbackFederate.hpp"
+
+#include "../core/Core.hpp"
+#include "../core/FederateOperator.hpp"
+#include "../core/core-exceptions.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace helics {
+/** the operator connecting the core callbacks to the federate*/
+class CallbackFederate::Operator: public FederateOperator {
+  public:
+    explicit Operator(CallbackFederate* federate): fed(federate) {}
+    virtual IterationRequest initializeOperations() override
+    {
+        if (fed->currentMode == Modes::INITIALIZING) {
+            // the entry to executing mode iterated
+            fed->currentTime = initializationTime;
+            fed->initializeToExecuteStateTransition(IterationResult::ITERATING);
+        } else {
+            fed->currentMode = Modes::INITIALIZING;
+            fed->currentTime = fed->coreObject->getCurrentTime(fed->getID());
+            fed->startupToInitializeStateTransition();
+        }
+        return (fed->initializeCallback) ? fed->initializeCallback() :
+                                           IterationRequest::NO_ITERATIONS;
+    }
+    virtual std::pair<Time, IterationRequest> operate(iteration_time newTime) override
+    {
+        Time oldTime = fed->currentTime;
+        fed->currentTime = newTime.grantedTime;
+        if (fed->currentMode == Modes::EXECUTING) {
+            fed->updateTime(newTime.grantedTime, oldTime);
+        } else {
+            fed->currentMode = Modes::EXECUTING;
+            fed->initializeToExecuteStateTransition(IterationResult::NEXT_STEP);
+        }
+        Time nextTime = (fed->stepCallback) ? fed->stepCallback(newTime.grantedTime) :
+                                              Time::maxVal();
+        // the step callback may have finalized the federate already
+        if (nextTime == Time::maxVal() && fed->currentMode == Modes::EXECUTING) {
+            fed->currentMode = Modes::FINISHED;
+        }
+        return {nextTime, IterationRequest::NO_ITERATIONS};
+    }
+    virtual void finalize() override
+    {
+        if (fed->finalizeCallback) {
+            fed->finalizeCallback();
+        }
+        fed->complete();
+    }
+    virtual void error_handler(int errorCode, std::string_view errorString) override
+    {
+        fed->currentMode = Modes::ERROR_STATE;
+        if (fed->errorCallback) {
+            fed->errorCallback(errorCode, errorString);
+        }
+        fed->complete();
+    }
+
+  private:
+    CallbackFederate* fed;  //!< the federate executing the callbacks
+};
+
+CallbackFederate::CallbackFederate(const std::string& fedName, const FederateInfo& fi):
+    Federate(fedName, fi), CombinationFederate(fedName, fi)
+{
+    setupOperator();
+}
+
+CallbackFederate::CallbackFederate(const std::string& fedName,
+                                   const std::shared_ptr<Core>& core,
+                                   const FederateInfo& fi):
+    Federate(fedName, core, fi),
+    CombinationFederate(fedName, core, fi)
+{
+    setupOperator();
+}
+
+CallbackFederate::CallbackFederate(const std::string& fedName,
+                                   CoreApp& core,
+                                   const FederateInfo& fi):
+    Federate(fedName, core, fi),
+    CombinationFederate(fedName, core, fi)
+{
+    setupOperator();
+}
+
+CallbackFederate::CallbackFederate(const std::string& fedName, const std::string& configString):
+    Federate(fedName, loadFederateInfo(configString)), CombinationFederate(fedName, configString)
+{
+    setupOperator();
+}
+
+CallbackFederate::CallbackFederate(const std::string& configString):
+    Federate(std::string(), loadFederateInfo(configString)), CombinationFederate(configString)
+{
+    setupOperator();
+}
+
+CallbackFederate::~CallbackFederate()
+{
+    // the callbacks must complete before the members they use are destroyed
+    if (coreObject) {
+        try {
+            finalize();
+        }
+        // LCOV_EXCL_START
+        catch (...)  // do not allow a throw inside the destructor
+        {
+        }
+        // LCOV_EXCL_STOP
+    }
+}
+
+void CallbackFederate::setupOperator()
+{
+    coreObject->setFederateOperator(getID(), std::make_shared<Operator>(this));
+}
+
+void CallbackFederate::enterInitializingMode()
+{
+    if (currentMode != Modes::STARTUP) {
+        throw(InvalidFunctionCall("cannot transition from current mode to initializing mode"));
+    }
+    try {
+        coreObject->enterInitializingMode(getID());
+    }
+    catch (const HelicsException&) {
+        currentMode = Modes::ERROR_STATE;
+        throw;
+    }
+}
+
+void CallbackFederate::waitForCompletion()
+{
+    std::unique_lock<std::mutex> completeLock(completionLock);
+    completion.wait(completeLock, [this]() { return completed; });
+}
+
+bool CallbackFederate::isCompleted() const
+{
+    std::lock_guard<std::mutex> completeLock(completionLock);
+    return completed;
+}
+
+void CallbackFederate::complete()
+{
+    std::lock_guard<std::mutex> completeLock(completionLock);
+    completed = true;
+    completion.notify_all();
+}
+
+void CallbackFederate::setInitializeCallback(std::function<IterationRequest()> callback)
+{
+    initializeCallback = std::move(callback);
+}
+
+void CallbackFederate::setStepCallback(std::function<Time(Time)> callback)
+{
+    stepCallback = std::move(callback);
+}
+
+void CallbackFederate::setFinalizeCallback(std::function<void()> callback)
+{
+    finalizeCallback = std::move(callback);
+}
+
+void CallbackFederate::setErrorCallback(std::function<void(int, std::string_view)> callback)
+{
+    errorCallback = std::move(callback);
+}
+}  // namespace helics
@@ -0,0 +1,112 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "CombinationFederate.hpp"
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace helics {
+/** class defining a federate driven by callbacks executed by the core
+@details the federate does not need a thread of its own, the core executes the callbacks on a
+shared pool of worker threads when the grants for the federate arrive so thousands of federates
+can run in a single process.  The step callback is called with each granted time and returns the
+next time to request,  returning Time::maxVal() finishes the federate.  The callbacks must be
+set before entering initializing mode.  The blocking calls for entering executing mode and
+requesting time are not available,  and realtime and optimistic operation are not supported.
+finalize can be called from within a callback,  it then returns immediately and the federate
+finishes once the callback returns,  ignoring the time or iteration the callback returned.
+*/
+class HELICS_CXX_EXPORT CallbackFederate: public CombinationFederate {
+  public:
+    /**constructor taking a federate information structure and using the default core
+    @param fedName the name of the federate, may be left empty to use a default or one found in fi
+    @param fi  a federate information structure
+    */
+    CallbackFederate(const std::string& fedName, const FederateInfo& fi);
+
+    /**constructor taking a federate information structure and using the given core
+    @param fedName the name of the federate, may be left empty to use a default or one found in fi
+    @param core a pointer to core object which the federate can join
+    @param fi  a federate information structure
+    */
+    CallbackFederate(const std::string& fedName,
+                     const std::shared_ptr<Core>& core,
+                     const FederateInfo& fi = FederateInfo{});
+
+    /**constructor taking a federate information structure and using the given CoreApp
+    @param fedName the name of the federate, may be left empty to use a default or one found in fi
+    @param core a CoreApp object representing the core to connect to
+    @param fi  a federate information structure
+    */
+    CallbackFederate(const std::string& fedName,
+                     CoreApp& core,
+                     const FederateInfo& fi = FederateInfo{});
+
+    /**constructor taking a federate name and a file with the required information
+    @param fedName the name of the federate, can be empty to use the name from the configString
+    @param configString can be either a JSON file a TOML file (with extension TOML) or a string
+    containing JSON code or a string with command line arguments
+    */
+    CallbackFederate(const std::string& fedName, const std::string& configString);
+
+    /**constructor taking a file with the required information
+     @param configString can be either a JSON file a TOML file (with extension TOML) or a string
+    containing JSON code or a string with command line arguments
+    */
+    explicit CallbackFederate(const std::string& configString);
+
+    /** destructor finalizes the federate and waits for the callbacks to complete*/
+    virtual ~CallbackFederate();
+    /** the callbacks refer to the federate so it cannot be moved or copied*/
+    CallbackFederate(CallbackFederate&& fed) = delete;
+    CallbackFederate& operator=(CallbackFederate&& fed) = delete;
+    CallbackFederate(const CallbackFederate& fed) = delete;
+    CallbackFederate& operator=(const CallbackFederate& fed) = delete;
+
+    /** start the federate
+    @details requests entry to initializing mode and returns immediately,  the callbacks are
+    executed by the core once the request is granted*/
+    void enterInitializingMode();
+    /** wait until the federate has finished or encountered an error*/
+    void waitForCompletion();
+    /** check if the federate has finished or encountered an error*/
+    bool isCompleted() const;
+
+    /** set the callback executed when the federate enters initializing mode
+    @param callback function returning the iteration request for entering executing mode,  it is
+    called again if the entry to executing mode iterates*/
+    void setInitializeCallback(std::function<IterationRequest()> callback);
+    /** set the callback executed for each granted time
+    @param callback function taking the granted time and returning the next time to request*/
+    void setStepCallback(std::function<Time(Time)> callback);
+    /** set the callback executed when the federate finishes*/
+    void setFinalizeCallback(std::function<void()> callback);
+    /** set the callback executed if the federate encounters an error*/
+    void setErrorCallback(std::function<void(int, std::string_view)> callback);
+
+  private:
+    class Operator;
+    /** register the operator for the federate with the core*/
+    void setupOperator();
+    /** mark the federate as completed*/
+    void complete();
+
+    std::function<IterationRequest()> initializeCallback;  //!< callback for initializing mode
+    std::function<Time(Time)> stepCallback;  //!< callback for each granted time
+    std::function<void()> finalizeCallback;  //!< callback for the end of the federate
+    std::function<void(int, std::string_view)> errorCallback;  //!< callback for errors
+    bool completed{false};  //!< the federate has completed, guarded by completionLock
+    mutable std::mutex completionLock;  //!< lock for the completion flag
+    std::condition_variable completion;  //!< notification of the completion
+};
+}  // namespace helics
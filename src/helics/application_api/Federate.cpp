@@ -7,7 +7,9 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "Federate.hpp"
 
 #include "../common/GuardedTypes.hpp"
+#include "../common/InterfaceConfigReader.hpp"
 #include "../common/JsonGeneration.hpp"
+#include "../common/ThreadPlacement.hpp"
 #include "../common/addTargets.hpp"
 #include "../common/configFileHelpers.hpp"
 #include "../common/fmt_format.h"
@@ -25,6 +27,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include <cassert>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 #include <utility>
 
@@ -40,6 +43,20 @@ void cleanupHelicsLibrary()
     BrokerFactory::cleanUpBrokers(100ms);
 }
 
+/** run a function asynchronously on a thread using the processors and priority of the federate*/
+template<class Callable>
+static auto placedAsync(const ThreadPlacement& placement, Callable&& func)
+{
+    if (placement.empty()) {
+        return std::async(std::launch::async, std::forward<Callable>(func));
+    }
+    return std::async(std::launch::async,
+                      [placement, func = std::forward<Callable>(func)]() mutable {
+                          applyThreadPlacement(placement);
+                          return func();
+                      });
+}
+
 Federate::Federate(const std::string& fedName, const FederateInfo& fi): name(fedName)
 {
     if (name.empty()) {
@@ -95,6 +112,7 @@ Federate::Federate(const std::string& fedName, const FederateInfo& fi): name(fed
     strictConfigChecking = fi.checkFlagProperty(HELICS_FLAG_STRICT_CONFIG_CHECKING, true);
     currentTime = coreObject->getCurrentTime(fedID);
     asyncCallInfo = std::make_unique<shared_guarded_m<AsyncFedCallInfo>>();
+    placeFederateThreads(fi);
     fManager = std::make_unique<FilterFederateManager>(coreObject.get(), this, fedID);
 }
 
@@ -133,6 +151,7 @@ Federate::Federate(const std::string& fedName,
     strictConfigChecking = fi.checkFlagProperty(HELICS_FLAG_STRICT_CONFIG_CHECKING, true);
     currentTime = coreObject->getCurrentTime(fedID);
     asyncCallInfo = std::make_unique<shared_guarded_m<AsyncFedCallInfo>>();
+    placeFederateThreads(fi);
     fManager = std::make_unique<FilterFederateManager>(coreObject.get(), this, fedID);
 }
 
@@ -195,6 +214,25 @@ Federate::~Federate()
     }
 }
 
+void Federate::placeFederateThreads(const FederateInfo& fi)
+{
+    ThreadPlacement placement;
+    placement.priority = fi.threadPriority;
+    try {
+        placement.cpus = parseCpuSet(fi.cpuAffinity);
+    }
+    catch (const std::invalid_argument& ia) {
+        throw(InvalidParameter(ia.what()));
+    }
+    if (placement.empty()) {
+        return;
+    }
+    if (!applyThreadPlacement(placement)) {
+        logWarningMessage("unable to set the processor affinity or priority of the federate");
+    }
+    asyncCallInfo->lock()->threadPlacement = std::move(placement);
+}
+
 void Federate::enterInitializingMode()
 {
     auto cm = currentMode.load();
@@ -227,7 +265,7 @@ void Federate::enterInitializingModeAsync()
     if (cm == Modes::STARTUP) {
         auto asyncInfo = asyncCallInfo->lock();
         if (currentMode.compare_exchange_strong(cm, Modes::PENDING_INIT)) {
-            asyncInfo->initFuture = std::async(std::launch::async, [this]() {
+            asyncInfo->initFuture = placedAsync(asyncInfo->threadPlacement, [this]() {
                 coreObject->enterInitializingMode(fedID);
             });
         }
@@ -353,7 +391,7 @@ void Federate::enterExecutingModeAsync(IterationRequest iterate)
             };
             auto asyncInfo = asyncCallInfo->lock();
             currentMode = Modes::PENDING_EXEC;
-            asyncInfo->execFuture = std::async(std::launch::async, eExecFunc);
+            asyncInfo->execFuture = placedAsync(asyncInfo->threadPlacement, eExecFunc);
         } break;
         case Modes::PENDING_INIT:
             enterInitializingModeComplete();
@@ -364,7 +402,7 @@ void Federate::enterExecutingModeAsync(IterationRequest iterate)
             };
             auto asyncInfo = asyncCallInfo->lock();
             currentMode = Modes::PENDING_EXEC;
-            asyncInfo->execFuture = std::async(std::launch::async, eExecFunc);
+            asyncInfo->execFuture = placedAsync(asyncInfo->threadPlacement, eExecFunc);
         } break;
         case Modes::PENDING_EXEC:
         case Modes::EXECUTING:
@@ -531,7 +569,7 @@ void Federate::finalizeAsync()
     auto finalizeFunc = [this]() { return coreObject->finalize(fedID); };
     auto asyncInfo = asyncCallInfo->lock();
     currentMode = Modes::PENDING_FINALIZE;
-    asyncInfo->finalizeFuture = std::async(std::launch::async, finalizeFunc);
+    asyncInfo->finalizeFuture = placedAsync(asyncInfo->threadPlacement, finalizeFunc);
 }
 
 /** complete the asynchronous terminate pair*/
@@ -618,6 +656,7 @@ Time Federate::requestTime(Time nextInternalTimeStep)
                 auto newTime = coreObject->timeRequest(fedID, nextInternalTimeStep);
                 Time oldTime = currentTime;
                 currentTime = newTime;
+                updateOptimisticState(newTime, oldTime);
                 updateTime(newTime, oldTime);
                 if (newTime == Time::maxVal()) {
                     currentMode = Modes::FINISHED;
@@ -647,6 +686,7 @@ iteration_time Federate::requestTimeIterative(Time nextInternalTimeStep, Iterati
         switch (iterativeTime.state) {
             case IterationResult::NEXT_STEP:
                 currentTime = iterativeTime.grantedTime;
+                updateOptimisticState(currentTime, oldTime);
                 [[fallthrough]];
             case IterationResult::ITERATING:
                 updateTime(currentTime, oldTime);
@@ -676,7 +716,7 @@ void Federate::requestTimeAsync(Time nextInternalTimeStep)
     if (currentMode.compare_exchange_strong(exp, Modes::PENDING_TIME)) {
         auto asyncInfo = asyncCallInfo->lock();
         asyncInfo->timeRequestFuture =
-            std::async(std::launch::async, [this, nextInternalTimeStep]() {
+            placedAsync(asyncInfo->threadPlacement, [this, nextInternalTimeStep]() {
                 return coreObject->timeRequest(fedID, nextInternalTimeStep);
             });
     } else {
@@ -690,7 +730,7 @@ void Federate::requestTimeIterativeAsync(Time nextInternalTimeStep, IterationReq
     if (currentMode.compare_exchange_strong(exp, Modes::PENDING_ITERATIVE_TIME)) {
         auto asyncInfo = asyncCallInfo->lock();
         asyncInfo->timeRequestIterativeFuture =
-            std::async(std::launch::async, [this, nextInternalTimeStep, iterate]() {
+            placedAsync(asyncInfo->threadPlacement, [this, nextInternalTimeStep, iterate]() {
                 return coreObject->requestTimeIterative(fedID, nextInternalTimeStep, iterate);
             });
     } else {
@@ -707,6 +747,7 @@ Time Federate::requestTimeComplete()
         asyncInfo.unlock();  // remove the lock;
         Time oldTime = currentTime;
         currentTime = newTime;
+        updateOptimisticState(newTime, oldTime);
         updateTime(newTime, oldTime);
         return newTime;
     }
@@ -726,6 +767,7 @@ iteration_time Federate::requestTimeIterativeComplete()
         switch (iterativeTime.state) {
             case IterationResult::NEXT_STEP:
                 currentTime = iterativeTime.grantedTime;
+                updateOptimisticState(currentTime, oldTime);
                 [[fallthrough]];
             case IterationResult::ITERATING:
                 updateTime(currentTime, oldTime);
@@ -752,6 +794,25 @@ void Federate::updateTime(Time /*newTime*/, Time /*oldTime*/)
     // child classes would likely implement this
 }
 
+void Federate::updateOptimisticState(Time newTime, Time oldTime)
+{
+    if (!saveStateCallback || newTime == Time::maxVal()) {
+        return;
+    }
+    // time grants only go backwards on a rollback
+    if (newTime <= oldTime && restoreStateCallback) {
+        restoreStateCallback(newTime);
+    }
+    saveStateCallback(newTime);
+    if (fossilCollectionCallback) {
+        auto committed = coreObject->getCommittedTime(fedID);
+        if (committed > lastCommittedTime) {
+            lastCommittedTime = committed;
+            fossilCollectionCallback(committed);
+        }
+    }
+}
+
 void Federate::startupToInitializeStateTransition()
 {
     // child classes may do something with this
@@ -845,7 +906,8 @@ static void loadOptions(const Inp& data, Filter& filt)
 
 void Federate::registerFilterInterfacesJson(const std::string& jsonString)
 {
-    auto doc = loadJson(jsonString);
+    // skip loading the other interface sections
+    auto doc = InterfaceConfigReader(jsonString).getSubDocument({"filters", "globals"});
 
     if (doc.isMember("filters")) {
         for (const auto& filt : doc["filters"]) {
@@ -1186,6 +1248,18 @@ void Federate::setQueryCallback(const std::function<std::string(std::string_view
     }
 }
 
+void Federate::setOptimisticCallbacks(std::function<void(Time)> saveCallback,
+                                      std::function<void(Time)> restoreCallback,
+                                      std::function<void(Time)> fossilCallback)
+{
+    if (currentMode == Modes::EXECUTING) {
+        throw(InvalidFunctionCall("optimistic callbacks must be set prior to execution"));
+    }
+    saveStateCallback = std::move(saveCallback);
+    restoreStateCallback = std::move(restoreCallback);
+    fossilCollectionCallback = std::move(fossilCallback);
+}
+
 bool Federate::isQueryCompleted(query_id_t queryIndex) const  // NOLINT
 {
     auto asyncInfo = asyncCallInfo->lock();
@@ -88,6 +88,10 @@ class HELICS_CXX_EXPORT Federate {
         asyncCallInfo;  //!< pointer to a class defining the async call information
     std::unique_ptr<FilterFederateManager> fManager;  //!< class for managing filter operations
     std::string name;  //!< the name of the federate
+    std::function<void(Time)> saveStateCallback;  //!< callback to checkpoint federate state
+    std::function<void(Time)> restoreStateCallback;  //!< callback to restore a checkpoint
+    std::function<void(Time)> fossilCollectionCallback;  //!< callback to discard old checkpoints
+    Time lastCommittedTime{Time::minVal()};  //!< the last committed time seen by the federate
 
   public:
     /**constructor taking a federate information structure
@@ -383,6 +387,22 @@ class HELICS_CXX_EXPORT Federate {
     */
     void setQueryCallback(const std::function<std::string(std::string_view)>& queryFunction);
 
+    /** supply the callbacks used by an optimistic federate
+    @details a federate with the rollback flag set may be granted times speculatively and later
+    rolled back to an earlier time if a message arrives in the past or a consumed message is
+    retracted.  Messages sent in the rolled back steps are retracted automatically, value
+    publications are not.
+    @param saveCallback called with the granted time after every time grant, the federate should
+    checkpoint its state for that time
+    @param restoreCallback called with the granted time on a rollback, the federate should restore
+    the earliest checkpoint at or after that time
+    @param fossilCallback called with the committed time when it advances,  checkpoints
+    prior to that time can no longer be restored and may be discarded
+    */
+    void setOptimisticCallbacks(std::function<void(Time)> saveCallback,
+                                std::function<void(Time)> restoreCallback,
+                                std::function<void(Time)> fossilCallback = {});
+
     /** set a federation global value
     @details this overwrites any previous value for this name
     @param valueName the name of the global to set
@@ -522,13 +542,13 @@ received
     /** register a set of interfaces defined in a file
     @details call is only valid in startup mode
     @param configString  the location of the file or config String to load to generate the
-    interfaces
+    interfaces,  files generated by generateInterfaceManifest are also accepted
     */
     virtual void registerInterfaces(const std::string& configString);
     /** register filter interfaces defined in  file or string
     @details call is only valid in startup mode
     @param configString  the location of the file or config String to load to generate the
-    interfaces
+    interfaces,  files generated by generateInterfaceManifest are also accepted
     */
     void registerFilterInterfaces(const std::string& configString);
 
@@ -594,6 +614,11 @@ received
     @param tomlString  the location of the file or config String to load to generate the interfaces
     */
     void registerFilterInterfacesToml(const std::string& tomlString);
+    /** call the optimistic callbacks for a new granted time*/
+    void updateOptimisticState(Time newTime, Time oldTime);
+    /** apply the processor affinity and priority of the federate to the calling thread and store
+    it for the asynchronous calls*/
+    void placeFederateThreads(const FederateInfo& fi);
 };
 
 /** base class for the interface objects*/
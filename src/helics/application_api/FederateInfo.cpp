@@ -7,7 +7,9 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "FederateInfo.hpp"
 
+#include "../common/InterfaceConfigReader.hpp"
 #include "../common/JsonProcessingFunctions.hpp"
+#include "../common/ThreadPlacement.hpp"
 #include "../common/TomlProcessingFunctions.hpp"
 #include "../common/addTargets.hpp"
 #include "../core/core-exceptions.hpp"
@@ -19,6 +21,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <iostream>
 #include <map>
 #include <set>
+#include <stdexcept>
 #include <unordered_map>
 #include <utility>
 
@@ -52,18 +55,23 @@ static const std::unordered_map<std::string, int> propStringsTranslations{
     {"rtlead", HELICS_PROPERTY_TIME_RT_LEAD},
     {"rtlag", HELICS_PROPERTY_TIME_RT_LAG},
     {"rttolerance", HELICS_PROPERTY_TIME_RT_TOLERANCE},
+    {"rtspin", HELICS_PROPERTY_TIME_RT_SPIN},
     {"timertlead", HELICS_PROPERTY_TIME_RT_LEAD},
     {"timertlag", HELICS_PROPERTY_TIME_RT_LAG},
     {"timerttolerance", HELICS_PROPERTY_TIME_RT_TOLERANCE},
+    {"timertspin", HELICS_PROPERTY_TIME_RT_SPIN},
     {"rtLead", HELICS_PROPERTY_TIME_RT_LEAD},
     {"rtLag", HELICS_PROPERTY_TIME_RT_LAG},
     {"rtTolerance", HELICS_PROPERTY_TIME_RT_TOLERANCE},
+    {"rtSpin", HELICS_PROPERTY_TIME_RT_SPIN},
     {"rt_lead", HELICS_PROPERTY_TIME_RT_LEAD},
     {"rt_lag", HELICS_PROPERTY_TIME_RT_LAG},
     {"rt_tolerance", HELICS_PROPERTY_TIME_RT_TOLERANCE},
+    {"rt_spin", HELICS_PROPERTY_TIME_RT_SPIN},
     {"time_rt_lead", HELICS_PROPERTY_TIME_RT_LEAD},
     {"time_rt_lag", HELICS_PROPERTY_TIME_RT_LAG},
     {"time_rt_tolerance", HELICS_PROPERTY_TIME_RT_TOLERANCE},
+    {"time_rt_spin", HELICS_PROPERTY_TIME_RT_SPIN},
     {"inputdelay", HELICS_PROPERTY_TIME_INPUT_DELAY},
     {"outputdelay", HELICS_PROPERTY_TIME_OUTPUT_DELAY},
     {"inputDelay", HELICS_PROPERTY_TIME_INPUT_DELAY},
@@ -120,6 +128,9 @@ static const std::unordered_map<std::string, int> flagStringsTranslations{
     {"realtime", HELICS_FLAG_REALTIME},
     {"real_time", HELICS_FLAG_REALTIME},
     {"realTime", HELICS_FLAG_REALTIME},
+    {"detect_convergence", HELICS_FLAG_DETECT_CONVERGENCE},
+    {"detectconvergence", HELICS_FLAG_DETECT_CONVERGENCE},
+    {"detectConvergence", HELICS_FLAG_DETECT_CONVERGENCE},
     {"restrictivetimepolicy", HELICS_FLAG_RESTRICTIVE_TIME_POLICY},
     {"restrictive_time_policy", HELICS_FLAG_RESTRICTIVE_TIME_POLICY},
     {"restrictiveTimePolicy", HELICS_FLAG_RESTRICTIVE_TIME_POLICY},
@@ -200,6 +211,9 @@ static const std::unordered_map<std::string, int> optionStringsTranslations{
     {"only_update_on_change", HELICS_HANDLE_OPTION_ONLY_UPDATE_ON_CHANGE},
     {"onlyupdateonchange", HELICS_HANDLE_OPTION_ONLY_UPDATE_ON_CHANGE},
     {"onlyUpdateOnChange", HELICS_HANDLE_OPTION_ONLY_UPDATE_ON_CHANGE},
+    {"transmit_deltas", HELICS_HANDLE_OPTION_TRANSMIT_DELTAS},
+    {"transmitdeltas", HELICS_HANDLE_OPTION_TRANSMIT_DELTAS},
+    {"transmitDeltas", HELICS_HANDLE_OPTION_TRANSMIT_DELTAS},
     {"ignore_unit_mismatch", HELICS_HANDLE_OPTION_IGNORE_UNIT_MISMATCH},
     {"ignoreunitmismatch", HELICS_HANDLE_OPTION_IGNORE_UNIT_MISMATCH},
     {"ignoreUnitMismatch", HELICS_HANDLE_OPTION_IGNORE_UNIT_MISMATCH},
@@ -494,6 +508,13 @@ std::unique_ptr<helicsCLI11App> FederateInfo::makeCLIApp()
             [this](Time val) { setProperty(HELICS_PROPERTY_TIME_RT_TOLERANCE, val); },
             "the time tolerance of the real time mode (default in ms)")
         ->configurable(false);
+    rtgroup
+        ->add_option_function<Time>(
+            "--rtspin",
+            [this](Time val) { setProperty(HELICS_PROPERTY_TIME_RT_SPIN, val); },
+            "the period before a real time deadline in which the federate spins instead of "
+            "sleeping for more precise pacing (default in ms)")
+        ->configurable(false);
 
     app->add_option_function<Time>(
            "--inputdelay",
@@ -519,6 +540,24 @@ std::unique_ptr<helicsCLI11App> FederateInfo::makeCLIApp()
 
     app->add_option("--separator", separator, "separator character for local federates")
         ->default_str(std::string(1, separator));
+    app->add_option_function<std::string>(
+        "--federate_cpus",
+        [this](const std::string& val) {
+            try {
+                parseCpuSet(val);
+            }
+            catch (const std::invalid_argument& ia) {
+                throw CLI::ValidationError(ia.what());
+            }
+            cpuAffinity = val;
+        },
+        "the processors (for example '0-3,8') the federate and its asynchronous calls run on");
+    app->add_option(
+           "--federate_priority",
+           threadPriority,
+           "the real time (round robin) scheduling priority of the federate threads, 0 leaves the "
+           "priority unchanged")
+        ->check(CLI::Range(0, 99));
     app->add_option("--flags,-f,--flag", "named flag for the federate")
         ->type_size(-1)
         ->delimiter(',')
@@ -654,7 +693,9 @@ void FederateInfo::loadInfoFromJson(const std::string& jsonString, bool runArgPa
 {
     Json::Value doc;
     try {
-        doc = loadJson(jsonString);
+        // the interface definitions can be large and are not needed here
+        doc = InterfaceConfigReader(jsonString)
+                  .getDocumentWithout({"publications", "subscriptions", "inputs", "endpoints"});
     }
     catch (const std::invalid_argument& ia) {
         throw(helics::InvalidParameter(ia.what()));
@@ -744,6 +785,16 @@ void FederateInfo::loadInfoFromToml(const std::string& tomlString, bool runArgPa
     }
 }
 
+void generateInterfaceManifest(const std::string& configString, const std::string& manifestFile)
+{
+    try {
+        writeInterfaceManifest(configString, manifestFile);
+    }
+    catch (const std::invalid_argument& ia) {
+        throw(helics::InvalidParameter(ia.what()));
+    }
+}
+
 std::string generateFullCoreInitString(const FederateInfo& fi)
 {
     auto res = fi.coreInitString;
@@ -27,6 +27,7 @@ class HELICS_CXX_EXPORT FederateInfo: public CoreFederateInfo {
                             //!< mode which will turn off some timeouts
     CoreType coreType{CoreType::DEFAULT};  //!< the type of the core
     int brokerPort{-1};  //!< broker port information
+    int threadPriority{0};  //!< real time priority of the federate threads,  0 for unchanged
 
     std::string defName;  //!< a default name to use for a federate
     std::string coreName;  //!< the name of the core
@@ -37,6 +38,7 @@ class HELICS_CXX_EXPORT FederateInfo: public CoreFederateInfo {
     std::string localport;  //!< string for defining the local port to use usually a number but
                             //!< other strings are possible
     std::string fileInUse;  //!< string containing a configuration file that was used
+    std::string cpuAffinity;  //!< the processors (for example "0-3,8") the federate threads run on
     /** default constructor*/
     FederateInfo() = default;
     /** construct from a type
@@ -110,6 +112,17 @@ class HELICS_CXX_EXPORT FederateInfo: public CoreFederateInfo {
  */
 HELICS_CXX_EXPORT FederateInfo loadFederateInfo(const std::string& configString);
 
+/** generate a precompiled interface manifest from a JSON configuration
+@details the manifest is a compact binary form of the interface definitions that can be passed to
+registerInterfaces in place of the JSON configuration to speed up loading very large configurations
+@param configString a JSON file or string with the interface definitions, TOML configurations are
+not supported
+@param manifestFile the name of the manifest file to generate
+@throw InvalidParameter if the configuration cannot be read or the manifest cannot be written
+*/
+HELICS_CXX_EXPORT void generateInterfaceManifest(const std::string& configString,
+                                                 const std::string& manifestFile);
+
 /** generate string for passing arguments to the core*/
 HELICS_CXX_EXPORT std::string generateFullCoreInitString(const FederateInfo& fi);
 
@@ -290,10 +290,9 @@ void RerouteFilterOperation::setString(const std::string& property, const std::s
         newDest = val;
     } else if (property == "condition") {
         try {
-            // this line is to verify that it is a valid regex
-            auto test = std::regex(val);
+            // the pattern is compiled here once instead of for every message
             auto cond = conditions.lock();
-            cond->insert(val);
+            cond->addPattern(val);
         }
         catch (const std::regex_error& re) {
             std::cerr << "filter expression is not a valid Regular expression " << re.what()
@@ -309,6 +308,16 @@ std::shared_ptr<FilterOperator> RerouteFilterOperation::getOperator()
     return std::static_pointer_cast<FilterOperator>(op);
 }
 
+static void
+    replaceAll(std::string& str, const std::string& pattern, const std::string& replacement)
+{
+    auto loc = str.find(pattern);
+    while (loc != std::string::npos) {
+        str.replace(loc, pattern.size(), replacement);
+        loc = str.find(pattern, loc + replacement.size());
+    }
+}
+
 std::string
     newDestGeneration(const std::string& src, const std::string& dest, const std::string& formula)
 {
@@ -316,10 +325,8 @@ std::string
         return formula;
     }
     std::string newDest = formula;
-    std::regex srcreg(R"(\$\{source\})");
-    newDest = std::regex_replace(newDest, srcreg, src);
-    std::regex destreg(R"(\$\{dest\})");
-    newDest = std::regex_replace(newDest, destreg, dest);
+    replaceAll(newDest, "${source}", src);
+    replaceAll(newDest, "${dest}", dest);
     return newDest;
 }
 
@@ -330,28 +337,40 @@ std::string RerouteFilterOperation::rerouteOperation(const std::string& src,
     if (cond->empty()) {
         return newDestGeneration(src, dest, newDest.load());
     }
-
-    for (auto& sr : *cond) {
-        std::regex reg(sr);
-        if (std::regex_search(dest, reg, std::regex_constants::match_any)) {
-            return newDestGeneration(src, dest, newDest.load());
-        }
+    bool matched{false};
+    if (!decisions.find(cond->generation(), dest, matched)) {
+        matched = cond->matches(dest);
+        decisions.insert(cond->generation(), dest, matched);
     }
-    return dest;
+    return (matched) ? newDestGeneration(src, dest, newDest.load()) : dest;
 }
 
 FirewallFilterOperation::FirewallFilterOperation():
     op(std::make_shared<FirewallOperator>(
         [this](const Message* mess) { return allowPassed(mess); }))
 {
+    op->setOperation(FirewallOperator::operations::pass);
 }
 
 FirewallFilterOperation::~FirewallFilterOperation() = default;
 
 void FirewallFilterOperation::set(const std::string& /*property*/, double /*val*/) {}
 
-void FirewallFilterOperation::setString(const std::string& /*property*/, const std::string& /*val*/)
+void FirewallFilterOperation::setString(const std::string& property, const std::string& val)
 {
+    if (property == "allow" || property == "block") {
+        try {
+            auto ruleSet = rules.lock();
+            ruleSet->addRule(property == "allow", val);
+        }
+        catch (const std::regex_error& re) {
+            throw(helics::InvalidParameter(
+                std::string("firewall rule is not a valid Regular expression ") + re.what()));
+        }
+    } else {
+        throw(helics::InvalidParameter(
+            std::string("property " + property + " is not a known property")));
+    }
 }
 
 std::shared_ptr<FilterOperator> FirewallFilterOperation::getOperator()
@@ -359,9 +378,31 @@ std::shared_ptr<FilterOperator> FirewallFilterOperation::getOperator()
     return std::static_pointer_cast<FilterOperator>(op);
 }
 
-bool FirewallFilterOperation::allowPassed(const Message* /*mess*/) const
+bool FirewallFilterOperation::allowPassed(const Message* mess) const
 {
-    return true;
+    auto ruleSet = rules.lock_shared();
+    if (ruleSet->empty()) {
+        return true;
+    }
+    if (!ruleSet->addressOnly()) {
+        return ruleSet->allowed(*mess);
+    }
+    std::string key;
+    key.reserve(mess->source.size() + mess->dest.size() + mess->original_source.size() +
+                mess->original_dest.size() + 3);
+    key.append(mess->source)
+        .append(1, '\n')
+        .append(mess->dest)
+        .append(1, '\n')
+        .append(mess->original_source)
+        .append(1, '\n')
+        .append(mess->original_dest);
+    bool pass{true};
+    if (!decisions.find(ruleSet->generation(), key, pass)) {
+        pass = ruleSet->allowed(*mess);
+        decisions.insert(ruleSet->generation(), key, pass);
+    }
+    return pass;
 }
 
 CloneFilterOperation::CloneFilterOperation():
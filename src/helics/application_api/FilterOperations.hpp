@@ -12,11 +12,11 @@ file defines some common filter operations
 
 #include "../common/GuardedTypes.hpp"
 #include "../core/helicsTime.hpp"
+#include "FilterRules.hpp"
 #include "gmlc/libguarded/cow_guarded.hpp"
 
 #include <atomic>
 #include <memory>
-#include <set>
 #include <string>
 #include <vector>
 
@@ -105,8 +105,9 @@ class RerouteFilterOperation: public FilterOperations {
   private:
     std::shared_ptr<MessageDestOperator> op;  //!< the actual operator
     atomic_guarded<std::string> newDest;  //!< the target destination
-    shared_guarded<std::set<std::string>>
+    gmlc::libguarded::cow_guarded<CompiledPatternSet>
         conditions;  //!< the conditions on which the rerouting will occur
+    mutable FilterDecisionCache decisions;  //!< cached condition results for each destination
 
   public:
     RerouteFilterOperation();
@@ -120,14 +121,14 @@ class RerouteFilterOperation: public FilterOperations {
     std::string rerouteOperation(const std::string& src, const std::string& dest) const;
 };
 
-/** filter for rerouting a packet to a particular endpoint*/
+/** filter for allowing or blocking messages based on rules matching the message fields
+@details rules are added with the "allow" and "block" string properties,  see FirewallRules for the
+format*/
 class FirewallFilterOperation: public FilterOperations {
   private:
     std::shared_ptr<FirewallOperator> op;  //!< the actual operator
-    gmlc::libguarded::cow_guarded<std::vector<std::string>>
-        allowed;  //!< the conditions on which the rerouting will occur
-    gmlc::libguarded::cow_guarded<std::vector<std::string>>
-        blocked;  //!< the conditions that block a message
+    gmlc::libguarded::cow_guarded<FirewallRules> rules;  //!< the allow and block rules
+    mutable FilterDecisionCache decisions;  //!< cache of the decisions for each set of addresses
   public:
     FirewallFilterOperation();
     ~FirewallFilterOperation();
@@ -136,7 +137,7 @@ class FirewallFilterOperation: public FilterOperations {
     virtual std::shared_ptr<FilterOperator> getOperator() override;
 
   private:
-    /** function to execute the rerouting operation*/
+    /** function to check if a message is allowed through the firewall*/
     bool allowPassed(const Message* mess) const;
 };
 
@@ -0,0 +1,177 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "FilterRules.hpp"
+
+#include "../core/core-data.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+namespace helics {
+/** generate a new identifier for a modified set of rules*/
+static std::uint64_t nextRuleGeneration()
+{
+    static std::atomic<std::uint64_t> generationCounter{0};
+    return ++generationCounter;
+}
+
+static bool isLiteralPattern(const std::string& pattern)
+{
+    return pattern.find_first_of(R"(^$\.*+?()[]{}|)") == std::string::npos;
+}
+
+/** check for back references which would be renumbered in a combined expression*/
+static bool hasBackReference(const std::string& pattern)
+{
+    auto loc = pattern.find_first_of('\\');
+    while (loc != std::string::npos && loc + 1 < pattern.size()) {
+        auto next = pattern[loc + 1];
+        if ((next >= '1' && next <= '9') || next == 'k') {
+            return true;
+        }
+        loc = pattern.find_first_of('\\', loc + 2);
+    }
+    return false;
+}
+
+bool CompiledPatternSet::addPattern(const std::string& pattern)
+{
+    if (std::find(patterns.begin(), patterns.end(), pattern) != patterns.end()) {
+        return false;
+    }
+    if (isLiteralPattern(pattern)) {
+        literals.push_back(pattern);
+    } else {
+        // compile the pattern alone first so an invalid pattern generates a specific error
+        std::regex expression(pattern);
+        if (hasBackReference(pattern)) {
+            separate.push_back(std::move(expression));
+        } else {
+            std::string combinedPattern;
+            for (const auto& pat : patterns) {
+                if (!isLiteralPattern(pat) && !hasBackReference(pat)) {
+                    combinedPattern.append("(?:").append(pat).append(")|");
+                }
+            }
+            combinedPattern.append("(?:").append(pattern).push_back(')');
+            combined = std::regex(combinedPattern, std::regex_constants::optimize);
+            hasCombined = true;
+        }
+    }
+    patterns.push_back(pattern);
+    ruleGeneration = nextRuleGeneration();
+    return true;
+}
+
+bool CompiledPatternSet::matches(const std::string& str) const
+{
+    for (const auto& literal : literals) {
+        if (str.find(literal) != std::string::npos) {
+            return true;
+        }
+    }
+    if (hasCombined && std::regex_search(str, combined, std::regex_constants::match_any)) {
+        return true;
+    }
+    for (const auto& expression : separate) {
+        if (std::regex_search(str, expression, std::regex_constants::match_any)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void FirewallRules::addRule(bool allow, const std::string& rule)
+{
+    auto& group = (allow) ? allowRules : blockRules;
+    auto* target = &group.address;
+    std::string pattern = rule;
+    auto sep = rule.find_first_of(':');
+    if (sep != std::string::npos) {
+        auto field = rule.substr(0, sep);
+        bool known{true};
+        if (field == "source" || field == "src") {
+            target = &group.source;
+        } else if (field == "dest" || field == "destination") {
+            target = &group.dest;
+        } else if (field == "original_source") {
+            target = &group.original_source;
+        } else if (field == "original_dest" || field == "original_destination") {
+            target = &group.original_dest;
+        } else if (field == "data") {
+            target = &group.data;
+        } else {
+            // the ':' is part of the pattern
+            known = false;
+        }
+        if (known) {
+            pattern = rule.substr(sep + 1);
+        }
+    }
+    target->addPattern(pattern);
+    ruleGeneration = nextRuleGeneration();
+}
+
+bool FirewallRules::allowed(const Message& message) const
+{
+    if (blockRules.matches(message)) {
+        return false;
+    }
+    return (allowRules.empty()) ? true : allowRules.matches(message);
+}
+
+bool FirewallRules::RuleGroup::matches(const Message& message) const
+{
+    if (address.matches(message.source) || address.matches(message.dest)) {
+        return true;
+    }
+    if (source.matches(message.source) || dest.matches(message.dest)) {
+        return true;
+    }
+    if (original_source.matches(message.original_source) ||
+        original_dest.matches(message.original_dest)) {
+        return true;
+    }
+    if (!data.empty()) {
+        return data.matches(std::string(message.data.to_string()));
+    }
+    return false;
+}
+
+bool FirewallRules::RuleGroup::empty() const
+{
+    return address.empty() && source.empty() && dest.empty() && original_source.empty() &&
+        original_dest.empty() && data.empty();
+}
+
+bool FilterDecisionCache::find(std::uint64_t generation, const std::string& key, bool& result) const
+{
+    std::shared_lock<std::shared_mutex> rlock(lock);
+    if (generation != ruleGeneration) {
+        return false;
+    }
+    auto fnd = decisions.find(key);
+    if (fnd == decisions.end()) {
+        return false;
+    }
+    result = fnd->second;
+    return true;
+}
+
+void FilterDecisionCache::insert(std::uint64_t generation, const std::string& key, bool result)
+{
+    std::lock_guard<std::shared_mutex> wlock(lock);
+    if (generation != ruleGeneration || decisions.size() >= maxDecisions) {
+        decisions.clear();
+        ruleGeneration = generation;
+    }
+    decisions.emplace(key, result);
+}
+
+}  // namespace helics
@@ -0,0 +1,107 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+/** @file
+file defines the compiled matching rules used by the reroute and firewall filter operations
+*/
+
+#include <cstdint>
+#include <regex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace helics {
+class Message;
+
+/** a set of regular expressions compiled once when they are added and matched as a group
+@details patterns without any special characters are matched with a plain string search,  the
+remaining patterns are combined into a single alternation so one search checks all of them*/
+class CompiledPatternSet {
+  public:
+    /** add a pattern to the set
+    @throw std::regex_error if the pattern is not a valid regular expression
+    @return false if the pattern was already part of the set*/
+    bool addPattern(const std::string& pattern);
+    /** check if the set has any patterns*/
+    bool empty() const { return patterns.empty(); }
+    /** check if any of the patterns is found in a string*/
+    bool matches(const std::string& str) const;
+    /** get the patterns in the order they were added*/
+    const std::vector<std::string>& getPatterns() const { return patterns; }
+    /** get an identifier that changes every time the set is modified*/
+    std::uint64_t generation() const { return ruleGeneration; }
+
+  private:
+    std::vector<std::string> patterns;  //!< the patterns as given
+    std::vector<std::string> literals;  //!< patterns without special characters
+    std::vector<std::regex> separate;  //!< patterns which cannot be combined (back references)
+    std::regex combined;  //!< a single expression matching any of the combinable patterns
+    bool hasCombined{false};  //!< indicator that the combined expression is in use
+    std::uint64_t ruleGeneration{0};  //!< identifier of the current set of patterns
+};
+
+/** compiled allow and block rules for a firewall filter
+@details rules are strings of the form [field:]pattern where field is one of source, dest,
+original_source, original_dest, or data.  A rule without a field matches the source or the
+destination.  A message matching any block rule is blocked,  if there are allow rules a message must
+also match at least one of them to pass*/
+class FirewallRules {
+  public:
+    /** add a rule
+    @param allow true for an allow rule,  false for a block rule
+    @param rule the rule string
+    @throw std::regex_error if the pattern is not a valid regular expression*/
+    void addRule(bool allow, const std::string& rule);
+    /** check if a message passes the rules*/
+    bool allowed(const Message& message) const;
+    /** check if the decision depends only on the message addresses and can be cached*/
+    bool addressOnly() const { return allowRules.data.empty() && blockRules.data.empty(); }
+    /** check if there are no rules*/
+    bool empty() const { return allowRules.empty() && blockRules.empty(); }
+    /** get an identifier that changes every time the rules are modified*/
+    std::uint64_t generation() const { return ruleGeneration; }
+
+  private:
+    /** the patterns for each of the fields of a message*/
+    struct RuleGroup {
+        CompiledPatternSet address;  //!< patterns matching the source or destination
+        CompiledPatternSet source;  //!< patterns matching the source
+        CompiledPatternSet dest;  //!< patterns matching the destination
+        CompiledPatternSet original_source;  //!< patterns matching the original source
+        CompiledPatternSet original_dest;  //!< patterns matching the original destination
+        CompiledPatternSet data;  //!< patterns matching the message payload
+        /** check if a message matches any of the patterns*/
+        bool matches(const Message& message) const;
+        bool empty() const;
+    };
+    RuleGroup allowRules;  //!< the rules that allow a message through
+    RuleGroup blockRules;  //!< the rules that block a message
+    std::uint64_t ruleGeneration{0};  //!< identifier of the current set of rules
+};
+
+/** a thread safe cache of filter decisions keyed on message addresses
+@details the cache is tied to the generation of the rules the decisions were made with and is
+cleared when the rules change or it grows past a fixed size*/
+class FilterDecisionCache {
+  public:
+    /** look up a decision
+    @return true if a decision was found and stored in result*/
+    bool find(std::uint64_t generation, const std::string& key, bool& result) const;
+    /** store a decision*/
+    void insert(std::uint64_t generation, const std::string& key, bool result);
+
+  private:
+    static constexpr std::size_t maxDecisions{4096};  //!< the maximum number of stored decisions
+    mutable std::shared_mutex lock;  //!< lock protecting the decisions
+    std::uint64_t ruleGeneration{0};  //!< the generation of the rules the decisions are for
+    std::unordered_map<std::string, bool> decisions;  //!< the stored decisions
+};
+
+}  // namespace helics
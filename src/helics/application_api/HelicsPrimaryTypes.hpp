@@ -15,6 +15,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <complex>
 #include <cstdint>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -216,10 +217,12 @@ std::enable_if_t<std::is_arithmetic<X>::value>
             break;
         }
         case DataType::HELICS_STRING:
-        default:
+        default: {
+            std::string storage;
             val = static_cast<X>(
-                getDoubleFromString(ValueConverter<std::string_view>::interpret(dv)));
+                getDoubleFromString(detail::readStringView(dv.bytes(), dv.size(), storage)));
             break;
+        }
         case DataType::HELICS_BOOL:
             val = static_cast<X>((ValueConverter<std::string_view>::interpret(dv) != "0"));
             break;
@@ -274,4 +277,26 @@ std::enable_if_t<std::is_arithmetic<X>::value>
 
 HELICS_CXX_EXPORT void valueConvert(defV& val, DataType newType);
 
+/** function pointer for a conversion from a specific source data type to a primary type*/
+template<class X>
+using ConversionKernel = void (*)(const data_view& dv, X& val);
+
+/** the set of conversion kernels for all the primary types from a single source type*/
+using ConversionKernelSet = std::tuple<ConversionKernel<double>,
+                                       ConversionKernel<int64_t>,
+                                       ConversionKernel<std::string>,
+                                       ConversionKernel<std::complex<double>>,
+                                       ConversionKernel<std::vector<double>>,
+                                       ConversionKernel<std::vector<std::complex<double>>>,
+                                       ConversionKernel<NamedPoint>,
+                                       ConversionKernel<bool>,
+                                       ConversionKernel<Time>>;
+
+/** get the conversion kernels specialized for a known source type
+@details the kernels produce the same results as valueExtract(dv,sourceType,val) but skip the
+runtime dispatch on the source type,  matching binary types are copied directly
+@return a set of kernels, all of which are nullptr if the source type is not a fixed primary type
+(any, custom, multi, or unknown)*/
+HELICS_CXX_EXPORT ConversionKernelSet getConversionKernels(DataType sourceType);
+
 }  // namespace helics
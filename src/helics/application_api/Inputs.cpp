@@ -8,6 +8,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "Inputs.hpp"
 
 #include "../common/JsonProcessingFunctions.hpp"
+#include "../core/Core.hpp"
 #include "../core/core-exceptions.hpp"
 #include "ValueFederate.hpp"
 #include "units/units/units.hpp"
@@ -72,6 +73,47 @@ void Input::setDefaultBytes(data_view val)
     fed->setDefaultValue(*this, val);
 }
 
+/** check if a value differs from a previous value by more than a tolerance*/
+static bool toleranceChange(const SmallBuffer& previous, const SmallBuffer& update, double deltaV)
+{
+    defV prevValue;
+    defV newValue;
+    valueExtract(data_view(previous), DataType::HELICS_ANY, prevValue);
+    valueExtract(data_view(update), DataType::HELICS_ANY, newValue);
+    return std::visit(
+        [&prevValue, deltaV](const auto& val) { return changeDetected(prevValue, val, deltaV); },
+        newValue);
+}
+
+void Input::setMinimumChange(double deltaV) noexcept
+{
+    // this first check enables change detection if it was disabled via negative delta
+    if (delta < 0.0) {
+        changeDetectionEnabled = true;
+    }
+    delta = deltaV;
+    // the second checks if we should disable from negative delta
+    if (delta < 0.0) {
+        changeDetectionEnabled = false;
+    }
+    if (cr == nullptr || !handle.isValid()) {
+        return;
+    }
+    try {
+        if (delta >= 0.0) {
+            cr->setInputChangeDetector(
+                handle, [deltaV](const SmallBuffer& prev, const SmallBuffer& update) {
+                    return toleranceChange(prev, update, deltaV);
+                });
+        } else {
+            cr->setInputChangeDetector(handle, nullptr);
+        }
+    }
+    catch (const std::exception&) {
+        // the tolerance still applies to the local change detection
+    }
+}
+
 void Input::handleCallback(Time time)
 {
     if (!isUpdated()) {
@@ -522,16 +564,7 @@ bool Input::checkUpdate(bool assumeUpdate)
             auto visitor = [&, this](auto&& arg) {
                 std::remove_reference_t<decltype(arg)> newVal;
                 (void)arg;  // suppress VS2015 warning
-                if (injectionType == helics::DataType::HELICS_DOUBLE) {
-                    defV val = doubleExtractAndConvert(dv, inputUnits, outputUnits);
-                    valueExtract(val, newVal);
-                } else if (injectionType == helics::DataType::HELICS_INT) {
-                    defV val;
-                    integerExtractAndConvert(val, dv, inputUnits, outputUnits);
-                    valueExtract(val, newVal);
-                } else {
-                    valueExtract(dv, injectionType, newVal);
-                }
+                extractValue(dv, newVal);
 
                 if (changeDetected(lastValue, newVal, delta)) {
                     lastValue = newVal;
@@ -753,6 +786,9 @@ void Input::loadSourceInformation()
             }
         }
     }
+    // unit conversions go through the general extraction path
+    conversionKernels = (inputUnits || multiUnits) ? ConversionKernelSet{} :
+                                                     getConversionKernels(injectionType);
 }
 
 double doubleExtractAndConvert(const data_view& dv,
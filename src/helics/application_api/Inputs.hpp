@@ -59,6 +59,7 @@ class HELICS_CXX_EXPORT Input: public Interface {
     std::shared_ptr<units::precise_unit> inputUnits;  //!< the units of the linked publications
     std::vector<std::pair<DataType, std::shared_ptr<units::precise_unit>>>
         sourceTypes;  //!< source information for input sources
+    ConversionKernelSet conversionKernels{};  //!< conversion kernels resolved for the source type
     std::string givenTarget;  //!< the first target set for the input
     double delta{-1.0};  //!< the minimum difference
     double threshold{0.0};  //!< the threshold to use for binary decisions
@@ -275,19 +276,10 @@ class HELICS_CXX_EXPORT Input: public Interface {
     void setDefaultBytes(data_view val);
     /** set the minimum delta for change detection
     @param deltaV a double with the change in a value in order to register a different value
+    @details the delta is also used by the core to decide if a value received during an iteration
+    is a change for federates detecting convergence
     */
-    void setMinimumChange(double deltaV) noexcept
-    {
-        // this first check enables change detection if it was disabled via negative delta
-        if (delta < 0.0) {
-            changeDetectionEnabled = true;
-        }
-        delta = deltaV;
-        // the second checks if we should disable from negative delta
-        if (delta < 0.0) {
-            changeDetectionEnabled = false;
-        }
-    }
+    void setMinimumChange(double deltaV) noexcept;
     /** enable change detection
     @param enabled (optional) set to false to disable change detection true(default) to enable it
     */
@@ -422,6 +414,9 @@ class HELICS_CXX_EXPORT Input: public Interface {
             inputVectorOp == MultiInputHandlingMethod::NO_OP;
     }
     data_view checkAndGetFedUpdate();
+    /** extract a primary type from the data using the resolved kernel if one is available*/
+    template<class X>
+    void extractValue(const data_view& dv, X& out);
     friend class ValueFederateManager;
 };
 
@@ -437,6 +432,24 @@ HELICS_CXX_EXPORT void
                              const std::shared_ptr<units::precise_unit>& inputUnits,
                              const std::shared_ptr<units::precise_unit>& outputUnits);
 
+template<class X>
+void Input::extractValue(const data_view& dv, X& out)
+{
+    auto kernel = std::get<ConversionKernel<X>>(conversionKernels);
+    if (kernel != nullptr) {
+        kernel(dv, out);
+    } else if (injectionType == helics::DataType::HELICS_DOUBLE) {
+        defV val = doubleExtractAndConvert(dv, inputUnits, outputUnits);
+        valueExtract(val, out);
+    } else if (injectionType == helics::DataType::HELICS_INT) {
+        defV val;
+        integerExtractAndConvert(val, dv, inputUnits, outputUnits);
+        valueExtract(val, out);
+    } else {
+        valueExtract(dv, injectionType, out);
+    }
+}
+
 template<class X>
 void Input::getValue_impl(std::integral_constant<int, primaryType> /*V*/, X& out)
 {
@@ -446,16 +459,7 @@ void Input::getValue_impl(std::integral_constant<int, primaryType> /*V*/, X& out
             loadSourceInformation();
         }
 
-        if (injectionType == helics::DataType::HELICS_DOUBLE) {
-            defV val = doubleExtractAndConvert(dv, inputUnits, outputUnits);
-            valueExtract(val, out);
-        } else if (injectionType == helics::DataType::HELICS_INT) {
-            defV val;
-            integerExtractAndConvert(val, dv, inputUnits, outputUnits);
-            valueExtract(val, out);
-        } else {
-            valueExtract(dv, injectionType, out);
-        }
+        extractValue(dv, out);
         if (changeDetectionEnabled) {
             if (changeDetected(lastValue, out, delta)) {
                 lastValue = make_valid(out);
@@ -502,16 +506,7 @@ const X& Input::getValueRef()
 
         if (changeDetectionEnabled) {
             X out;
-            if (injectionType == helics::DataType::HELICS_DOUBLE) {
-                defV val = doubleExtractAndConvert(dv, inputUnits, outputUnits);
-                valueExtract(val, out);
-            } else if (injectionType == helics::DataType::HELICS_INT) {
-                defV val;
-                integerExtractAndConvert(val, dv, inputUnits, outputUnits);
-                valueExtract(val, out);
-            } else {
-                valueExtract(dv, injectionType, out);
-            }
+            extractValue(dv, out);
             if (changeDetected(lastValue, out, delta)) {
                 lastValue = make_valid(std::move(out));
             }
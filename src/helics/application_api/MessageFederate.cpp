@@ -6,6 +6,7 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #include "MessageFederate.hpp"
 
+#include "../common/InterfaceConfigReader.hpp"
 #include "../common/JsonProcessingFunctions.hpp"
 #include "../common/TomlProcessingFunctions.hpp"
 #include "../common/addTargets.hpp"
@@ -189,20 +190,19 @@ static void loadOptions(const Inp& data, Endpoint& ept)
 
 void MessageFederate::registerMessageInterfacesJson(const std::string& jsonString)
 {
-    auto doc = loadJson(jsonString);
+    // the endpoints are loaded one element at a time
+    InterfaceConfigReader doc(jsonString);
     bool defaultGlobal = false;
-    replaceIfMember(doc, "defaultglobal", defaultGlobal);
-    if (doc.isMember("endpoints")) {
-        for (const auto& ept : doc["endpoints"]) {
-            auto eptName = getKey(ept);
-            auto type = getOrDefault(ept, "type", emptyStr);
-            bool global = getOrDefault(ept, "global", defaultGlobal);
-            Endpoint& epObj =
-                (global) ? registerGlobalEndpoint(eptName, type) : registerEndpoint(eptName, type);
-
-            loadOptions(ept, epObj);
-        }
-    }
+    replaceIfMember(doc.getSubDocument({"defaultglobal"}), "defaultglobal", defaultGlobal);
+    doc.forEachElement("endpoints", [this, defaultGlobal](const Json::Value& ept) {
+        auto eptName = getKey(ept);
+        auto type = getOrDefault(ept, "type", emptyStr);
+        bool global = getOrDefault(ept, "global", defaultGlobal);
+        Endpoint& epObj =
+            (global) ? registerGlobalEndpoint(eptName, type) : registerEndpoint(eptName, type);
+
+        loadOptions(ept, epObj);
+    });
 }
 
 void MessageFederate::registerMessageInterfacesToml(const std::string& tomlString)
@@ -7,11 +7,13 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "MessageFederateManager.hpp"
 
 #include "../core/Core.hpp"
+#include "../core/helics_definitions.hpp"
 #include "../core/queryHelpers.hpp"
 #include "helics/core/core-exceptions.hpp"
 
 #include <cassert>
 #include <string>
+#include <vector>
 
 namespace helics {
 MessageFederateManager::MessageFederateManager(Core* coreOb,
@@ -162,9 +164,25 @@ std::unique_ptr<Message> MessageFederateManager::getMessage()
     return nullptr;
 }
 
-void MessageFederateManager::updateTime(Time newTime, Time /*oldTime*/)
+void MessageFederateManager::updateTime(Time newTime, Time oldTime)
 {
     CurrentTime = newTime;
+    if (newTime <= oldTime && coreObject->getFlagOption(fedID, defs::Flags::ROLLBACK)) {
+        // a rollback returned the messages retrieved in the rolled back steps to the core
+        auto eptDat = eptData.lock();
+        std::vector<std::unique_ptr<Message>> retained;
+        for (auto& edat : *eptDat) {
+            while (auto message = edat->messages.pop()) {
+                if ((*message)->time < newTime) {
+                    retained.push_back(std::move(*message));
+                }
+            }
+            for (auto& message : retained) {
+                edat->messages.push(std::move(message));
+            }
+            retained.clear();
+        }
+    }
     auto epCount = coreObject->receiveCountAny(fedID);
     if (epCount == 0) {
         return;
@@ -167,7 +167,8 @@ void Publication::publishString(std::string_view val)
 void Publication::publish(const std::vector<std::string>& val)
 {
     auto buffer = ValueConverter<std::vector<std::string>>::convert(val);
-    auto str = ValueConverter<std::string_view>::interpret(buffer);
+    // the full encoded block is used for change detection
+    std::string_view str(reinterpret_cast<const char*>(buffer.data()), buffer.size());
     bool doPublish = true;
     if (changeDetectionEnabled) {
         if (changeDetected(prevValue, str, delta)) {
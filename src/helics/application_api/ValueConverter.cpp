@@ -10,6 +10,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../common/JsonProcessingFunctions.hpp"
 #include "../common/frozen_map.h"
 
+#include <algorithm>
 #include <complex>
 #include <vector>
 
@@ -76,6 +77,7 @@ namespace detail {
     static constexpr const std::byte npCode{0xAE};
     static constexpr const std::byte cvCode{0x62};
     static constexpr const std::byte customCode{0xF4};
+    static constexpr const std::byte svCode{0x3E};
 
     static constexpr std::byte endianMask{0x01};
     // static constexpr std::byte lowByteMask{0xFF};
@@ -171,6 +173,36 @@ namespace detail {
         return size * sizeof(double) * 2U + 8U;
     }
 
+    static inline void addSize(std::byte* data, size_t size)
+    {
+        data[0] = std::byte((size >> 24U) & 0xFFU);
+        data[1] = std::byte((size >> 16U) & 0xFFU);
+        data[2] = std::byte((size >> 8U) & 0xFFU);
+        data[3] = std::byte((size & 0xFFU));
+    }
+
+    static inline size_t readSize(const std::byte* data)
+    {
+        return (std::to_integer<size_t>(data[0]) << 24U) +
+            (std::to_integer<size_t>(data[1]) << 16U) + (std::to_integer<size_t>(data[2]) << 8U) +
+            std::to_integer<size_t>(data[3]);
+    }
+
+    size_t convertToBinary(std::byte* data, const std::vector<std::string>& val)
+    {
+        addCodeAndSize(data, svCode, val.size());
+        size_t loc{8};
+        for (const auto& str : val) {
+            addSize(data + loc, str.size());
+            loc += 4;
+            if (!str.empty()) {
+                std::memcpy(data + loc, str.data(), str.size());
+                loc += str.size();
+            }
+        }
+        return loc;
+    }
+
     size_t getDataSize(const std::byte* data)
     {
         return (std::to_integer<size_t>(data[4]) << 24U) +
@@ -178,7 +210,8 @@ namespace detail {
             std::to_integer<size_t>(data[7]);
     }
 
-    static constexpr const frozen::unordered_map<std::int8_t, helics::DataType, 8> typeDetect{
+    // a string vector is reported as a string since it converts to a JSON string array
+    static constexpr const frozen::unordered_map<std::int8_t, helics::DataType, 9> typeDetect{
         {std::to_integer<std::int8_t>(intCode), DataType::HELICS_INT},
         {std::to_integer<std::int8_t>(doubleCode), DataType::HELICS_DOUBLE},
         {std::to_integer<std::int8_t>(complexCode), DataType::HELICS_COMPLEX},
@@ -186,7 +219,8 @@ namespace detail {
         {std::to_integer<std::int8_t>(cvCode), DataType::HELICS_COMPLEX_VECTOR},
         {std::to_integer<std::int8_t>(npCode), DataType::HELICS_NAMED_POINT},
         {std::to_integer<std::int8_t>(customCode), DataType::HELICS_CUSTOM},
-        {std::to_integer<std::int8_t>(stringCode), DataType::HELICS_STRING}};
+        {std::to_integer<std::int8_t>(stringCode), DataType::HELICS_STRING},
+        {std::to_integer<std::int8_t>(svCode), DataType::HELICS_STRING}};
 
     DataType detectType(const std::byte* data)
     {
@@ -219,11 +253,44 @@ namespace detail {
         }
     }
 
+    /** get the number of bytes in an encoded string vector from the length prefixes*/
+    static size_t getStringVectorSize(const std::byte* data)
+    {
+        auto count = getDataSize(data);
+        size_t loc{8};
+        for (size_t ii = 0; ii < count; ++ii) {
+            loc += 4 + readSize(data + loc);
+        }
+        return loc;
+    }
+
     void convertFromBinary(const std::byte* data, std::string& val)
     {
-        std::size_t size = getDataSize(data);
+        convertFromBinary(data,
+                          (data[0] == svCode) ? getStringVectorSize(data) : getDataSize(data) + 8,
+                          val);
+    }
+
+    void convertFromBinary(const std::byte* data, size_t size, std::string& val)
+    {
+        if (size < 8) {
+            val.clear();
+            return;
+        }
+        if (data[0] == svCode) {
+            // string vectors are read as strings through their JSON representation
+            std::vector<std::string> strings;
+            convertFromBinary(data, size, strings);
+            Json::Value V(Json::arrayValue);
+            for (const auto& str : strings) {
+                V.append(str);
+            }
+            val = generateJsonString(V);
+            return;
+        }
+        auto strSize = std::min(getDataSize(data), size - 8);
         val.assign(reinterpret_cast<const char*>(data) + 8,
-                   reinterpret_cast<const char*>(data) + 8 + size);
+                   reinterpret_cast<const char*>(data) + 8 + strSize);
     }
 
     void convertFromBinary(const std::byte* data, std::string_view& val)
@@ -232,6 +299,27 @@ namespace detail {
         val = std::string_view(reinterpret_cast<const char*>(data) + 8, size);
     }
 
+    void convertFromBinary(const std::byte* data, size_t size, std::string_view& val)
+    {
+        if (size < 8) {
+            val = std::string_view{};
+            return;
+        }
+        val = std::string_view(reinterpret_cast<const char*>(data) + 8,
+                               std::min(getDataSize(data), size - 8));
+    }
+
+    std::string_view readStringView(const std::byte* data, size_t size, std::string& storage)
+    {
+        if (size >= 8 && data[0] == svCode) {
+            convertFromBinary(data, size, storage);
+            return storage;
+        }
+        std::string_view val;
+        convertFromBinary(data, size, val);
+        return val;
+    }
+
     void convertFromBinary(const std::byte* data, char* val)
     {
         std::size_t size = getDataSize(data);
@@ -278,6 +366,27 @@ namespace detail {
         }
     }
 
+    bool convertFromBinary(const std::byte* data, size_t size, std::vector<std::string>& val)
+    {
+        val.clear();
+        if (size < 8 || data[0] != svCode) {
+            return false;
+        }
+        auto count = getDataSize(data);
+        val.reserve(std::min(count, (size - 8) / 4));
+        size_t loc{8};
+        for (size_t ii = 0; ii < count && loc + 4 <= size; ++ii) {
+            auto strSize = readSize(data + loc);
+            loc += 4;
+            if (strSize > size - loc) {
+                break;
+            }
+            val.emplace_back(reinterpret_cast<const char*>(data) + loc, strSize);
+            loc += strSize;
+        }
+        return true;
+    }
+
     void convertFromBinary(const std::byte* data, std::vector<std::complex<double>>& val)
     {
         std::size_t size = getDataSize(data);
@@ -299,19 +408,18 @@ namespace detail {
 void ValueConverter<std::vector<std::string>>::convert(const std::vector<std::string>& val,
                                                        SmallBuffer& store)
 {
-    Json::Value V(Json::arrayValue);
-    for (const auto& str : val) {
-        V.append(str);
-    }
-    auto strgen = generateJsonString(V);
-    return ValueConverter<std::string_view>::convert(strgen, store);
+    store.resize(detail::getBinaryLength(val));
+    detail::convertToBinary(store.data(), val);
 }
 
 /** interpret a view of the data block and store to the specified value*/
 void ValueConverter<std::vector<std::string>>::interpret(const data_view& block,
                                                          std::vector<std::string>& val)
 {
-    val.clear();
+    if (detail::convertFromBinary(block.bytes(), block.size(), val)) {
+        return;
+    }
+    // strings and JSON arrays are converted for compatibility
     auto str = ValueConverter<std::string_view>::interpret(block);
     try {
         Json::Value V = loadJsonStr(str);
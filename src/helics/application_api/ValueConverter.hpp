@@ -49,6 +49,15 @@ namespace detail {
         return size * sizeof(double) * 2 + 8;
     }
 
+    inline size_t getBinaryLength(const std::vector<std::string>& val)
+    {
+        size_t size{8};
+        for (const auto& str : val) {
+            size += str.size() + 4;
+        }
+        return size;
+    }
+
     HELICS_CXX_EXPORT size_t convertToBinary(std::byte* data, double val);
 
     HELICS_CXX_EXPORT size_t convertToBinary(std::byte* data, std::int64_t val);
@@ -70,6 +79,9 @@ namespace detail {
                                              const std::complex<double>* val,
                                              size_t size);
 
+    /** store a vector of strings as a count followed by length prefixed strings*/
+    HELICS_CXX_EXPORT size_t convertToBinary(std::byte* data, const std::vector<std::string>& val);
+
     /** detect the contained data type,  assumes data is at least 1 byte long*/
     HELICS_CXX_EXPORT DataType detectType(const std::byte* data);
 
@@ -86,6 +98,41 @@ namespace detail {
 
     HELICS_CXX_EXPORT void convertFromBinary(const std::byte* data,
                                              std::vector<std::complex<double>>& val);
+    /** read a vector of strings from a block of binary data
+    @param data the binary data
+    @param size the number of bytes available in data
+    @param val the vector to store the strings in
+    @return false if the data is not a binary string vector*/
+    HELICS_CXX_EXPORT bool
+        convertFromBinary(const std::byte* data, size_t size, std::vector<std::string>& val);
+
+    /** read a string from a block of binary data
+    @details a string vector is converted to its JSON array representation
+    @param data the binary data
+    @param size the number of bytes available in data
+    @param val the string to store the result in*/
+    HELICS_CXX_EXPORT void convertFromBinary(const std::byte* data, size_t size, std::string& val);
+    /** get a view of the string in a block of binary data
+    @param data the binary data
+    @param size the number of bytes available in data
+    @param val the view of the string contained in data*/
+    HELICS_CXX_EXPORT void
+        convertFromBinary(const std::byte* data, size_t size, std::string_view& val);
+    /** get a view of the string in a block of binary data, converting string vectors to their JSON
+    array representation
+    @param data the binary data
+    @param size the number of bytes available in data
+    @param storage the string holding the JSON representation if data is a string vector
+    @return a view of the string in data or storage*/
+    HELICS_CXX_EXPORT std::string_view
+        readStringView(const std::byte* data, size_t size, std::string& storage);
+    /** read a value from a block of binary data of a known size
+    @details types with a fixed size do not need the size of the block*/
+    template<class X>
+    void convertFromBinary(const std::byte* data, size_t /*size*/, X& val)
+    {
+        convertFromBinary(data, val);
+    }
 
     /** get the size of the data from the data stream for a specific type
     @details this returns the number of elements of the specific data type  it is NOT in bytes
@@ -132,14 +179,14 @@ class ValueConverter {
     static X interpret(const data_view& block)
     {
         X val;
-        detail::convertFromBinary(block.bytes(), val);
+        detail::convertFromBinary(block.bytes(), block.size(), val);
         return val;
     }
 
     /** interpret a view of the data block and store to the specified value*/
     static void interpret(const data_view& block, X& val)
     {
-        detail::convertFromBinary(block.bytes(), val);
+        detail::convertFromBinary(block.bytes(), block.size(), val);
     }
 
     /** get the type of the value*/
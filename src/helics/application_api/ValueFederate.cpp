@@ -6,6 +6,7 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #include "ValueFederate.hpp"
 
+#include "../common/InterfaceConfigReader.hpp"
 #include "../common/addTargets.hpp"
 #include "../common/configFileHelpers.hpp"
 #include "../core/Core.hpp"
@@ -214,66 +215,58 @@ static void loadOptions(ValueFederate* fed, const Inp& data, Obj& objUpdate)
 
 void ValueFederate::registerValueInterfacesJson(const std::string& jsonString)
 {
-    auto doc = loadJson(jsonString);
+    // the interface sections are loaded one element at a time
+    InterfaceConfigReader doc(jsonString);
     bool defaultGlobal = false;
-    replaceIfMember(doc, "defaultglobal", defaultGlobal);
-    if (doc.isMember("publications")) {
-        auto pubs = doc["publications"];
-        for (const auto& pub : pubs) {
-            auto key = getKey(pub);
-
-            Publication* pubAct = &vfManager->getPublication(key);
-            if (!pubAct->isValid()) {
-                auto type = getOrDefault(pub, "type", emptyStr);
-                auto units = getOrDefault(pub, "unit", emptyStr);
-                replaceIfMember(pub, "units", units);
-                bool global = getOrDefault(pub, "global", defaultGlobal);
-                if (global) {
-                    pubAct = &registerGlobalPublication(key, type, units);
-                } else {
-                    pubAct = &registerPublication(key, type, units);
-                }
+    replaceIfMember(doc.getSubDocument({"defaultglobal"}), "defaultglobal", defaultGlobal);
+    doc.forEachElement("publications", [this, defaultGlobal](const Json::Value& pub) {
+        auto key = getKey(pub);
+
+        Publication* pubAct = &vfManager->getPublication(key);
+        if (!pubAct->isValid()) {
+            auto type = getOrDefault(pub, "type", emptyStr);
+            auto units = getOrDefault(pub, "unit", emptyStr);
+            replaceIfMember(pub, "units", units);
+            bool global = getOrDefault(pub, "global", defaultGlobal);
+            if (global) {
+                pubAct = &registerGlobalPublication(key, type, units);
+            } else {
+                pubAct = &registerPublication(key, type, units);
             }
+        }
 
-            loadOptions(this, pub, *pubAct);
+        loadOptions(this, pub, *pubAct);
+    });
+    doc.forEachElement("subscriptions", [this](const Json::Value& sub) {
+        auto key = getKey(sub);
+        auto* subAct = &vfManager->getSubscription(key);
+        if (!subAct->isValid()) {
+            auto type = getOrDefault(sub, "type", emptyStr);
+            auto units = getOrDefault(sub, "unit", emptyStr);
+            replaceIfMember(sub, "units", units);
+            subAct = &registerInput(emptyStr, type, units);
+            subAct->addTarget(key);
         }
-    }
-    if (doc.isMember("subscriptions")) {
-        auto subs = doc["subscriptions"];
-        for (const auto& sub : subs) {
-            auto key = getKey(sub);
-            auto* subAct = &vfManager->getSubscription(key);
-            if (!subAct->isValid()) {
-                auto type = getOrDefault(sub, "type", emptyStr);
-                auto units = getOrDefault(sub, "unit", emptyStr);
-                replaceIfMember(sub, "units", units);
-                subAct = &registerInput(emptyStr, type, units);
-                subAct->addTarget(key);
+        loadOptions(this, sub, *subAct);
+    });
+    doc.forEachElement("inputs", [this, defaultGlobal](const Json::Value& ipt) {
+        auto key = getKey(ipt);
+
+        Input* inp = &vfManager->getInput(key);
+        if (!inp->isValid()) {
+            auto type = getOrDefault(ipt, "type", emptyStr);
+            auto units = getOrDefault(ipt, "unit", emptyStr);
+            replaceIfMember(ipt, "units", units);
+            bool global = getOrDefault(ipt, "global", defaultGlobal);
+            if (global) {
+                inp = &registerGlobalInput(key, type, units);
+            } else {
+                inp = &registerInput(key, type, units);
             }
-            loadOptions(this, sub, *subAct);
         }
-    }
-    if (doc.isMember("inputs")) {
-        auto ipts = doc["inputs"];
-        for (const auto& ipt : ipts) {
-            auto key = getKey(ipt);
 
-            Input* inp = &vfManager->getInput(key);
-            if (!inp->isValid()) {
-                auto type = getOrDefault(ipt, "type", emptyStr);
-                auto units = getOrDefault(ipt, "unit", emptyStr);
-                replaceIfMember(ipt, "units", units);
-                bool global = getOrDefault(ipt, "global", defaultGlobal);
-                if (global) {
-                    inp = &registerGlobalInput(key, type, units);
-                } else {
-                    inp = &registerInput(key, type, units);
-                }
-            }
-
-            loadOptions(this, ipt, *inp);
-        }
-    }
+        loadOptions(this, ipt, *inp);
+    });
 }
 
 void ValueFederate::registerValueInterfacesToml(const std::string& tomlString)
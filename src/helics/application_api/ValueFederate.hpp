@@ -303,8 +303,8 @@ class HELICS_CXX_EXPORT ValueFederate:
     /** register a set of interfaces defined in a file
     @details call is only valid in startup mode to add an TOML files must have extension .toml or
     .TOML
-    @param configString  the location of the file(JSON or TOML) or JSON String to load to generate
-    the interfaces
+    @param configString  the location of the file(JSON, TOML, or interface manifest) or JSON String
+    to load to generate the interfaces
     */
     virtual void registerInterfaces(const std::string& configString) override;
 
@@ -528,7 +528,7 @@ void valueExtract(const data_view& dv, DataType baseType, std::string& val)
         }
         case DataType::HELICS_STRING:
         default:
-            val = ValueConverter<std::string_view>::interpret(dv);
+            ValueConverter<std::string>::interpret(dv, val);
             break;
         case DataType::HELICS_NAMED_POINT:
             val = helicsNamedPointString(ValueConverter<NamedPoint>::interpret(dv));
@@ -564,7 +564,8 @@ void valueExtract(const data_view& dv, DataType baseType, std::vector<double>& v
         } break;
         case DataType::HELICS_STRING:
         default: {
-            helicsGetVector(ValueConverter<std::string_view>::interpret(dv), val);
+            std::string storage;
+            helicsGetVector(detail::readStringView(dv.bytes(), dv.size(), storage), val);
             break;
         }
         case DataType::HELICS_NAMED_POINT: {
@@ -616,7 +617,8 @@ void valueExtract(const data_view& dv, DataType baseType, std::vector<std::compl
         } break;
         case DataType::HELICS_STRING:
         default: {
-            helicsGetComplexVector(ValueConverter<std::string_view>::interpret(dv), val);
+            std::string storage;
+            helicsGetComplexVector(detail::readStringView(dv.bytes(), dv.size(), storage), val);
             break;
         }
         case DataType::HELICS_VECTOR: {
@@ -665,7 +667,8 @@ void valueExtract(const data_view& dv, DataType baseType, std::complex<double>&
         } break;
         case DataType::HELICS_STRING:
         default: {
-            val = helicsGetComplex(ValueConverter<std::string_view>::interpret(dv));
+            std::string storage;
+            val = helicsGetComplex(detail::readStringView(dv.bytes(), dv.size(), storage));
             break;
         }
         case DataType::HELICS_NAMED_POINT: {
@@ -715,7 +718,8 @@ void valueExtract(const data_view& dv, DataType baseType, NamedPoint& val)
         } break;
         case DataType::HELICS_STRING:
         default: {
-            val = helicsGetNamedPoint(ValueConverter<std::string_view>::interpret(dv));
+            std::string storage;
+            val = helicsGetNamedPoint(detail::readStringView(dv.bytes(), dv.size(), storage));
             break;
         }
         case DataType::HELICS_VECTOR: {
@@ -775,7 +779,8 @@ void valueExtract(const data_view& dv, DataType baseType, Time& val)
         default: {
             size_t index;
             try {
-                auto data = ValueConverter<std::string_view>::interpret(dv);
+                std::string storage;
+                auto data = detail::readStringView(dv.bytes(), dv.size(), storage);
                 auto ul = std::stoll(std::string(data), &index);
                 if ((index == std::string::npos) || (index == data.size())) {
                     val.setBaseTimeCode(ul);
@@ -822,9 +827,11 @@ void valueExtract(const data_view& dv, DataType baseType, bool& val)
             break;
         }
         case DataType::HELICS_STRING:
-        default:
-            val = helicsBoolValue(ValueConverter<std::string_view>::interpret(dv));
+        default: {
+            std::string storage;
+            val = helicsBoolValue(detail::readStringView(dv.bytes(), dv.size(), storage));
             break;
+        }
         case DataType::HELICS_BOOL:
             val = (ValueConverter<std::string_view>::interpret(dv) != "0");
             break;
@@ -886,7 +893,7 @@ void valueExtract(const data_view& dv, DataType baseType, defV& val)
             break;
         case DataType::HELICS_STRING:
         default:
-            val = std::string(ValueConverter<std::string_view>::interpret(dv));
+            val = ValueConverter<std::string>::interpret(dv);
             break;
         case DataType::HELICS_VECTOR:
             val = ValueConverter<std::vector<double>>::interpret(dv);
@@ -983,4 +990,59 @@ void valueConvert(defV& val, DataType newType)
     }
 }
 
+namespace {
+    /** conversion kernel with the source type fixed at compile time*/
+    template<class X, DataType sourceType>
+    void conversionKernel(const data_view& dv, X& val)
+    {
+        if constexpr (helicsType<X>() == sourceType && sourceType != DataType::HELICS_BOOL &&
+                      sourceType != DataType::HELICS_TIME) {
+            // the binary representation matches so it can be copied directly
+            ValueConverter<X>::interpret(dv, val);
+        } else {
+            valueExtract(dv, sourceType, val);
+        }
+    }
+
+    template<class X>
+    ConversionKernel<X> getKernel(DataType sourceType)
+    {
+        switch (sourceType) {
+            case DataType::HELICS_DOUBLE:
+                return &conversionKernel<X, DataType::HELICS_DOUBLE>;
+            case DataType::HELICS_INT:
+                return &conversionKernel<X, DataType::HELICS_INT>;
+            case DataType::HELICS_STRING:
+                return &conversionKernel<X, DataType::HELICS_STRING>;
+            case DataType::HELICS_COMPLEX:
+                return &conversionKernel<X, DataType::HELICS_COMPLEX>;
+            case DataType::HELICS_VECTOR:
+                return &conversionKernel<X, DataType::HELICS_VECTOR>;
+            case DataType::HELICS_COMPLEX_VECTOR:
+                return &conversionKernel<X, DataType::HELICS_COMPLEX_VECTOR>;
+            case DataType::HELICS_NAMED_POINT:
+                return &conversionKernel<X, DataType::HELICS_NAMED_POINT>;
+            case DataType::HELICS_BOOL:
+                return &conversionKernel<X, DataType::HELICS_BOOL>;
+            case DataType::HELICS_TIME:
+                return &conversionKernel<X, DataType::HELICS_TIME>;
+            default:
+                return nullptr;
+        }
+    }
+}  // namespace
+
+ConversionKernelSet getConversionKernels(DataType sourceType)
+{
+    return {getKernel<double>(sourceType),
+            getKernel<int64_t>(sourceType),
+            getKernel<std::string>(sourceType),
+            getKernel<std::complex<double>>(sourceType),
+            getKernel<std::vector<double>>(sourceType),
+            getKernel<std::vector<std::complex<double>>>(sourceType),
+            getKernel<NamedPoint>(sourceType),
+            getKernel<bool>(sourceType),
+            getKernel<Time>(sourceType)};
+}
+
 }  // namespace helics
@@ -18,6 +18,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "gmlc/utilities/string_viewConversion.h"
 
 #include <algorithm>
+#include <charconv>
 #include <functional>
 #include <numeric>
 #include <regex>
@@ -251,6 +252,22 @@ std::string_view getCleanedTypeName(std::string_view typeName)
     return typeName;
 }
 
+/** read a string that is entirely a real number,  this is locale independent and avoids the
+regular expression used for the general complex number formats
+@return true if the full string was read as a number*/
+static bool readPlainNumber(std::string_view val, double& result)
+{
+#ifdef __cpp_lib_to_chars
+    const char* end = val.data() + val.size();
+    auto res = std::from_chars(val.data(), end, result);
+    return (res.ec == std::errc{} && res.ptr == end);
+#else
+    (void)val;
+    (void)result;
+    return false;
+#endif
+}
+
 // regular expression to handle complex numbers of various formats
 const std::regex creg(
     R"(([+-]?(\d+(\.\d+)?|\.\d+)([eE][+-]?\d+)?)\s*([+-]\s*(\d+(\.\d+)?|\.\d+)([eE][+-]?\d+)?)[ji]*)");
@@ -262,6 +279,10 @@ std::complex<double> helicsGetComplex(std::string_view val)
     }
     double re{invalidValue<double>()};
     double im{0.0};
+    double plain{0.0};
+    if (readPlainNumber(val, plain)) {
+        return {plain, im};
+    }
     if (val.front() == '[') {
         auto sep = val.find_first_of(',');
         if (sep == std::string_view::npos) {
@@ -0,0 +1,110 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "CapturePipeline.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <utility>
+
+namespace helics {
+namespace apps {
+    CapturePipeline::CapturePipeline(std::size_t capacity,
+                                     std::function<void(CaptureRecord&)> processor,
+                                     bool dropWhenFull):
+        processRecord(std::move(processor)),
+        dropOnFull(dropWhenFull)
+    {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size <<= 1U;
+        }
+        ring.resize(size);
+        mask = size - 1;
+        writer = std::thread([this]() { writerLoop(); });
+    }
+
+    CapturePipeline::~CapturePipeline()
+    {
+        halting.store(true);
+        wakeWriter();
+        if (writer.joinable()) {
+            writer.join();
+        }
+    }
+
+    bool CapturePipeline::push(CaptureRecord&& record)
+    {
+        auto seq = head.load(std::memory_order_relaxed);
+        if (seq - tail.load(std::memory_order_acquire) > mask) {
+            if (dropOnFull) {
+                ++dropped;
+                return false;
+            }
+            ++stalls;
+            wakeWriter();
+            while (seq - tail.load(std::memory_order_acquire) > mask) {
+                std::this_thread::yield();
+            }
+        }
+        ring[seq & mask] = std::move(record);
+        head.store(seq + 1, std::memory_order_seq_cst);
+        if (writerWaiting.load(std::memory_order_seq_cst)) {
+            wakeWriter();
+        }
+        return true;
+    }
+
+    void CapturePipeline::flush()
+    {
+        auto target = head.load(std::memory_order_relaxed);
+        wakeWriter();
+        while (tail.load(std::memory_order_acquire) != target) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+
+    void CapturePipeline::wakeWriter()
+    {
+        { std::lock_guard<std::mutex> lock(sleepLock); }
+        wake.notify_one();
+    }
+
+    void CapturePipeline::writerLoop()
+    {
+        while (true) {
+            auto seq = tail.load(std::memory_order_relaxed);
+            if (seq == head.load(std::memory_order_acquire)) {
+                if (halting.load()) {
+                    if (seq == head.load(std::memory_order_acquire)) {
+                        break;
+                    }
+                    continue;
+                }
+                std::unique_lock<std::mutex> lock(sleepLock);
+                writerWaiting.store(true, std::memory_order_seq_cst);
+                wake.wait(lock, [this, seq]() {
+                    return (head.load(std::memory_order_seq_cst) != seq) || halting.load();
+                });
+                writerWaiting.store(false, std::memory_order_relaxed);
+                continue;
+            }
+            auto& record = ring[seq & mask];
+            try {
+                processRecord(record);
+            }
+            catch (const std::exception& e) {
+                std::cerr << "error processing captured record: " << e.what() << '\n';
+            }
+            // release any storage held by the record before handing the slot back
+            record = CaptureRecord{};
+            tail.store(seq + 1, std::memory_order_release);
+            ++processed;
+        }
+    }
+}  // namespace apps
+}  // namespace helics
@@ -0,0 +1,85 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "../application_api/helicsTypes.hpp"
+#include "../core/SmallBuffer.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace helics {
+namespace apps {
+    /** raw record of a captured value or message*/
+    struct CaptureRecord {
+        Time time{timeZero};  //!< the time of the capture
+        int index{-1};  //!< the index of the interface the record was captured from
+        int iteration{0};  //!< the iteration of the capture
+        DataType type{DataType::HELICS_ANY};  //!< the type of a raw value
+        SmallBuffer payload;  //!< the raw value data
+        std::unique_ptr<Message> message;  //!< a captured message
+    };
+
+    /** pipeline moving captured records from a federate to a background writer thread
+    @details the federate thread pushes raw records into a single producer single consumer ring
+    without locking,  the writer thread hands them to a processing function for formatting and
+    output.  If the ring is full the producer either waits for space or drops the record*/
+    class CapturePipeline {
+      public:
+        /** construct the pipeline and start the writer thread
+        @param capacity the minimum number of records in the ring (rounded up to a power of 2)
+        @param processor the function called on the writer thread for each record
+        @param dropWhenFull set to true to drop records when the ring is full instead of waiting*/
+        CapturePipeline(std::size_t capacity,
+                        std::function<void(CaptureRecord&)> processor,
+                        bool dropWhenFull = false);
+        /** destructor processes any remaining records and stops the writer thread*/
+        ~CapturePipeline();
+        CapturePipeline(const CapturePipeline&) = delete;
+        CapturePipeline& operator=(const CapturePipeline&) = delete;
+        /** push a record into the ring (federate thread only)
+        @return false if the record was dropped*/
+        bool push(CaptureRecord&& record);
+        /** wait until all the pushed records have been processed*/
+        void flush();
+        /** get the number of records dropped because the ring was full*/
+        std::uint64_t droppedCount() const { return dropped.load(); }
+        /** get the number of times the federate had to wait for space in the ring*/
+        std::uint64_t stallCount() const { return stalls.load(); }
+        /** get the number of records processed by the writer*/
+        std::uint64_t processedCount() const { return processed.load(); }
+
+      private:
+        /** the writer thread loop*/
+        void writerLoop();
+        /** wake the writer if it is waiting for records*/
+        void wakeWriter();
+
+        std::vector<CaptureRecord> ring;  //!< the record storage
+        std::size_t mask{0};  //!< mask for converting a sequence number to a ring index
+        alignas(64) std::atomic<std::size_t> head{0};  //!< next sequence to write (producer)
+        alignas(64) std::atomic<std::size_t> tail{0};  //!< next sequence to read (writer)
+        alignas(64) std::atomic<bool> writerWaiting{false};  //!< the writer is asleep
+        std::atomic<bool> halting{false};  //!< the writer should stop once the ring is empty
+        std::atomic<std::uint64_t> dropped{0};  //!< the number of dropped records
+        std::atomic<std::uint64_t> stalls{0};  //!< the number of times the producer waited
+        std::atomic<std::uint64_t> processed{0};  //!< the number of processed records
+        std::function<void(CaptureRecord&)> processRecord;  //!< the record processing function
+        const bool dropOnFull{false};  //!< drop records instead of waiting when full
+        std::mutex sleepLock;  //!< lock for the writer wakeup
+        std::condition_variable wake;  //!< condition for the writer wakeup
+        std::thread writer;  //!< the writer thread
+    };
+}  // namespace apps
+}  // namespace helics
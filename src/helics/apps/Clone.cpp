@@ -13,6 +13,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../common/fmt_format.h"
 #include "../common/fmt_ostream.h"
 #include "../core/helicsCLI11.hpp"
+#include "CapturePipeline.hpp"
 #include "PrecHelper.hpp"
 #include "gmlc/utilities/base64.h"
 #include "gmlc/utilities/stringOps.h"
@@ -20,6 +21,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <iterator>
 #include <map>
 #include <regex>
 #include <set>
@@ -99,6 +101,7 @@ namespace apps {
 
     void Clone::saveFile(const std::string& filename)
     {
+        flushCapture();
         if (filename.empty()) {
             if (!outFileName.empty()) {
                 saveFile(outFileName);
@@ -170,6 +173,17 @@ namespace apps {
         generateInterfaces();
 
         pubPointCount.resize(subids.size(), 0);
+        if (asyncCapture) {
+            captureTargets.clear();
+            for (auto& sub : subscriptions) {
+                captureTargets.push_back(sub.getTarget());
+            }
+            captureTypes.assign(subscriptions.size(), DataType::HELICS_UNKNOWN);
+            pipeline = std::make_unique<CapturePipeline>(
+                captureBufferSize,
+                [this](CaptureRecord& record) { processCaptureRecord(record); },
+                dropCaptureWhenFull);
+        }
 
         fed->enterInitializingMode();
         captureForCurrentTime(-1.0);
@@ -213,44 +227,38 @@ namespace apps {
 
     void Clone::captureForCurrentTime(Time currentTime, int iteration)
     {
-        for (auto& sub : subscriptions) {
-            if (sub.isUpdated()) {
-                auto val = sub.getValue<std::string>();
-                int ii = subids[sub.getHandle()];
-                points.emplace_back(currentTime, ii, val);
-                if (iteration > 0) {
-                    points.back().iteration = iteration;
-                }
-                if (verbose) {
-                    std::string valstr;
-                    if (val.size() < 150) {
-                        if (iteration > 0) {
-                            valstr = fmt::format(
-                                "[{}:{}]value {}={}", currentTime, iteration, sub.getTarget(), val);
-                        } else {
-                            valstr =
-                                fmt::format("[{}]value {}={}", currentTime, sub.getTarget(), val);
-                        }
-                    } else {
-                        if (iteration > 0) {
-                            valstr = fmt::format("[{}:{}]value {}=block[{}]",
-                                                 currentTime,
-                                                 iteration,
-                                                 sub.getTarget(),
-                                                 val.size());
-                        } else {
-                            valstr = fmt::format("[{}]value {}=block[{}]",
-                                                 currentTime,
-                                                 sub.getTarget(),
-                                                 val.size());
-                        }
+        if (pipeline) {
+            // only copy the raw data here, the writer thread does the rest
+            for (auto& sub : subscriptions) {
+                if (sub.isUpdated()) {
+                    int ii = subids[sub.getHandle()];
+                    if (captureTypes[ii] == DataType::HELICS_UNKNOWN) {
+                        captureTypes[ii] = getTypeFromString(sub.getPublicationType());
                     }
-                    spdlog::info(valstr);
+                    auto raw = sub.getBytes();
+                    CaptureRecord record;
+                    record.time = currentTime;
+                    record.index = ii;
+                    record.iteration = iteration;
+                    record.type = captureTypes[ii];
+                    record.payload = SmallBuffer(raw.data(), raw.size());
+                    pipeline->push(std::move(record));
                 }
-                if (pubPointCount[ii] == 0) {
-                    points.back().first = true;
+            }
+            if (cloneEndpoint) {
+                while (cloneEndpoint->hasMessage()) {
+                    CaptureRecord record;
+                    record.time = currentTime;
+                    record.message = cloneEndpoint->getMessage();
+                    pipeline->push(std::move(record));
                 }
-                ++pubPointCount[ii];
+            }
+            return;
+        }
+        for (auto& sub : subscriptions) {
+            if (sub.isUpdated()) {
+                auto val = sub.getValue<std::string>();
+                processValue(currentTime, iteration, subids[sub.getHandle()], val);
             }
         }
 
@@ -262,6 +270,79 @@ namespace apps {
         }
     }
 
+    void Clone::processValue(Time currentTime, int iteration, int index, const std::string& val)
+    {
+        auto& pointList = (pipeline) ? capturedPoints : points;
+        pointList.emplace_back(currentTime, index, val);
+        if (iteration > 0) {
+            pointList.back().iteration = iteration;
+        }
+        if (verbose) {
+            const auto& target =
+                (pipeline) ? captureTargets[index] : subscriptions[index].getTarget();
+            std::string valstr;
+            if (val.size() < 150) {
+                if (iteration > 0) {
+                    valstr = fmt::format("[{}:{}]value {}={}", currentTime, iteration, target, val);
+                } else {
+                    valstr = fmt::format("[{}]value {}={}", currentTime, target, val);
+                }
+            } else {
+                if (iteration > 0) {
+                    valstr = fmt::format(
+                        "[{}:{}]value {}=block[{}]", currentTime, iteration, target, val.size());
+                } else {
+                    valstr = fmt::format("[{}]value {}=block[{}]", currentTime, target, val.size());
+                }
+            }
+            spdlog::info(valstr);
+        }
+        if (pubPointCount[index] == 0) {
+            pointList.back().first = true;
+        }
+        ++pubPointCount[index];
+    }
+
+    void Clone::processCaptureRecord(CaptureRecord& record)
+    {
+        // the results are kept separate from the points and messages used by the federate
+        // thread until they are handed back in flushCapture
+        if (record.message) {
+            capturedMessages.push_back(std::move(record.message));
+        } else {
+            std::string val;
+            valueExtract(data_view(record.payload), record.type, val);
+            processValue(record.time, record.iteration, record.index, val);
+        }
+    }
+
+    void Clone::flushCapture()
+    {
+        if (!pipeline) {
+            return;
+        }
+        // the writer is idle once the flush completes since only this thread pushes records
+        pipeline->flush();
+        points.insert(points.end(),
+                      std::make_move_iterator(capturedPoints.begin()),
+                      std::make_move_iterator(capturedPoints.end()));
+        capturedPoints.clear();
+        messages.insert(messages.end(),
+                        std::make_move_iterator(capturedMessages.begin()),
+                        std::make_move_iterator(capturedMessages.end()));
+        capturedMessages.clear();
+    }
+
+    std::uint64_t Clone::droppedCaptureCount() const
+    {
+        return (pipeline) ? pipeline->droppedCount() : 0;
+    }
+
+    std::uint64_t Clone::stalledCaptureCount() const
+    {
+        return (pipeline) ? pipeline->stallCount() : 0;
+    }
+
     /** run the Player until the specified time*/
     void Clone::runTo(Time runToTime)
     {
@@ -297,6 +378,10 @@ namespace apps {
         }
         catch (...) {
         }
+        flushCapture();
+        if (droppedCaptureCount() > 0) {
+            spdlog::warn("clone dropped {} captured records", droppedCaptureCount());
+        }
     }
     /** add a subscription to record*/
     void Clone::addSubscription(const std::string& key)
@@ -352,6 +437,18 @@ namespace apps {
             ->ignore_underscore();
 
         app->add_option("--output,-o", outFileName, "the output file for recording the data", true);
+        app->add_flag("--async_capture",
+                      asyncCapture,
+                      "store the captured values and messages on a separate writer thread")
+            ->ignore_underscore();
+        app->add_option("--capture_buffer",
+                        captureBufferSize,
+                        "the number of records buffered for the asynchronous capture")
+            ->ignore_underscore();
+        app->add_flag("--drop_when_full",
+                      dropCaptureWhenFull,
+                      "drop captured records instead of waiting if the capture buffer is full")
+            ->ignore_underscore();
         app->add_option("capture", captureFederate, "name of the federate to clone");
 
         return app;
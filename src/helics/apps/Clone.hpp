@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../application_api/Subscriptions.hpp"
 #include "helicsApp.hpp"
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <set>
@@ -22,6 +23,9 @@ namespace helics {
 class CloningFilter;
 
 namespace apps {
+    class CapturePipeline;
+    struct CaptureRecord;
+
     /** class designed to capture data points from a set of subscriptions or endpoints*/
     class HELICS_CXX_EXPORT Clone: public App {
       public:
@@ -60,10 +64,10 @@ namespace apps {
     @param jsonString a file or json string defining the federate information in JSON or text
     */
         Clone(const std::string& appName, const std::string& jsonString);
-        /** move construction*/
-        Clone(Clone&& other_recorder) = default;
-        /** move assignment*/
-        Clone& operator=(Clone&& record) = default;
+        /** the capture pipeline thread refers to this object so it cannot be moved*/
+        Clone(Clone&& other_recorder) = delete;
+        /** the capture pipeline thread refers to this object so it cannot be moved*/
+        Clone& operator=(Clone&& record) = delete;
         /** destructor*/
         ~Clone();
         /** run the Cloner until the specified time*/
@@ -92,6 +96,23 @@ namespace apps {
         /** set the name of the output file
     @param fileName  the name of the file, can be "" if no file should be auto saved*/
         void setOutputFile(std::string fileName) { outFileName = std::move(fileName); }
+        /** process the captured values and messages on a background thread
+    @details the federate thread only copies the raw data into a ring buffer and a writer thread
+    stores it,  all captured data is processed before runTo returns.  Must be called before the
+    Clone is run
+    @param bufferSize the number of records the ring buffer can hold
+    @param dropWhenFull set to true to drop records if the buffer is full instead of waiting
+    */
+        void enableAsyncCapture(std::size_t bufferSize = 4096, bool dropWhenFull = false)
+        {
+            asyncCapture = true;
+            captureBufferSize = bufferSize;
+            dropCaptureWhenFull = dropWhenFull;
+        }
+        /** get the number of captured records dropped by the asynchronous capture*/
+        std::uint64_t droppedCaptureCount() const;
+        /** get the number of times the asynchronous capture waited for space in the buffer*/
+        std::uint64_t stalledCaptureCount() const;
 
       private:
         /** add a subscription to capture*/
@@ -103,6 +124,13 @@ namespace apps {
         virtual void initialize() override;
         void generateInterfaces();
         void captureForCurrentTime(Time currentTime, int iteration = 0);
+        /** store a captured value,  in the writer thread storage if the capture is asynchronous*/
+        void processValue(Time currentTime, int iteration, int index, const std::string& val);
+        /** process a record from the capture pipeline on the writer thread*/
+        void processCaptureRecord(CaptureRecord& record);
+        /** wait for all the captured records to be processed and move them to the points and
+        messages, must be called from the federate thread*/
+        void flushCapture();
         /** build the command line argument processing application*/
         std::shared_ptr<helicsCLI11App> buildArgParserApp();
         /** process remaining command line arguments*/
@@ -143,7 +171,20 @@ namespace apps {
         std::string captureFederate;  //!< storage for the name of the federate to clone
         std::string fedConfig;  //!< storage for the federateConfiguration
         std::string outFileName{"clone.json"};  //!< the final output file
-        std::vector<int> pubPointCount;  //!< a    vector containing the counts of each publication
+        /// a vector containing the counts of each publication, owned by the writer thread when the
+        /// capture is asynchronous
+        std::vector<int> pubPointCount;
+        bool asyncCapture{false};  //!< process the captured data on a writer thread
+        bool dropCaptureWhenFull{false};  //!< drop captured data if the pipeline is full
+        std::size_t captureBufferSize{4096};  //!< the size of the capture ring buffer
+        std::vector<std::string> captureTargets;  //!< subscription targets used by the writer
+        std::vector<DataType> captureTypes;  //!< the publication type of each subscription
+        /// points processed by the writer thread and not yet moved to points
+        std::vector<ValueCapture> capturedPoints;
+        /// messages processed by the writer thread and not yet moved to messages
+        std::vector<std::unique_ptr<Message>> capturedMessages;
+        /// the asynchronous capture pipeline,  declared last so it is stopped first
+        std::unique_ptr<CapturePipeline> pipeline;
     };
 
 }  // namespace apps
@@ -0,0 +1,113 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "MappedFile.hpp"
+
+#ifdef _WIN32
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace helics {
+namespace apps {
+#ifdef _WIN32
+    MappedFile::MappedFile(const std::string& filename)
+    {
+        HANDLE file = CreateFileA(filename.c_str(),
+                                  GENERIC_READ,
+                                  FILE_SHARE_READ,
+                                  nullptr,
+                                  OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                                  nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return;
+        }
+        fileHandle = file;
+        LARGE_INTEGER fileSize;
+        if (GetFileSizeEx(file, &fileSize) == 0) {
+            return;
+        }
+        if (fileSize.QuadPart == 0) {
+            opened = true;
+            return;
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr) {
+            return;
+        }
+        mapHandle = mapping;
+        auto* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (view == nullptr) {
+            return;
+        }
+        data = static_cast<const char*>(view);
+        size = static_cast<std::size_t>(fileSize.QuadPart);
+        opened = true;
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (data != nullptr) {
+            UnmapViewOfFile(data);
+        }
+        if (mapHandle != nullptr) {
+            CloseHandle(mapHandle);
+        }
+        if (fileHandle != nullptr) {
+            CloseHandle(fileHandle);
+        }
+    }
+#else
+    MappedFile::MappedFile(const std::string& filename)
+    {
+        fileDescriptor = ::open(filename.c_str(), O_RDONLY);  // NOLINT
+        if (fileDescriptor < 0) {
+            return;
+        }
+        struct stat fileStats {
+        };
+        if ((::fstat(fileDescriptor, &fileStats) != 0) || (!S_ISREG(fileStats.st_mode))) {
+            return;
+        }
+        if (fileStats.st_size == 0) {
+            opened = true;
+            return;
+        }
+        auto fileSize = static_cast<std::size_t>(fileStats.st_size);
+        void* view = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        if (view == MAP_FAILED) {  // NOLINT
+            return;
+        }
+        ::madvise(view, fileSize, MADV_SEQUENTIAL);
+        data = static_cast<const char*>(view);
+        size = fileSize;
+        opened = true;
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (data != nullptr) {
+            ::munmap(const_cast<char*>(data), size);  // NOLINT
+        }
+        if (fileDescriptor >= 0) {
+            ::close(fileDescriptor);
+        }
+    }
+#endif
+}  // namespace apps
+}  // namespace helics
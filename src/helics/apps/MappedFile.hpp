@@ -0,0 +1,43 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace helics {
+namespace apps {
+    /** read only memory mapped view of a file
+    @details the contents are paged in by the operating system as they are accessed so large files
+    can be read without loading them into memory*/
+    class MappedFile {
+      public:
+        MappedFile() = default;
+        /** map the specified file,  check isOpen() to see if the mapping succeeded*/
+        explicit MappedFile(const std::string& filename);
+        ~MappedFile();
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        /** check if the file was successfully mapped*/
+        bool isOpen() const { return opened; }
+        /** get a view of the entire file contents*/
+        std::string_view view() const { return {data, size}; }
+
+      private:
+        const char* data{nullptr};  //!< the start of the mapped region
+        std::size_t size{0};  //!< the size of the mapped region
+        bool opened{false};  //!< indicator that the file was opened
+#ifdef _WIN32
+        void* fileHandle{nullptr};  //!< the file handle
+        void* mapHandle{nullptr};  //!< the file mapping object handle
+#else
+        int fileDescriptor{-1};  //!< the open file descriptor
+#endif
+    };
+}  // namespace apps
+}  // namespace helics
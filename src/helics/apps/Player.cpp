@@ -8,21 +8,29 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "Player.hpp"
 
 #include "../common/JsonProcessingFunctions.hpp"
+#include "../core/core-exceptions.hpp"
 #include "../core/helicsCLI11.hpp"
 #include "../core/helicsVersion.hpp"
+#include "MappedFile.hpp"
 #include "PrecHelper.hpp"
 #include "gmlc/utilities/base64.h"
 #include "gmlc/utilities/stringOps.h"
 #include "gmlc/utilities/timeStringOps.hpp"
 
 #include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -59,6 +67,12 @@ namespace apps {
 
     Player::Player(int argc, char* argv[]): App("player", argc, argv) { processArgs(); }
 
+    Player::Player(Player&& other_player) = default;
+
+    Player& Player::operator=(Player&& fed) = default;
+
+    Player::~Player() = default;
+
     void Player::processArgs()
     {
         auto app = generateParser();
@@ -109,6 +123,17 @@ namespace apps {
                false)
             ->take_last()
             ->ignore_underscore();
+        app->add_flag(
+            "--stream",
+            streaming,
+            "stream text input files through a memory mapped file instead of loading them into "
+            "memory, files with more than 1024 sections out of time order are loaded completely "
+            "and JSON files over 64MB are rejected");
+        app->add_option(
+               "--stream_buffer",
+               streamBufferSize,
+               "the maximum number of points and messages to buffer ahead of the current time when streaming")
+            ->ignore_underscore();
 
         return app;
     }
@@ -166,7 +191,8 @@ namespace apps {
         messages.back().mess.time = actionTime;
     }
 
-    helics::Time Player::extractTime(const std::string& str, int lineNumber) const
+    /** extract a time from a string using the specified units*/
+    static helics::Time extractPlayerTime(const std::string& str, int lineNumber, time_units units)
     {
         try {
             if (units == time_units::ns)  // ns
@@ -181,10 +207,415 @@ namespace apps {
         }
     }
 
+    helics::Time Player::extractTime(const std::string& str, int lineNumber) const
+    {
+        return extractPlayerTime(str, lineNumber, units);
+    }
+
+    /** check if a line of a player text file is blank or part of a comment*/
+    static bool skipPlayerLine(const std::string& str, bool& mlineComment)
+    {
+        if (str.empty()) {
+            return true;
+        }
+        auto fc = str.find_first_not_of(" \t\n\r\0");
+        if (fc == std::string::npos) {
+            return true;
+        }
+        if (mlineComment) {
+            if (fc + 2 < str.size()) {
+                if ((str[fc] == '#') && (str[fc + 1] == '#') && (str[fc + 2] == ']')) {
+                    mlineComment = false;
+                }
+            }
+            return true;
+        }
+        if (str[fc] == '#') {
+            if (fc + 2 < str.size()) {
+                if ((str[fc + 1] == '#') && (str[fc + 2] == '[')) {
+                    mlineComment = true;
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+
+    /** parse a data line of a player text file into a point or a message
+    @param str the line to parse
+    @param lineNumber the line number used in error messages
+    @param units the default time units
+    @param previousKey the key of the preceding point (nullptr if there is none)
+    @param point the point to load
+    @param message the message to load
+    @return 'p' if a point was loaded, 'm' if a message was loaded, 0 otherwise
+    */
+    static char parsePlayerLine(std::string& str,
+                                int lineNumber,
+                                time_units units,
+                                const std::string* previousKey,
+                                ValueSetter& point,
+                                MessageHolder& message)
+    {
+        using namespace gmlc::utilities::stringOps;  // NOLINT
+        /* time key type value units*/
+        auto blk = splitlineBracket(str, ",\t ", default_bracket_chars, delimiter_compression::on);
+
+        trimString(blk[0]);
+        if ((blk[0].front() == 'm') || (blk[0].front() == 'M')) {
+            // deal with messages
+            switch (blk.size()) {
+                case 5:
+                    if ((message.sendTime = extractPlayerTime(blk[1], lineNumber, units)) ==
+                        Time::minVal()) {
+                        return 0;
+                    }
+
+                    message.mess.source = blk[2];
+                    message.mess.dest = blk[3];
+                    message.mess.time = message.sendTime;
+                    message.mess.data = decode(std::move(blk[4]));
+                    return 'm';
+                case 6:
+                    if ((message.sendTime = extractPlayerTime(blk[1], lineNumber, units)) ==
+                        Time::minVal()) {
+                        return 0;
+                    }
+
+                    message.mess.source = blk[3];
+                    message.mess.dest = blk[4];
+                    if ((message.mess.time = extractPlayerTime(blk[2], lineNumber, units)) ==
+                        Time::minVal()) {
+                        return 0;
+                    }
+                    message.mess.data = decode(std::move(blk[5]));
+                    return 'm';
+                default:
+                    std::cerr << "unknown message format line " << lineNumber << '\n';
+                    return 0;
+            }
+        }
+        if ((blk.size() < 2) || (blk.size() > 4)) {
+            std::cerr << "unknown publish format line " << lineNumber << '\n';
+            return 0;
+        }
+        auto cloc = blk[0].find_last_of(':');
+        if (cloc == std::string::npos) {
+            if ((point.time = extractPlayerTime(trim(blk[0]), lineNumber, units)) ==
+                Time::minVal()) {
+                return 0;
+            }
+        } else {
+            if ((point.time = extractPlayerTime(trim(blk[0]).substr(0, cloc), lineNumber, units)) ==
+                Time::minVal()) {
+                return 0;
+            }
+            point.iteration = std::stoi(blk[0].substr(cloc + 1));
+        }
+        if ((blk.size() == 2) || (blk[1].empty())) {
+            if (previousKey != nullptr) {
+                point.pubName = *previousKey;
+            } else if (blk.size() == 2) {
+                std::cerr
+                    << "lines without publication name but follow one with a publication line "
+                    << lineNumber << '\n';
+            }
+        } else {
+            point.pubName = blk[1];
+        }
+        if (blk.size() == 4) {
+            point.type = blk[2];
+        }
+        point.value = blk.back();
+        return 'p';
+    }
+
+    /** cursor parsing the points and messages of a section of a player text file in file order*/
+    class PlayerLineCursor {
+      public:
+        /** construct a cursor over the lines from start up to end of the file contents
+        @param startLine the number of lines preceding start*/
+        PlayerLineCursor(std::string_view contents,
+                         std::size_t start,
+                         std::size_t end,
+                         int startLine):
+            lineNumber(startLine),
+            text(contents.substr(0, end)), offset(start)
+        {
+        }
+        /** set the publication key used for lines without a key that precede any other key*/
+        void setPreviousKey(const std::string& key)
+        {
+            previousKey = key;
+            hasPrevious = true;
+        }
+        /** parse the next point or message
+        @return false if the end of the section was reached*/
+        bool next(time_units units);
+        /** get the time of the current entry*/
+        Time time() const { return (code == 'p') ? point.time : message.sendTime; }
+        /** get the iteration of the current entry*/
+        int iteration() const { return (code == 'p') ? point.iteration : 0; }
+
+        char code{0};  //!< the type of the current entry 'p' for a point 'm' for a message
+        int lineNumber{0};  //!< the line number of the current entry
+        std::size_t lineOffset{0};  //!< the offset of the start of the line of the current entry
+        ValueSetter point;  //!< the current point
+        MessageHolder message;  //!< the current message
+
+      private:
+        std::string_view text;  //!< the contents up to the end of the section
+        std::size_t offset{0};  //!< the offset of the next line
+        std::string str;  //!< buffer for the current line
+        std::string previousKey;  //!< the key of the last point
+        bool hasPrevious{false};  //!< indicator that previousKey is valid
+        bool mlineComment{false};  //!< indicator of being inside a multiline comment
+    };
+
+    bool PlayerLineCursor::next(time_units units)
+    {
+        while (offset < text.size()) {
+            lineOffset = offset;
+            auto lineEnd = text.find('\n', offset);
+            if (lineEnd == std::string_view::npos) {
+                lineEnd = text.size();
+            }
+            offset = lineEnd + 1;
+            ++lineNumber;
+            str.assign(text.substr(lineOffset, lineEnd - lineOffset));
+            if (skipPlayerLine(str, mlineComment)) {
+                continue;
+            }
+            point = ValueSetter{};
+            message = MessageHolder{};
+            code = parsePlayerLine(
+                str, lineNumber, units, hasPrevious ? &previousKey : nullptr, point, message);
+            if (code == 0) {
+                continue;
+            }
+            if (code == 'p') {
+                previousKey = point.pubName;
+                hasPrevious = true;
+            }
+            return true;
+        }
+        code = 0;
+        return false;
+    }
+
+    /** iterate over the points and messages in the contents of a player text file
+    @details the callback is called with the line number, the offset of the line, the result of
+    parsePlayerLine, and the parsed point and message; the iteration stops if it returns false*/
+    template<class Callback>
+    static void
+        forEachPlayerLine(std::string_view contents, time_units units, Callback&& callback)
+    {
+        PlayerLineCursor cursor(contents, 0, contents.size(), 0);
+        while (cursor.next(units)) {
+            if (!callback(cursor.lineNumber,
+                          cursor.lineOffset,
+                          cursor.code,
+                          cursor.point,
+                          cursor.message)) {
+                return;
+            }
+        }
+    }
+
+    /** the maximum number of time ordered sections a streamed player file can be merged from*/
+    static constexpr std::size_t maxPlayerStreamRuns{1024};
+    /** the largest JSON file accepted when streaming is enabled, JSON files are always loaded
+    completely*/
+    static constexpr std::uintmax_t maxPlayerStreamJsonSize{64U * 1024U * 1024U};
+
+    /** section of a streamed player file whose points and messages are in time order*/
+    struct PlayerStreamRun {
+        std::size_t start{0};  //!< the offset of the first line of the section
+        std::size_t end{0};  //!< the offset past the last line of the section
+        int lineNumber{0};  //!< the number of lines preceding the section
+        int key{-1};  //!< the index of the publication key in effect at the start of the section
+    };
+
+    /** block of points and messages parsed from a streamed player file*/
+    struct PlayerStreamBlock {
+        std::vector<ValueSetter> points;
+        std::vector<MessageHolder> messages;
+        std::size_t size() const { return points.size() + messages.size(); }
+    };
+
+    /** class containing the memory mapped file and the background parser for a streamed player
+    file
+    @details the parser runs ahead of the player filling a bounded queue of blocks of points and
+    messages in time order.  Files not in time order are merged from their time ordered sections so
+    memory use depends on the number of sections not the number of lines.  The buffered points carry
+    only the publication index, the key and type strings are interned into the publications when
+    the player is initialized*/
+    class PlayerStream {
+      public:
+        explicit PlayerStream(const std::string& filename): file(filename) {}
+        ~PlayerStream() { stop(); }
+        /** start the background parser*/
+        void start(time_units timeUnits, std::size_t bufferSize);
+        /** get the next block from the parser
+        @return false if the file is complete*/
+        bool getBlock(PlayerStreamBlock& block);
+        /** halt the background parser*/
+        void stop();
+
+        MappedFile file;  //!< the memory mapped file
+        std::vector<PlayerStreamRun> runs;  //!< the time ordered sections of the file
+        std::vector<std::string> keys;  //!< the publication keys referenced by the sections
+        std::map<std::string, int> pubIds;  //!< map of publication keys to publication index
+        std::map<std::string, int> eptIds;  //!< map of endpoint names to endpoint index
+
+      private:
+        /** the parser loop*/
+        void parse(time_units timeUnits, std::size_t blockSize);
+        /** add a block to the queue waiting for space if necessary
+        @return false if the parser has been halted*/
+        bool pushBlock(PlayerStreamBlock&& block);
+
+        static constexpr std::size_t maxBlocks{4};  //!< the maximum number of queued blocks
+        std::thread parser;  //!< the background parsing thread
+        std::mutex queueLock;  //!< lock protecting the block queue
+        std::condition_variable queueCondition;  //!< condition for the block queue
+        std::deque<PlayerStreamBlock> blocks;  //!< the parsed blocks
+        bool complete{false};  //!< indicator that the parser has reached the end of the file
+        bool halt{false};  //!< indicator that the parser should stop
+    };
+
+    void PlayerStream::start(time_units timeUnits, std::size_t bufferSize)
+    {
+        auto blockSize = std::max(bufferSize / maxBlocks, std::size_t{1});
+        parser = std::thread([this, timeUnits, blockSize]() { parse(timeUnits, blockSize); });
+    }
+
+    bool PlayerStream::getBlock(PlayerStreamBlock& block)
+    {
+        std::unique_lock<std::mutex> lock(queueLock);
+        queueCondition.wait(lock, [this]() { return (!blocks.empty()) || complete; });
+        if (blocks.empty()) {
+            return false;
+        }
+        block = std::move(blocks.front());
+        blocks.pop_front();
+        lock.unlock();
+        queueCondition.notify_all();
+        return true;
+    }
+
+    void PlayerStream::stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(queueLock);
+            halt = true;
+        }
+        queueCondition.notify_all();
+        if (parser.joinable()) {
+            parser.join();
+        }
+    }
+
+    bool PlayerStream::pushBlock(PlayerStreamBlock&& block)
+    {
+        std::unique_lock<std::mutex> lock(queueLock);
+        queueCondition.wait(lock, [this]() { return halt || (blocks.size() < maxBlocks); });
+        if (halt) {
+            return false;
+        }
+        blocks.push_back(std::move(block));
+        lock.unlock();
+        queueCondition.notify_all();
+        return true;
+    }
+
+    void PlayerStream::parse(time_units timeUnits, std::size_t blockSize)
+    {
+        PlayerStreamBlock block;
+        bool active = true;
+        auto addEntry = [this, &block, &active, blockSize](
+                            char code, ValueSetter& point, MessageHolder& message) {
+            if (code == 'p') {
+                auto fnd = pubIds.find(point.pubName);
+                if (fnd != pubIds.end()) {
+                    point.index = fnd->second;
+                    point.pubName.clear();
+                    point.type.clear();
+                    block.points.push_back(std::move(point));
+                }
+            } else if (code == 'm') {
+                auto fnd = eptIds.find(message.mess.source);
+                if (fnd != eptIds.end()) {
+                    message.index = fnd->second;
+                    block.messages.push_back(std::move(message));
+                }
+            }
+            if (block.size() >= blockSize) {
+                active = pushBlock(std::move(block));
+                block = PlayerStreamBlock{};
+            }
+            return active;
+        };
+        try {
+            auto contents = file.view();
+            std::vector<PlayerLineCursor> cursors;
+            cursors.reserve(runs.size());
+            for (const auto& run : runs) {
+                cursors.emplace_back(contents, run.start, run.end, run.lineNumber);
+                if (run.key >= 0) {
+                    cursors.back().setPreviousKey(keys[run.key]);
+                }
+            }
+            // merge the sections, ties go to the earlier section to preserve the file order
+            auto later = [&cursors](std::size_t c1, std::size_t c2) {
+                const auto& cur1 = cursors[c1];
+                const auto& cur2 = cursors[c2];
+                if (cur1.time() != cur2.time()) {
+                    return cur1.time() > cur2.time();
+                }
+                if (cur1.iteration() != cur2.iteration()) {
+                    return cur1.iteration() > cur2.iteration();
+                }
+                return c1 > c2;
+            };
+            std::vector<std::size_t> heap;
+            heap.reserve(cursors.size());
+            for (std::size_t ii = 0; ii < cursors.size(); ++ii) {
+                if (cursors[ii].next(timeUnits)) {
+                    heap.push_back(ii);
+                }
+            }
+            std::make_heap(heap.begin(), heap.end(), later);
+            while (!heap.empty()) {
+                std::pop_heap(heap.begin(), heap.end(), later);
+                auto& cursor = cursors[heap.back()];
+                if (!addEntry(cursor.code, cursor.point, cursor.message)) {
+                    break;
+                }
+                if (cursor.next(timeUnits)) {
+                    std::push_heap(heap.begin(), heap.end(), later);
+                } else {
+                    heap.pop_back();
+                }
+            }
+            if (active && (block.size() > 0)) {
+                pushBlock(std::move(block));
+            }
+        }
+        catch (const std::exception& e) {
+            std::cerr << "error parsing player stream: " << e.what() << '\n';
+        }
+        std::lock_guard<std::mutex> lock(queueLock);
+        complete = true;
+        queueCondition.notify_all();
+    }
+
     void Player::loadTextFile(const std::string& filename)
     {
         App::loadTextFile(filename);
-        using namespace gmlc::utilities::stringOps;  // NOLINT
+        if (streaming && !stream && prepareTextStream(filename)) {
+            return;
+        }
         std::ifstream infile(filename);
         std::string str;
 
@@ -193,29 +624,10 @@ namespace apps {
         bool mlineComment = false;
         // count the lines
         while (std::getline(infile, str)) {
-            if (str.empty()) {
+            if (skipPlayerLine(str, mlineComment)) {
                 continue;
             }
             auto fc = str.find_first_not_of(" \t\n\r\0");
-            if (fc == std::string::npos) {
-                continue;
-            }
-            if (mlineComment) {
-                if (fc + 2 < str.size()) {
-                    if ((str[fc] == '#') && (str[fc + 1] == '#') && (str[fc + 2] == ']')) {
-                        mlineComment = false;
-                    }
-                }
-                continue;
-            }
-            if (str[fc] == '#') {
-                if (fc + 2 < str.size()) {
-                    if ((str[fc + 1] == '#') && (str[fc + 2] == '[')) {
-                        mlineComment = true;
-                    }
-                }
-                continue;
-            }
             if ((str[fc] == 'm') || (str[fc] == 'M')) {
                 ++mcnt;
             } else {
@@ -230,162 +642,162 @@ namespace apps {
         infile.close();
         infile.open(filename);
 
+        mlineComment = false;
         int lcount = 0;
         while (std::getline(infile, str)) {
-            if (str.empty()) {
+            ++lcount;
+            if (skipPlayerLine(str, mlineComment)) {
                 continue;
             }
-            auto fc = str.find_first_not_of(" \t\n\r\0");
-            if (fc == std::string::npos) {
-                continue;
-            }
-            if (mlineComment) {
-                if (fc + 2 < str.size()) {
-                    if ((str[fc] == '#') && (str[fc + 1] == '#') && (str[fc + 2] == ']')) {
-                        mlineComment = false;
-                    }
-                }
-                continue;
-            }
-            if (str[fc] == '#') {
-                if (fc + 2 < str.size()) {
-                    if ((str[fc + 1] == '#') && (str[fc + 2] == '[')) {
-                        mlineComment = true;
-                    } else if (str[fc + 1] == '!') {
-                        /*  //allow configuration inside the regular text file
-
-
-
-
-
-
-                    if (playerConfig.find("time_units") != playerConfig.end())
-                    {
-                        if (playerConfig["time_units"] == "ns")
-                        {
-                            timeMultiplier = 1e-9;
-                        }
-                    }
-                    */
-                    }
-                }
-                continue;
+            ValueSetter point;
+            MessageHolder message;
+            const std::string* previousKey =
+                (pIndex > 0) ? &(points[static_cast<size_t>(pIndex) - 1].pubName) : nullptr;
+            switch (parsePlayerLine(str, lcount, units, previousKey, point, message)) {
+                case 'p':
+                    points[pIndex] = std::move(point);
+                    ++pIndex;
+                    break;
+                case 'm':
+                    messages[mIndex] = std::move(message);
+                    ++mIndex;
+                    break;
+                default:
+                    break;
             }
-            /* time key type value units*/
-            auto blk =
-                splitlineBracket(str, ",\t ", default_bracket_chars, delimiter_compression::on);
-
-            trimString(blk[0]);
-            if ((blk[0].front() == 'm') || (blk[0].front() == 'M')) {
-                // deal with messages
-                switch (blk.size()) {
-                    case 5:
-                        if ((messages[mIndex].sendTime = extractTime(blk[1], lcount)) ==
-                            Time::minVal()) {
-                            continue;
-                        }
+        }
+        // drop the entries from any invalid lines
+        points.resize(pIndex);
+        messages.resize(mIndex);
+    }
 
-                        messages[mIndex].mess.source = blk[2];
-                        messages[mIndex].mess.dest = blk[3];
-                        messages[mIndex].mess.time = messages[mIndex].sendTime;
-                        messages[mIndex].mess.data = decode(std::move(blk[4]));
-                        break;
-                    case 6:
-                        if ((messages[mIndex].sendTime = extractTime(blk[1], lcount)) ==
-                            Time::minVal()) {
-                            continue;
-                        }
+    bool Player::prepareTextStream(const std::string& filename)
+    {
+        auto newStream = std::make_unique<PlayerStream>(filename);
+        if (!newStream->file.isOpen()) {
+            return false;
+        }
+        auto contents = newStream->file.view();
+        auto& runs = newStream->runs;
+        auto& keys = newStream->keys;
+        std::map<std::string, int> keyIds;
+        std::string lastKey;
+        bool hasKey = false;
+        bool tooManyRuns = false;
+        Time lastTime = Time::minVal();
+        int lastIteration = 0;
+        std::size_t pointTotal = 0;
+        std::size_t messageTotal = 0;
+        runs.emplace_back();
+        // scan the file to find the publications and endpoints and split it into time ordered
+        // sections
+        forEachPlayerLine(contents,
+                          units,
+                          [&](int lineNumber,
+                              std::size_t offset,
+                              char code,
+                              ValueSetter& point,
+                              MessageHolder& message) {
+                              Time lineTime = message.sendTime;
+                              int lineIteration = 0;
+                              if (code == 'p') {
+                                  lineTime = point.time;
+                                  lineIteration = point.iteration;
+                              }
+                              if ((lineTime < lastTime) ||
+                                  ((lineTime == lastTime) && (lineIteration < lastIteration))) {
+                                  if (runs.size() >= maxPlayerStreamRuns) {
+                                      tooManyRuns = true;
+                                      return false;
+                                  }
+                                  runs.back().end = offset;
+                                  PlayerStreamRun run;
+                                  run.start = offset;
+                                  run.lineNumber = lineNumber - 1;
+                                  if (hasKey) {
+                                      auto fnd = keyIds.find(lastKey);
+                                      if (fnd == keyIds.end()) {
+                                          fnd = keyIds
+                                                    .emplace(lastKey,
+                                                             static_cast<int>(keys.size()))
+                                                    .first;
+                                          keys.push_back(lastKey);
+                                      }
+                                      run.key = fnd->second;
+                                  }
+                                  runs.push_back(run);
+                              }
+                              if (code == 'p') {
+                                  auto fnd = tags.find(point.pubName);
+                                  if (fnd == tags.end()) {
+                                      tags.emplace(point.pubName, point.type);
+                                  } else if (fnd->second.empty()) {
+                                      fnd->second = point.type;
+                                  }
+                                  lastKey = point.pubName;
+                                  hasKey = true;
+                                  ++pointTotal;
+                              } else {
+                                  epts.emplace(message.mess.source);
+                                  ++messageTotal;
+                              }
+                              lastTime = lineTime;
+                              lastIteration = lineIteration;
+                              return true;
+                          });
+        if (tooManyRuns) {
+            std::cerr << filename << " has more than " << maxPlayerStreamRuns
+                      << " sections out of time order and will be loaded without streaming\n";
+            return false;
+        }
+        runs.back().end = contents.size();
+        streamPointCount = pointTotal;
+        streamMessageCount = messageTotal;
+        stream = std::move(newStream);
+        return true;
+    }
 
-                        messages[mIndex].mess.source = blk[3];
-                        messages[mIndex].mess.dest = blk[4];
-                        if ((messages[mIndex].mess.time = extractTime(blk[2], lcount)) ==
-                            Time::minVal()) {
-                            continue;
-                        }
-                        messages[mIndex].mess.data = decode(std::move(blk[5]));
-                        break;
-                    default:
-                        std::cerr << "unknown message format line " << lcount << '\n';
-                        break;
-                }
-                ++mIndex;
-            } else {
-                if (blk.size() == 2) {
-                    auto cloc = blk[0].find_last_of(':');
-                    if (cloc == std::string::npos) {
-                        if ((points[pIndex].time = extractTime(trim(blk[0]), lcount)) ==
-                            Time::minVal()) {
-                            continue;
-                        }
-                    } else {
-                        if ((points[pIndex].time = extractTime(trim(blk[0]).substr(0, cloc),
-                                                               lcount)) == Time::minVal()) {
-                            continue;
-                        }
-                        points[pIndex].iteration = std::stoi(blk[0].substr(cloc + 1));
-                    }
-                    if (pIndex > 0) {
-                        points[pIndex].pubName = points[static_cast<size_t>(pIndex) - 1].pubName;
-                    } else {
-                        std::cerr
-                            << "lines without publication name but follow one with a publication line "
-                            << lcount << '\n';
-                    }
-                    points[pIndex].value = blk[1];
-                    ++pIndex;
-                } else if (blk.size() == 3) {
-                    auto cloc = blk[0].find_last_of(':');
-                    if (cloc == std::string::npos) {
-                        if ((points[pIndex].time = extractTime(trim(blk[0]), lcount)) ==
-                            Time::minVal()) {
-                            continue;
-                        }
-                    } else {
-                        if ((points[pIndex].time = extractTime(trim(blk[0]).substr(0, cloc),
-                                                               lcount)) == Time::minVal()) {
-                            continue;
-                        }
-                        points[pIndex].iteration = std::stoi(blk[0].substr(cloc + 1));
-                    }
-                    if ((blk[1].empty()) && (pIndex > 0)) {
-                        points[pIndex].pubName = points[static_cast<size_t>(pIndex) - 1].pubName;
-                    } else {
-                        points[pIndex].pubName = blk[1];
-                    }
+    void Player::startStream()
+    {
+        if (!stream) {
+            return;
+        }
+        stream->pubIds = pubids;
+        stream->eptIds = eptids;
+        stream->start(units, streamBufferSize);
+    }
 
-                    points[pIndex].value = blk[2];
-                    ++pIndex;
-                } else if (blk.size() == 4) {
-                    auto cloc = blk[0].find_last_of(':');
-                    if (cloc == std::string::npos) {
-                        if ((points[pIndex].time = extractTime(trim(blk[0]), lcount)) ==
-                            Time::minVal()) {
-                            continue;
-                        }
-                    } else {
-                        if ((points[pIndex].time = extractTime(trim(blk[0]).substr(0, cloc),
-                                                               lcount)) == Time::minVal()) {
-                            continue;
-                        }
-                        points[pIndex].iteration = std::stoi(blk[0].substr(cloc + 1));
-                    }
-                    if ((blk[1].empty()) && (pIndex > 0)) {
-                        points[pIndex].pubName = points[static_cast<size_t>(pIndex) - 1].pubName;
-                    } else {
-                        points[pIndex].pubName = blk[1];
-                    }
-                    points[pIndex].type = blk[2];
-                    points[pIndex].value = blk[3];
-                    ++pIndex;
-                } else {
-                    std::cerr << "unknown publish format line " << lcount << '\n';
-                }
-            }
+    bool Player::loadStreamBlock()
+    {
+        if (!stream) {
+            return false;
+        }
+        PlayerStreamBlock block;
+        if (!stream->getBlock(block)) {
+            return false;
         }
+        points = std::move(block.points);
+        messages = std::move(block.messages);
+        pointIndex = 0;
+        messageIndex = 0;
+        return true;
     }
 
     void Player::loadJsonFile(const std::string& jsonString)
     {
+        if (streaming) {
+            // JSON files are loaded completely so the size must be bounded when streaming
+            std::ifstream jsonFile(jsonString, std::ios::binary | std::ios::ate);
+            if (jsonFile.is_open()) {
+                auto fileSize = static_cast<std::streamoff>(jsonFile.tellg());
+                if ((fileSize > 0) &&
+                    (static_cast<std::uintmax_t>(fileSize) > maxPlayerStreamJsonSize)) {
+                    throw(InvalidParameter(
+                        jsonString +
+                        " is too large to load with streaming enabled, use a text player file"));
+                }
+            }
+        }
         loadJsonFileConfiguration("player", jsonString);
 
         auto pubCount = fed->getPublicationCount();
@@ -623,6 +1035,7 @@ namespace apps {
             generatePublications();
             generateEndpoints();
             cleanUpPointList();
+            startStream();
             fed->enterInitializingMode();
         }
     }
@@ -657,6 +1070,11 @@ namespace apps {
                 }
             }
         }
+        if (!isValidIndex(pointIndex, points) && !isValidIndex(messageIndex, messages) &&
+            loadStreamBlock()) {
+            // the next block of a streamed file can contain more information for the same time
+            sendInformation(sendTime, iteration);
+        }
     }
 
     void Player::runTo(Time stopTime_input)
@@ -673,22 +1091,25 @@ namespace apps {
             sendInformation(timeZero);
         } else {
             auto ctime = fed->getCurrentTime();
-            if (isValidIndex(pointIndex, points)) {
-                while (points[pointIndex].time <= ctime) {
-                    ++pointIndex;
-                    if (pointIndex >= points.size()) {
-                        break;
+            do {
+                if (isValidIndex(pointIndex, points)) {
+                    while (points[pointIndex].time <= ctime) {
+                        ++pointIndex;
+                        if (pointIndex >= points.size()) {
+                            break;
+                        }
                     }
                 }
-            }
-            if (isValidIndex(messageIndex, messages)) {
-                while (messages[messageIndex].sendTime <= ctime) {
-                    ++messageIndex;
-                    if (messageIndex >= messages.size()) {
-                        break;
+                if (isValidIndex(messageIndex, messages)) {
+                    while (messages[messageIndex].sendTime <= ctime) {
+                        ++messageIndex;
+                        if (messageIndex >= messages.size()) {
+                            break;
+                        }
                     }
                 }
-            }
+            } while (!isValidIndex(pointIndex, points) && !isValidIndex(messageIndex, messages) &&
+                     loadStreamBlock());
         }
 
         Time nextPrintTime = (nextPrintTimeStep > timeZero) ? nextPrintTimeStep : Time::maxVal();
@@ -697,6 +1118,9 @@ namespace apps {
         int nextIteration = 0;
         int currentIteration = 0;
         while (moreToSend) {
+            if (!isValidIndex(pointIndex, points) && !isValidIndex(messageIndex, messages)) {
+                loadStreamBlock();
+            }
             nextSendTime = Time::maxVal();
             if (isValidIndex(pointIndex, points)) {
                 nextSendTime = std::min(nextSendTime, points[pointIndex].time);
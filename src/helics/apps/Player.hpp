@@ -34,6 +34,8 @@ namespace apps {
         Message mess;
     };
 
+    class PlayerStream;
+
     /** class implementing a Player object, which is capable of reading a file and generating
 interfaces and sending signals at the appropriate times
 @details  the Player class is not thread-safe,  don't try to use it from multiple threads without
@@ -77,9 +79,11 @@ external protection, that will result in undefined behavior
         Player(const std::string& appName, const std::string& configString);
 
         /** move construction*/
-        Player(Player&& other_player) = default;
+        Player(Player&& other_player);
         /** move assignment*/
-        Player& operator=(Player&& fed) = default;
+        Player& operator=(Player&& fed);
+        /** destructor*/
+        ~Player();
 
         /** initialize the Player federate
     @details generate all the publications and organize the points, the final publication count will
@@ -181,10 +185,31 @@ external protection, that will result in undefined behavior
                         const std::string& dest,
                         const std::string& payload);
 
+        /** enable streaming of text input files
+    @details when enabled text files are memory mapped and parsed by a background thread a block at
+    a time as the Player advances,  rather than loaded into memory in their entirety, so the memory
+    use is bounded by the buffer size regardless of the number of lines.  Files not in time order
+    are merged from their time ordered sections; files with more than 1024 such sections are loaded
+    completely with a warning.  Must be set before the file is loaded and should not be combined
+    with points or messages added directly. JSON files are always loaded completely so JSON files
+    larger than 64MB are rejected with an InvalidParameter exception when streaming is enabled
+    @param stream set to true to enable streaming
+    @param bufferSize the maximum number of points and messages to buffer ahead of the current time
+    */
+        void setStreaming(bool stream = true, std::size_t bufferSize = 65536)
+        {
+            streaming = stream;
+            streamBufferSize = bufferSize;
+        }
+        /** check if the loaded text file is streamed*/
+        bool isStreamed() const { return static_cast<bool>(stream); }
         /** get the number of points loaded*/
-        auto pointCount() const { return points.size(); }
+        auto pointCount() const { return (streamPointCount > 0) ? streamPointCount : points.size(); }
         /** get the number of messages loaded*/
-        auto messageCount() const { return messages.size(); }
+        auto messageCount() const
+        {
+            return (streamMessageCount > 0) ? streamMessageCount : messages.size();
+        }
         /** get the number of publications */
         auto publicationCount() const { return publications.size(); }
         /** get the number of endpoints*/
@@ -204,6 +229,14 @@ external protection, that will result in undefined behavior
         virtual void loadJsonFile(const std::string& jsonString) override;
         /** load a text file*/
         virtual void loadTextFile(const std::string& filename) override;
+        /** scan a text file and set it up for streaming
+        @return true if the file is set up to stream,  false if it could not be mapped*/
+        bool prepareTextStream(const std::string& filename);
+        /** start the background parser of a streamed file*/
+        void startStream();
+        /** load the next block of points and messages from a streamed file
+        @return true if a new block was loaded*/
+        bool loadStreamBlock();
         /** helper function to sort through the tags*/
         void sortTags();
         /** helper function to generate the publications*/
@@ -240,6 +273,11 @@ external protection, that will result in undefined behavior
             1.0;  //!< specify the time multiplier for different time specifications
         Time nextPrintTimeStep =
             helics::timeZero;  //!< the time advancement period for printing markers
+        bool streaming{false};  //!< indicator that text files should be streamed
+        std::size_t streamBufferSize{65536};  //!< the number of entries to buffer from a stream
+        std::size_t streamPointCount{0};  //!< the number of points in a streamed file
+        std::size_t streamMessageCount{0};  //!< the number of messages in a streamed file
+        std::unique_ptr<PlayerStream> stream;  //!< the state of a streamed file
     };
 }  // namespace apps
 }  // namespace helics
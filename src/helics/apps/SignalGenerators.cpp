@@ -30,13 +30,26 @@ namespace apps {
         }
     }
 
-    defV RampGenerator::generate(Time signalTime)
+    double RampGenerator::value(Time signalTime)
     {
         double newVal = level + ramp * (signalTime - keyTime);
         lastTime = signalTime;
         return newVal;
     }
 
+    defV RampGenerator::generate(Time signalTime) { return value(signalTime); }
+
+    bool RampGenerator::generateBlock(SignalGenerator* const* block,
+                                      std::size_t count,
+                                      Time signalTime,
+                                      double* values)
+    {
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            values[ii] = static_cast<RampGenerator*>(block[ii])->value(signalTime);
+        }
+        return true;
+    }
+
     void SineGenerator::set(const std::string& parameter, double val)
     {
         if ((parameter == "frequency") || (parameter == "freq") || (parameter == "f")) {
@@ -58,15 +71,20 @@ namespace apps {
         }
     }
 
-    defV SineGenerator::generate(Time signalTime)
+    double SineGenerator::advance(Time signalTime)
     {
         auto dt = signalTime - lastTime;
         auto tdiff = signalTime - lastCycle;
         // account for the frequency shift
         frequency += dfdt * dt;
         amplitude += dAdt * dt;
-        // compute the sine wave component
-        double newValue = level + amplitude * sin(2.0 * pi * (frequency * tdiff) + offset);
+        return 2.0 * pi * (frequency * tdiff) + offset;
+    }
+
+    double SineGenerator::finish(Time signalTime, double sineValue)
+    {
+        auto tdiff = signalTime - lastCycle;
+        double newValue = level + amplitude * sineValue;
         period = (frequency > 0.0) ? 1.0 / frequency : 1e36;
         while (tdiff > period) {
             tdiff -= period;
@@ -76,6 +94,29 @@ namespace apps {
         return newValue;
     }
 
+    defV SineGenerator::generate(Time signalTime)
+    {
+        // compute the sine wave component
+        return finish(signalTime, sin(advance(signalTime)));
+    }
+
+    bool SineGenerator::generateBlock(SignalGenerator* const* block,
+                                      std::size_t count,
+                                      Time signalTime,
+                                      double* values)
+    {
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            values[ii] = static_cast<SineGenerator*>(block[ii])->advance(signalTime);
+        }
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            values[ii] = std::sin(values[ii]);
+        }
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            values[ii] = static_cast<SineGenerator*>(block[ii])->finish(signalTime, values[ii]);
+        }
+        return true;
+    }
+
     void PhasorGenerator::set(const std::string& parameter, double val)
     {
         if ((parameter == "frequency") || (parameter == "freq") || (parameter == "f")) {
@@ -118,16 +159,49 @@ namespace apps {
         }
     }
 
-    defV PhasorGenerator::generate(Time signalTime)
+    double PhasorGenerator::advance(Time signalTime)
     {
         auto dt = signalTime - lastTime;
 
         frequency += dfdt * dt;
         amplitude += dAdt * dt;
-        rotation = std::polar(1.0, frequency * dt * (2.0 * pi));
-        state *= rotation;
         lastTime = signalTime;
+        return frequency * dt * (2.0 * pi);
+    }
+
+    std::complex<double> PhasorGenerator::rotate(std::complex<double> rotationValue)
+    {
+        rotation = rotationValue;
+        state *= rotation;
         return amplitude * state + std::complex<double>(bias_real, bias_imag);
     }
+
+    defV PhasorGenerator::generate(Time signalTime)
+    {
+        return rotate(std::polar(1.0, advance(signalTime)));
+    }
+
+    bool PhasorGenerator::generateBlock(SignalGenerator* const* block,
+                                        std::size_t count,
+                                        Time signalTime,
+                                        double* values)
+    {
+        // the values are stored as interleaved real and imaginary parts
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            values[2 * ii] = static_cast<PhasorGenerator*>(block[ii])->advance(signalTime);
+        }
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            auto angle = values[2 * ii];
+            values[2 * ii] = std::cos(angle);
+            values[2 * ii + 1] = std::sin(angle);
+        }
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            auto result = static_cast<PhasorGenerator*>(block[ii])->rotate(
+                std::complex<double>(values[2 * ii], values[2 * ii + 1]));
+            values[2 * ii] = result.real();
+            values[2 * ii + 1] = result.imag();
+        }
+        return true;
+    }
 }  // namespace apps
 }  // namespace helics
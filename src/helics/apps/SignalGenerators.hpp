@@ -13,6 +13,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "Source.hpp"
 
 #include <complex>
+#include <cstddef>
 #include <string>
 
 namespace helics {
@@ -27,6 +28,14 @@ namespace apps {
         virtual void set(const std::string& parameter, double val) override;
 
         virtual defV generate(Time signalTime) override;
+        virtual bool generateBlock(SignalGenerator* const* block,
+                                   std::size_t count,
+                                   Time signalTime,
+                                   double* values) override;
+
+      private:
+        /** compute the ramp value at signalTime and update the last time*/
+        double value(Time signalTime);
     };
 
     /** generate a sinusoidal signal*/
@@ -45,6 +54,17 @@ namespace apps {
         virtual void set(const std::string& parameter, double val) override;
 
         virtual defV generate(Time signalTime) override;
+        virtual bool generateBlock(SignalGenerator* const* block,
+                                   std::size_t count,
+                                   Time signalTime,
+                                   double* values) override;
+
+      private:
+        /** update the frequency and amplitude to signalTime
+        @return the phase angle of the sinusoid*/
+        double advance(Time signalTime);
+        /** complete a generation step from the sine of the phase angle*/
+        double finish(Time signalTime, double sineValue);
     };
 
     /** generate a rotating phasor
@@ -68,6 +88,18 @@ namespace apps {
         void set(const std::string& parameter, std::complex<double> val);
         virtual void setString(const std::string& parameter, const std::string& val) override;
         virtual defV generate(Time signalTime) override;
+        virtual bool generateBlock(SignalGenerator* const* block,
+                                   std::size_t count,
+                                   Time signalTime,
+                                   double* values) override;
+        virtual int blockWidth() const override { return 2; }
+
+      private:
+        /** update the frequency and amplitude to signalTime
+        @return the rotation angle of the phasor*/
+        double advance(Time signalTime);
+        /** apply a rotation to the phasor and return the output value*/
+        std::complex<double> rotate(std::complex<double> rotationValue);
     };
 }  // namespace apps
 }  // namespace helics
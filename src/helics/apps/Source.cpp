@@ -15,6 +15,8 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "gmlc/utilities/stringOps.h"
 
 #include <algorithm>
+#include <cmath>
+#include <complex>
 #include <fstream>
 #include <iostream>
 #include <map>
@@ -22,6 +24,8 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <typeindex>
+#include <typeinfo>
 #include <utility>
 #include <vector>
 
@@ -31,6 +35,14 @@ namespace apps {
     /** set a string parameter*/
     void SignalGenerator::setString(const std::string& /*parameter*/, const std::string& /*val*/) {}
 
+    bool SignalGenerator::generateBlock(SignalGenerator* const* /*block*/,
+                                        std::size_t /*count*/,
+                                        Time /*signalTime*/,
+                                        double* /*values*/)
+    {
+        return false;
+    }
+
     Source::Source(int argc, char* argv[]): App("source", argc, argv) { processArgs(); }
 
     Source::Source(std::vector<std::string> args): App("source", std::move(args)) { processArgs(); }
@@ -39,6 +51,10 @@ namespace apps {
     {
         helicsCLI11App app("Options specific to the Source App");
         app.add_option("--default_period", defaultPeriod, "the default period publications");
+        app.add_flag("--block_generation",
+                     blockGeneration,
+                     "generate the values for generators of the same type in blocks")
+            ->ignore_underscore();
         if (!deactivated) {
             fed->setFlagOption(HELICS_FLAG_SOURCE_ONLY);
             app.parse(remArgs);
@@ -350,6 +366,16 @@ namespace apps {
         sources[fnd->second].generatorIndex = genIndex;
     }
 
+    /** advance the next publication time of a source past the current time*/
+    static void advanceSourceTime(SourceObject& obj, Time currentTime)
+    {
+        obj.nextTime += obj.period;
+        if (obj.nextTime < currentTime) {
+            auto periods = std::floor((currentTime - obj.nextTime) / obj.period);
+            obj.nextTime += periods * obj.period + obj.period;
+        }
+    }
+
     Time Source::runSource(SourceObject& obj, Time currentTime)
     {
         if (currentTime >= obj.nextTime) {
@@ -358,11 +384,7 @@ namespace apps {
             }
             auto val = generators[obj.generatorIndex]->generate(currentTime);
             obj.pub.publish(val);
-            obj.nextTime += obj.period;
-            if (obj.nextTime < currentTime) {
-                auto periods = std::floor((currentTime - obj.nextTime) / obj.period);
-                obj.nextTime += periods * obj.period + obj.period;
-            }
+            advanceSourceTime(obj, currentTime);
         }
         return obj.nextTime;
     }
@@ -378,6 +400,9 @@ namespace apps {
             }
             return timeZero;
         }
+        if (blockGeneration) {
+            return runSourceBlocks(currentTime);
+        }
         Time minTime = Time::maxVal();
         for (auto& src : sources) {
             auto tm = runSource(src, currentTime);
@@ -388,5 +413,93 @@ namespace apps {
         return minTime;
     }
 
+    void Source::groupGenerators()
+    {
+        generatorGroups.clear();
+        std::map<std::type_index, std::size_t> groupLookup;
+        for (int ii = 0; ii < static_cast<int>(generators.size()); ++ii) {
+            const auto& gen = *generators[ii];
+            auto res = groupLookup.emplace(std::type_index(typeid(gen)), generatorGroups.size());
+            if (res.second) {
+                generatorGroups.emplace_back();
+            }
+            generatorGroups[res.first->second].push_back(ii);
+        }
+        groupedGeneratorCount = generators.size();
+        generatorDue.assign(generators.size(), 0);
+        generatorValueIndex.assign(generators.size(), 0);
+        generatorWidth.assign(generators.size(), 0);
+    }
+
+    Time Source::runSourceBlocks(Time currentTime)
+    {
+        if (groupedGeneratorCount != generators.size()) {
+            groupGenerators();
+        }
+        // find the generators needed for this time step, each is evaluated once even if it
+        // feeds several publications
+        std::fill(generatorDue.begin(), generatorDue.end(), 0);
+        for (auto& src : sources) {
+            if ((currentTime >= src.nextTime) &&
+                (src.generatorIndex < static_cast<int>(generators.size()))) {
+                generatorDue[src.generatorIndex] = 1;
+            }
+        }
+        blockValues.clear();
+        for (auto& group : generatorGroups) {
+            blockGenerators.clear();
+            for (auto genIndex : group) {
+                if (generatorDue[genIndex] != 0) {
+                    blockGenerators.push_back(generators[genIndex].get());
+                }
+            }
+            if (blockGenerators.empty()) {
+                continue;
+            }
+            auto width = blockGenerators.front()->blockWidth();
+            auto start = blockValues.size();
+            blockValues.resize(start + blockGenerators.size() * width);
+            if (!blockGenerators.front()->generateBlock(blockGenerators.data(),
+                                                         blockGenerators.size(),
+                                                         currentTime,
+                                                         blockValues.data() + start)) {
+                // not supported by the generator so fall back to generating for each source
+                blockValues.resize(start);
+                width = 0;
+            }
+            auto index = start;
+            for (auto genIndex : group) {
+                if (generatorDue[genIndex] != 0) {
+                    generatorValueIndex[genIndex] = index;
+                    generatorWidth[genIndex] = width;
+                    index += width;
+                }
+            }
+        }
+
+        Time minTime = Time::maxVal();
+        for (auto& src : sources) {
+            Time tm;
+            if ((currentTime >= src.nextTime) &&
+                (src.generatorIndex < static_cast<int>(generators.size())) &&
+                (generatorWidth[src.generatorIndex] > 0)) {
+                const double* vals = blockValues.data() + generatorValueIndex[src.generatorIndex];
+                if (generatorWidth[src.generatorIndex] == 1) {
+                    src.pub.publish(vals[0]);
+                } else {
+                    src.pub.publish(std::complex<double>(vals[0], vals[1]));
+                }
+                advanceSourceTime(src, currentTime);
+                tm = src.nextTime;
+            } else {
+                tm = runSource(src, currentTime);
+            }
+            if (tm < minTime) {
+                minTime = tm;
+            }
+        }
+        return minTime;
+    }
+
 }  // namespace apps
 }  // namespace helics
@@ -48,6 +48,23 @@ namespace apps {
         /** generate a new value at time signalTime
     @return a value and a defV object*/
         virtual defV generate(Time signalTime) = 0;
+        /** generate new values at time signalTime for a block of generators of the same type as
+    this one
+    @details the values are written contiguously to values, blockWidth() entries per generator.
+    The built in generators evaluate each generator of the block in turn with scalar math, the
+    block call only saves the per value virtual call and defV conversion
+    @param block pointer to an array of generators of the same type as this generator
+    @param count the number of generators in the block
+    @param signalTime the time to generate the values for
+    @param values pointer to an array of at least count*blockWidth() values
+    @return false if the generator does not support block generation*/
+        virtual bool generateBlock(SignalGenerator* const* block,
+                                   std::size_t count,
+                                   Time signalTime,
+                                   double* values);
+        /** get the number of values generated per generator in a block, 1 for real signals and 2
+         * for complex signals*/
+        virtual int blockWidth() const { return 1; }
         /** set the key time*/
         void setTime(Time indexTime) { keyTime = indexTime; }
     };
@@ -150,6 +167,11 @@ external protection, that will result in undefined behavior
         void linkPublicationToGenerator(const std::string& key, int genIndex);
         /** get a pointer to the signal generator*/
         std::shared_ptr<SignalGenerator> getGenerator(int index);
+        /** enable or disable block generation
+    @details when enabled the generators of the same type are evaluated together for all the
+    publications due at a time step,  otherwise each publication is generated individually.  Block
+    generation is disabled by default*/
+        void setBlockGeneration(bool enabled = true) { blockGeneration = enabled; }
 
       private:
         /** process remaining command line arguments*/
@@ -162,6 +184,10 @@ external protection, that will result in undefined behavior
         Time runSource(SourceObject& obj, Time currentTime);
         /** execute all the sources*/
         Time runSourceLoop(Time currentTime);
+        /** execute all the sources generating the values for each generator type in blocks*/
+        Time runSourceBlocks(Time currentTime);
+        /** group the generators by type for block generation*/
+        void groupGenerators();
 
       private:
         std::vector<SourceObject> sources;  //!< the actual publication objects
@@ -170,6 +196,14 @@ external protection, that will result in undefined behavior
         std::vector<Endpoint> endpoints;  //!< the actual endpoint objects
         std::map<std::string, int> pubids;  //!< publication id map
         Time defaultPeriod = 1.0;  //!< the default period of publication
+        bool blockGeneration{false};  //!< generate the values in blocks by generator type
+        std::vector<std::vector<int>> generatorGroups;  //!< generator indices grouped by type
+        std::size_t groupedGeneratorCount{0};  //!< the number of generators that are grouped
+        std::vector<char> generatorDue;  //!< indicator that a generator is used in a time step
+        std::vector<std::size_t> generatorValueIndex;  //!< location of generator block values
+        std::vector<int> generatorWidth;  //!< the number of block values for each generator
+        std::vector<SignalGenerator*> blockGenerators;  //!< buffer for the generators in a block
+        std::vector<double> blockValues;  //!< buffer for the block generated values
     };
 }  // namespace apps
 }  // namespace helics
@@ -15,6 +15,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../common/fmt_format.h"
 #include "../core/helicsCLI11.hpp"
 #include "../core/helicsVersion.hpp"
+#include "CapturePipeline.hpp"
 #include "PrecHelper.hpp"
 #include "gmlc/utilities/stringOps.h"
 
@@ -207,6 +208,21 @@ namespace apps {
         auto state = fed->getCurrentMode();
         if (state == Federate::Modes::STARTUP) {
             generateInterfaces();
+            if (asyncCapture) {
+                captureTargets.clear();
+                for (auto& sub : subscriptions) {
+                    captureTargets.push_back(sub.getTarget());
+                }
+                captureEndpoints.clear();
+                for (auto& ept : endpoints) {
+                    captureEndpoints.push_back(ept.getName());
+                }
+                captureTypes.assign(subscriptions.size(), DataType::HELICS_UNKNOWN);
+                pipeline = std::make_unique<CapturePipeline>(
+                    captureBufferSize,
+                    [this](CaptureRecord& record) { processCaptureRecord(record); },
+                    dropCaptureWhenFull);
+            }
 
             fed->enterInitializingMode();
             captureForCurrentTime(-1.0);
@@ -241,108 +257,189 @@ namespace apps {
 
     void Tracer::captureForCurrentTime(Time currentTime, int iteration)
     {
-        for (auto& sub : subscriptions) {
-            if (sub.isUpdated()) {
-                auto val = sub.getValue<std::string>();
-
-                if (printMessage) {
-                    std::string valstr;
-                    if (val.size() < 150) {
-                        if (iteration > 0) {
-                            valstr = fmt::format(
-                                "[{}:{}]value {}={}", currentTime, iteration, sub.getTarget(), val);
-                        } else {
-                            valstr =
-                                fmt::format("[{}]value {}={}", currentTime, sub.getTarget(), val);
-                        }
-                    } else {
-                        if (iteration > 0) {
-                            valstr = fmt::format("[{}:{}]value {}=block[{}]",
-                                                 currentTime,
-                                                 iteration,
-                                                 sub.getTarget(),
-                                                 val.size());
-                        } else {
-                            valstr = fmt::format("[{}]value {}=block[{}]",
-                                                 currentTime,
-                                                 sub.getTarget(),
-                                                 val.size());
-                        }
-                    }
-                    if (skiplog) {
-                        std::cout << valstr << '\n';
-                    } else {
-                        spdlog::info(valstr);
+        if (pipeline) {
+            // only copy the raw data here, the writer thread does the rest
+            int index = 0;
+            for (auto& sub : subscriptions) {
+                if (sub.isUpdated()) {
+                    if (captureTypes[index] == DataType::HELICS_UNKNOWN) {
+                        captureTypes[index] = getTypeFromString(sub.getPublicationType());
                     }
+                    auto raw = sub.getBytes();
+                    CaptureRecord record;
+                    record.time = currentTime;
+                    record.index = index;
+                    record.iteration = iteration;
+                    record.type = captureTypes[index];
+                    record.payload = SmallBuffer(raw.data(), raw.size());
+                    pipeline->push(std::move(record));
                 }
-                if (valueCallback) {
-                    valueCallback(currentTime, sub.getTarget(), val);
+                ++index;
+            }
+            index = 0;
+            for (auto& ept : endpoints) {
+                while (ept.hasMessage()) {
+                    CaptureRecord record;
+                    record.time = currentTime;
+                    record.index = index;
+                    record.message = ept.getMessage();
+                    pipeline->push(std::move(record));
                 }
+                ++index;
+            }
+            if (cloneEndpoint) {
+                while (cloneEndpoint->hasMessage()) {
+                    CaptureRecord record;
+                    record.time = currentTime;
+                    record.message = cloneEndpoint->getMessage();
+                    pipeline->push(std::move(record));
+                }
+            }
+            return;
+        }
+        for (auto& sub : subscriptions) {
+            if (sub.isUpdated()) {
+                auto val = sub.getValue<std::string>();
+                processValue(currentTime, iteration, sub.getTarget(), val);
             }
         }
 
         for (auto& ept : endpoints) {
             while (ept.hasMessage()) {
-                auto mess = ept.getMessage();
-                if (printMessage) {
-                    std::string messstr;
-                    if (mess->data.size() < 50) {
-                        messstr = fmt::format("[{}]message from {} to {}::{}",
-                                              currentTime,
-                                              mess->source,
-                                              mess->dest,
-                                              mess->data.to_string());
-                    } else {
-                        messstr = fmt::format("[{}]message from {} to {}:: size {}",
-                                              currentTime,
-                                              mess->source,
-                                              mess->dest,
-                                              mess->data.size());
-                    }
-                    if (skiplog) {
-                        std::cout << messstr << '\n';
-                    } else {
-                        spdlog::info(messstr);
-                    }
-                }
-                if (endpointMessageCallback) {
-                    endpointMessageCallback(currentTime, ept.getName(), std::move(mess));
-                }
+                processEndpointMessage(currentTime, ept.getName(), ept.getMessage());
             }
         }
 
         // get the clone endpoints
         if (cloneEndpoint) {
             while (cloneEndpoint->hasMessage()) {
-                auto mess = cloneEndpoint->getMessage();
-                if (printMessage) {
-                    std::string messstr;
-                    if (mess->data.size() < 50) {
-                        messstr = fmt::format("[{}]message from {} to {}::{}",
-                                              currentTime,
-                                              mess->source,
-                                              mess->original_dest,
-                                              mess->data.to_string());
-                    } else {
-                        messstr = fmt::format("[{}]message from %s to %s:: size %d",
-                                              currentTime,
-                                              mess->source,
-                                              mess->original_dest,
-                                              mess->data.size());
-                    }
-                    if (skiplog) {
-                        std::cout << messstr << '\n';
-                    } else {
-                        spdlog::info(messstr);
-                    }
+                processClonedMessage(currentTime, cloneEndpoint->getMessage());
+            }
+        }
+    }
+
+    void Tracer::processValue(Time currentTime,
+                              int iteration,
+                              const std::string& target,
+                              const std::string& val)
+    {
+        if (printMessage) {
+            std::string valstr;
+            if (val.size() < 150) {
+                if (iteration > 0) {
+                    valstr = fmt::format("[{}:{}]value {}={}", currentTime, iteration, target, val);
+                } else {
+                    valstr = fmt::format("[{}]value {}={}", currentTime, target, val);
                 }
-                if (clonedMessageCallback) {
-                    clonedMessageCallback(currentTime, std::move(mess));
+            } else {
+                if (iteration > 0) {
+                    valstr = fmt::format(
+                        "[{}:{}]value {}=block[{}]", currentTime, iteration, target, val.size());
+                } else {
+                    valstr = fmt::format("[{}]value {}=block[{}]", currentTime, target, val.size());
                 }
             }
+            if (skiplog) {
+                std::cout << valstr << '\n';
+            } else {
+                spdlog::info(valstr);
+            }
+        }
+        if (valueCallback) {
+            valueCallback(currentTime, target, val);
+        }
+    }
+
+    void Tracer::processEndpointMessage(Time currentTime,
+                                        const std::string& endpointName,
+                                        std::unique_ptr<Message> mess)
+    {
+        if (printMessage) {
+            std::string messstr;
+            if (mess->data.size() < 50) {
+                messstr = fmt::format("[{}]message from {} to {}::{}",
+                                      currentTime,
+                                      mess->source,
+                                      mess->dest,
+                                      mess->data.to_string());
+            } else {
+                messstr = fmt::format("[{}]message from {} to {}:: size {}",
+                                      currentTime,
+                                      mess->source,
+                                      mess->dest,
+                                      mess->data.size());
+            }
+            if (skiplog) {
+                std::cout << messstr << '\n';
+            } else {
+                spdlog::info(messstr);
+            }
+        }
+        if (endpointMessageCallback) {
+            endpointMessageCallback(currentTime, endpointName, std::move(mess));
+        }
+    }
+
+    void Tracer::processClonedMessage(Time currentTime, std::unique_ptr<Message> mess)
+    {
+        if (printMessage) {
+            std::string messstr;
+            if (mess->data.size() < 50) {
+                messstr = fmt::format("[{}]message from {} to {}::{}",
+                                      currentTime,
+                                      mess->source,
+                                      mess->original_dest,
+                                      mess->data.to_string());
+            } else {
+                messstr = fmt::format("[{}]message from {} to {}:: size {}",
+                                      currentTime,
+                                      mess->source,
+                                      mess->original_dest,
+                                      mess->data.size());
+            }
+            if (skiplog) {
+                std::cout << messstr << '\n';
+            } else {
+                spdlog::info(messstr);
+            }
+        }
+        if (clonedMessageCallback) {
+            clonedMessageCallback(currentTime, std::move(mess));
         }
     }
 
+    void Tracer::processCaptureRecord(CaptureRecord& record)
+    {
+        if (!record.message) {
+            std::string val;
+            valueExtract(data_view(record.payload), record.type, val);
+            processValue(record.time, record.iteration, captureTargets[record.index], val);
+        } else if (record.index >= 0) {
+            processEndpointMessage(record.time,
+                                   captureEndpoints[record.index],
+                                   std::move(record.message));
+        } else {
+            processClonedMessage(record.time, std::move(record.message));
+        }
+    }
+
+    void Tracer::flushCapture()
+    {
+        if (pipeline) {
+            pipeline->flush();
+        }
+    }
+
+    std::uint64_t Tracer::droppedCaptureCount() const
+    {
+        return (pipeline) ? pipeline->droppedCount() : 0;
+    }
+
+    std::uint64_t Tracer::stalledCaptureCount() const
+    {
+        return (pipeline) ? pipeline->stallCount() : 0;
+    }
+
     /** run the Player until the specified time*/
     void Tracer::runTo(Time runToTime)
     {
@@ -387,6 +484,10 @@ namespace apps {
         }
         catch (...) {
         }
+        flushCapture();
+        if (droppedCaptureCount() > 0) {
+            spdlog::warn("tracer dropped {} captured records", droppedCaptureCount());
+        }
     }
     /** add a subscription to record*/
     void Tracer::addSubscription(const std::string& key)
@@ -444,6 +545,18 @@ namespace apps {
             ->ignore_underscore();
         app->add_flag("--print", printMessage, "print messages to the screen");
         app->add_flag("--skiplog", skiplog, "print messages to the screen through cout");
+        app->add_flag("--async_capture",
+                      asyncCapture,
+                      "process the captured values and messages on a separate writer thread")
+            ->ignore_underscore();
+        app->add_option("--capture_buffer",
+                        captureBufferSize,
+                        "the number of records buffered for the asynchronous capture")
+            ->ignore_underscore();
+        app->add_flag("--drop_when_full",
+                      dropCaptureWhenFull,
+                      "drop captured records instead of waiting if the capture buffer is full")
+            ->ignore_underscore();
         auto* clone_group = app->add_option_group(
             "cloning", "Options related to endpoint cloning operations and specifications");
         clone_group->add_option("--clone", "existing endpoints to clone all packets to and from")
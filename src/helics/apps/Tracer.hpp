@@ -10,6 +10,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../application_api/Subscriptions.hpp"
 #include "helicsApp.hpp"
 
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
@@ -21,6 +22,9 @@ namespace helics {
 class CloningFilter;
 
 namespace apps {
+    class CapturePipeline;
+    struct CaptureRecord;
+
     /** class designed to capture data points from a set of subscriptions or endpoints*/
     class HELICS_CXX_EXPORT Tracer: public App {
       public:
@@ -53,10 +57,10 @@ namespace apps {
     @param file a file defining the federate information
     */
         Tracer(const std::string& name, const std::string& file);
-        /** move construction*/
-        Tracer(Tracer&& other_tracer) = default;
-        /** move assignment*/
-        Tracer& operator=(Tracer&& tracer) = default;
+        /** the capture pipeline thread refers to this object so it cannot be moved*/
+        Tracer(Tracer&& other_tracer) = delete;
+        /** the capture pipeline thread refers to this object so it cannot be moved*/
+        Tracer& operator=(Tracer&& tracer) = delete;
         /**destructor*/
         ~Tracer();
         virtual void runTo(Time runToTime) override;
@@ -102,6 +106,23 @@ namespace apps {
         void enableTextOutput() { printMessage = true; }
         /** turn the screen display off for values and messages*/
         void disableTextOutput() { printMessage = false; }
+        /** process the captured values and messages on a background thread
+    @details the federate thread only copies the raw data into a ring buffer and the formatting,
+    printing, and callbacks are handled by a writer thread,  all captured data is processed before
+    runTo returns.  Must be called before the Tracer is initialized
+    @param bufferSize the number of records the ring buffer can hold
+    @param dropWhenFull set to true to drop records if the buffer is full instead of waiting
+    */
+        void enableAsyncCapture(std::size_t bufferSize = 4096, bool dropWhenFull = false)
+        {
+            asyncCapture = true;
+            captureBufferSize = bufferSize;
+            dropCaptureWhenFull = dropWhenFull;
+        }
+        /** get the number of captured records dropped by the asynchronous capture*/
+        std::uint64_t droppedCaptureCount() const;
+        /** get the number of times the asynchronous capture waited for space in the buffer*/
+        std::uint64_t stalledCaptureCount() const;
 
       private:
         /** load from a jsonString
@@ -115,6 +136,21 @@ namespace apps {
         void generateInterfaces();
         void captureForCurrentTime(Time currentTime, int iteration = 0);
         void loadCaptureInterfaces();
+        /** print and forward a captured value*/
+        void processValue(Time currentTime,
+                          int iteration,
+                          const std::string& target,
+                          const std::string& val);
+        /** print and forward a message received on an endpoint*/
+        void processEndpointMessage(Time currentTime,
+                                    const std::string& endpointName,
+                                    std::unique_ptr<Message> mess);
+        /** print and forward a message received through a clone filter*/
+        void processClonedMessage(Time currentTime, std::unique_ptr<Message> mess);
+        /** process a record from the capture pipeline on the writer thread*/
+        void processCaptureRecord(CaptureRecord& record);
+        /** wait for all the captured records to be processed*/
+        void flushCapture();
 
         /** build the command line argument processing application*/
         std::shared_ptr<helicsCLI11App> buildArgParserApp();
@@ -140,6 +176,15 @@ namespace apps {
         std::function<void(Time, const std::string&, std::unique_ptr<Message>)>
             endpointMessageCallback;
         std::function<void(Time, const std::string&, const std::string&)> valueCallback;
+
+        bool asyncCapture{false};  //!< process the captured data on a writer thread
+        bool dropCaptureWhenFull{false};  //!< drop captured data if the pipeline is full
+        std::size_t captureBufferSize{4096};  //!< the size of the capture ring buffer
+        std::vector<std::string> captureTargets;  //!< subscription targets used by the writer
+        std::vector<std::string> captureEndpoints;  //!< endpoint names used by the writer
+        std::vector<DataType> captureTypes;  //!< the publication type of each subscription
+        /// the asynchronous capture pipeline,  declared last so it is stopped first
+        std::unique_ptr<CapturePipeline> pipeline;
     };
 
 }  // namespace apps
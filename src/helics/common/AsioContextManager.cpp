@@ -18,6 +18,8 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "AsioContextManager.h"
 
+#include <asio/post.hpp>
+
 #include <chrono>
 #include <iostream>
 #include <map>
@@ -190,6 +192,15 @@ AsioContextManager::LoopHandle AsioContextManager::startContextLoop()
     return std::make_unique<Servicer>(shared_from_this());
 }
 
+void AsioContextManager::setLoopInitializer(std::function<void()> initializer)
+{
+    std::lock_guard<std::mutex> nullLock(runningLoopLock);
+    loopInitializer = std::move(initializer);
+    if (loopInitializer && nullwork) {
+        asio::post(*ictx, loopInitializer);
+    }
+}
+
 void AsioContextManager::haltContextLoop()
 {
     if (isRunning()) {
@@ -227,6 +238,12 @@ void AsioContextManager::haltContextLoop()
 
 void contextProcessingLoop(std::shared_ptr<AsioContextManager> ptr)
 {
+    std::unique_lock<std::mutex> nullLock(ptr->runningLoopLock);
+    auto initializer = ptr->loopInitializer;
+    nullLock.unlock();
+    if (initializer) {
+        initializer();
+    }
     while ((ptr->runCounter > 0) && (!(ptr->terminateLoop))) {
         auto clk = std::chrono::steady_clock::now();
         try {
@@ -20,6 +20,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #pragma once
 
 #include <atomic>
+#include <functional>
 #include <future>
 #include <map>
 #include <memory>
@@ -55,6 +56,8 @@ class AsioContextManager: public std::enable_shared_from_this<AsioContextManager
     std::mutex runningLoopLock;  //!< lock protecting the nullwork object and the return future
     std::atomic<bool> terminateLoop{false};  //!< flag indicating that the loop should terminate
     std::future<void> loopRet;
+    /// function called on the loop thread when it starts
+    std::function<void()> loopInitializer;
     /** constructor*/
     explicit AsioContextManager(const std::string& contextName);
 
@@ -141,6 +144,11 @@ class AsioContextManager: public std::enable_shared_from_this<AsioContextManager
     LoopHandle startContextLoop();
     /** check if the contextLoopo is running*/
     bool isRunning() const { return (running.load() != loop_mode::stopped); }
+    /** set a function to call on the context loop thread when it starts
+    @details if the loop is already running the function is posted to the context so it executes
+    on the running loop thread as well,  used for setting the processor affinity of the thread
+    */
+    void setLoopInitializer(std::function<void()> initializer);
 
   private:
     /** halt the context loop thread if the counter==0
@@ -0,0 +1,531 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "InterfaceConfigReader.hpp"
+
+#include "JsonProcessingFunctions.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace helics {
+static constexpr std::string_view manifestHeader{"HELICSIM"};
+static constexpr std::uint8_t manifestVersion{1};
+/// the sections stored as binary records in a manifest
+static const std::vector<std::string_view> manifestSections{"publications",
+                                                            "subscriptions",
+                                                            "inputs",
+                                                            "endpoints"};
+
+namespace {
+    /** codes for the global field of a manifest record*/
+    enum RecordCode : std::uint8_t {
+        LOCAL_RECORD = 0,
+        GLOBAL_RECORD = 1,
+        DEFAULT_RECORD = 2,  // the global field was not specified
+        RAW_RECORD = 3  // the element is not an object and is stored as JSON
+    };
+
+    constexpr auto npos = std::string_view::npos;
+
+    /** skip whitespace and comments
+    @return the position of the next significant character or npos for an unterminated comment*/
+    std::size_t skipSpace(std::string_view text, std::size_t pos)
+    {
+        while (pos < text.size()) {
+            char c = text[pos];
+            if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+                ++pos;
+                continue;
+            }
+            if (c == '/' && pos + 1 < text.size()) {
+                if (text[pos + 1] == '/') {
+                    pos = text.find('\n', pos);
+                    if (pos == npos) {
+                        return text.size();
+                    }
+                    continue;
+                }
+                if (text[pos + 1] == '*') {
+                    pos = text.find("*/", pos + 2);
+                    if (pos == npos) {
+                        return npos;
+                    }
+                    pos += 2;
+                    continue;
+                }
+            }
+            break;
+        }
+        return pos;
+    }
+
+    /** get the position just past the end of a string starting at pos*/
+    std::size_t skipString(std::string_view text, std::size_t pos)
+    {
+        ++pos;
+        while (pos < text.size()) {
+            if (text[pos] == '\\') {
+                pos += 2;
+            } else if (text[pos] == '"') {
+                return pos + 1;
+            } else {
+                ++pos;
+            }
+        }
+        return npos;
+    }
+
+    /** get the position just past the end of the value starting at pos*/
+    std::size_t skipValue(std::string_view text, std::size_t pos)
+    {
+        if (pos >= text.size()) {
+            return npos;
+        }
+        char c = text[pos];
+        if (c == '"') {
+            return skipString(text, pos);
+        }
+        if (c == '{' || c == '[') {
+            int depth{0};
+            while (pos < text.size()) {
+                switch (text[pos]) {
+                    case '"':
+                        pos = skipString(text, pos);
+                        if (pos == npos) {
+                            return npos;
+                        }
+                        continue;
+                    case '/': {
+                        auto next = skipSpace(text, pos);
+                        if (next == npos) {
+                            return npos;
+                        }
+                        pos = (next == pos) ? pos + 1 : next;
+                        continue;
+                    }
+                    case '{':
+                    case '[':
+                        ++depth;
+                        break;
+                    case '}':
+                    case ']':
+                        if (--depth == 0) {
+                            return pos + 1;
+                        }
+                        break;
+                    default:
+                        break;
+                }
+                ++pos;
+            }
+            return npos;
+        }
+        // scalar values run to the next separator
+        while (pos < text.size()) {
+            c = text[pos];
+            if (c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' || c == '\n' ||
+                c == '\r' || c == '/') {
+                break;
+            }
+            ++pos;
+        }
+        return pos;
+    }
+
+    /** call a function with the key and value text of each member of an object or each element
+    of an array
+    @return the position just past the end of the object or array or npos if the text could not be
+    scanned*/
+    std::size_t
+        visitElements(std::string_view text,
+                      const std::function<void(std::string_view, std::string_view)>& visitor)
+    {
+        auto pos = skipSpace(text, 0);
+        if (pos == npos || pos >= text.size() || (text[pos] != '{' && text[pos] != '[')) {
+            return npos;
+        }
+        const bool object = (text[pos] == '{');
+        const char close = object ? '}' : ']';
+        pos = skipSpace(text, pos + 1);
+        while (pos != npos && pos < text.size()) {
+            if (text[pos] == close) {
+                return pos + 1;
+            }
+            std::string_view key;
+            if (object) {
+                if (text[pos] != '"') {
+                    return npos;
+                }
+                auto keyEnd = skipString(text, pos);
+                if (keyEnd == npos) {
+                    return npos;
+                }
+                key = text.substr(pos + 1, keyEnd - pos - 2);
+                if (key.find('\\') != npos) {
+                    // escaped keys are left to the full parser
+                    return npos;
+                }
+                pos = skipSpace(text, keyEnd);
+                if (pos == npos || pos >= text.size() || text[pos] != ':') {
+                    return npos;
+                }
+                pos = skipSpace(text, pos + 1);
+            }
+            auto valueEnd = skipValue(text, pos);
+            if (valueEnd == npos || valueEnd == pos) {
+                return npos;
+            }
+            visitor(key, text.substr(pos, valueEnd - pos));
+            pos = skipSpace(text, valueEnd);
+            if (pos == npos || pos >= text.size()) {
+                return npos;
+            }
+            if (text[pos] == ',') {
+                pos = skipSpace(text, pos + 1);
+            } else if (text[pos] != close) {
+                return npos;
+            }
+        }
+        return npos;
+    }
+
+    Json::Value parseElement(Json::CharReader& reader, std::string_view elementText)
+    {
+        Json::Value element;
+        std::string errs;
+        if (!reader.parse(elementText.data(),
+                          elementText.data() + elementText.size(),
+                          &element,
+                          &errs)) {
+            throw(std::invalid_argument(errs));
+        }
+        return element;
+    }
+
+    std::unique_ptr<Json::CharReader> makeReader()
+    {
+        Json::CharReaderBuilder rbuilder;
+        return std::unique_ptr<Json::CharReader>(rbuilder.newCharReader());
+    }
+
+    std::string compactJsonString(const Json::Value& block)
+    {
+        Json::StreamWriterBuilder builder;
+        builder["commentStyle"] = "None";
+        builder["indentation"] = "";
+        return Json::writeString(builder, block);
+    }
+
+    template<class X>
+    void appendInteger(std::string& block, X value)
+    {
+        for (std::size_t ii = 0; ii < sizeof(X); ++ii) {
+            block.push_back(static_cast<char>((value >> (8 * ii)) & 0xFFU));
+        }
+    }
+
+    template<class X>
+    X readInteger(std::string_view text, std::size_t& pos)
+    {
+        if (pos + sizeof(X) > text.size()) {
+            throw(std::invalid_argument("interface manifest is truncated"));
+        }
+        X value{0};
+        for (std::size_t ii = 0; ii < sizeof(X); ++ii) {
+            value |= static_cast<X>(static_cast<unsigned char>(text[pos + ii])) << (8 * ii);
+        }
+        pos += sizeof(X);
+        return value;
+    }
+
+    void appendString(std::string& block, std::string_view str)
+    {
+        appendInteger(block, static_cast<std::uint32_t>(str.size()));
+        block.append(str.data(), str.size());
+    }
+
+    std::string_view readString(std::string_view text, std::size_t& pos)
+    {
+        auto size = readInteger<std::uint32_t>(text, pos);
+        if (pos + size > text.size()) {
+            throw(std::invalid_argument("interface manifest is truncated"));
+        }
+        auto str = text.substr(pos, size);
+        pos += size;
+        return str;
+    }
+
+    /** append an interface definition as a binary record*/
+    void appendRecord(std::string& block, const Json::Value& element)
+    {
+        if (!element.isObject()) {
+            block.push_back(static_cast<char>(RAW_RECORD));
+            for (int ii = 0; ii < 3; ++ii) {
+                appendString(block, std::string_view{});
+            }
+            appendString(block, compactJsonString(element));
+            return;
+        }
+        const std::string emptyStr;
+        auto units = getOrDefault(element, "unit", emptyStr);
+        replaceIfMember(element, "units", units);
+        std::uint8_t global{DEFAULT_RECORD};
+        if (element.isMember("global")) {
+            global = element["global"].asBool() ? GLOBAL_RECORD : LOCAL_RECORD;
+        }
+        block.push_back(static_cast<char>(global));
+        appendString(block, getKey(element));
+        appendString(block, getOrDefault(element, "type", emptyStr));
+        appendString(block, units);
+
+        Json::Value options = element;
+        for (const auto* field : {"key", "name", "type", "unit", "units", "global"}) {
+            options.removeMember(field);
+        }
+        appendString(block, options.empty() ? std::string{} : compactJsonString(options));
+    }
+
+    /** load an interface definition from a binary record*/
+    Json::Value readRecord(Json::CharReader& reader, std::string_view text, std::size_t& pos)
+    {
+        auto global = readInteger<std::uint8_t>(text, pos);
+        auto key = readString(text, pos);
+        auto type = readString(text, pos);
+        auto units = readString(text, pos);
+        auto options = readString(text, pos);
+        if (global == RAW_RECORD) {
+            return parseElement(reader, options);
+        }
+        Json::Value element =
+            options.empty() ? Json::Value(Json::objectValue) : parseElement(reader, options);
+        if (!key.empty()) {
+            element["key"] = std::string(key);
+        }
+        if (!type.empty()) {
+            element["type"] = std::string(type);
+        }
+        if (!units.empty()) {
+            element["units"] = std::string(units);
+        }
+        if (global != DEFAULT_RECORD) {
+            element["global"] = (global == GLOBAL_RECORD);
+        }
+        return element;
+    }
+}  // namespace
+
+InterfaceConfigReader::InterfaceConfigReader(const std::string& configString)
+{
+    if (configString.find_first_of('{') == std::string::npos) {
+        std::ifstream file(configString, std::ios::binary);
+        if (file.is_open()) {
+            text.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        } else {
+            text = configString;
+        }
+    } else {
+        text = configString;
+    }
+    if (text.compare(0, manifestHeader.size(), manifestHeader) == 0) {
+        loadManifest();
+        return;
+    }
+    std::size_t start{0};
+    // skip a UTF-8 byte order mark
+    if (text.compare(0, 3, "\xEF\xBB\xBF") == 0) {
+        start = 3;
+    }
+    if (!indexDocument(start, text.size() - start)) {
+        // let the full parser deal with anything the scanner does not handle (or generate the
+        // appropriate error)
+        members.clear();
+        fallback = loadJsonStr(text);
+        useFallback = true;
+    }
+}
+
+bool InterfaceConfigReader::indexDocument(std::size_t offset, std::size_t length)
+{
+    std::string_view view(text);
+    view = view.substr(offset, length);
+    auto end = visitElements(view, [this](std::string_view key, std::string_view value) {
+        members[std::string(key)] = {static_cast<std::size_t>(value.data() - text.data()),
+                                     value.size()};
+    });
+    // only whitespace or comments are allowed after the document
+    return (end != npos) && (skipSpace(view, end) == view.size());
+}
+
+void InterfaceConfigReader::loadManifest()
+{
+    manifest = true;
+    std::string_view view(text);
+    std::size_t pos{manifestHeader.size()};
+    auto version = readInteger<std::uint8_t>(view, pos);
+    if (version != manifestVersion) {
+        throw(std::invalid_argument("unrecognized interface manifest version"));
+    }
+    auto document = readString(view, pos);
+    if (!indexDocument(static_cast<std::size_t>(document.data() - text.data()), document.size())) {
+        throw(std::invalid_argument("invalid interface manifest document"));
+    }
+    auto sectionCount = readInteger<std::uint8_t>(view, pos);
+    for (std::uint8_t ii = 0; ii < sectionCount; ++ii) {
+        auto name = readString(view, pos);
+        auto blockLength = readInteger<std::uint64_t>(view, pos);
+        if (pos + blockLength > view.size()) {
+            throw(std::invalid_argument("interface manifest is truncated"));
+        }
+        recordBlocks[std::string(name)] = {pos, static_cast<std::size_t>(blockLength)};
+        pos += blockLength;
+    }
+}
+
+bool InterfaceConfigReader::isMember(std::string_view name) const
+{
+    if (useFallback) {
+        return fallback.isMember(std::string(name));
+    }
+    return (members.find(name) != members.end()) ||
+        (recordBlocks.find(name) != recordBlocks.end());
+}
+
+Json::Value InterfaceConfigReader::loadMember(const std::string& name) const
+{
+    auto mem = members.find(name);
+    if (mem != members.end()) {
+        auto reader = makeReader();
+        return parseElement(*reader,
+                            std::string_view(text).substr(mem->second.first, mem->second.second));
+    }
+    Json::Value section(Json::arrayValue);
+    forEachElement(name, [&section](const Json::Value& element) { section.append(element); });
+    return section;
+}
+
+Json::Value InterfaceConfigReader::getSubDocument(const std::vector<std::string_view>& names) const
+{
+    Json::Value doc(Json::objectValue);
+    for (const auto& name : names) {
+        if (!isMember(name)) {
+            continue;
+        }
+        std::string key(name);
+        doc[key] = (useFallback) ? fallback[key] : loadMember(key);
+    }
+    return doc;
+}
+
+Json::Value
+    InterfaceConfigReader::getDocumentWithout(const std::vector<std::string_view>& names) const
+{
+    auto excluded = [&names](const std::string& name) {
+        for (const auto& exname : names) {
+            if (exname == name) {
+                return true;
+            }
+        }
+        return false;
+    };
+    if (useFallback) {
+        Json::Value doc = fallback;
+        if (doc.isObject()) {
+            for (const auto& name : names) {
+                doc.removeMember(std::string(name));
+            }
+        }
+        return doc;
+    }
+    Json::Value doc(Json::objectValue);
+    for (const auto& mem : members) {
+        if (!excluded(mem.first)) {
+            doc[mem.first] = loadMember(mem.first);
+        }
+    }
+    for (const auto& block : recordBlocks) {
+        if (!excluded(block.first)) {
+            doc[block.first] = loadMember(block.first);
+        }
+    }
+    return doc;
+}
+
+std::size_t InterfaceConfigReader::forEachElement(
+    std::string_view section,
+    const std::function<void(const Json::Value&)>& process) const
+{
+    std::size_t count{0};
+    if (useFallback) {
+        const auto& elements = fallback[std::string(section)];
+        for (const auto& element : elements) {
+            process(element);
+            ++count;
+        }
+        return count;
+    }
+    auto reader = makeReader();
+    auto block = recordBlocks.find(section);
+    if (block != recordBlocks.end()) {
+        auto records =
+            std::string_view(text).substr(block->second.offset, block->second.length);
+        std::size_t pos{0};
+        while (pos < records.size()) {
+            process(readRecord(*reader, records, pos));
+            ++count;
+        }
+        return count;
+    }
+    auto mem = members.find(section);
+    if (mem == members.end()) {
+        return 0;
+    }
+    auto value = std::string_view(text).substr(mem->second.first, mem->second.second);
+    if (value.front() != '[' && value.front() != '{') {
+        return 0;
+    }
+    auto end = visitElements(value, [&](std::string_view /*key*/, std::string_view elementText) {
+        process(parseElement(*reader, elementText));
+        ++count;
+    });
+    if (end == npos) {
+        throw(std::invalid_argument(std::string("unable to read section ") + std::string(section)));
+    }
+    return count;
+}
+
+void writeInterfaceManifest(const std::string& configString, const std::string& manifestFile)
+{
+    InterfaceConfigReader config(configString);
+    auto document = compactJsonString(config.getDocumentWithout(manifestSections));
+
+    std::string output(manifestHeader);
+    output.push_back(static_cast<char>(manifestVersion));
+    appendString(output, document);
+    appendInteger(output, static_cast<std::uint8_t>(manifestSections.size()));
+    std::string block;
+    for (const auto& section : manifestSections) {
+        block.clear();
+        config.forEachElement(section, [&block](const Json::Value& element) {
+            appendRecord(block, element);
+        });
+        appendString(output, section);
+        appendInteger(output, static_cast<std::uint64_t>(block.size()));
+        output.append(block);
+    }
+
+    std::ofstream out(manifestFile, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        throw(std::invalid_argument(std::string("unable to open ") + manifestFile));
+    }
+    out.write(output.data(), static_cast<std::streamsize>(output.size()));
+}
+
+}  // namespace helics
@@ -0,0 +1,75 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "json/json.h"
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/** @file
+@details incremental loading of interface configurations,  the top level members of a JSON
+configuration are located without building a DOM of the full document so the large interface
+sections can be processed one element at a time.  Precompiled interface manifests are read through
+the same interface.  TOML configurations are not handled here and are parsed as a full document
+*/
+namespace helics {
+/** class for reading the sections of an interface configuration one element at a time*/
+class InterfaceConfigReader {
+  public:
+    /** load a JSON string, a JSON file, or an interface manifest file
+    @throw std::invalid_argument if the configuration is not valid*/
+    explicit InterfaceConfigReader(const std::string& configString);
+    /** check if the configuration has a top level member*/
+    bool isMember(std::string_view name) const;
+    /** load a JSON object containing only the listed top level members*/
+    Json::Value getSubDocument(const std::vector<std::string_view>& names) const;
+    /** load a JSON object containing all the top level members except the listed ones*/
+    Json::Value getDocumentWithout(const std::vector<std::string_view>& names) const;
+    /** call a function on each element of a top level array or object
+    @details each element is parsed individually so only a single element is loaded at a time
+    @return the number of elements processed*/
+    std::size_t forEachElement(std::string_view section,
+                               const std::function<void(const Json::Value&)>& process) const;
+    /** check if the configuration was loaded from an interface manifest*/
+    bool isManifest() const { return manifest; }
+
+  private:
+    /** location of a block of records for an interface section of a manifest*/
+    struct RecordBlock {
+        std::size_t offset{0};
+        std::size_t length{0};
+    };
+    /** locate the top level members of the JSON document in the given range of the text*/
+    bool indexDocument(std::size_t offset, std::size_t length);
+    /** load the sections of a precompiled manifest*/
+    void loadManifest();
+    /** load the JSON value of a top level member*/
+    Json::Value loadMember(const std::string& name) const;
+
+    std::string text;  //!< the text of the configuration
+    /// the location of each top level member value in the text
+    std::map<std::string, std::pair<std::size_t, std::size_t>, std::less<>> members;
+    /// the interface sections stored as binary records in a manifest
+    std::map<std::string, RecordBlock, std::less<>> recordBlocks;
+    Json::Value fallback;  //!< the full document if the incremental scan could not be used
+    bool useFallback{false};  //!< indicator that the full document is in use
+    bool manifest{false};  //!< indicator that the text is a precompiled manifest
+};
+
+/** write a compact binary interface manifest from a JSON configuration
+@details the publications, subscriptions, inputs, and endpoints are stored as binary records and any
+other configuration is stored as JSON
+@param configString a JSON file or string containing the interface definitions
+@param manifestFile the name of the manifest file to write
+@throw std::invalid_argument if the configuration cannot be read or the file cannot be written*/
+void writeInterfaceManifest(const std::string& configString, const std::string& manifestFile);
+
+}  // namespace helics
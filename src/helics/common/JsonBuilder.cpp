@@ -34,7 +34,7 @@ bool JsonMapBuilder::isCompleted() const
 
 int JsonMapBuilder::generatePlaceHolder(const std::string& location, int32_t code)
 {
-    int index = static_cast<int>(missing_components.size()) + 2;
+    int index = static_cast<int>(missing_components.size() + filled_components.size()) + 2;
     missing_components.emplace(index, std::make_pair(location, code));
     return index;
 }
@@ -43,17 +43,23 @@ bool JsonMapBuilder::addComponent(const std::string& info, int index) noexcept
 {
     auto loc = missing_components.find(index);
     if (loc != missing_components.end()) {
-        if (info == "#invalid") {
-            (*jMap)[loc->second.first].append(Json::Value{});
-        } else {
+        Json::Value element;
+        if (info != "#invalid") {
             try {
-                auto element = loadJsonStr(info);
-                (*jMap)[loc->second.first].append(element);
+                element = loadJsonStr(info);
             }
             catch (const std::invalid_argument&) {
-                (*jMap)[loc->second.first].append(Json::Value{});
+                element = Json::Value{};
             }
         }
+        auto& section = (*jMap)[loc->second.first];
+        auto filled = filled_components.find(index);
+        if (filled != filled_components.end() && section.isValidIndex(filled->second.element)) {
+            section[filled->second.element] = std::move(element);
+        } else {
+            filled_components[index] = {loc->second.first, loc->second.second, section.size()};
+            section.append(std::move(element));
+        }
 
         missing_components.erase(loc);
 
@@ -62,10 +68,45 @@ bool JsonMapBuilder::addComponent(const std::string& info, int index) noexcept
     return false;
 }
 
+bool JsonMapBuilder::invalidateComponent(int index, int32_t code)
+{
+    auto filled = filled_components.find(index);
+    if (filled != filled_components.end() && filled->second.code == code) {
+        stale_components.insert(index);
+        return true;
+    }
+    auto loc = missing_components.find(index);
+    if (loc != missing_components.end() && loc->second.second == code) {
+        // the information may have changed after the component was generated
+        stale_components.insert(index);
+        return true;
+    }
+    return false;
+}
+
+std::vector<std::pair<int, int32_t>> JsonMapBuilder::refreshComponents()
+{
+    std::vector<std::pair<int, int32_t>> refresh;
+    for (auto index : stale_components) {
+        auto filled = filled_components.find(index);
+        if (filled == filled_components.end() || missing_components.count(index) != 0) {
+            continue;
+        }
+        missing_components.emplace(index,
+                                   std::make_pair(filled->second.location, filled->second.code));
+        refresh.emplace_back(index, filled->second.code);
+    }
+    for (const auto& ref : refresh) {
+        stale_components.erase(ref.first);
+    }
+    return refresh;
+}
+
 bool JsonMapBuilder::clearComponents(int32_t code)
 {
     for (auto b = missing_components.begin(); b != missing_components.end(); ++b) {
         if (b->second.second == code) {
+            stale_components.erase(b->first);
             missing_components.erase(b);
             return missing_components.empty();
         }
@@ -85,6 +126,8 @@ void JsonMapBuilder::reset()
 {
     jMap = nullptr;
     missing_components.clear();
+    filled_components.clear();
+    stale_components.clear();
 }
 
 JsonBuilder::JsonBuilder() noexcept {}
@@ -7,6 +7,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #pragma once
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -19,8 +20,17 @@ namespace helics {
 /** class handling the construction in pieces of a JSON map*/
 class JsonMapBuilder {
   private:
+    /** location of a component that has been added to the map*/
+    struct ComponentLocation {
+        std::string location;
+        int32_t code{0};
+        unsigned int element{0};
+    };
     std::unique_ptr<Json::Value> jMap;
     std::map<int, std::pair<std::string, int32_t>> missing_components;
+    /// the components that have been filled in so they can be replaced with updated information
+    std::map<int, ComponentLocation> filled_components;
+    std::set<int> stale_components;  //!< the components known to have changed since added
     int counterCode{0};  // a code for the user to include for various purposes
   public:
     JsonMapBuilder() noexcept;
@@ -33,12 +43,23 @@ class JsonMapBuilder {
     bool isCompleted() const;
     // check whether a map is currently completed or under construction
     bool isActive() const { return static_cast<bool>(jMap); }
+    /** check if the map is completed and none of the components are known to have changed*/
+    bool isCurrent() const { return isCompleted() && stale_components.empty(); }
     /** add a component value for a previously generated location
+    @details if the location was filled before and then refreshed the existing value is replaced
     @param info the string to use for information
     @param index the index of the place holder
-    @return true if successfully added
+    @return true if successfully added and the map is now complete
     */
     bool addComponent(const std::string& info, int index) noexcept;
+    /** mark a component as having changed since it was added
+    @param index the index of the place holder
+    @param code the code given when the place holder was generated
+    @return true if the component was found*/
+    bool invalidateComponent(int index, int32_t code);
+    /** move all the changed components back to the missing state so they can be filled again
+    @return a vector of the place holder indices and codes that need to be filled*/
+    std::vector<std::pair<int, int32_t>> refreshComponents();
     /** generate a new location to fill in later
     @return the index value of the location for use in addComponent*/
     int generatePlaceHolder(const std::string& location, int32_t code);
@@ -0,0 +1,148 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "ThreadPlacement.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+
+#ifdef _WIN32
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <pthread.h>
+#    include <sched.h>
+#endif
+
+namespace helics {
+/** read a processor number from a cpu set string and advance the position past it*/
+static int readCpu(const std::string& cpuSet, std::size_t& pos)
+{
+    auto start = pos;
+    while (pos < cpuSet.size() && std::isdigit(static_cast<unsigned char>(cpuSet[pos])) != 0) {
+        ++pos;
+    }
+    if (pos == start || pos - start > 6) {
+        throw(std::invalid_argument(std::string("invalid processor set ") + cpuSet));
+    }
+    return std::stoi(cpuSet.substr(start, pos - start));
+}
+
+std::vector<int> parseCpuSet(const std::string& cpuSet)
+{
+    std::string spec;
+    spec.reserve(cpuSet.size());
+    for (auto chr : cpuSet) {
+        if (std::isspace(static_cast<unsigned char>(chr)) == 0) {
+            spec.push_back(chr);
+        }
+    }
+    std::vector<int> cpus;
+    std::size_t pos{0};
+    while (pos < spec.size()) {
+        auto first = readCpu(spec, pos);
+        auto last = first;
+        if (pos < spec.size() && spec[pos] == '-') {
+            ++pos;
+            last = readCpu(spec, pos);
+            if (last < first) {
+                throw(std::invalid_argument(std::string("invalid processor range in ") + cpuSet));
+            }
+        }
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+        if (pos < spec.size()) {
+            if (spec[pos] != ',' || pos + 1 == spec.size()) {
+                throw(std::invalid_argument(std::string("invalid processor set ") + cpuSet));
+            }
+            ++pos;
+        }
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+#ifdef _WIN32
+static bool applyPlacement(HANDLE thread, const ThreadPlacement& placement)
+{
+    bool applied{true};
+    if (!placement.cpus.empty()) {
+        // processor groups are not handled so only the first 64 processors can be used
+        DWORD_PTR mask{0};
+        for (auto cpu : placement.cpus) {
+            if (cpu < static_cast<int>(sizeof(DWORD_PTR) * 8)) {
+                mask |= (static_cast<DWORD_PTR>(1) << cpu);
+            }
+        }
+        applied = (mask != 0) && (SetThreadAffinityMask(thread, mask) != 0);
+    }
+    if (placement.priority > 0) {
+        auto level = (placement.priority >= 50) ? THREAD_PRIORITY_TIME_CRITICAL :
+                                                  THREAD_PRIORITY_HIGHEST;
+        applied = (SetThreadPriority(thread, level) != 0) && applied;
+    }
+    return applied;
+}
+
+bool applyThreadPlacement(const ThreadPlacement& placement)
+{
+    return placement.empty() || applyPlacement(GetCurrentThread(), placement);
+}
+
+bool applyThreadPlacement(std::thread& thread, const ThreadPlacement& placement)
+{
+    return placement.empty() || applyPlacement(thread.native_handle(), placement);
+}
+#else
+static bool applyPlacement(pthread_t thread, const ThreadPlacement& placement)
+{
+    bool applied{true};
+    if (!placement.cpus.empty()) {
+#    ifdef __linux__
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        bool anyCpu{false};
+        for (auto cpu : placement.cpus) {
+            if (cpu < CPU_SETSIZE) {
+                CPU_SET(cpu, &cpuset);
+                anyCpu = true;
+            }
+        }
+        applied = anyCpu && (pthread_setaffinity_np(thread, sizeof(cpuset), &cpuset) == 0);
+#    else
+        // there is no way to bind a thread to specific processors on this platform
+        applied = false;
+#    endif
+    }
+    if (placement.priority > 0) {
+        sched_param param{};
+        param.sched_priority = std::clamp(placement.priority,
+                                          sched_get_priority_min(SCHED_RR),
+                                          sched_get_priority_max(SCHED_RR));
+        applied = (pthread_setschedparam(thread, SCHED_RR, &param) == 0) && applied;
+    }
+    return applied;
+}
+
+bool applyThreadPlacement(const ThreadPlacement& placement)
+{
+    return placement.empty() || applyPlacement(pthread_self(), placement);
+}
+
+bool applyThreadPlacement(std::thread& thread, const ThreadPlacement& placement)
+{
+    return placement.empty() || applyPlacement(thread.native_handle(), placement);
+}
+#endif
+}  // namespace helics
@@ -0,0 +1,37 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace helics {
+/** the processors and scheduling priority a thread should run with*/
+struct ThreadPlacement {
+    std::vector<int> cpus;  //!< the processors the thread may run on,  empty for any processor
+    int priority{0};  //!< the real time scheduling priority,  0 to leave the priority unchanged
+    /** check if the placement leaves the thread unchanged*/
+    bool empty() const { return cpus.empty() && priority == 0; }
+};
+
+/** parse a set of processors
+@details the set is a comma separated list of processor numbers and ranges such as "0-3,8"
+@return a sorted list of unique processor numbers
+@throw std::invalid_argument if the string is not a valid processor set*/
+std::vector<int> parseCpuSet(const std::string& cpuSet);
+
+/** apply a placement to the calling thread
+@return false if the placement could not be applied on this platform or with the current
+permissions*/
+bool applyThreadPlacement(const ThreadPlacement& placement);
+
+/** apply a placement to a running thread
+@return false if the placement could not be applied on this platform or with the current
+permissions*/
+bool applyThreadPlacement(std::thread& thread, const ThreadPlacement& placement);
+}  // namespace helics
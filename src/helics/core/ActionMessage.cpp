@@ -175,6 +175,14 @@ static constexpr std::size_t action_message_base_size =
 int ActionMessage::toByteArray(std::byte* data, std::size_t buffer_size) const
 {
     static const uint8_t littleEndian = isLittleEndian();
+    if (messageAction == CMD_RELAY) {
+        // the payload is an already serialized message
+        if ((data == nullptr) || buffer_size < payload.size()) {
+            return -1;
+        }
+        std::memcpy(data, payload.data(), payload.size());
+        return static_cast<int>(payload.size());
+    }
     // put the main string size in the first 4 bytes;
     std::uint32_t ssize = (messageAction != CMD_TIME_REQUEST) ?
         static_cast<uint32_t>(payload.size() & 0x00FFFFFFUL) :
@@ -258,6 +266,9 @@ int ActionMessage::toByteArray(std::byte* data, std::size_t buffer_size) const
 
 int ActionMessage::serializedByteCount() const
 {
+    if (messageAction == CMD_RELAY) {
+        return static_cast<int>(payload.size());
+    }
     int size{action_message_base_size};
 
     // for time request add an additional 3*8 bytes
@@ -509,6 +520,59 @@ int ActionMessage::depacketize(const void* data, std::size_t buffer_size)
     return (bytesUsed > 0) ? message_size + 2 : 0;
 }
 
+bool readRoutingInfo(const std::byte* data, std::size_t buffer_size, SerializedRoutingInfo& info)
+{
+    static const uint8_t littleEndian = isLittleEndian();
+    info.body = data;
+    info.bodySize = buffer_size;
+    if (buffer_size >= 6 && data[0] == std::byte(LEADING_CHAR)) {
+        std::size_t message_size = (std::to_integer<std::size_t>(data[1]) << 16U) +
+            (std::to_integer<std::size_t>(data[2]) << 8U) + std::to_integer<std::size_t>(data[3]);
+        if (message_size < 4 || buffer_size < message_size + 2 ||
+            data[message_size] != std::byte(TAIL_CHAR1) ||
+            data[message_size + 1] != std::byte(TAIL_CHAR2)) {
+            return false;
+        }
+        info.body = data + 4;
+        info.bodySize = message_size - 4;
+        info.frameSize = message_size + 2;
+    } else {
+        info.frameSize = buffer_size;
+    }
+    const std::byte* body = info.body;
+    if (info.bodySize < action_message_base_size) {
+        return false;
+    }
+    std::size_t payloadSize = (std::to_integer<std::size_t>(body[1]) << 16U) +
+        (std::to_integer<std::size_t>(body[2]) << 8U) + std::to_integer<std::size_t>(body[3]);
+    if (info.bodySize < action_message_base_size + payloadSize) {
+        return false;
+    }
+    body += sizeof(uint32_t);
+    std::memcpy(&info.action, body, sizeof(action_message_def::action_t));
+    // skip the action, messageID, source_id, and source_handle
+    body += sizeof(action_message_def::action_t) + 3 * sizeof(int32_t);
+    std::memcpy(&info.dest_id, body, sizeof(GlobalFederateId));
+    body += sizeof(GlobalFederateId);
+    std::memcpy(&info.dest_handle, body, sizeof(InterfaceHandle));
+    if (info.body[0] != std::byte{littleEndian}) {
+        swap_bytes<sizeof(action_message_def::action_t)>(
+            reinterpret_cast<std::uint8_t*>(&info.action));
+        swap_bytes<4>(reinterpret_cast<std::uint8_t*>(&info.dest_id));
+        swap_bytes<4>(reinterpret_cast<std::uint8_t*>(&info.dest_handle));
+    }
+    return true;
+}
+
+ActionMessage createRelayCommand(const SerializedRoutingInfo& info)
+{
+    ActionMessage relay(CMD_RELAY);
+    relay.dest_id = info.dest_id;
+    relay.dest_handle = info.dest_handle;
+    relay.payload.assign(info.body, info.bodySize);
+    return relay;
+}
+
 void ActionMessage::from_string(std::string_view data)
 {
     fromByteArray(reinterpret_cast<const std::byte*>(data.data()), data.size());
@@ -587,7 +651,7 @@ std::unique_ptr<Message> createMessageFromCommand(ActionMessage&& cmd)
 static constexpr char unknownStr[] = "unknown";
 
 // Map to translate the action to a description
-static constexpr frozen::unordered_map<action_message_def::action_t, frozen::string, 93>
+static constexpr frozen::unordered_map<action_message_def::action_t, frozen::string, 99>
     actionStrings = {
         // priority commands
         {action_message_def::action_t::cmd_priority_disconnect, "priority_disconnect"},
@@ -598,6 +662,7 @@ static constexpr frozen::unordered_map<action_message_def::action_t, frozen::str
         {action_message_def::action_t::cmd_fed_ack, "fed_ack"},
 
         {action_message_def::action_t::cmd_broker_ack, "broker_ack"},
+        {action_message_def::action_t::cmd_broker_redirect, "broker_redirect"},
         {action_message_def::action_t::cmd_add_route, "add_route"},
         {action_message_def::action_t::cmd_route_ack, "route_ack"},
         {action_message_def::action_t::cmd_register_route, "register_route"},
@@ -605,6 +670,7 @@ static constexpr frozen::unordered_map<action_message_def::action_t, frozen::str
         {action_message_def::action_t::cmd_priority_ack, "priority_ack"},
         {action_message_def::action_t::cmd_query, "query"},
         {action_message_def::action_t::cmd_query_reply, "query_reply"},
+        {action_message_def::action_t::cmd_map_update, "map_update"},
         {action_message_def::action_t::cmd_reg_broker, "reg_broker"},
 
         {action_message_def::action_t::cmd_ignore, "ignore"},
@@ -639,6 +705,8 @@ static constexpr frozen::unordered_map<action_message_def::action_t, frozen::str
         {action_message_def::action_t::cmd_error, "error"},
 
         {action_message_def::action_t::cmd_send_route, "send_route"},
+        {action_message_def::action_t::cmd_route_marker, "route_marker"},
+        {action_message_def::action_t::cmd_close_route, "close_route"},
         {action_message_def::action_t::cmd_add_dependency, "add_dependency"},
         {action_message_def::action_t::cmd_remove_dependency, "remove_dependency"},
         {action_message_def::action_t::cmd_add_dependent, "add_dependent"},
@@ -650,6 +718,7 @@ static constexpr frozen::unordered_map<action_message_def::action_t, frozen::str
         {action_message_def::action_t::priority_null_info_command, "priority_null_info"},
         {action_message_def::action_t::cmd_time_request, "time_request"},
         {action_message_def::action_t::cmd_send_message, "send_message"},
+        {action_message_def::action_t::cmd_anti_message, "anti_message"},
         {action_message_def::action_t::cmd_send_for_filter, "send_for_filter"},
         {action_message_def::action_t::cmd_filter_result, "result from running a filter"},
         {action_message_def::action_t::cmd_send_for_filter_return, "send_for_filter_return"},
@@ -683,6 +752,7 @@ static constexpr frozen::unordered_map<action_message_def::action_t, frozen::str
         {action_message_def::action_t::cmd_remove_named_filter, "remove_named_filter"},
         {action_message_def::action_t::cmd_close_interface, "close_interface"},
         {action_message_def::action_t::cmd_multi_message, "multi message"},
+        {action_message_def::action_t::cmd_relay, "relay"},
         {action_message_def::action_t::cmd_broker_configure, "broker_configure"},
         {action_message_def::action_t::cmd_time_barrier_request, "request time barrier"},
         {action_message_def::action_t::cmd_time_barrier, "time barrier"},
@@ -782,6 +852,7 @@ std::string prettyPrintString(const ActionMessage& command)
         case CMD_FED_CONFIGURE_FLAG:
             break;
         case CMD_SEND_MESSAGE:
+        case CMD_ANTI_MESSAGE:
             ret.push_back(':');
             ret.append(fmt::format("From ({})({}:{}) To {} size {} at {}",
                                    command.getString(origSourceStringLoc),
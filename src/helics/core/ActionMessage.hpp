@@ -163,7 +163,8 @@ class ActionMessage {
     int32_t getExtraDestData() const { return source_handle.baseValue(); }
     // functions that convert to and from a byte stream
 
-    /** generate a size of the message in bytes if it were to be serialized*/
+    /** generate a size of the message in bytes if it were to be serialized
+    @details a CMD_RELAY message serializes as the message stored in its payload*/
     int serializedByteCount() const;
     /** convert a command to a raw data bytes
     @param[out] data pointer to memory to store the command
@@ -325,6 +326,29 @@ std::ostream& operator<<(std::ostream& os, const ActionMessage& command);
 @return the integer location of the message in the stringData section*/
 int appendMessage(ActionMessage& m, const ActionMessage& newMessage);
 
+/** the fields of a serialized message needed to route it to its destination*/
+struct SerializedRoutingInfo {
+    action_message_def::action_t action{CMD_INVALID};  //!< the action of the message
+    GlobalFederateId dest_id;  //!< the destination federate
+    InterfaceHandle dest_handle;  //!< the destination handle
+    const std::byte* body{nullptr};  //!< the serialized message without any packet framing
+    std::size_t bodySize{0};  //!< the number of bytes in the serialized message
+    std::size_t frameSize{0};  //!< the number of bytes used including any packet framing
+};
+
+/** read the routing fields of a serialized or packetized message without deserializing it
+@param data the serialized message, a packetized message must be complete
+@param buffer_size the number of bytes available
+@param[out] info the routing fields and the location of the serialized message
+@return true if the data contains a message that could be read
+*/
+bool readRoutingInfo(const std::byte* data, std::size_t buffer_size, SerializedRoutingInfo& info);
+
+/** generate a relay command which transmits a serialized message unchanged
+@details the relay command serializes to the original bytes so the message can be forwarded without
+deserializing the payload and string data*/
+ActionMessage createRelayCommand(const SerializedRoutingInfo& info);
+
 /** generate a string representing an error from an ActionMessage
 @param command the command to generate the error string for
 @return a string describing the error, if the string is not an error the string is empty
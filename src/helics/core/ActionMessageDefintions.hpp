@@ -25,6 +25,8 @@ across different compilers*/
             -25,  //!< a reply with the global id or an error if the fed registration failed
 
         cmd_broker_ack = -27,  // a reply to the connect command with a global route id
+        cmd_broker_redirect = -29,  //!< a reply to the connect command with the address of a
+                                    //!< different broker to connect to
         cmd_add_route = -32,  //!< command to define a route
         cmd_route_ack = -16,  //!< acknowledge reply to a route registration
         cmd_register_route = -15,  //!< instructions to create a direct route to another federate
@@ -41,6 +43,7 @@ across different compilers*/
         cmd_broker_query_ordered = 939,  //!< send a query to a core
         cmd_query_reply = -cmd_info_basis - 38,  //!< response to a query
         cmd_query_reply_ordered = 942,  //!< response to a query on normal paths
+        cmd_map_update = -41,  //!< notice that the contents of a subscribed query map changed
         cmd_reg_broker =
             -cmd_info_basis - 40,  //!< for a broker to connect with a higher level broker
         cmd_broker_location = cmd_info_basis - 57,  //!< command to define a new broker location
@@ -99,6 +102,9 @@ across different compilers*/
         cmd_error_check = 10001,  //!< check some status for error and error timeouts
         cmd_invalid = 1010101,  //!< indicates that command has generated an invalid state
         cmd_send_route = 75,  //!< command to define a route information
+        cmd_route_marker =
+            76,  //!< marker sent through a broker ahead of switching to a direct route
+        cmd_close_route = 77,  //!< command to remove a direct route to a disconnected core
         cmd_search_dependency = 1464,  //!< command to add a dependency by name
         cmd_add_dependency = 140,  //!< command to send a federate dependency information
         cmd_remove_dependency = 141,  //!< command to remove a dependency
@@ -137,6 +143,8 @@ across different compilers*/
         cmd_force_time_grant =
             525,  //!< command to force grant a time regardless of other considerations
         cmd_send_message = cmd_info_basis + 20,  //!< send a message
+        cmd_anti_message =
+            cmd_info_basis + 22,  //!< retract a message sent during a speculative time step
         cmd_null_message = 726,  //!< used when a filter drops a message but it needs to return
         cmd_null_dest_message = 730,  //!< used when a destination filter drops a message
         cmd_send_for_filter = cmd_info_basis +
@@ -175,6 +183,7 @@ across different compilers*/
 
         cmd_close_interface = 133,  //!< cmd to close all communications from an interface
         cmd_multi_message = 1037,  //!< cmd that encapsulates a bunch of messages in its payload
+        cmd_relay = 1039,  //!< a serialized data message in the payload forwarded without changes
 
         cmd_connection_error = 2034,  //!< cmd indicating a connection error with a broker/federate
 
@@ -224,6 +233,9 @@ across different compilers*/
 #define CMD_EXEC_CHECK action_message_def::action_t::cmd_exec_check
 #define CMD_REG_ROUTE action_message_def::action_t::cmd_register_route
 #define CMD_ROUTE_ACK action_message_def::action_t::cmd_route_ack
+#define CMD_SEND_ROUTE action_message_def::action_t::cmd_send_route
+#define CMD_ROUTE_MARKER action_message_def::action_t::cmd_route_marker
+#define CMD_CLOSE_ROUTE action_message_def::action_t::cmd_close_route
 #define CMD_STOP action_message_def::action_t::cmd_stop
 #define CMD_TERMINATE_IMMEDIATELY action_message_def::action_t::cmd_terminate_immediately
 #define CMD_TIME_REQUEST action_message_def::action_t::cmd_time_request
@@ -240,6 +252,7 @@ across different compilers*/
 #define CMD_TIME_BARRIER_CLEAR action_message_def::action_t::cmd_time_barrier_clear
 
 #define CMD_SEND_MESSAGE action_message_def::action_t::cmd_send_message
+#define CMD_ANTI_MESSAGE action_message_def::action_t::cmd_anti_message
 #define CMD_SEND_FOR_FILTER action_message_def::action_t::cmd_send_for_filter
 #define CMD_SEND_FOR_FILTER_AND_RETURN action_message_def::action_t::cmd_send_for_filter_return
 #define CMD_SEND_FOR_DEST_FILTER_AND_RETURN                                                        \
@@ -304,6 +317,7 @@ across different compilers*/
 
 #define CMD_REG_FED action_message_def::action_t::cmd_reg_fed
 #define CMD_BROKER_ACK action_message_def::action_t::cmd_broker_ack
+#define CMD_BROKER_REDIRECT action_message_def::action_t::cmd_broker_redirect
 #define CMD_FED_ACK action_message_def::action_t::cmd_fed_ack
 #define CMD_PROTOCOL_PRIORITY action_message_def::action_t::cmd_protocol_priority
 #define CMD_PROTOCOL action_message_def::action_t::cmd_protocol
@@ -328,12 +342,14 @@ across different compilers*/
 #define CMD_INTERFACE_QUERY action_message_def::action_t::cmd_interface_query
 #define CMD_QUERY_REPLY action_message_def::action_t::cmd_query_reply
 #define CMD_QUERY_REPLY_ORDERED action_message_def::action_t::cmd_query_reply_ordered
+#define CMD_MAP_UPDATE action_message_def::action_t::cmd_map_update
 #define CMD_SET_GLOBAL action_message_def::action_t::cmd_set_global
 
 #define CMD_SEND_COMMAND action_message_def::action_t::cmd_send_command
 #define CMD_COMMAND_STATUS action_message_def::action_t::cmd_command_status
 
 #define CMD_MULTI_MESSAGE action_message_def::action_t::cmd_multi_message
+#define CMD_RELAY action_message_def::action_t::cmd_relay
 
 // definitions for the protocol options
 #define PROTOCOL_PING 10
@@ -345,6 +361,7 @@ across different compilers*/
 #define UNPAUSE_TRANSMITTER 453625
 // routing information
 #define NEW_ROUTE 233
+#define NEW_PARENT_ROUTE 235
 #define REMOVE_ROUTE 244
 #define CONNECTION_INFORMATION 299
 #define CONNECTION_REQUEST 301
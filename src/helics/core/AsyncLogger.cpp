@@ -0,0 +1,160 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "AsyncLogger.hpp"
+
+#include <chrono>
+#include <utility>
+
+namespace helics {
+AsyncLogger::AsyncLogger(std::size_t queueSize,
+                         std::function<void(LogRecord&)> writer,
+                         std::function<void(std::size_t)> dropReporter):
+    writeFunction(std::move(writer)),
+    dropFunction(std::move(dropReporter))
+{
+    std::size_t size{2};
+    while (size < queueSize) {
+        size <<= 1U;
+    }
+    mask = size - 1;
+    cells = std::make_unique<Cell[]>(size);
+    for (std::size_t ii = 0; ii < size; ++ii) {
+        cells[ii].sequence.store(ii, std::memory_order_relaxed);
+    }
+    writerThread = std::thread(&AsyncLogger::writerLoop, this);
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    {
+        std::lock_guard<std::mutex> lock(waitLock);
+        halting.store(true);
+    }
+    wakeup.notify_one();
+    if (writerThread.joinable()) {
+        writerThread.join();
+    }
+}
+
+bool AsyncLogger::push(LogRecord&& record)
+{
+    auto pos = enqueuePos.load(std::memory_order_relaxed);
+    Cell* cell{nullptr};
+    while (true) {
+        cell = &cells[pos & mask];
+        auto seq = cell->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+        if (diff == 0) {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // the queue is full
+            return false;
+        } else {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    cell->record = std::move(record);
+    cell->sequence.store(pos + 1, std::memory_order_seq_cst);
+    if (sleeping.load()) {
+        std::lock_guard<std::mutex> lock(waitLock);
+        wakeup.notify_one();
+    }
+    return true;
+}
+
+bool AsyncLogger::tryPop(LogRecord& record)
+{
+    auto pos = dequeuePos.load(std::memory_order_relaxed);
+    Cell* cell{nullptr};
+    while (true) {
+        cell = &cells[pos & mask];
+        auto seq = cell->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+        if (diff == 0) {
+            if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+    record = std::move(cell->record);
+    cell->record.command.reset();
+    cell->sequence.store(pos + mask + 1, std::memory_order_release);
+    return true;
+}
+
+bool AsyncLogger::hasQueued() const
+{
+    auto pos = dequeuePos.load();
+    return cells[pos & mask].sequence.load() == pos + 1;
+}
+
+void AsyncLogger::flush()
+{
+    if (std::this_thread::get_id() == writerThread.get_id()) {
+        // flushing from within the writer would never complete
+        return;
+    }
+    auto target = enqueuePos.load();
+    std::unique_lock<std::mutex> lock(waitLock);
+    drained.wait(lock, [this, target]() { return written.load() >= target || halting.load(); });
+}
+
+void AsyncLogger::synchronize(const std::function<void()>& operation)
+{
+    std::lock_guard<std::mutex> lock(writeLock);
+    operation();
+}
+
+void AsyncLogger::writerLoop()
+{
+    LogRecord record;
+    while (true) {
+        bool wroteRecords{false};
+        {
+            std::lock_guard<std::mutex> lock(writeLock);
+            while (tryPop(record)) {
+                writeFunction(record);
+                record.command.reset();
+                written.fetch_add(1);
+                wroteRecords = true;
+            }
+            auto dropCount = dropped.load(std::memory_order_acquire);
+            if (dropCount > reportedDrops) {
+                if (dropFunction) {
+                    dropFunction(dropCount - reportedDrops);
+                }
+                reportedDrops = dropCount;
+            }
+        }
+        if (wroteRecords) {
+            {
+                std::lock_guard<std::mutex> lock(waitLock);
+            }
+            drained.notify_all();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(waitLock);
+        if (halting.load() && !hasQueued()) {
+            break;
+        }
+        sleeping.store(true);
+        // the timeout guards the drop report which does not signal the writer
+        wakeup.wait_for(lock, std::chrono::milliseconds(200), [this]() {
+            return halting.load() || hasQueued();
+        });
+        sleeping.store(false);
+    }
+    drained.notify_all();
+}
+
+}  // namespace helics
@@ -0,0 +1,97 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "ActionMessage.hpp"
+#include "global_federate_id.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace helics {
+/** a log message waiting to be written*/
+struct LogRecord {
+    GlobalFederateId federateID;  //!< the id of the object generating the message
+    int level{0};  //!< the logging level of the message
+    bool alwaysLog{false};  //!< the message should be written regardless of the sink levels
+    bool showDestination{false};  //!< include the destination in the command description
+    std::string name;  //!< the name of the source of the message
+    std::string message;  //!< the message or the prefix of a command description
+    /// a command whose description is generated when the record is written
+    std::unique_ptr<ActionMessage> command;
+};
+
+/** a background writer for log messages
+@details messages are placed in a bounded lock free queue and written by a separate thread so the
+threads generating the messages never wait on the logging sinks,  messages that do not fit in the
+queue are counted and the count reported through the writer*/
+class AsyncLogger {
+  public:
+    /** construct the logger and start the writer thread
+    @param queueSize the number of messages the queue can hold, rounded up to a power of 2
+    @param writer the function called on the writer thread to write each message
+    @param dropReporter function called on the writer thread with the number of messages dropped
+    since the last report*/
+    AsyncLogger(std::size_t queueSize,
+                std::function<void(LogRecord&)> writer,
+                std::function<void(std::size_t)> dropReporter);
+    /** destructor writes any queued messages and joins the writer thread*/
+    ~AsyncLogger();
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+    /** place a message in the queue
+    @return false if the queue was full,  the record is left unmodified in that case*/
+    bool push(LogRecord&& record);
+    /** block until all messages pushed before the call have been written*/
+    void flush();
+    /** execute a function while no messages are being written
+    @details used for changing the objects the writer makes use of*/
+    void synchronize(const std::function<void()>& operation);
+    /** record a message that was dropped because the queue was full*/
+    void countDropped() { dropped.fetch_add(1, std::memory_order_relaxed); }
+    /** get the total number of messages that have been dropped*/
+    std::size_t droppedCount() const { return dropped.load(std::memory_order_acquire); }
+    /** get the number of messages the queue can hold*/
+    std::size_t capacity() const { return mask + 1; }
+
+  private:
+    /** a slot in the queue with a sequence number indicating its state*/
+    struct Cell {
+        std::atomic<std::size_t> sequence{0};  //!< the position the cell is ready for
+        LogRecord record;  //!< the stored message
+    };
+    /** remove the next message from the queue if one is available*/
+    bool tryPop(LogRecord& record);
+    /** check if the next message in the queue is ready to be removed*/
+    bool hasQueued() const;
+    /** the loop executed by the writer thread*/
+    void writerLoop();
+
+    std::unique_ptr<Cell[]> cells;  //!< the storage for the queue
+    std::size_t mask{0};  //!< the mask for converting positions to cell indices
+    alignas(64) std::atomic<std::size_t> enqueuePos{0};  //!< the next position to fill
+    alignas(64) std::atomic<std::size_t> dequeuePos{0};  //!< the next position to remove
+    alignas(64) std::atomic<std::size_t> dropped{0};  //!< the number of messages dropped
+    std::atomic<std::size_t> written{0};  //!< the number of queued messages written
+    std::size_t reportedDrops{0};  //!< the drop count at the last report
+    std::function<void(LogRecord&)> writeFunction;  //!< the function writing a message
+    std::function<void(std::size_t)> dropFunction;  //!< the function reporting dropped messages
+    std::mutex writeLock;  //!< lock held while the writer is writing messages
+    std::mutex waitLock;  //!< lock for the condition variables
+    std::condition_variable wakeup;  //!< signal to the writer that messages are available
+    std::condition_variable drained;  //!< signal that queued messages have been written
+    std::atomic<bool> sleeping{false};  //!< the writer is waiting for messages
+    std::atomic<bool> halting{false};  //!< the writer should exit once the queue is empty
+    std::thread writerThread;  //!< the thread writing the messages
+};
+}  // namespace helics
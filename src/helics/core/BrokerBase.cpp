@@ -8,6 +8,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "BrokerBase.hpp"
 
 #include "../common/fmt_format.h"
+#include "AsyncLogger.hpp"
 #include "ForwardingTimeCoordinator.hpp"
 #include "flagOperations.hpp"
 #include "gmlc/libguarded/guarded.hpp"
@@ -36,6 +37,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include <iostream>
 #include <map>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -66,6 +68,8 @@ BrokerBase::BrokerBase(const std::string& broker_name, bool DisableQueue):
 
 BrokerBase::~BrokerBase()
 {
+    // write out anything remaining in the asynchronous logging queue
+    asyncLogger.reset();
     consoleLogger.reset();
     if (fileLogger) {
         spdlog::drop(identifier);
@@ -93,6 +97,9 @@ void BrokerBase::joinAllThreads()
         actionQueue.push(CMD_TERMINATE_IMMEDIATELY);
         queueProcessingThread.join();
     }
+    if (asyncLogger) {
+        asyncLogger->flush();
+    }
 }
 
 std::shared_ptr<helicsCLI11App> BrokerBase::generateCLI()
@@ -102,6 +109,11 @@ std::shared_ptr<helicsCLI11App> BrokerBase::generateCLI()
     return hApp;
 }
 
+void BrokerBase::setCutThroughRoutes(const GlobalIdTable<route_id>& /*routes*/,
+                                     bool /*forwardUnknown*/)
+{
+}
+
 static const std::map<std::string, int> log_level_map{{"none", HELICS_LOG_LEVEL_NO_PRINT},
                                                       {"no_print", HELICS_LOG_LEVEL_NO_PRINT},
                                                       {"error", HELICS_LOG_LEVEL_ERROR},
@@ -117,6 +129,17 @@ static const std::map<std::string, int> log_level_map{{"none", HELICS_LOG_LEVEL_
                                                       /** all internal messages*/
                                                       {"trace", HELICS_LOG_LEVEL_TRACE}};
 
+/** load a processor set option like "0-3,8"*/
+static std::vector<int> loadCpuSet(const std::string& val)
+{
+    try {
+        return parseCpuSet(val);
+    }
+    catch (const std::invalid_argument& ia) {
+        throw CLI::ValidationError(ia.what());
+    }
+}
+
 std::shared_ptr<helicsCLI11App> BrokerBase::generateBaseCLI()
 {
     auto hApp = std::make_shared<helicsCLI11App>("Arguments applying to all Brokers and Cores");
@@ -153,6 +176,11 @@ std::shared_ptr<helicsCLI11App> BrokerBase::generateBaseCLI()
     hApp->add_flag("--terminate_on_error",
                    terminate_on_error,
                    "specify that a broker should cause the federation to terminate on an error");
+    hApp->add_flag(
+        "--coalesce,!--no_coalesce",
+        coalesceTimeMessages,
+        "skip queued time requests that are superseded by a newer request from the same source "
+        "(default off)");
     auto* logging_group =
         hApp->add_option_group("logging", "Options related to file and message logging");
     logging_group->add_flag_function(
@@ -163,6 +191,15 @@ std::shared_ptr<helicsCLI11App> BrokerBase::generateBaseCLI()
             }
         },
         "flush the log after every message");
+    logging_group->add_flag(
+        "--async_logging",
+        asyncLogging,
+        "write log messages from a separate thread so logging does not slow down message processing");
+    logging_group
+        ->add_option("--log_queue_size",
+                     logQueueSize,
+                     "the number of messages the asynchronous logging queue can hold before messages are dropped")
+        ->check(CLI::PositiveNumber);
     logging_group->add_option("--logfile", logFile, "the file to log the messages to");
     logging_group
         ->add_option_function<int>(
@@ -219,6 +256,34 @@ std::shared_ptr<helicsCLI11App> BrokerBase::generateBaseCLI()
                      "like '10s' or '45ms') ")
         ->default_str(std::to_string(static_cast<double>(errorDelay)));
 
+    auto* thread_group = hApp->add_option_group(
+        "threads", "Options related to the processors and priority of the broker threads");
+    thread_group->add_option_function<std::string>(
+        "--cpu_affinity",
+        [this](const std::string& val) { threadCpus = loadCpuSet(val); },
+        "the processors (for example '0-3,8') the processing, communication, and asio threads "
+        "run on unless set individually");
+    thread_group->add_option_function<std::string>(
+        "--processing_cpus",
+        [this](const std::string& val) { processingPlacement.cpus = loadCpuSet(val); },
+        "the processors the message processing thread runs on");
+    thread_group->add_option_function<std::string>(
+        "--comms_cpus",
+        [this](const std::string& val) { commsPlacement.cpus = loadCpuSet(val); },
+        "the processors the network transmit and receive threads run on");
+    thread_group->add_option_function<std::string>(
+        "--asio_cpus",
+        [this](const std::string& val) { asioPlacement.cpus = loadCpuSet(val); },
+        "the processors the asio context loop thread runs on, the context is shared by all "
+        "brokers and cores in a process");
+    thread_group
+        ->add_option(
+            "--thread_priority",
+            threadPriority,
+            "the real time (round robin) scheduling priority of the broker threads, 0 leaves the "
+            "priority unchanged")
+        ->check(CLI::Range(0, 99));
+
     return hApp;
 }
 
@@ -307,12 +372,66 @@ void BrokerBase::configureBase()
     timeCoord->restrictive_time_policy = restrictive_time_policy;
 
     generateLoggers();
+    if (asyncLogging && !asyncLogger) {
+        asyncLogger = std::make_unique<AsyncLogger>(
+            static_cast<std::size_t>(logQueueSize),
+            [this](LogRecord& record) { writeLogRecord(record); },
+            [this](std::size_t count) {
+                writeLogMessage(global_id.load(),
+                                HELICS_LOG_LEVEL_WARNING,
+                                false,
+                                identifier,
+                                fmt::format("{} log messages dropped, the logging queue is full",
+                                            count));
+            });
+    }
+
+    for (auto* placement : {&processingPlacement, &commsPlacement, &asioPlacement}) {
+        if (placement->cpus.empty()) {
+            placement->cpus = threadCpus;
+        }
+        if (placement->priority == 0) {
+            placement->priority = threadPriority;
+        }
+    }
+#ifndef HELICS_DISABLE_ASIO
+    if (!asioPlacement.empty()) {
+        AsioContextManager::getContextPointer()->setLoopInitializer(
+            [placement = asioPlacement]() { applyThreadPlacement(placement); });
+    }
+#endif
 
     mainLoopIsRunning.store(true);
-    queueProcessingThread = std::thread(&BrokerBase::queueProcessingLoop, this);
+    // with the queue disabled the owner processes the commands through processQueuedCommands
+    if (!queueDisabled) {
+        queueProcessingThread = std::thread(&BrokerBase::queueProcessingLoop, this);
+        if (!applyThreadPlacement(queueProcessingThread, processingPlacement)) {
+            sendToLogger(global_id.load(),
+                         HELICS_LOG_LEVEL_WARNING,
+                         identifier,
+                         "unable to set the processor affinity or priority of the processing "
+                         "thread");
+        }
+    }
     brokerState = broker_state_t::configured;
 }
 
+static std::string
+    commandLogString(std::string_view prefix, const ActionMessage& command, bool showDestination)
+{
+    if (showDestination) {
+        return fmt::format("{}{} from {} to {}",
+                           prefix,
+                           prettyPrintString(command),
+                           command.source_id.baseValue(),
+                           command.dest_id.baseValue());
+    }
+    return fmt::format("{}{} from {}",
+                       prefix,
+                       prettyPrintString(command),
+                       command.source_id.baseValue());
+}
+
 bool BrokerBase::sendToLogger(GlobalFederateId federateID,
                               int logLevel,
                               std::string_view name,
@@ -328,72 +447,144 @@ bool BrokerBase::sendToLogger(GlobalFederateId federateID,
             // check the logging level
             return true;
         }
-        if (loggerFunction) {
-            loggerFunction(logLevel, fmt::format("{} ({})", name, federateID.baseValue()), message);
+        if (asyncLogger) {
+            LogRecord record;
+            record.federateID = federateID;
+            record.level = logLevel;
+            record.alwaysLog = alwaysLog;
+            record.name = name;
+            record.message = message;
+            queueLogRecord(std::move(record));
         } else {
-            if (consoleLogLevel >= logLevel || alwaysLog) {
-                if (logLevel >= HELICS_LOG_LEVEL_TRACE) {
-                    consoleLogger->log(
-                        spdlog::level::trace, "{} ({})::{}", name, federateID.baseValue(), message);
-                } else if (logLevel >= HELICS_LOG_LEVEL_TIMING) {
-                    consoleLogger->log(
-                        spdlog::level::debug, "{} ({})::{}", name, federateID.baseValue(), message);
-                } else if (logLevel >= HELICS_LOG_LEVEL_SUMMARY) {
-                    consoleLogger->log(
-                        spdlog::level::info, "{} ({})::{}", name, federateID.baseValue(), message);
-                } else if (logLevel >= HELICS_LOG_LEVEL_WARNING) {
-                    consoleLogger->log(
-                        spdlog::level::warn, "{} ({})::{}", name, federateID.baseValue(), message);
-                } else if (logLevel >= HELICS_LOG_LEVEL_ERROR) {
-                    consoleLogger->log(
-                        spdlog::level::err, "{} ({})::{}", name, federateID.baseValue(), message);
-                } else if (logLevel == -10) {  // dumplog
-                    consoleLogger->log(spdlog::level::trace, "{}", message);
-                } else {
-                    consoleLogger->log(spdlog::level::critical,
-                                       "{} ({})::{}",
-                                       name,
-                                       federateID.baseValue(),
-                                       message);
-                }
-                if (forceLoggingFlush) {
-                    consoleLogger->flush();
-                }
+            writeLogMessage(federateID, logLevel, alwaysLog, name, message);
+        }
+        return true;
+    }
+    return false;
+}
+
+void BrokerBase::logCommand(GlobalFederateId federateID,
+                            int logLevel,
+                            std::string_view name,
+                            std::string_view prefix,
+                            const ActionMessage& command,
+                            bool showDestination) const
+{
+    if (!asyncLogger) {
+        sendToLogger(
+            federateID, logLevel, name, commandLogString(prefix, command, showDestination));
+        return;
+    }
+    if (((federateID != parent_broker_id) && (federateID != global_id.load())) ||
+        logLevel > maxLogLevel) {
+        return;
+    }
+    LogRecord record;
+    record.federateID = federateID;
+    record.level = logLevel;
+    record.showDestination = showDestination;
+    record.name = name;
+    record.message = prefix;
+    record.command = std::make_unique<ActionMessage>(command);
+    queueLogRecord(std::move(record));
+}
+
+void BrokerBase::queueLogRecord(LogRecord&& record) const
+{
+    if (asyncLogger->push(std::move(record))) {
+        return;
+    }
+    if (record.level <= HELICS_LOG_LEVEL_WARNING) {
+        asyncLogger->synchronize([this, &record]() { writeLogRecord(record); });
+    } else {
+        asyncLogger->countDropped();
+    }
+}
+
+void BrokerBase::writeLogRecord(LogRecord& record) const
+{
+    if (record.command) {
+        record.message =
+            commandLogString(record.message, *record.command, record.showDestination);
+    }
+    writeLogMessage(
+        record.federateID, record.level, record.alwaysLog, record.name, record.message);
+}
+
+void BrokerBase::writeLogMessage(GlobalFederateId federateID,
+                                 int logLevel,
+                                 bool alwaysLog,
+                                 std::string_view name,
+                                 std::string_view message) const
+{
+    if (loggerFunction) {
+        loggerFunction(logLevel, fmt::format("{} ({})", name, federateID.baseValue()), message);
+    } else {
+        if (consoleLogLevel >= logLevel || alwaysLog) {
+            if (logLevel >= HELICS_LOG_LEVEL_TRACE) {
+                consoleLogger->log(
+                    spdlog::level::trace, "{} ({})::{}", name, federateID.baseValue(), message);
+            } else if (logLevel >= HELICS_LOG_LEVEL_TIMING) {
+                consoleLogger->log(
+                    spdlog::level::debug, "{} ({})::{}", name, federateID.baseValue(), message);
+            } else if (logLevel >= HELICS_LOG_LEVEL_SUMMARY) {
+                consoleLogger->log(
+                    spdlog::level::info, "{} ({})::{}", name, federateID.baseValue(), message);
+            } else if (logLevel >= HELICS_LOG_LEVEL_WARNING) {
+                consoleLogger->log(
+                    spdlog::level::warn, "{} ({})::{}", name, federateID.baseValue(), message);
+            } else if (logLevel >= HELICS_LOG_LEVEL_ERROR) {
+                consoleLogger->log(
+                    spdlog::level::err, "{} ({})::{}", name, federateID.baseValue(), message);
+            } else if (logLevel == -10) {  // dumplog
+                consoleLogger->log(spdlog::level::trace, "{}", message);
+            } else {
+                consoleLogger->log(spdlog::level::critical,
+                                   "{} ({})::{}",
+                                   name,
+                                   federateID.baseValue(),
+                                   message);
+            }
+            if (forceLoggingFlush) {
+                consoleLogger->flush();
+            }
+        }
+        if (fileLogger && (logLevel <= fileLogLevel || alwaysLog)) {
+            if (logLevel >= HELICS_LOG_LEVEL_TRACE) {
+                fileLogger->log(
+                    spdlog::level::trace, "{} ({})::{}", name, federateID.baseValue(), message);
+            } else if (logLevel >= HELICS_LOG_LEVEL_TIMING) {
+                fileLogger->log(
+                    spdlog::level::debug, "{} ({})::{}", name, federateID.baseValue(), message);
+            } else if (logLevel >= HELICS_LOG_LEVEL_SUMMARY) {
+                fileLogger->log(
+                    spdlog::level::info, "{} ({})::{}", name, federateID.baseValue(), message);
+            } else if (logLevel >= HELICS_LOG_LEVEL_WARNING) {
+                fileLogger->log(
+                    spdlog::level::warn, "{} ({})::{}", name, federateID.baseValue(), message);
+            } else if (logLevel >= HELICS_LOG_LEVEL_ERROR) {
+                fileLogger->log(
+                    spdlog::level::err, "{} ({})::{}", name, federateID.baseValue(), message);
+            } else if (logLevel == -10) {  // dumplog
+                fileLogger->log(spdlog::level::trace, message);
+            } else {
+                fileLogger->log(spdlog::level::critical,
+                                "{} ({})::{}",
+                                name,
+                                federateID.baseValue(),
+                                message);
             }
-            if (fileLogger && (logLevel <= fileLogLevel || alwaysLog)) {
-                if (logLevel >= HELICS_LOG_LEVEL_TRACE) {
-                    fileLogger->log(
-                        spdlog::level::trace, "{} ({})::{}", name, federateID.baseValue(), message);
-                } else if (logLevel >= HELICS_LOG_LEVEL_TIMING) {
-                    fileLogger->log(
-                        spdlog::level::debug, "{} ({})::{}", name, federateID.baseValue(), message);
-                } else if (logLevel >= HELICS_LOG_LEVEL_SUMMARY) {
-                    fileLogger->log(
-                        spdlog::level::info, "{} ({})::{}", name, federateID.baseValue(), message);
-                } else if (logLevel >= HELICS_LOG_LEVEL_WARNING) {
-                    fileLogger->log(
-                        spdlog::level::warn, "{} ({})::{}", name, federateID.baseValue(), message);
-                } else if (logLevel >= HELICS_LOG_LEVEL_ERROR) {
-                    fileLogger->log(
-                        spdlog::level::err, "{} ({})::{}", name, federateID.baseValue(), message);
-                } else if (logLevel == -10) {  // dumplog
-                    fileLogger->log(spdlog::level::trace, message);
-                } else {
-                    fileLogger->log(spdlog::level::critical,
-                                    "{} ({})::{}",
-                                    name,
-                                    federateID.baseValue(),
-                                    message);
-                }
 
-                if (forceLoggingFlush) {
-                    fileLogger->flush();
-                }
+            if (forceLoggingFlush) {
+                fileLogger->flush();
             }
         }
-        return true;
     }
-    return false;
+}
+
+std::size_t BrokerBase::droppedLogMessageCounter() const
+{
+    return (asyncLogger) ? asyncLogger->droppedCount() : 0;
 }
 
 void BrokerBase::generateNewIdentifier()
@@ -423,14 +614,21 @@ void BrokerBase::setErrorState(int eCode, std::string_view estring)
 void BrokerBase::setLoggingFile(const std::string& lfile)
 {
     if (logFile.empty() || lfile != logFile) {
-        logFile = lfile;
-        if (!logFile.empty()) {
-            fileLogger = spdlog::basic_logger_mt(identifier, logFile);
-        } else {
-            if (fileLogger) {
-                spdlog::drop(identifier);
-                fileLogger.reset();
+        auto updateFileLogger = [this, &lfile]() {
+            logFile = lfile;
+            if (!logFile.empty()) {
+                fileLogger = spdlog::basic_logger_mt(identifier, logFile);
+            } else {
+                if (fileLogger) {
+                    spdlog::drop(identifier);
+                    fileLogger.reset();
+                }
             }
+        };
+        if (asyncLogger) {
+            asyncLogger->synchronize(updateFileLogger);
+        } else {
+            updateFileLogger();
         }
     }
 }
@@ -450,7 +648,12 @@ bool BrokerBase::getFlagValue(int32_t flag) const
 void BrokerBase::setLoggerFunction(
     std::function<void(int, std::string_view, std::string_view)> logFunction)
 {
-    loggerFunction = std::move(logFunction);
+    if (asyncLogger) {
+        asyncLogger->synchronize(
+            [this, &logFunction]() { loggerFunction = std::move(logFunction); });
+    } else {
+        loggerFunction = std::move(logFunction);
+    }
 }
 
 void BrokerBase::setLogLevel(int32_t level)
@@ -460,6 +663,9 @@ void BrokerBase::setLogLevel(int32_t level)
 
 void BrokerBase::logFlush()
 {
+    if (asyncLogger) {
+        asyncLogger->flush();
+    }
     if (consoleLogger) {
         consoleLogger->flush();
     }
@@ -489,6 +695,7 @@ void BrokerBase::addActionMessage(const ActionMessage& m)
     if (isPriorityCommand(m)) {
         actionQueue.pushPriority(m);
     } else {
+        trackSupersedable(m);
         // just route to the general queue;
         actionQueue.push(m);
     }
@@ -505,10 +712,54 @@ void BrokerBase::addActionMessage(ActionMessage&& m)
     if (isPriorityCommand(m)) {
         actionQueue.emplacePriority(std::move(m));
     } else {
+        trackSupersedable(m);
         // just route to the general queue;
         actionQueue.emplace(std::move(m));
     }
 }
+
+/** a time request carries the complete time state of its source so only the newest queued request
+from a source to a destination needs processing,  skipping older ones delays a state update which is
+always conservative.  Dependency additions and removals are not idempotent so are never skipped*/
+static bool isSupersedable(const ActionMessage& m)
+{
+    return (m.action() == CMD_TIME_REQUEST);
+}
+
+static std::uint64_t supersedeKey(const ActionMessage& m)
+{
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(m.source_id.baseValue()))
+            << 32U) |
+        static_cast<std::uint32_t>(m.dest_id.baseValue());
+}
+
+void BrokerBase::trackSupersedable(const ActionMessage& m)
+{
+    if (!coalesceTimeMessages || !isSupersedable(m)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(supersedeLock);
+    ++pendingSupersedable[supersedeKey(m)];
+}
+
+bool BrokerBase::isSuperseded(const ActionMessage& m)
+{
+    if (!coalesceTimeMessages || !isSupersedable(m)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(supersedeLock);
+    auto pending = pendingSupersedable.find(supersedeKey(m));
+    if (pending == pendingSupersedable.end()) {
+        // the message was queued before coalescing was enabled
+        return false;
+    }
+    if (--pending->second == 0) {
+        pendingSupersedable.erase(pending);
+        return false;
+    }
+    ++supersededCounter;
+    return true;
+}
 #ifndef HELICS_DISABLE_ASIO
 using activeProtector = gmlc::libguarded::guarded<std::pair<bool, bool>>;
 
@@ -582,7 +833,6 @@ void BrokerBase::queueProcessingLoop()
         mainLoopIsRunning.store(false);
         return;
     }
-    std::vector<ActionMessage> dumpMessages;
 #ifndef HELICS_DISABLE_ASIO
     auto serv = AsioContextManager::getContextPointer();
     auto contextLoop = serv->startContextLoop();
@@ -614,20 +864,7 @@ void BrokerBase::queueProcessingLoop()
 #endif
 
     global_broker_id_local = global_id.load();
-    int messagesSinceLastTick = 0;
-    auto logDump = [&, this]() {
-        if (!dumpMessages.empty()) {
-            for (auto& act : dumpMessages) {
-                sendToLogger(parent_broker_id,
-                             -10,
-                             identifier,
-                             fmt::format("|| dl cmd:{} from {} to {}",
-                                         prettyPrintString(act),
-                                         act.source_id.baseValue(),
-                                         act.dest_id.baseValue()));
-            }
-        }
-    };
+    messagesSinceLastTick = 0;
     if (haltOperations) {
         timerStop();
         mainLoopIsRunning.store(false);
@@ -635,19 +872,7 @@ void BrokerBase::queueProcessingLoop()
     }
     while (true) {
         auto command = actionQueue.pop();
-        ++messageCounter;
-        if (dumplog) {
-            dumpMessages.push_back(command);
-        }
-        if (command.action() == CMD_IGNORE) {
-            continue;
-        }
-        auto ret = commandProcessor(command);
-        if (ret == CMD_IGNORE) {
-            ++messagesSinceLastTick;
-            continue;
-        }
-        switch (ret) {
+        switch (processQueueCommand(command)) {
             case CMD_TICK:
                 if (checkActionFlag(command, error_flag)) {
 #ifndef HELICS_DISABLE_ASIO
@@ -714,24 +939,10 @@ void BrokerBase::queueProcessingLoop()
                     }
                 }
                 break;
-            case CMD_PING:
-                // ping is processed normally but doesn't count as an actual message for timeout
-                // purposes unless it comes from the parent
-                if (command.source_id != parent_broker_id) {
-                    ++messagesSinceLastTick;
-                }
-                processCommand(std::move(command));
-                break;
-            case CMD_BASE_CONFIGURE:
-                baseConfigure(command);
-                break;
-            case CMD_IGNORE:
-            default:
-                break;
             case CMD_TERMINATE_IMMEDIATELY:
                 timerStop();
                 mainLoopIsRunning.store(false);
-                logDump();
+                logDumpMessages();
                 {
                     auto tcmd = actionQueue.try_pop();
                     while (tcmd) {
@@ -745,14 +956,9 @@ void BrokerBase::queueProcessingLoop()
                     }
                 }
                 return;  // immediate return
-            case CMD_STOP:
+            case CMD_STOP: {
                 timerStop();
-                if (!haltOperations) {
-                    processCommand(std::move(command));
-                    mainLoopIsRunning.store(false);
-                    logDump();
-                    processDisconnect();
-                }
+                processStopCommand(command);
                 auto tcmd = actionQueue.try_pop();
                 while (tcmd) {
                     if (!isDisconnectCommand(*tcmd)) {
@@ -763,11 +969,107 @@ void BrokerBase::queueProcessingLoop()
                     }
                     tcmd = actionQueue.try_pop();
                 }
+            }
                 return;
+            default:
+                break;
         }
     }
 }
 
+void BrokerBase::processQueuedCommands()
+{
+    auto command = actionQueue.try_pop();
+    while (command) {
+        if (!mainLoopIsRunning.load()) {
+            // processing has stopped so anything remaining is discarded
+            command = actionQueue.try_pop();
+            continue;
+        }
+        switch (processQueueCommand(*command)) {
+            case CMD_TERMINATE_IMMEDIATELY:
+                mainLoopIsRunning.store(false);
+                logDumpMessages();
+                break;
+            case CMD_STOP:
+                processStopCommand(*command);
+                break;
+            case CMD_TICK:
+            case CMD_ERROR_CHECK:
+                // there is no timer without the processing thread
+            default:
+                break;
+        }
+        command = actionQueue.try_pop();
+    }
+}
+
+action_message_def::action_t BrokerBase::processQueueCommand(ActionMessage& command)
+{
+    ++messageCounter;
+    if (dumplog) {
+        dumpMessages.push_back(command);
+    }
+    if (command.action() == CMD_IGNORE) {
+        return CMD_IGNORE;
+    }
+    if (isSuperseded(command)) {
+        ++messagesSinceLastTick;
+        return CMD_IGNORE;
+    }
+    ++processedCounter;
+    auto ret = commandProcessor(command);
+    switch (ret) {
+        case CMD_IGNORE:
+            ++messagesSinceLastTick;
+            break;
+        case CMD_PING:
+            // ping is processed normally but doesn't count as an actual message for timeout
+            // purposes unless it comes from the parent
+            if (command.source_id != parent_broker_id) {
+                ++messagesSinceLastTick;
+            }
+            processCommand(std::move(command));
+            break;
+        case CMD_BASE_CONFIGURE:
+            baseConfigure(command);
+            break;
+        case CMD_TICK:
+        case CMD_ERROR_CHECK:
+        case CMD_TERMINATE_IMMEDIATELY:
+        case CMD_STOP:
+            return ret;
+        default:
+            break;
+    }
+    return CMD_IGNORE;
+}
+
+void BrokerBase::processStopCommand(ActionMessage& command)
+{
+    if (!haltOperations) {
+        processCommand(std::move(command));
+        mainLoopIsRunning.store(false);
+        logDumpMessages();
+        processDisconnect();
+    }
+    mainLoopIsRunning.store(false);
+}
+
+void BrokerBase::logDumpMessages()
+{
+    for (auto& act : dumpMessages) {
+        sendToLogger(parent_broker_id,
+                     -10,
+                     identifier,
+                     fmt::format("|| dl cmd:{} from {} to {}",
+                                 prettyPrintString(act),
+                                 act.source_id.baseValue(),
+                                 act.dest_id.baseValue()));
+    }
+    dumpMessages.clear();
+}
+
 void BrokerBase::baseConfigure(ActionMessage& command)
 {
     if (command.action() == CMD_BASE_CONFIGURE) {
@@ -811,6 +1113,15 @@ action_message_def::action_t BrokerBase::commandProcessor(ActionMessage& command
                 }
             }
             break;
+        case CMD_RELAY:
+            if (!haltOperations) {
+                // a relayed message that could not be forwarded directly
+                ActionMessage NMess;
+                NMess.from_string(command.payload.to_string());
+                command = std::move(NMess);
+                return commandProcessor(command);
+            }
+            break;
         default:
             if (!haltOperations) {
                 if (isPriorityCommand(command)) {
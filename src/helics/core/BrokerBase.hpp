@@ -11,14 +11,19 @@ virtual base class for object that function like a broker includes common parame
 and some common methods used cores and brokers
 */
 
+#include "../common/ThreadPlacement.hpp"
 #include "ActionMessage.hpp"
+#include "DenseIdTable.hpp"
 #include "federate_id_extra.hpp"
 #include "gmlc/containers/BlockingPriorityQueue.hpp"
 
 #include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace spdlog {
@@ -27,6 +32,8 @@ class logger;
 namespace helics {
 class ForwardingTimeCoordinator;
 class helicsCLI11App;
+class AsyncLogger;
+struct LogRecord;
 /** base class for broker like objects
  */
 class BrokerBase {
@@ -76,14 +83,33 @@ class BrokerBase {
         false};  //!< flag indicating that the main processing loop is running
     bool dumplog{false};  //!< flag indicating the broker should capture a dump log
     std::atomic<bool> forceLoggingFlush{false};  //!< force the log to flush after every message
+    bool asyncLogging{false};  //!< write log messages from a separate thread
+    int logQueueSize{4096};  //!< the number of messages the asynchronous logging queue holds
+    std::unique_ptr<AsyncLogger> asyncLogger;  //!< the writer for asynchronous logging
+    std::vector<int> threadCpus;  //!< the default processors for all the broker threads
+    int threadPriority{0};  //!< the real time priority of the broker threads,  0 for unchanged
     bool queueDisabled{
         false};  //!< flag indicating that the message queue should not be used and all functions
     //!< called directly instead of distinct thread
     bool disable_timer{false};  //!< turn off the timer/timeout subsystem completely
     std::atomic<std::size_t> messageCounter{
         0};  //!< counter for the total number of message processed
+    /// counter for the commands actually processed,  excluding ignored and superseded commands
+    std::atomic<std::size_t> processedCounter{0};
+    bool coalesceTimeMessages{false};  //!< skip queued time requests superseded by a newer one
+    std::atomic<std::size_t> supersededCounter{
+        0};  //!< counter for the number of queued messages skipped as superseded
+    std::mutex supersedeLock;  //!< lock protecting the pending supersedable message counts
+    /// the number of queued supersedable messages for each source/destination pair
+    std::unordered_map<std::uint64_t, std::uint32_t> pendingSupersedable;
+    std::vector<ActionMessage> dumpMessages;  //!< the messages captured for the dump log
+    /// the number of messages processed since the last timer tick
+    int messagesSinceLastTick{0};
   protected:
     std::string logFile;  //!< the file to log message to
+    ThreadPlacement processingPlacement;  //!< processors and priority of the processing thread
+    ThreadPlacement commsPlacement;  //!< processors and priority of the communication threads
+    ThreadPlacement asioPlacement;  //!< processors and priority of the asio context thread
     std::unique_ptr<ForwardingTimeCoordinator> timeCoord;  //!< object managing the time control
     gmlc::containers::BlockingPriorityQueue<ActionMessage> actionQueue;  //!< primary routing queue
     // time coordinator for managing filters
@@ -168,13 +194,30 @@ class BrokerBase {
     void setLogLevels(int32_t consoleLevel, int32_t fileLevel);
     /** get the internal global broker id*/
     GlobalBrokerId getGlobalId() const { return global_id.load(); }
+    /** check if the broker is capturing all processed messages in a dump log*/
+    bool isDumpLogging() const { return dumplog; }
 
   private:
     /** start main broker loop*/
     void queueProcessingLoop();
+    /** record a supersedable message being added to the action queue*/
+    void trackSupersedable(const ActionMessage& m);
+    /** check if a message popped from the action queue has been replaced by a newer queued message
+    from the same source to the same destination*/
+    bool isSuperseded(const ActionMessage& m);
     /** helper function for doing some preprocessing on a command
     @return (CMD_IGNORE) if the command is a termination command*/
     action_message_def::action_t commandProcessor(ActionMessage& command);
+    /** process a single command taken from the action queue
+    @details used by both the processing thread and processQueuedCommands,  the timer commands and
+    the end of processing are left to the caller
+    @return CMD_TICK, CMD_ERROR_CHECK, CMD_TERMINATE_IMMEDIATELY, or CMD_STOP if the caller needs to
+    handle the command, otherwise CMD_IGNORE*/
+    action_message_def::action_t processQueueCommand(ActionMessage& command);
+    /** process a stop command and end the command processing*/
+    void processStopCommand(ActionMessage& command);
+    /** write the messages captured for the dump log to the logger*/
+    void logDumpMessages();
 
     /** Generate the base CLI processor*/
     std::shared_ptr<helicsCLI11App> generateBaseCLI();
@@ -182,8 +225,24 @@ class BrokerBase {
     void generateLoggers();
     /** handle some configuration options for the base*/
     void baseConfigure(ActionMessage& command);
+    /** write a message to the logger function or the console and file loggers*/
+    void writeLogMessage(GlobalFederateId federateID,
+                         int logLevel,
+                         bool alwaysLog,
+                         std::string_view name,
+                         std::string_view message) const;
+    /** write a record from the asynchronous logging queue*/
+    void writeLogRecord(LogRecord& record) const;
+    /** place a record in the asynchronous logging queue
+    @details errors and warnings are written directly if the queue is full,  other messages are
+    dropped*/
+    void queueLogRecord(LogRecord&& record) const;
 
   protected:
+    /** process all the commands currently in the action queue on the calling thread
+    @details used in place of the processing thread when the queue is disabled, commands generated
+    while processing are also handled before returning*/
+    void processQueuedCommands();
     /** process a disconnect signal*/
     virtual void processDisconnect(bool skipUnregister = false) = 0;
     /** in the case of connection failure with a broker this function will try a reconnect procedure
@@ -206,6 +265,20 @@ class BrokerBase {
                               int logLevel,
                               std::string_view name,
                               std::string_view message) const;
+    /** send a description of a command to the logging system
+    @details if asynchronous logging is enabled the description is generated on the logging thread
+    @param federateID the id of the object logging the command
+    @param logLevel the logging level of the message
+    @param name the name of the object logging the command
+    @param prefix text to place before the description of the command
+    @param command the command to describe
+    @param showDestination set to true to include the destination of the command*/
+    void logCommand(GlobalFederateId federateID,
+                    int logLevel,
+                    std::string_view name,
+                    std::string_view prefix,
+                    const ActionMessage& command,
+                    bool showDestination = false) const;
 
     /** generate a new random id*/
     void generateNewIdentifier();
@@ -213,6 +286,12 @@ class BrokerBase {
     virtual std::string generateLocalAddressString() const = 0;
     /** generate a CLI11 Application for subprocesses for processing of command line arguments*/
     virtual std::shared_ptr<helicsCLI11App> generateCLI();
+    /** set the routes the communication layer uses to forward data messages directly
+    @details the default does nothing since only communication layers that receive serialized
+    messages can forward them without processing
+    @param routes the route to each known federate,  an empty table disables forwarding
+    @param forwardUnknown set to true to forward messages for unknown federates to the parent*/
+    virtual void setCutThroughRoutes(const GlobalIdTable<route_id>& routes, bool forwardUnknown);
     /** set the broker error state and error string*/
     void setErrorState(int eCode, std::string_view estring);
     /** set the logging file if using the default logger*/
@@ -230,6 +309,19 @@ class BrokerBase {
     {
         return messageCounter.load(std::memory_order_acquire);
     }
+    /** get the number of commands actually processed
+    @details unlike currentMessageCounter this does not include ignored or superseded commands*/
+    std::size_t processedCommandCounter() const
+    {
+        return processedCounter.load(std::memory_order_acquire);
+    }
+    /** get the number of queued messages skipped because a newer message superseded them*/
+    std::size_t supersededMessageCounter() const
+    {
+        return supersededCounter.load(std::memory_order_acquire);
+    }
+    /** get the number of log messages dropped because the asynchronous logging queue was full*/
+    std::size_t droppedLogMessageCounter() const;
     friend class TimeoutMonitor;
     friend const std::string& brokerStateName(broker_state_t state);
 };
@@ -14,6 +14,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "CoreFactory.hpp"
 #include "CoreFederateInfo.hpp"
 #include "EndpointInfo.hpp"
+#include "FederateOperator.hpp"
 #include "FederateState.hpp"
 #include "FilterCoordinator.hpp"
 #include "FilterFederate.hpp"
@@ -22,10 +23,12 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "InputInfo.hpp"
 #include "PublicationInfo.hpp"
 #include "TimeoutMonitor.h"
+#include "WorkerPool.hpp"
 #include "core-exceptions.hpp"
 #include "coreTypeOperations.hpp"
 #include "fileConnections.hpp"
 #include "gmlc/concurrency/DelayedObjects.hpp"
+#include "helicsCLI11.hpp"
 #include "helicsVersion.hpp"
 #include "helics_definitions.hpp"
 #include "loggingHelper.hpp"
@@ -39,6 +42,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -121,6 +125,40 @@ void CommonCore::configureFromVector(std::vector<std::string> args)
     }
 }
 
+ActionMessage CommonCore::generateBrokerRegistration() const
+{
+    ActionMessage m(CMD_REG_BROKER);
+    m.source_id = GlobalFederateId{};
+    m.name(getIdentifier());
+    m.setStringData(getAddress());
+
+    if (!brokerKey.empty()) {
+        m.setString(1, brokerKey);
+    }
+
+    setActionFlag(m, core_flag);
+    if (no_ping) {
+        setActionFlag(m, slow_responding_flag);
+    }
+    return m;
+}
+
+void CommonCore::processBrokerRedirect(const ActionMessage& command)
+{
+    route_id newParent{routeCount++};
+    std::string brokerAddress(command.payload.to_string());
+    addRoute(newParent, 0, brokerAddress);
+    // the comms send everything for the parent broker along the new route from here on
+    ActionMessage parentRoute(CMD_PROTOCOL_PRIORITY);
+    parentRoute.messageID = NEW_PARENT_ROUTE;
+    parentRoute.setExtraData(newParent.baseValue());
+    transmit(control_route, parentRoute);
+    LOG_CONNECTIONS(parent_broker_id,
+                    getIdentifier(),
+                    fmt::format("redirected to broker at {}", brokerAddress));
+    transmit(parent_route_id, generateBrokerRegistration());
+}
+
 bool CommonCore::connect()
 {
     if (brokerState >= broker_state_t::configured) {
@@ -130,21 +168,7 @@ bool CommonCore::connect()
             bool res = brokerConnect();
             if (res) {
                 // now register this core object as a broker
-
-                ActionMessage m(CMD_REG_BROKER);
-                m.source_id = GlobalFederateId{};
-                m.name(getIdentifier());
-                m.setStringData(getAddress());
-
-                if (!brokerKey.empty()) {
-                    m.setString(1, brokerKey);
-                }
-
-                setActionFlag(m, core_flag);
-                if (no_ping) {
-                    setActionFlag(m, slow_responding_flag);
-                }
-                transmit(parent_route_id, m);
+                transmit(parent_route_id, generateBrokerRegistration());
                 brokerState = broker_state_t::connected;
                 disconnection.activate();
             } else {
@@ -261,6 +285,8 @@ void CommonCore::unregister()
 CommonCore::~CommonCore()
 {
     joinAllThreads();
+    // finish any callback processing before the federates are destroyed
+    callbackPool.reset();
 }
 
 FederateState* CommonCore::getFederateAt(LocalFederateId federateID) const
@@ -312,8 +338,8 @@ FederateState* CommonCore::getHandleFederate(InterfaceHandle handle)
 
 FederateState* CommonCore::getFederateCore(GlobalFederateId federateID)
 {
-    auto fed = loopFederates.find(federateID);
-    return (fed != loopFederates.end()) ? (fed->fed) : nullptr;
+    auto* const* fed = loopFederateIds.find(federateID);
+    return (fed != nullptr) ? *fed : nullptr;
 }
 
 FederateState* CommonCore::getFederateCore(const std::string& federateName)
@@ -344,13 +370,13 @@ const BasicHandleInfo* CommonCore::getLocalEndpoint(const std::string& name) con
 
 bool CommonCore::isLocal(GlobalFederateId global_fedid) const
 {
-    return (loopFederates.find(global_fedid) != loopFederates.end());
+    return (loopFederateIds.find(global_fedid) != nullptr);
 }
 
 route_id CommonCore::getRoute(GlobalFederateId global_fedid) const
 {
-    auto fnd = routing_table.find(global_fedid);
-    return (fnd != routing_table.end()) ? fnd->second : parent_route_id;
+    const auto* route = routing_table.find(global_fedid);
+    return (route != nullptr) ? *route : parent_route_id;
 }
 
 bool CommonCore::isConfigured() const
@@ -376,6 +402,10 @@ void CommonCore::globalError(LocalFederateId federateID,
     m.payload = errorString;
     addActionMessage(m);
     fed->addAction(m);
+    if (fed->isCallbackBased()) {
+        // the error is processed by the callback workers
+        return;
+    }
     IterationResult ret = IterationResult::NEXT_STEP;
     while (ret != IterationResult::ERROR_RESULT) {
         ret = fed->genericUnspecifiedQueueProcess();
@@ -399,6 +429,10 @@ void CommonCore::localError(LocalFederateId federateID,
     m.payload = errorString;
     addActionMessage(m);
     fed->addAction(m);
+    if (fed->isCallbackBased()) {
+        // the error is processed by the callback workers
+        return;
+    }
     IterationResult ret = IterationResult::NEXT_STEP;
     while (ret != IterationResult::ERROR_RESULT) {
         ret = fed->genericUnspecifiedQueueProcess();
@@ -516,6 +550,10 @@ void CommonCore::enterInitializingMode(LocalFederateId federateID)
         ActionMessage m(CMD_INIT);
         m.source_id = fed->global_id.load();
         addActionMessage(m);
+        if (fed->isCallbackBased()) {
+            // the grant is processed by the callback workers
+            return;
+        }
 
         auto check = fed->enterInitializingMode();
         if (check != IterationResult::NEXT_STEP) {
@@ -536,6 +574,9 @@ IterationResult CommonCore::enterExecutingMode(LocalFederateId federateID, Itera
     if (fed == nullptr) {
         throw(InvalidIdentifier("federateID not valid (EnterExecutingState)"));
     }
+    if (fed->isCallbackBased()) {
+        throw(InvalidFunctionCall("callback federates cannot enter executing mode directly"));
+    }
     if (HELICS_EXECUTING == fed->getState()) {
         return IterationResult::NEXT_STEP;
     }
@@ -674,6 +715,9 @@ Time CommonCore::timeRequest(LocalFederateId federateID, Time next)
     if (fed == nullptr) {
         throw(InvalidIdentifier("federateID not valid timeRequest"));
     }
+    if (fed->isCallbackBased()) {
+        throw(InvalidFunctionCall("callback federates cannot request time directly"));
+    }
     switch (fed->getState()) {
         case HELICS_EXECUTING: {
             // generate the request through the core
@@ -708,6 +752,9 @@ iteration_time CommonCore::requestTimeIterative(LocalFederateId federateID,
     if (fed == nullptr) {
         throw(InvalidIdentifier("federateID not valid timeRequestIterative"));
     }
+    if (fed->isCallbackBased()) {
+        throw(InvalidFunctionCall("callback federates cannot request time directly"));
+    }
 
     switch (fed->getState()) {
         case HELICS_EXECUTING:
@@ -751,6 +798,15 @@ Time CommonCore::getCurrentTime(LocalFederateId federateID) const
     return fed->grantedTime();
 }
 
+Time CommonCore::getCommittedTime(LocalFederateId federateID) const
+{
+    auto* fed = getFederateAt(federateID);
+    if (fed == nullptr) {
+        throw InvalidIdentifier("federateID not valid (getCommittedTime)");
+    }
+    return fed->committedTime();
+}
+
 uint64_t CommonCore::getCurrentReiteration(LocalFederateId federateID) const
 {
     auto* fed = getFederateAt(federateID);
@@ -879,7 +935,6 @@ bool CommonCore::getFlagOption(LocalFederateId federateID, int32_t flag) const
             return getFlagValue(flag);
         case defs::Flags::FORWARD_COMPUTE:
         case defs::Flags::SINGLE_THREAD_FEDERATE:
-        case defs::Flags::ROLLBACK:
             return false;
         default:
             break;
@@ -1149,6 +1204,25 @@ int32_t CommonCore::getHandleOption(InterfaceHandle handle, int32_t option) cons
     return 0;
 }
 
+void CommonCore::setInputChangeDetector(
+    InterfaceHandle handle,
+    std::function<bool(const SmallBuffer&, const SmallBuffer&)> detector)
+{
+    const auto* handleInfo = getHandleInfo(handle);
+    if (handleInfo == nullptr) {
+        throw(InvalidIdentifier("Handle is invalid (setInputChangeDetector)"));
+    }
+    if (handleInfo->handleType != InterfaceType::INPUT) {
+        throw(InvalidIdentifier("Handle does not identify an input"));
+    }
+    auto& fed = *getFederateAt(handleInfo->local_fed_id);
+    std::lock_guard<FederateState> lk(fed);
+    auto* inp = fed.interfaces().getInput(handle);
+    if (inp != nullptr) {
+        inp->changeDetector = std::move(detector);
+    }
+}
+
 void CommonCore::closeHandle(InterfaceHandle handle)
 {
     const auto* handleInfo = getHandleInfo(handle);
@@ -1381,13 +1455,21 @@ void CommonCore::setValue(InterfaceHandle handle, const char* data, uint64_t len
         if (subs.empty()) {
             return;
         }
+        SmallBuffer delta;
+        const bool useDelta =
+            fed->generatePublicationDelta(handle, data, len, subs.size(), delta);
         if (subs.size() == 1) {
             ActionMessage mv(CMD_PUB);
             mv.source_id = handleInfo->getFederateId();
             mv.source_handle = handle;
             mv.setDestination(subs[0]);
             mv.counter = static_cast<uint16_t>(fed->getCurrentIteration());
-            mv.payload.assign(data, len);
+            if (useDelta) {
+                mv.payload = std::move(delta);
+                setActionFlag(mv, delta_data_flag);
+            } else {
+                mv.payload.assign(data, len);
+            }
             mv.actionTime = fed->nextAllowedSendTime();
 
             actionQueue.push(std::move(mv));
@@ -1401,7 +1483,12 @@ void CommonCore::setValue(InterfaceHandle handle, const char* data, uint64_t len
         mv.source_id = handleInfo->getFederateId();
         mv.source_handle = handle;
         mv.counter = static_cast<uint16_t>(fed->getCurrentIteration());
-        mv.payload.assign(data, len);
+        if (useDelta) {
+            mv.payload = std::move(delta);
+            setActionFlag(mv, delta_data_flag);
+        } else {
+            mv.payload.assign(data, len);
+        }
         mv.actionTime = fed->nextAllowedSendTime();
 
         for (auto& target : subs) {
@@ -1702,6 +1789,9 @@ void CommonCore::sendTo(InterfaceHandle sourceHandle,
     m.payload.assign(data, length);
     m.setStringData(destination, hndl->key, hndl->key);
     m.actionTime = fed->nextAllowedSendTime();
+    if (fed->isSpeculating()) {
+        fed->recordSpeculativeSend(m);
+    }
     addActionMessage(std::move(m));
 }
 
@@ -1734,7 +1824,9 @@ void CommonCore::sendToAt(InterfaceHandle sourceHandle,
 
     m.payload.assign(data, length);
     m.setStringData(destination, hndl->key, hndl->key);
-
+    if (fed->isSpeculating()) {
+        fed->recordSpeculativeSend(m);
+    }
     addActionMessage(std::move(m));
 }
 
@@ -1792,6 +1884,9 @@ void CommonCore::send(InterfaceHandle sourceHandle, const void* data, uint64_t l
     m.payload.assign(data, length);
     m.messageID = ++messageCounter;
     m.setStringData("", hndl->key, hndl->key);
+    if (fed->isSpeculating()) {
+        fed->recordSpeculativeSend(m, targets);
+    }
     generateMessages(m, targets);
 }
 
@@ -1818,6 +1913,9 @@ void CommonCore::sendAt(InterfaceHandle sourceHandle, const void* data, uint64_t
     m.payload.assign(data, length);
     m.messageID = ++messageCounter;
     m.setStringData("", hndl->key, hndl->key);
+    if (fed->isSpeculating()) {
+        fed->recordSpeculativeSend(m, targets);
+    }
     generateMessages(m, targets);
 }
 
@@ -1860,29 +1958,48 @@ void CommonCore::sendMessage(InterfaceHandle sourceHandle, std::unique_ptr<Messa
                         "",
                         fmt::format("receive_message {}", prettyPrintString(m)));
     }
+    if (fed->isSpeculating()) {
+        fed->recordSpeculativeSend(m);
+    }
     addActionMessage(std::move(m));
 }
 
 void CommonCore::deliverMessage(ActionMessage& message)
 {
     switch (message.action()) {
-        case CMD_SEND_MESSAGE: {
+        case CMD_SEND_MESSAGE:
+        case CMD_ANTI_MESSAGE: {
+            // anti-messages follow the message to wherever the filters forwarded it
+            if (message.action() == CMD_ANTI_MESSAGE && retractSpeculativeRoute(message)) {
+                return;
+            }
             // Find the destination endpoint
             auto* localP = (message.dest_id == parent_broker_id) ?
                 loopHandles.getEndpoint(message.getString(targetStringLoc)) :
                 loopHandles.findHandle(message.getDest());
             if (localP == nullptr) {
-                auto kfnd = knownExternalEndpoints.find(message.getString(targetStringLoc));
-                if (kfnd != knownExternalEndpoints.end()) {  // destination is known
-                    transmit(kfnd->second, message);
-                } else {
-                    transmit(parent_route_id, message);
+                if (message.action() == CMD_ANTI_MESSAGE || recordSpeculativeRoute(message)) {
+                    transmitRemote(message);
                 }
                 return;
             }
-            // now we deal with local processing
-            if (checkActionFlag(*localP, has_dest_filter_flag)) {
+            // now we deal with local processing, anti-messages retract the filtered message so
+            // they skip the destination filters
+            bool trackedRoute{false};
+            SpeculativeRouteKey routeKey;
+            if (message.action() == CMD_SEND_MESSAGE &&
+                checkActionFlag(*localP, has_dest_filter_flag)) {
+                // the destination filters may reroute or clone the message so record where it goes
+                trackedRoute = trackSpeculativeRoute(message, localP->getFederateId());
+                if (trackedRoute) {
+                    routeKey = {message.getString(origSourceStringLoc), message.messageID};
+                }
                 if (!filterFed->destinationProcessMessage(message, localP)) {
+                    if (trackedRoute) {
+                        releaseSpeculativeRoute(routeKey,
+                                                GlobalHandle(localP->getFederateId(),
+                                                             localP->getInterfaceHandle()));
+                    }
                     return;
                 }
             }
@@ -1890,13 +2007,28 @@ void CommonCore::deliverMessage(ActionMessage& message)
                 message.dest_id = localP->getFederateId();
                 message.dest_handle = localP->getInterfaceHandle();
             }
+            if (message.action() == CMD_SEND_MESSAGE && !recordSpeculativeRoute(message)) {
+                return;
+            }
+            if (trackedRoute) {
+                releaseSpeculativeRoute(routeKey, message.getDest());
+            }
 
             auto* fed = getFederateCore(localP->getFederateId());
             if (fed != nullptr) {
                 fed->addAction(std::move(message));
             }
         } break;
-        case CMD_SEND_FOR_FILTER:
+        case CMD_SEND_FOR_FILTER: {
+            // the filter core forwards the message so a retraction falls back to the original
+            // destination
+            auto route = speculativeRoutes.find(
+                SpeculativeRouteKey(message.getString(origSourceStringLoc), message.messageID));
+            if (route != speculativeRoutes.end()) {
+                route->second.untracked = true;
+            }
+            transmitRemote(message);
+        } break;
         case CMD_SEND_FOR_FILTER_AND_RETURN:
         case CMD_SEND_FOR_DEST_FILTER_AND_RETURN:
         case CMD_FILTER_RESULT:
@@ -1904,7 +2036,7 @@ void CommonCore::deliverMessage(ActionMessage& message)
         case CMD_NULL_MESSAGE:
         case CMD_NULL_DEST_MESSAGE:
         default: {
-            transmit(getRoute(message.dest_id), message);
+            transmitRemote(message);
         } break;
     }
 }
@@ -2082,6 +2214,41 @@ void CommonCore::setFilterOperator(InterfaceHandle filter, std::shared_ptr<Filte
     actionQueue.push(filtOpUpdate);
 }
 
+void CommonCore::setFederateOperator(LocalFederateId federateID,
+                                     std::shared_ptr<FederateOperator> callback)
+{
+    auto* fed = getFederateAt(federateID);
+    if (fed == nullptr) {
+        throw(InvalidIdentifier("federateID not valid (setFederateOperator)"));
+    }
+    if (!callback) {
+        throw(InvalidParameter("federate operator must not be null"));
+    }
+    if (fed->getState() != HELICS_CREATED || fed->init_requested.load()) {
+        throw(InvalidFunctionCall("federate operator may only be set in the created state"));
+    }
+    WorkerPool* pool{nullptr};
+    {
+        std::lock_guard<std::mutex> poolLock(callbackPoolLock);
+        if (!callbackPool) {
+            auto threads = callbackThreadCount;
+            if (threads <= 0) {
+                threads = static_cast<int>(std::thread::hardware_concurrency());
+            }
+            callbackPool = std::make_unique<WorkerPool>(threads);
+        }
+        pool = callbackPool.get();
+    }
+    auto key = static_cast<std::size_t>(federateID.baseValue());
+    if (!fed->setCallbackOperator(std::move(callback),
+                                  [pool, fed, key]() {
+                                      pool->post(key, [fed]() { fed->callbackProcessing(); });
+                                  })) {
+        throw(InvalidFunctionCall(
+            "federate operators are not supported for realtime or optimistic federates"));
+    }
+}
+
 void CommonCore::setIdentifier(const std::string& name)
 {
     if (brokerState == broker_state_t::created) {
@@ -2095,6 +2262,7 @@ void CommonCore::setIdentifier(const std::string& name)
 // enumeration of subqueries that cascade and need multiple levels of processing
 enum subqueries : std::uint16_t {
     general_query = 0,
+    federate_map = 1,
     current_time_map = 2,
     dependency_graph = 3,
     data_flow_graph = 4,
@@ -2180,7 +2348,7 @@ std::string CommonCore::quickCoreQueries(const std::string& queryStr) const
 {
     if ((queryStr == "queries") || (queryStr == "available_queries")) {
         return "[\"isinit\",\"isconnected\",\"exists\",\"name\",\"identifier\",\"address\",\"queries\",\"address\",\"federates\",\"inputs\",\"endpoints\",\"filtered_endpoints\","
-               "\"publications\",\"filters\",\"version\",\"version_all\",\"federate_map\",\"dependency_graph\",\"data_flow_graph\",\"dependencies\",\"dependson\",\"dependents\",\"current_time\",\"global_time\",\"global_state\",\"global_flush\",\"current_state\"]";
+               "\"publications\",\"filters\",\"version\",\"version_all\",\"federate_map\",\"dependency_graph\",\"data_flow_graph\",\"dependencies\",\"dependson\",\"dependents\",\"current_time\",\"global_time\",\"global_state\",\"global_flush\",\"current_state\",\"command_counts\",\"direct_routes\"]";
     }
     if (queryStr == "isconnected") {
         return (isConnected()) ? "true" : "false";
@@ -2375,6 +2543,16 @@ std::string CommonCore::coreQuery(const std::string& queryStr, bool force_orderi
     if (queryStr == "counter") {
         return fmt::format("{}", generateMapObjectCounter());
     }
+    if (queryStr == "command_counts") {
+        Json::Value base;
+        base["name"] = getIdentifier();
+        base["id"] = global_broker_id_local.baseValue();
+        base["received"] = static_cast<Json::UInt64>(currentMessageCounter());
+        base["processed"] = static_cast<Json::UInt64>(processedCommandCounter());
+        base["superseded"] = static_cast<Json::UInt64>(supersededMessageCounter());
+        base["log_dropped"] = static_cast<Json::UInt64>(droppedLogMessageCounter());
+        return generateJsonString(base);
+    }
     if (queryStr == "filtered_endpoints") {
         return filteredEndpointQuery(nullptr);
     }
@@ -2448,6 +2626,19 @@ std::string CommonCore::coreQuery(const std::string& queryStr, bool force_orderi
         }
         return generateJsonString(base);
     }
+    if (queryStr == "direct_routes") {
+        Json::Value base;
+        base["name"] = getIdentifier();
+        base["id"] = global_broker_id_local.baseValue();
+        base["routes"] = Json::arrayValue;
+        for (const auto& direct : directRoutes) {
+            Json::Value route;
+            route["core"] = direct.first.baseValue();
+            route["active"] = direct.second.active;
+            base["routes"].append(route);
+        }
+        return generateJsonString(base);
+    }
     if (queryStr == "federate_map") {
         Json::Value base;
         loadBasicJsonInfo(base, [](Json::Value& /*val*/, const FedInfo& /*fed*/) {});
@@ -2571,11 +2762,10 @@ void CommonCore::sendCommand(const std::string& target,
 void CommonCore::processPriorityCommand(ActionMessage&& command)
 {
     // deal with a few types of message immediately
-    LOG_TRACE(global_broker_id_local,
-              getIdentifier(),
-              fmt::format("|| priority_cmd:{} from {}",
-                          prettyPrintString(command),
-                          command.source_id.baseValue()));
+    LOG_TRACE_COMMAND(global_broker_id_local, getIdentifier(), "|| priority_cmd:", command, false);
+    if (!mapSubscriptions.empty() && isPriorityCommand(command)) {
+        checkMapSubscriptions(command);
+    }
     switch (command.action()) {
         case CMD_PING_PRIORITY:
             if (command.dest_id == global_broker_id_local) {
@@ -2585,6 +2775,9 @@ void CommonCore::processPriorityCommand(ActionMessage&& command)
                 routeMessage(pngrep);
             }
             break;
+        case CMD_MAP_UPDATE:
+            // time update notices from local federates are handled with the subscriptions
+            break;
         case CMD_REG_FED:
             // this one in the core needs to be the thread-safe version of getFederate
             loopFederates.insert(std::string(command.name()),
@@ -2623,6 +2816,14 @@ void CommonCore::processPriorityCommand(ActionMessage&& command)
                 transmit(parent_route_id, command);
             }
             break;
+        case CMD_BROKER_REDIRECT:
+            // only valid before the core has been acknowledged by a broker
+            if (command.name() == identifier &&
+                (global_broker_id_local == parent_broker_id ||
+                 !global_broker_id_local.isValid())) {
+                processBrokerRedirect(command);
+            }
+            break;
         case CMD_BROKER_ACK:
             if (command.name() == identifier) {
                 if (checkActionFlag(command, error_flag)) {
@@ -2675,6 +2876,7 @@ void CommonCore::processPriorityCommand(ActionMessage&& command)
                 } else {
                     fed->global_id = command.dest_id;
                     loopFederates.addSearchTerm(command.dest_id, std::string(command.name()));
+                    loopFederateIds[command.dest_id] = fed;
                 }
 
                 // push the command to the local queue
@@ -2721,7 +2923,11 @@ void CommonCore::processPriorityCommand(ActionMessage&& command)
             processQueryCommand(command);
             break;
         case CMD_PRIORITY_ACK:
+            break;
         case CMD_ROUTE_ACK:
+            if (command.dest_id == global_broker_id_local) {
+                processRouteAck(GlobalBrokerId(command.source_id));
+            }
             break;
         case CMD_SET_GLOBAL:
             if (global_broker_id_local != parent_broker_id) {
@@ -2821,19 +3027,191 @@ void CommonCore::transmitDelayedMessages(GlobalFederateId source)
     }
 }
 
+void CommonCore::processDirectRouteInstruction(const ActionMessage& command)
+{
+    GlobalBrokerId peer(command.getExtraData());
+    if (directRoutes.find(peer) != directRoutes.end()) {
+        return;
+    }
+    auto routeInfo = loadJsonStr(command.payload.to_string());
+    const auto& address = routeInfo["address"];
+    if (!address.isString() || address.asString().empty()) {
+        return;
+    }
+    DirectRoute direct;
+    direct.route = route_id{routeCount++};
+    for (const auto& fed : routeInfo["federates"]) {
+        direct.federates.emplace_back(fed.asInt());
+    }
+    for (const auto& ept : routeInfo["endpoints"]) {
+        direct.endpoints.push_back(ept.asString());
+    }
+    addRoute(direct.route, 0, address.asString());
+    direct.markerTime = std::chrono::steady_clock::now();
+    directRoutes.emplace(peer, std::move(direct));
+    // the marker travels along the broker path so the route switch happens only after all
+    // messages already in flight through the broker have been delivered
+    ActionMessage marker(CMD_ROUTE_MARKER);
+    marker.source_id = global_broker_id_local;
+    marker.dest_id = peer;
+    transmit(parent_route_id, marker);
+}
+
+void CommonCore::processRouteAck(GlobalBrokerId coreId)
+{
+    auto direct = directRoutes.find(coreId);
+    if (direct == directRoutes.end()) {
+        return;
+    }
+    auto& route = direct->second;
+    if (route.active) {
+        route.flushing = false;
+    } else {
+        for (const auto& fed : route.federates) {
+            routing_table[fed] = route.route;
+        }
+        for (const auto& ept : route.endpoints) {
+            knownExternalEndpoints[ept] = route.route;
+        }
+        route.active = true;
+        LOG_CONNECTIONS(global_broker_id_local,
+                        getIdentifier(),
+                        fmt::format("direct route to core {} established", coreId.baseValue()));
+    }
+    releaseHeldRouteMessages();
+}
+
+void CommonCore::closeDirectRoute(GlobalBrokerId coreId)
+{
+    auto direct = directRoutes.find(coreId);
+    if (direct == directRoutes.end()) {
+        return;
+    }
+    const auto& route = direct->second;
+    for (const auto& fed : route.federates) {
+        const auto* rid = routing_table.find(fed);
+        if (rid != nullptr && *rid == route.route) {
+            routing_table.erase(fed);
+        }
+    }
+    for (const auto& ept : route.endpoints) {
+        auto kfnd = knownExternalEndpoints.find(ept);
+        if (kfnd != knownExternalEndpoints.end() && kfnd->second == route.route) {
+            knownExternalEndpoints.erase(kfnd);
+        }
+    }
+    removeRoute(route.route);
+    LOG_CONNECTIONS(global_broker_id_local,
+                    getIdentifier(),
+                    fmt::format("direct route to core {} closed", coreId.baseValue()));
+    directRoutes.erase(direct);
+    releaseHeldRouteMessages();
+}
+
+void CommonCore::transmitRemote(const ActionMessage& cmd)
+{
+    route_id rid = getRoute(cmd.dest_id);
+    if (cmd.action() == CMD_SEND_MESSAGE || cmd.action() == CMD_ANTI_MESSAGE) {
+        auto kfnd = knownExternalEndpoints.find(std::string(cmd.getString(targetStringLoc)));
+        if (kfnd != knownExternalEndpoints.end()) {
+            rid = kfnd->second;
+        }
+    }
+    if (directRoutes.empty()) {
+        transmit(rid, cmd);
+        return;
+    }
+    const bool timing = isTimingCommand(cmd);
+    const bool message = (cmd.action() == CMD_SEND_MESSAGE || cmd.action() == CMD_ANTI_MESSAGE);
+    // check if the message is for a federate or endpoint of a route still being switched
+    auto isRouteTarget = [&cmd, message](const DirectRoute& route) {
+        if (std::find(route.federates.begin(), route.federates.end(), cmd.dest_id) !=
+            route.federates.end()) {
+            return true;
+        }
+        return message &&
+            std::find(route.endpoints.begin(),
+                      route.endpoints.end(),
+                      cmd.getString(targetStringLoc)) != route.endpoints.end();
+    };
+    // anything behind a held message waits as well to keep the order of the messages
+    bool hold = !heldRouteMessages.empty();
+    for (auto& direct : directRoutes) {
+        auto& route = direct.second;
+        if (!route.active) {
+            hold = hold || isRouteTarget(route);
+        } else if (timing && route.route != rid) {
+            // a timing message taking another path could let a federate of the other core advance
+            // before the data on the direct route arrives, so flush the direct route first
+            if (route.unflushed) {
+                ActionMessage marker(CMD_ROUTE_MARKER);
+                marker.source_id = global_broker_id_local;
+                marker.dest_id = direct.first;
+                transmit(route.route, marker);
+                route.unflushed = false;
+                route.flushing = true;
+                route.markerTime = std::chrono::steady_clock::now();
+            }
+            hold = hold || route.flushing;
+        }
+    }
+    if (hold) {
+        heldRouteMessages.push_back(cmd);
+        return;
+    }
+    if (!timing) {
+        for (auto& direct : directRoutes) {
+            if (direct.second.route == rid) {
+                direct.second.unflushed = true;
+            }
+        }
+    }
+    transmit(rid, cmd);
+}
+
+void CommonCore::releaseHeldRouteMessages()
+{
+    auto held = std::move(heldRouteMessages);
+    heldRouteMessages.clear();
+    for (const auto& cmd : held) {
+        transmitRemote(cmd);
+    }
+}
+
+void CommonCore::checkDirectRouteTimeouts()
+{
+    auto now = std::chrono::steady_clock::now();
+    std::vector<GlobalBrokerId> expired;
+    for (const auto& direct : directRoutes) {
+        const auto& route = direct.second;
+        if ((!route.active || route.flushing) && now - route.markerTime > tickTimer.to_ns()) {
+            expired.push_back(direct.first);
+        }
+    }
+    for (const auto& coreId : expired) {
+        LOG_WARNING(global_broker_id_local,
+                    getIdentifier(),
+                    fmt::format("direct route marker to core {} was not acknowledged",
+                                coreId.baseValue()));
+        closeDirectRoute(coreId);
+    }
+}
+
 void CommonCore::processCommand(ActionMessage&& command)
 {
-    LOG_TRACE(global_broker_id_local,
-              getIdentifier(),
-              fmt::format("|| cmd:{} from {}",
-                          prettyPrintString(command),
-                          command.source_id.baseValue()));
+    LOG_TRACE_COMMAND(global_broker_id_local, getIdentifier(), "|| cmd:", command, false);
+    if (!mapSubscriptions.empty()) {
+        checkMapSubscriptions(command);
+    }
     switch (command.action()) {
         case CMD_IGNORE:
             break;
         case CMD_TICK:
             if (brokerState == broker_state_t::operating) {
                 timeoutMon->tick(this);
+                if (!directRoutes.empty()) {
+                    checkDirectRouteTimeouts();
+                }
                 LOG_SUMMARY(global_broker_id_local, getIdentifier(), " core tick");
             }
             break;
@@ -3051,6 +3429,27 @@ void CommonCore::processCommand(ActionMessage&& command)
                 filterFed->processMessageFilter(command);
             }
             break;
+        case CMD_SEND_ROUTE:
+            if (command.dest_id == global_broker_id_local) {
+                processDirectRouteInstruction(command);
+            }
+            break;
+        case CMD_ROUTE_MARKER:
+            if (command.dest_id == global_broker_id_local) {
+                // every message sent on the path of the marker before it has been processed
+                ActionMessage ack(CMD_ROUTE_ACK);
+                ack.source_id = global_broker_id_local;
+                ack.dest_id = command.source_id;
+                transmit(parent_route_id, ack);
+            } else {
+                routeMessage(command);
+            }
+            break;
+        case CMD_CLOSE_ROUTE:
+            if (command.dest_id == global_broker_id_local) {
+                closeDirectRoute(GlobalBrokerId(command.getExtraData()));
+            }
+            break;
         case CMD_NULL_MESSAGE:
         case CMD_FILTER_RESULT:
             // if (command.dest_id == filterFedID.load()) {
@@ -3278,6 +3677,9 @@ void CommonCore::processCommand(ActionMessage&& command)
             }
 
             break;
+        case CMD_ANTI_MESSAGE:
+            deliverMessage(command);
+            break;
 
         default:
             if (isPriorityCommand(command)) {  // this is a backup if somehow one of these
@@ -3358,6 +3760,23 @@ void CommonCore::registerInterface(ActionMessage& command)
     }
 }
 
+std::shared_ptr<helicsCLI11App> CommonCore::generateCLI()
+{
+    auto app = std::make_shared<helicsCLI11App>("Option for Core");
+    app->remove_helics_specifics();
+    app->add_option("--filter_threads",
+                    filterThreadCount,
+                    "the number of threads used to execute local filter operators, 0 to execute "
+                    "them in the core processing loop")
+        ->check(CLI::NonNegativeNumber);
+    app->add_option("--callback_threads",
+                    callbackThreadCount,
+                    "the number of threads used to execute callback federates, 0 to use the "
+                    "hardware concurrency")
+        ->check(CLI::NonNegativeNumber);
+    return app;
+}
+
 void CommonCore::generateFilterFederate()
 {
     auto fid = filterFedID.load();
@@ -3378,6 +3797,9 @@ void CommonCore::generateFilterFederate()
     });
     filterFed->setAirLockFunction([this](int index) { return std::ref(dataAirlocks[index]); });
     filterFed->setDeliver([this](ActionMessage& m) { deliverMessage(m); });
+    if (filterThreadCount > 0) {
+        filterFed->setWorkerThreads(filterThreadCount);
+    }
     ActionMessage newFed(CMD_REG_FED);
     setActionFlag(newFed, child_flag);
     setActionFlag(newFed, non_counting_flag);
@@ -3904,6 +4326,9 @@ void CommonCore::processQueryCommand(ActionMessage& cmd)
         case CMD_BROKER_QUERY:
 
             if (cmd.dest_id == global_broker_id_local || cmd.dest_id == direct_core_id) {
+                if (checkActionFlag(cmd, map_subscription_flag)) {
+                    addMapSubscription(cmd);
+                }
                 std::string repStr = coreQuery(std::string(cmd.payload.to_string()), force_ordered);
                 if (repStr != "#wait") {
                     if (cmd.source_id == direct_core_id) {
@@ -4158,6 +4583,96 @@ int CommonCore::generateMapObjectCounter() const
     return result;
 }
 
+/** get the maps whose information at a core can be changed by a command
+@return a bit mask of the map indices*/
+static std::uint32_t coreMapUpdateMask(const ActionMessage& command)
+{
+    static constexpr std::uint32_t allMaps = (1U << federate_map) | (1U << current_time_map) |
+        (1U << dependency_graph) | (1U << data_flow_graph);
+    switch (command.action()) {
+        case CMD_REG_FED:
+        case CMD_FED_ACK:
+        case CMD_INIT_GRANT:
+        case CMD_STOP:
+        case CMD_DISCONNECT:
+        case CMD_DISCONNECT_FED:
+            return allMaps;
+        case CMD_MAP_UPDATE:
+        case CMD_EXEC_REQUEST:
+        case CMD_EXEC_GRANT:
+        case CMD_TIME_REQUEST:
+        case CMD_TIME_GRANT:
+            return (1U << current_time_map);
+        case CMD_ADD_DEPENDENCY:
+        case CMD_REMOVE_DEPENDENCY:
+        case CMD_ADD_DEPENDENT:
+        case CMD_REMOVE_DEPENDENT:
+        case CMD_ADD_INTERDEPENDENCY:
+        case CMD_REMOVE_INTERDEPENDENCY:
+            return (1U << dependency_graph);
+        case CMD_REG_INPUT:
+        case CMD_REG_ENDPOINT:
+        case CMD_REG_PUB:
+        case CMD_REG_FILTER:
+        case CMD_ADD_ENDPOINT:
+        case CMD_ADD_FILTER:
+        case CMD_ADD_SUBSCRIBER:
+        case CMD_ADD_PUBLISHER:
+        case CMD_REMOVE_PUBLICATION:
+        case CMD_REMOVE_SUBSCRIBER:
+        case CMD_REMOVE_FILTER:
+        case CMD_REMOVE_ENDPOINT:
+        case CMD_CLOSE_INTERFACE:
+            return (1U << data_flow_graph);
+        default:
+            return 0U;
+    }
+}
+
+void CommonCore::addMapSubscription(const ActionMessage& query)
+{
+    ActionMessage notice(CMD_MAP_UPDATE);
+    notice.source_id = global_broker_id_local;
+    notice.dest_id = query.source_id;
+    notice.messageID = query.messageID;
+    notice.counter = query.counter;
+    mapSubscriptions[query.counter] = std::make_pair(std::move(notice), false);
+    if (query.counter == current_time_map) {
+        for (auto& fed : loopFederates) {
+            fed->time_update_notice.store(true);
+        }
+    }
+}
+
+void CommonCore::checkMapSubscriptions(const ActionMessage& command)
+{
+    auto mask = coreMapUpdateMask(command);
+    if (mask == 0U) {
+        return;
+    }
+    for (const auto& sub : mapSubscriptions) {
+        if ((mask & (1U << sub.first)) != 0U) {
+            sendMapUpdate(sub.first);
+        }
+    }
+}
+
+void CommonCore::sendMapUpdate(std::uint16_t index)
+{
+    if (isValidIndex(index, mapBuilders)) {
+        auto& builder = std::get<0>(mapBuilders[index]);
+        // a completed map would be reused for the next query
+        if (builder.isCompleted()) {
+            builder.reset();
+        }
+    }
+    auto sub = mapSubscriptions.find(index);
+    if (sub != mapSubscriptions.end() && !sub->second.second) {
+        sub->second.second = true;
+        transmit(parent_route_id, sub->second.first);
+    }
+}
+
 void CommonCore::sendDisconnect()
 {
     LOG_CONNECTIONS(global_broker_id_local, "core", "sending disconnect");
@@ -4210,7 +4725,7 @@ void CommonCore::routeMessage(ActionMessage& cmd, GlobalFederateId dest)
     }
     cmd.dest_id = dest;
     if ((dest == parent_broker_id) || (dest == higher_broker_id)) {
-        transmit(parent_route_id, cmd);
+        transmitRemote(cmd);
     } else if (dest == global_broker_id_local) {
         processCommandsForCore(cmd);
     } else if (dest == filterFedID) {
@@ -4228,15 +4743,14 @@ void CommonCore::routeMessage(ActionMessage& cmd, GlobalFederateId dest)
             }
         }
     } else {
-        auto route = getRoute(dest);
-        transmit(route, cmd);
+        transmitRemote(cmd);
     }
 }
 
 void CommonCore::routeMessage(const ActionMessage& cmd)
 {
     if ((cmd.dest_id == parent_broker_id) || (cmd.dest_id == higher_broker_id)) {
-        transmit(parent_route_id, cmd);
+        transmitRemote(cmd);
     } else if (cmd.dest_id == global_broker_id_local) {
         processCommandsForCore(cmd);
     } else if (cmd.dest_id == filterFedID) {
@@ -4256,8 +4770,7 @@ void CommonCore::routeMessage(const ActionMessage& cmd)
             }
         }
     } else {
-        auto route = getRoute(cmd.dest_id);
-        transmit(route, cmd);
+        transmitRemote(cmd);
     }
 }
 
@@ -4268,7 +4781,7 @@ void CommonCore::routeMessage(ActionMessage&& cmd, GlobalFederateId dest)
     }
     cmd.dest_id = dest;
     if ((dest == parent_broker_id) || (dest == higher_broker_id)) {
-        transmit(parent_route_id, cmd);
+        transmitRemote(cmd);
     } else if (cmd.dest_id == global_broker_id_local) {
         processCommandsForCore(cmd);
     } else if (cmd.dest_id == filterFedID) {
@@ -4286,8 +4799,7 @@ void CommonCore::routeMessage(ActionMessage&& cmd, GlobalFederateId dest)
             }
         }
     } else {
-        auto route = getRoute(dest);
-        transmit(route, cmd);
+        transmitRemote(cmd);
     }
 }
 
@@ -4295,7 +4807,7 @@ void CommonCore::routeMessage(ActionMessage&& cmd)
 {
     GlobalFederateId dest = cmd.dest_id;
     if ((dest == parent_broker_id) || (dest == higher_broker_id)) {
-        transmit(parent_route_id, cmd);
+        transmitRemote(cmd);
     } else if (dest == global_broker_id_local) {
         processCommandsForCore(cmd);
     } else if (dest == filterFedID) {
@@ -4313,8 +4825,7 @@ void CommonCore::routeMessage(ActionMessage&& cmd)
             }
         }
     } else {
-        auto route = getRoute(dest);
-        transmit(route, cmd);
+        transmitRemote(cmd);
     }
 }  // namespace helics
 
@@ -4328,6 +4839,11 @@ ActionMessage& CommonCore::processMessage(ActionMessage& m)
     clearActionFlag(m, filter_processing_required_flag);
     if (checkActionFlag(*handle, has_source_filter_flag)) {
         if (filterFed != nullptr) {
+            auto* fed = getFederateCore(handle->getFederateId());
+            if (fed != nullptr && fed->isOptimistic()) {
+                // the filters may reroute or clone a message that a rollback retracts
+                trackSpeculativeRoute(m, handle->getFederateId());
+            }
             return filterFed->processMessage(m, handle);
         }
     }
@@ -4335,6 +4851,100 @@ ActionMessage& CommonCore::processMessage(ActionMessage& m)
     return m;
 }
 
+bool CommonCore::trackSpeculativeRoute(const ActionMessage& message, GlobalFederateId federate)
+{
+    if (speculativeRoutes.size() >= speculativeRoutePruneSize) {
+        pruneSpeculativeRoutes();
+    }
+    auto route = speculativeRoutes.try_emplace(
+        SpeculativeRouteKey(message.getString(origSourceStringLoc), message.messageID));
+    if (!route.second) {
+        return false;
+    }
+    route.first->second.federate = federate;
+    route.first->second.time = message.actionTime;
+    return true;
+}
+
+bool CommonCore::recordSpeculativeRoute(const ActionMessage& message)
+{
+    if (speculativeRoutes.empty()) {
+        return true;
+    }
+    auto route = speculativeRoutes.find(
+        SpeculativeRouteKey(message.getString(origSourceStringLoc), message.messageID));
+    if (route == speculativeRoutes.end()) {
+        return true;
+    }
+    if (route->second.retracted) {
+        // the anti-message arrived while the message was still in the filters
+        return false;
+    }
+    route->second.destinations.emplace_back(message.getDest(),
+                                            message.getString(targetStringLoc));
+    return true;
+}
+
+void CommonCore::releaseSpeculativeRoute(const SpeculativeRouteKey& key, GlobalHandle destination)
+{
+    auto route = speculativeRoutes.find(key);
+    if (route == speculativeRoutes.end() || route->second.retracted) {
+        return;
+    }
+    const auto& destinations = route->second.destinations;
+    if (destinations.empty() ||
+        (destinations.size() == 1 && destinations.front().first == destination)) {
+        speculativeRoutes.erase(route);
+    }
+}
+
+bool CommonCore::retractSpeculativeRoute(const ActionMessage& anti)
+{
+    if (speculativeRoutes.empty()) {
+        return false;
+    }
+    auto route = speculativeRoutes.find(
+        SpeculativeRouteKey(anti.getString(origSourceStringLoc), anti.messageID));
+    if (route == speculativeRoutes.end()) {
+        return false;
+    }
+    auto& record = route->second;
+    if (!record.retracted) {
+        record.retracted = true;
+        for (const auto& destination : record.destinations) {
+            ActionMessage retraction(anti);
+            retraction.setDestination(destination.first);
+            retraction.setString(targetStringLoc, destination.second);
+            const auto* localP = loopHandles.findHandle(destination.first);
+            if (localP == nullptr) {
+                transmitRemote(retraction);
+                continue;
+            }
+            auto* fed = getFederateCore(localP->getFederateId());
+            if (fed != nullptr) {
+                fed->addAction(std::move(retraction));
+            }
+        }
+        record.destinations.clear();
+    }
+    // a copy forwarded by a filter on another core is retracted at its original destination
+    return !record.untracked;
+}
+
+void CommonCore::pruneSpeculativeRoutes()
+{
+    for (auto route = speculativeRoutes.begin(); route != speculativeRoutes.end();) {
+        auto* fed = getFederateCore(route->second.federate);
+        if (fed == nullptr || fed->getState() == FederateStates::HELICS_FINISHED ||
+            route->second.time < fed->committedTime()) {
+            route = speculativeRoutes.erase(route);
+        } else {
+            ++route;
+        }
+    }
+    speculativeRoutePruneSize = std::max<std::size_t>(64, speculativeRoutes.size() * 2);
+}
+
 const std::string& CommonCore::getInterfaceInfo(InterfaceHandle handle) const
 {
     const auto* handleInfo = getHandleInfo(handle);
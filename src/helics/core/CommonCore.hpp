@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "ActionMessage.hpp"
 #include "BrokerBase.hpp"
 #include "Core.hpp"
+#include "DenseIdTable.hpp"
 #include "HandleManager.hpp"
 #include "gmlc/concurrency/DelayedObjects.hpp"
 #include "gmlc/concurrency/TriggerVariable.hpp"
@@ -26,8 +27,10 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <any>
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <tuple>
@@ -43,6 +46,7 @@ class BasicHandleInfo;
 class FilterCoordinator;
 class FilterInfo;
 class FilterFederate;
+class WorkerPool;
 class TimeoutMonitor;
 enum class InterfaceType : char;
 /** enumeration of possible operating conditions for a federate*/
@@ -106,6 +110,7 @@ class CommonCore: public Core, public BrokerBase {
                                                 Time next,
                                                 IterationRequest iterate) override final;
     virtual Time getCurrentTime(LocalFederateId federateID) const override final;
+    virtual Time getCommittedTime(LocalFederateId federateID) const override final;
     virtual uint64_t getCurrentReiteration(LocalFederateId federateID) const override final;
     virtual void
         setTimeProperty(LocalFederateId federateID, int32_t property, Time time) override final;
@@ -141,6 +146,9 @@ class CommonCore: public Core, public BrokerBase {
                                  int32_t option_value) override final;
 
     virtual int32_t getHandleOption(InterfaceHandle handle, int32_t option) const override final;
+    virtual void setInputChangeDetector(
+        InterfaceHandle handle,
+        std::function<bool(const SmallBuffer&, const SmallBuffer&)> detector) override final;
     virtual void closeHandle(InterfaceHandle handle) override final;
     virtual void removeTarget(InterfaceHandle handle,
                               std::string_view targetToRemove) override final;
@@ -216,6 +224,8 @@ class CommonCore: public Core, public BrokerBase {
                             const std::string& messageToLog) override final;
     virtual void setFilterOperator(InterfaceHandle filter,
                                    std::shared_ptr<FilterOperator> callback) override final;
+    virtual void setFederateOperator(LocalFederateId federateID,
+                                     std::shared_ptr<FederateOperator> callback) override final;
 
     /** set the local identification for the core*/
     void setIdentifier(const std::string& name);
@@ -269,6 +279,8 @@ class CommonCore: public Core, public BrokerBase {
     virtual void brokerDisconnect() = 0;
 
   protected:
+    virtual std::shared_ptr<helicsCLI11App> generateCLI() override;
+
     virtual void processCommand(ActionMessage&& command) override final;
 
     virtual void processPriorityCommand(ActionMessage&& command) override final;
@@ -323,14 +335,42 @@ class CommonCore: public Core, public BrokerBase {
 
   private:
     std::string prevIdentifier;  //!< storage for the case of requiring a renaming
-    std::map<GlobalFederateId, route_id>
-        routing_table;  //!< map for external routes  <global federate id, route id>
+    GlobalIdTable<route_id>
+        routing_table;  //!< table of external routes  <global federate id, route id>
     gmlc::containers::SimpleQueue<ActionMessage>
         delayTransmitQueue;  //!< FIFO queue for transmissions to the root that need to be delayed
                              //!< for a certain time
     std::unordered_map<std::string, route_id>
         knownExternalEndpoints;  //!< external map for all known external endpoints with names and
                                  //!< route
+    /** information on a direct route to another core*/
+    struct DirectRoute {
+        route_id route;  //!< the route to the other core
+        std::vector<GlobalFederateId> federates;  //!< federates reachable through the route
+        std::vector<std::string> endpoints;  //!< endpoints reachable through the route
+        bool active{false};  //!< the other core acknowledged the marker sent through the broker
+        bool unflushed{false};  //!< data was sent on the route since the last flush marker
+        bool flushing{false};  //!< a flush marker on the route is waiting on acknowledgement
+        /// when the marker waiting on acknowledgement was sent
+        decltype(std::chrono::steady_clock::now()) markerTime;
+    };
+    std::map<GlobalBrokerId, DirectRoute> directRoutes;  //!< direct routes to other cores
+    /// messages held until a direct route switch or flush is acknowledged
+    std::vector<ActionMessage> heldRouteMessages;
+    /// key of a message by its original source and message id
+    using SpeculativeRouteKey = std::pair<std::string, std::int32_t>;
+    /** where a message that filters may have rerouted or cloned was forwarded to*/
+    struct SpeculativeRoute {
+        GlobalFederateId federate;  //!< the local federate whose commit time ends the record
+        Time time{timeZero};  //!< the time of the message
+        bool retracted{false};  //!< an anti-message retracted the message
+        bool untracked{false};  //!< a copy left for a filter on another core
+        std::vector<std::pair<GlobalHandle, std::string>> destinations;  //!< forwarded copies
+    };
+    /// routes of filtered messages that an anti-message may need to follow
+    std::map<SpeculativeRouteKey, SpeculativeRoute> speculativeRoutes;
+    std::size_t speculativeRoutePruneSize{64};  //!< the record count that triggers pruning
+    int32_t routeCount{1};  //!< counter for generating new route ids
 
     std::unique_ptr<TimeoutMonitor>
         timeoutMon;  //!< class to handle timeouts and disconnection notices
@@ -385,6 +425,12 @@ class CommonCore: public Core, public BrokerBase {
                               std::uint16_t index,
                               bool reset,
                               bool force_ordering) const;
+    /** record a map query from the parent broker as a subscription for change notices*/
+    void addMapSubscription(const ActionMessage& query);
+    /** check if a command changes the information in any subscribed maps*/
+    void checkMapSubscriptions(const ActionMessage& command);
+    /** notify the parent broker that the information for a subscribed map has changed*/
+    void sendMapUpdate(std::uint16_t index);
     /** generate results for core queries*/
     std::string coreQuery(const std::string& queryStr, bool force_ordering) const;
 
@@ -396,6 +442,29 @@ class CommonCore: public Core, public BrokerBase {
     std::string filteredEndpointQuery(const FederateState* fed) const;
     /** process a command instruction for the core*/
     void processCommandInstruction(ActionMessage& command);
+    /** generate the registration message for connecting to a broker*/
+    ActionMessage generateBrokerRegistration() const;
+    /** connect to a different broker as directed by the broker*/
+    void processBrokerRedirect(const ActionMessage& command);
+    /** set up a direct route to another core as instructed by the broker*/
+    void processDirectRouteInstruction(const ActionMessage& command);
+    /** process the acknowledgement of a route or flush marker sent to another core
+    @details the first acknowledgement switches the federates and endpoints of the core to the
+    direct route*/
+    void processRouteAck(GlobalBrokerId coreId);
+    /** remove the direct route to a core and send its data through the broker again*/
+    void closeDirectRoute(GlobalBrokerId coreId);
+    /** transmit a message for a federate or endpoint of another core
+    @details data sent on a direct route travels on a different channel than anything sent through
+    the broker, so messages for a core whose route is being switched are held until the switch is
+    acknowledged, and timing messages sent any other way are held until the data on the direct
+    routes is flushed*/
+    void transmitRemote(const ActionMessage& cmd);
+    /** transmit the held messages once no route switch or flush is outstanding*/
+    void releaseHeldRouteMessages();
+    /** close the direct routes whose marker has gone unacknowledged for a full tick
+    @details closing the route releases the messages held for it through the broker*/
+    void checkDirectRouteTimeouts();
 
   private:
     int32_t _global_federation_size = 0;  //!< total size of the federation
@@ -406,6 +475,8 @@ class CommonCore: public Core, public BrokerBase {
         federates;  //!< threadsafe local federate information list for external functions
     gmlc::containers::DualMappedVector<FedInfo, std::string, GlobalFederateId>
         loopFederates;  // federate pointers stored for the core loop
+    /// federate pointers indexed by global id for fast lookup in the core loop
+    GlobalIdTable<FederateState*> loopFederateIds;
 
     /** counter for the number of messages that have been sent, nothing magical about 54 just a
      * number bigger than 1 to prevent confusion */
@@ -425,10 +496,17 @@ class CommonCore: public Core, public BrokerBase {
     gmlc::concurrency::DelayedObjects<std::string> activeQueries;
     /// holder for the query map builder information
     mutable std::vector<std::tuple<JsonMapBuilder, std::vector<ActionMessage>, bool>> mapBuilders;
+    /// change notices for the maps subscribed by the parent broker <index, <notice, sent>>
+    std::map<std::uint16_t, std::pair<ActionMessage, bool>> mapSubscriptions;
 
     FilterFederate* filterFed{nullptr};
     std::atomic<std::thread::id> filterThread{std::thread::id{}};
     std::atomic<GlobalFederateId> filterFedID;
+    int filterThreadCount{0};  //!< the number of threads for running filter operators, 0 for inline
+    /// the number of threads for running callback federates, 0 for the hardware concurrency
+    int callbackThreadCount{0};
+    std::mutex callbackPoolLock;  //!< lock for creating the callback worker pool
+    std::unique_ptr<WorkerPool> callbackPool;  //!< the worker threads for callback federates
     std::atomic<uint16_t> nextAirLock{0};  //!< the index of the next airlock to use
     std::array<gmlc::containers::AirLock<std::any>, 4>
         dataAirlocks;  //!< airlocks for updating filter operators and other functions
@@ -449,6 +527,20 @@ class CommonCore: public Core, public BrokerBase {
     void deliverMessage(ActionMessage& message);
     /** function to deal with a source filters*/
     ActionMessage& processMessage(ActionMessage& message);
+    /** start recording where the filters forward a message so an anti-message can follow it
+    @param federate the local federate whose commit time bounds the lifetime of the record
+    @return true if a new record was created*/
+    bool trackSpeculativeRoute(const ActionMessage& message, GlobalFederateId federate);
+    /** record the destination a message is forwarded to if its route is tracked
+    @return false if the message was already retracted and should be dropped*/
+    bool recordSpeculativeRoute(const ActionMessage& message);
+    /** remove a tracked route that holds nothing beyond the original destination*/
+    void releaseSpeculativeRoute(const SpeculativeRouteKey& key, GlobalHandle destination);
+    /** send an anti-message to the destinations recorded for the message it retracts
+    @return true if the anti-message was fully handled by the recorded route*/
+    bool retractSpeculativeRoute(const ActionMessage& anti);
+    /** remove route records for messages that can no longer be retracted*/
+    void pruneSpeculativeRoutes();
     /** add a new handle to the generic structure
     and return a reference to the basicHandle
     */
@@ -0,0 +1,192 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "ConnectionGraph.hpp"
+
+#include "../common/JsonProcessingFunctions.hpp"
+#include "../common/fmt_format.h"
+
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+namespace helics {
+/// version of the connection graph file format
+static constexpr int graphFileVersion{1};
+
+void ConnectionGraph::addFederate(const std::string& name)
+{
+    federates.insert(name);
+}
+
+void ConnectionGraph::addInterface(const std::string& name, InterfaceInfo info)
+{
+    if (name.empty()) {
+        return;
+    }
+    auto kind = info.kind;
+    interfaces[InterfaceKey(kind, name)] = std::move(info);
+}
+
+bool ConnectionGraph::addConnection(const std::string& publication,
+                                    const std::string& input,
+                                    bool declaredByInput,
+                                    std::uint16_t flags)
+{
+    if (publication.empty() || input.empty() || hasConnection(publication, input)) {
+        return false;
+    }
+    connectionIndex.emplace(InterfaceKey(InterfaceType::PUBLICATION, publication),
+                            connections.size());
+    connectionIndex.emplace(InterfaceKey(InterfaceType::INPUT, input), connections.size());
+    connections.push_back(Connection{publication, input, declaredByInput, flags});
+    return true;
+}
+
+bool ConnectionGraph::hasFederate(const std::string& name) const
+{
+    return (federates.find(name) != federates.end());
+}
+
+bool ConnectionGraph::hasConnection(const std::string& publication, const std::string& input) const
+{
+    auto rng = connectionIndex.equal_range(InterfaceKey(InterfaceType::PUBLICATION, publication));
+    for (auto it = rng.first; it != rng.second; ++it) {
+        const auto& conn = connections[it->second];
+        if (conn.publication == publication && conn.input == input) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const ConnectionGraph::InterfaceInfo* ConnectionGraph::findInterface(InterfaceType kind,
+                                                                     const std::string& name) const
+{
+    auto fnd = interfaces.find(InterfaceKey(kind, name));
+    return (fnd != interfaces.end()) ? &(fnd->second) : nullptr;
+}
+
+bool ConnectionGraph::matches(const std::string& name, const InterfaceInfo& info) const
+{
+    const auto* cached = findInterface(info.kind, name);
+    return (cached != nullptr) && cached->federate == info.federate &&
+        cached->type == info.type && cached->units == info.units;
+}
+
+std::vector<const ConnectionGraph::Connection*>
+    ConnectionGraph::connectionsOf(InterfaceType kind, const std::string& name) const
+{
+    std::vector<const Connection*> result;
+    auto rng = connectionIndex.equal_range(InterfaceKey(kind, name));
+    for (auto it = rng.first; it != rng.second; ++it) {
+        result.push_back(&connections[it->second]);
+    }
+    return result;
+}
+
+void ConnectionGraph::clear()
+{
+    federates.clear();
+    interfaces.clear();
+    connections.clear();
+    connectionIndex.clear();
+    loadedHash.clear();
+}
+
+std::string ConnectionGraph::configurationHash(int32_t federateCount) const
+{
+    // FNV-1a so the hash is the same on every platform
+    std::uint64_t hash{0xcbf2'9ce4'8422'2325ULL};
+    auto addText = [&hash](const std::string& text) {
+        for (auto chr : text) {
+            hash ^= static_cast<unsigned char>(chr);
+            hash *= 0x0000'0100'0000'01B3ULL;
+        }
+        // hash a terminating zero so the concatenation of the strings is unambiguous
+        hash *= 0x0000'0100'0000'01B3ULL;
+    };
+    addText(std::to_string(federateCount));
+    // the set is sorted so the hash does not depend on the registration order
+    for (const auto& fed : federates) {
+        addText(fed);
+    }
+    return fmt::format("{:016x}", hash);
+}
+
+void ConnectionGraph::save(const std::string& fileName, int32_t federateCount) const
+{
+    Json::Value graph;
+    graph["version"] = graphFileVersion;
+    graph["configuration_hash"] = configurationHash(federateCount);
+    graph["federates"] = Json::arrayValue;
+    for (const auto& fed : federates) {
+        graph["federates"].append(fed);
+    }
+    graph["interfaces"] = Json::arrayValue;
+    for (const auto& iface : interfaces) {
+        Json::Value ival;
+        ival["name"] = iface.first.second;
+        ival["federate"] = iface.second.federate;
+        ival["kind"] = std::string(1, static_cast<char>(iface.second.kind));
+        ival["type"] = iface.second.type;
+        ival["units"] = iface.second.units;
+        graph["interfaces"].append(ival);
+    }
+    graph["connections"] = Json::arrayValue;
+    for (const auto& conn : connections) {
+        Json::Value cval;
+        cval["publication"] = conn.publication;
+        cval["input"] = conn.input;
+        cval["declared_by"] = conn.declaredByInput ? "input" : "publication";
+        cval["flags"] = conn.flags;
+        graph["connections"].append(cval);
+    }
+    std::ofstream out(fileName, std::ios::trunc);
+    if (!out) {
+        throw(std::invalid_argument(std::string("unable to open ") + fileName));
+    }
+    out << generateJsonString(graph);
+}
+
+void ConnectionGraph::load(const std::string& fileName)
+{
+    if (!std::ifstream(fileName)) {
+        throw(std::invalid_argument(std::string("unable to open ") + fileName));
+    }
+    auto graph = loadJson(fileName);
+    if (!graph.isObject() || !graph["version"].isInt() ||
+        graph["version"].asInt() != graphFileVersion) {
+        throw(std::invalid_argument(fileName + " is not a valid connection graph"));
+    }
+    clear();
+    try {
+        for (const auto& fed : graph["federates"]) {
+            addFederate(fed.asString());
+        }
+        for (const auto& ival : graph["interfaces"]) {
+            InterfaceInfo info;
+            info.federate = ival["federate"].asString();
+            auto kind = ival["kind"].asString();
+            info.kind = kind.empty() ? InterfaceType::UNKNOWN : static_cast<InterfaceType>(kind[0]);
+            info.type = ival["type"].asString();
+            info.units = ival["units"].asString();
+            addInterface(ival["name"].asString(), std::move(info));
+        }
+        for (const auto& cval : graph["connections"]) {
+            addConnection(cval["publication"].asString(),
+                          cval["input"].asString(),
+                          cval["declared_by"].asString() != "publication",
+                          static_cast<std::uint16_t>(cval["flags"].asUInt()));
+        }
+        loadedHash = graph["configuration_hash"].asString();
+    }
+    catch (const Json::Exception& jerr) {
+        clear();
+        throw(std::invalid_argument(fileName + " is not a valid connection graph: " + jerr.what()));
+    }
+}
+}  // namespace helics
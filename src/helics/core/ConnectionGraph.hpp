@@ -0,0 +1,98 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "CoreTypes.hpp"
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace helics {
+/** class recording the interfaces and data connections of a federation
+@details the root broker records the resolved graph so it can be saved to a file and loaded on a
+later launch of the same federation to connect interfaces as soon as they register,
+interfaces are identified by their kind and name since publications and inputs can share names,
+this class is not designed to be thread safe that would require a wrapper around it
+*/
+class ConnectionGraph {
+  public:
+    /** description of an interface in the graph*/
+    struct InterfaceInfo {
+        std::string federate;  //!< the name of the federate owning the interface
+        InterfaceType kind{InterfaceType::UNKNOWN};  //!< the type of interface
+        std::string type;  //!< the data type of the interface
+        std::string units;  //!< the units of the interface
+    };
+    /** description of a data connection in the graph*/
+    struct Connection {
+        std::string publication;  //!< the name of the publication
+        std::string input;  //!< the name of the input
+        bool declaredByInput{true};  //!< the input requested the connection
+        std::uint16_t flags{0};  //!< the flags of the connection request
+    };
+
+    /** add a federate to the graph*/
+    void addFederate(const std::string& name);
+    /** add an interface to the graph,  interfaces without a name are ignored*/
+    void addInterface(const std::string& name, InterfaceInfo info);
+    /** add a data connection to the graph
+    @return false if the connection was already in the graph or either name is empty*/
+    bool addConnection(const std::string& publication,
+                       const std::string& input,
+                       bool declaredByInput,
+                       std::uint16_t flags);
+    /** check if a federate is part of the graph*/
+    bool hasFederate(const std::string& name) const;
+    /** check if a connection is part of the graph*/
+    bool hasConnection(const std::string& publication, const std::string& input) const;
+    /** get the description of an interface
+    @return a pointer to the description or nullptr if the interface is not in the graph*/
+    const InterfaceInfo* findInterface(InterfaceType kind, const std::string& name) const;
+    /** check if an interface of the kind given in info matches the description of it in the graph*/
+    bool matches(const std::string& name, const InterfaceInfo& info) const;
+    /** get all the connections of a publication or input*/
+    std::vector<const Connection*> connectionsOf(InterfaceType kind, const std::string& name) const;
+    /** get the number of federates in the graph*/
+    std::size_t federateCount() const { return federates.size(); }
+    /** get the number of connections in the graph*/
+    std::size_t connectionCount() const { return connections.size(); }
+    /** check if the graph is empty*/
+    bool empty() const { return interfaces.empty() && connections.empty(); }
+    /** remove everything from the graph*/
+    void clear();
+
+    /** compute the hash of the federation configuration the graph was generated from
+    @details the hash covers the expected federate count and the names of the federates in the
+    graph
+    @param federateCount the number of federates the broker was configured to expect*/
+    std::string configurationHash(int32_t federateCount) const;
+    /** get the configuration hash stored in a loaded graph*/
+    const std::string& storedHash() const { return loadedHash; }
+
+    /** save the graph to a json file
+    @param fileName the file to write
+    @param federateCount the number of federates the broker was configured to expect*/
+    void save(const std::string& fileName, int32_t federateCount) const;
+    /** load a graph from a json file
+    @throw std::invalid_argument if the file cannot be read or is not a valid graph*/
+    void load(const std::string& fileName);
+
+  private:
+    /// the kind and name identifying an interface
+    using InterfaceKey = std::pair<InterfaceType, std::string>;
+    std::set<std::string> federates;  //!< the names of the federates
+    std::map<InterfaceKey, InterfaceInfo> interfaces;  //!< the interfaces by kind and name
+    std::vector<Connection> connections;  //!< the data connections
+    /// the index of the connections of each publication and input
+    std::multimap<InterfaceKey, std::size_t> connectionIndex;
+    std::string loadedHash;  //!< the configuration hash stored in a loaded file
+};
+}  // namespace helics
@@ -37,6 +37,7 @@ namespace
 */
 namespace helics {
 class CoreFederateInfo;
+class FederateOperator;
 
 /** the class defining the core interface through an abstract class*/
 class Core {
@@ -183,7 +184,8 @@ class Core {
     /**
      * Change the federate state to the Initializing state.
      *
-     * May only be invoked in Created state otherwise an error is thrown
+     * May only be invoked in Created state otherwise an error is thrown.  For a federate with a
+     * federate operator the call returns without waiting for the initializing state.
      */
     virtual void enterInitializingMode(LocalFederateId federateID) = 0;
 
@@ -322,6 +324,13 @@ class Core {
     @return the most recent granted time or the startup time
     */
     virtual Time getCurrentTime(LocalFederateId federateID) const = 0;
+    /** get the most recent committed time of an optimistic federate
+    @details the committed time is the time granted through the time coordination, a federate with
+    the rollback flag set can be granted later times speculatively but will never be rolled back to a
+    time at or prior to the committed time. For other federates this is the same as the current time
+    @param federateID the identifier of the federate to get the time
+    */
+    virtual Time getCommittedTime(LocalFederateId federateID) const = 0;
 
     /**
     Set a flag in a a federate
@@ -445,6 +454,17 @@ class Core {
     */
     virtual int32_t getHandleOption(InterfaceHandle handle, int32_t option) const = 0;
 
+    /** set the comparison used to decide if a value received by an input is a change
+    @details used by federates detecting convergence of iterations,  the comparison is called with
+    the previous and the new value from a source and returns true if the new value is a change.
+    The comparison is called from the core threads.
+    @param handle the handle of the input
+    @param detector the comparison function,  an empty function restores the byte comparison
+    */
+    virtual void setInputChangeDetector(
+        InterfaceHandle handle,
+        std::function<bool(const SmallBuffer&, const SmallBuffer&)> detector) = 0;
+
     /** close a handle from further connections
     @param handle the handle from the publication, input, endpoint or filter
     */
@@ -743,6 +763,17 @@ class Core {
     virtual void setFilterOperator(InterfaceHandle filter,
                                    std::shared_ptr<FilterOperator> callback) = 0;
 
+    /** set an operator to drive a federate through callbacks
+    @details the operations of the federate are executed on a pool of worker threads in the core
+    as the grants for the federate arrive,  so the federate does not need a thread of its own.
+    The blocking calls for entering executing mode and requesting time are invalid for the
+    federate after this call.  May only be called in the created state.
+    @param federateID the identifier of the federate
+    @param callback the operator executing the federate operations
+    */
+    virtual void setFederateOperator(LocalFederateId federateID,
+                                     std::shared_ptr<FederateOperator> callback) = 0;
+
     /** define a logging function to use for logging message and notices from the federation and
     individual federate
     @param federateID  the identifier for the individual federate or 0 for the Core Logger
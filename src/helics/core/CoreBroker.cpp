@@ -15,6 +15,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "TimeoutMonitor.h"
 #include "fileConnections.hpp"
 #include "gmlc/utilities/stringConversion.h"
+#include "gmlc/utilities/stringOps.h"
 #include "helicsCLI11.hpp"
 #include "helics_definitions.hpp"
 #include "loggingHelper.hpp"
@@ -80,9 +81,8 @@ route_id CoreBroker::getRoute(GlobalFederateId fedid) const
     if ((fedid == parent_broker_id) || (fedid == higher_broker_id)) {
         return parent_route_id;
     }
-    auto fnd = routing_table.find(fedid);
-    return (fnd != routing_table.end()) ? fnd->second :
-                                          parent_route_id;  // zero is the default route
+    const auto* route = routing_table.find(fedid);
+    return (route != nullptr) ? *route : parent_route_id;  // zero is the default route
 }
 
 BasicBrokerInfo* CoreBroker::getBrokerById(GlobalBrokerId brokerid)
@@ -218,11 +218,10 @@ bool CoreBroker::isOpenToNewFederates() const
 void CoreBroker::processPriorityCommand(ActionMessage&& command)
 {
     // deal with a few types of message immediately
-    LOG_TRACE(global_broker_id_local,
-              getIdentifier(),
-              fmt::format("|| priority_cmd:{} from {}",
-                          prettyPrintString(command),
-                          command.source_id.baseValue()));
+    LOG_TRACE_COMMAND(global_broker_id_local, getIdentifier(), "|| priority_cmd:", command, false);
+    if (incrementalMaps || !mapSubscriptions.empty()) {
+        checkMapSubscriptions(command);
+    }
     switch (command.action()) {
         case CMD_PING_PRIORITY:
             if (command.dest_id == global_broker_id_local) {
@@ -314,6 +313,8 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
                 auto global_fedid = _federates.back().global_id;
 
                 routing_table.emplace(global_fedid, route_id);
+                refreshCutThroughRoutes();
+                checkConnectionCacheFederate(std::string(command.name()));
                 // don't bother with the federate_table
                 // transmit the response
                 ActionMessage fedReply(CMD_FED_ACK);
@@ -342,10 +343,10 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
                 if (brk != _brokers.end()) {
                     // we would get this if the ack didn't go through for some reason
                     brk->route = route_id{routeCount++};
-                    addRoute(brk->route,
-                             command.getExtraData(),
-                             command.getString(targetStringLoc));
+                    brk->routeInfo = command.getString(targetStringLoc);
+                    addRoute(brk->route, command.getExtraData(), brk->routeInfo);
                     routing_table[brk->global_id] = brk->route;
+                    refreshCutThroughRoutes();
 
                     // sending the response message
                     ActionMessage brokerReply(CMD_BROKER_ACK);
@@ -411,6 +412,13 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
                 }
                 return;
             }
+            if (autoSplitThreshold > 0 && localCoreCount >= autoSplitThreshold &&
+                checkActionFlag(command, core_flag) &&
+                ((!command.source_id.isValid()) || (command.source_id == parent_broker_id))) {
+                if (redirectToSubBroker(command)) {
+                    return;
+                }
+            }
             auto inserted = _brokers.insert(std::string(command.name()), no_search, command.name());
             if (!inserted) {
                 route_id newroute;
@@ -436,9 +444,10 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
             if ((!command.source_id.isValid()) || (command.source_id == parent_broker_id)) {
                 // TODO(PT): this will need to be updated when we enable mesh routing
                 _brokers.back().route = route_id{routeCount++};
+                _brokers.back().routeInfo = command.getString(targetStringLoc);
                 addRoute(_brokers.back().route,
                          command.getExtraData(),
-                         command.getString(targetStringLoc));
+                         _brokers.back().routeInfo);
                 _brokers.back().parent = global_broker_id_local;
                 _brokers.back()._nonLocal = false;
                 _brokers.back()._route_key = true;
@@ -451,6 +460,9 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
                 _brokers.back()._nonLocal = true;
             }
             _brokers.back()._core = checkActionFlag(command, core_flag);
+            if (_brokers.back()._core && !_brokers.back()._nonLocal) {
+                ++localCoreCount;
+            }
             if (!isRootc) {
                 if ((global_broker_id_local.isValid()) &&
                     (global_broker_id_local != parent_broker_id)) {
@@ -471,6 +483,7 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
                     _brokers.back()._disable_ping = true;
                 }
                 routing_table.emplace(global_brkid, route);
+                refreshCutThroughRoutes();
                 // don't bother with the broker_table for root broker
 
                 // sending the response message
@@ -500,6 +513,7 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
                 }
                 transmit(route, command);
                 routing_table.emplace(fed->global_id, route);
+                refreshCutThroughRoutes();
             } else {
                 // this means we haven't seen this federate before for some reason
                 _federates.insert(std::string(command.name()),
@@ -508,6 +522,7 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
                 _federates.back().route = getRoute(command.source_id);
                 _federates.back().global_id = command.dest_id;
                 routing_table.emplace(fed->global_id, _federates.back().route);
+                refreshCutThroughRoutes();
                 // it also means we don't forward it
             }
         } break;
@@ -551,6 +566,7 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
                 auto route = broker->route;
                 _brokers.addSearchTerm(GlobalBrokerId(command.dest_id), broker->name);
                 routing_table.emplace(broker->global_id, route);
+                refreshCutThroughRoutes();
                 command.source_id = global_broker_id_local;  // we want the intermediate broker to
                                                              // change the source_id
                 transmit(route, command);
@@ -561,6 +577,7 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
                 _brokers.back().route = getRoute(command.source_id);
                 _brokers.back().global_id = GlobalBrokerId(command.dest_id);
                 routing_table.emplace(broker->global_id, _brokers.back().route);
+                refreshCutThroughRoutes();
             }
         } break;
         case CMD_PRIORITY_DISCONNECT: {
@@ -579,6 +596,11 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
         } break;
         case CMD_REG_ROUTE:
             break;
+        case CMD_ROUTE_ACK:
+            if (command.dest_id != global_broker_id_local) {
+                routeMessage(command);
+            }
+            break;
         case CMD_SEND_COMMAND:
             processCommandInstruction(command);
             break;
@@ -588,6 +610,9 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
         case CMD_SET_GLOBAL:
             processQueryCommand(command);
             break;
+        case CMD_MAP_UPDATE:
+            processMapUpdate(command);
+            break;
 
         default:
             // must not have been a priority command
@@ -719,12 +744,10 @@ void CoreBroker::sendErrorToImmediateBrokers(int error_code)
 
 void CoreBroker::processCommand(ActionMessage&& command)
 {
-    LOG_TRACE(global_broker_id_local,
-              getIdentifier(),
-              fmt::format("|| cmd:{} from {} to {}",
-                          prettyPrintString(command),
-                          command.source_id.baseValue(),
-                          command.dest_id.baseValue()));
+    LOG_TRACE_COMMAND(global_broker_id_local, getIdentifier(), "|| cmd:", command, true);
+    if (incrementalMaps || !mapSubscriptions.empty()) {
+        checkMapSubscriptions(command);
+    }
     switch (command.action()) {
         case CMD_IGNORE:
         case CMD_PROTOCOL:
@@ -864,6 +887,7 @@ void CoreBroker::processCommand(ActionMessage&& command)
             for (const auto& brk : _brokers) {
                 transmit(brk.route, command);
             }
+            enableCutThrough();
             {
                 timeCoord->enteringExecMode();
                 auto res = timeCoord->checkExecEntry();
@@ -1056,6 +1080,7 @@ void CoreBroker::processCommand(ActionMessage&& command)
 
             break;
         case CMD_SEND_MESSAGE:
+        case CMD_ANTI_MESSAGE:
         case CMD_SEND_FOR_FILTER:
         case CMD_SEND_FOR_FILTER_AND_RETURN:
         case CMD_FILTER_RESULT:
@@ -1078,13 +1103,22 @@ void CoreBroker::processCommand(ActionMessage&& command)
                     }
 
                 } else {
+                    if (directRouteThreshold > 0 && command.action() == CMD_SEND_MESSAGE) {
+                        checkDirectRouteTraffic(command);
+                    }
                     transmit(route, command);
                 }
             } else {
+                if (directRouteThreshold > 0 && command.action() == CMD_SEND_MESSAGE) {
+                    checkDirectRouteTraffic(command);
+                }
                 transmit(getRoute(command.dest_id), command);
             }
             break;
         case CMD_PUB:
+            if (directRouteThreshold > 0) {
+                checkDirectRouteTraffic(command);
+            }
             transmit(getRoute(command.dest_id), command);
             break;
 
@@ -1242,15 +1276,18 @@ void CoreBroker::checkForNamedInterface(ActionMessage& command)
             if (pub != nullptr) {
                 auto fed = _federates.find(pub->getFederateId());
                 if (fed->state < connection_state::error) {
-                    command.setAction(CMD_ADD_SUBSCRIBER);
-                    command.setDestination(pub->handle);
-                    command.payload.clear();
-                    routeMessage(command);
-                    command.setAction(CMD_ADD_PUBLISHER);
-                    command.swapSourceDest();
-                    command.name(pub->key);
-                    command.setStringData(pub->type, pub->units);
-                    routeMessage(command);
+                    // skip connections already made from the cached connection graph
+                    if (!recordConnection(pub->handle, command.getSource(), true, command.flags)) {
+                        command.setAction(CMD_ADD_SUBSCRIBER);
+                        command.setDestination(pub->handle);
+                        command.payload.clear();
+                        routeConnectionMessage(command);
+                        command.setAction(CMD_ADD_PUBLISHER);
+                        command.swapSourceDest();
+                        command.name(pub->key);
+                        command.setStringData(pub->type, pub->units);
+                        routeConnectionMessage(command);
+                    }
                 } else {
                     command.setAction(CMD_ADD_PUBLISHER);
                     setActionFlag(command, error_flag);
@@ -1267,19 +1304,22 @@ void CoreBroker::checkForNamedInterface(ActionMessage& command)
             if (inp != nullptr) {
                 auto fed = _federates.find(inp->getFederateId());
                 if (fed->state < connection_state::error) {
-                    command.setAction(CMD_ADD_PUBLISHER);
-                    command.setDestination(inp->handle);
-                    auto* pub = handles.findHandle(command.getSource());
-                    if (pub != nullptr) {
-                        command.setStringData(pub->type, pub->units);
+                    // skip connections already made from the cached connection graph
+                    if (!recordConnection(command.getSource(), inp->handle, false, command.flags)) {
+                        command.setAction(CMD_ADD_PUBLISHER);
+                        command.setDestination(inp->handle);
+                        auto* pub = handles.findHandle(command.getSource());
+                        if (pub != nullptr) {
+                            command.setStringData(pub->type, pub->units);
+                        }
+                        command.payload.clear();
+                        routeConnectionMessage(command);
+                        command.setAction(CMD_ADD_SUBSCRIBER);
+                        command.swapSourceDest();
+                        command.clearStringData();
+                        command.name(inp->key);
+                        routeConnectionMessage(command);
                     }
-                    command.payload.clear();
-                    routeMessage(command);
-                    command.setAction(CMD_ADD_SUBSCRIBER);
-                    command.swapSourceDest();
-                    command.clearStringData();
-                    command.name(inp->key);
-                    routeMessage(command);
                 } else {
                     command.setAction(CMD_ADD_SUBSCRIBER);
                     setActionFlag(command, error_flag);
@@ -1539,6 +1579,8 @@ void CoreBroker::addPublication(ActionMessage& m)
     if (!isRootc) {
         transmit(parent_route_id, m);
     } else {
+        recordInterface(pub);
+        preResolveConnections(pub);
         FindandNotifyPublicationTargets(pub);
     }
 }
@@ -1564,6 +1606,8 @@ void CoreBroker::addInput(ActionMessage& m)
     if (!isRootc) {
         transmit(parent_route_id, m);
     } else {
+        recordInterface(inp);
+        preResolveConnections(inp);
         FindandNotifyInputTargets(inp);
     }
 }
@@ -1604,6 +1648,7 @@ void CoreBroker::addEndpoint(ActionMessage& m)
             }
         }
     } else {
+        recordInterface(ept);
         FindandNotifyEndpointTargets(ept);
     }
 }
@@ -1639,12 +1684,14 @@ void CoreBroker::addFilter(ActionMessage& m)
             }
         }
     } else {
+        recordInterface(filt);
         FindandNotifyFilterTargets(filt);
     }
 }
 
-CoreBroker::CoreBroker(bool setAsRootBroker) noexcept:
-    _isRoot(setAsRootBroker), isRootc(setAsRootBroker), timeoutMon(new TimeoutMonitor)
+CoreBroker::CoreBroker(bool setAsRootBroker, bool disableQueue) noexcept:
+    BrokerBase(disableQueue), _isRoot(setAsRootBroker), isRootc(setAsRootBroker),
+    timeoutMon(new TimeoutMonitor)
 {
 }
 
@@ -1707,6 +1754,31 @@ std::shared_ptr<helicsCLI11App> CoreBroker::generateCLI()
     app->remove_helics_specifics();
     app->add_flag_callback(
         "--root", [this]() { setAsRoot(); }, "specify whether the broker is a root");
+    app->add_option("--auto_split",
+                    autoSplitThreshold,
+                    "the number of cores that can connect directly to this broker, additional cores "
+                    "are redirected to automatically generated sub-brokers, 0 disables")
+        ->check(CLI::NonNegativeNumber);
+    app->add_option("--direct_route_threshold",
+                    directRouteThreshold,
+                    "the number of data messages between two cores connected to this broker "
+                    "that triggers a direct route between them, 0 disables direct routes")
+        ->check(CLI::NonNegativeNumber);
+    app->add_flag("--incremental_maps",
+                  incrementalMaps,
+                  "maintain the federation map queries from change notices sent by the cores "
+                  "instead of querying every core for each request");
+    app->add_flag("--cut_through",
+                  cutThrough,
+                  "forward publications and messages with a known destination directly from the "
+                  "communication layer without processing them in the broker, the routes are given "
+                  "to the communication layer when the federation starts executing and updated "
+                  "as federates and brokers register");
+    app->add_option("--connection_cache",
+                    connectionCacheFile,
+                    "file for the root broker to save the resolved connection graph to, a graph "
+                    "saved by an earlier launch with the same configuration is used to connect "
+                    "interfaces as soon as they register");
     return app;
 }
 
@@ -1806,6 +1878,10 @@ void CoreBroker::processDisconnect(bool skipUnregister)
     if (brokerState > broker_state_t::configured) {
         LOG_CONNECTIONS(parent_broker_id, getIdentifier(), "||disconnecting");
         brokerState = broker_state_t::terminating;
+        if (cutThroughActive) {
+            cutThroughActive = false;
+            setCutThroughRoutes({}, false);
+        }
         brokerDisconnect();
     }
     brokerState = broker_state_t::terminated;
@@ -2032,10 +2108,12 @@ void CoreBroker::executeInitializationOperations()
         }
     }
 
+    finalizeConnectionCache();
     ActionMessage m(CMD_INIT_GRANT);
     m.source_id = global_broker_id_local;
     brokerState = broker_state_t::operating;
     broadcast(m);
+    enableCutThrough();
     timeCoord->enteringExecMode();
     auto res = timeCoord->checkExecEntry();
     if (res == MessageProcessingResult::NEXT_STEP) {
@@ -2048,6 +2126,9 @@ void CoreBroker::FindandNotifyInputTargets(BasicHandleInfo& handleInfo)
 {
     auto Handles = unknownHandles.checkForInputs(handleInfo.key);
     for (auto target : Handles) {
+        if (recordConnection(target.first, handleInfo.handle, false, target.second)) {
+            continue;
+        }
         // notify the publication about its subscriber
         ActionMessage m(CMD_ADD_SUBSCRIBER);
 
@@ -2078,6 +2159,9 @@ void CoreBroker::FindandNotifyPublicationTargets(BasicHandleInfo& handleInfo)
 {
     auto subHandles = unknownHandles.checkForPublications(handleInfo.key);
     for (const auto& sub : subHandles) {
+        if (recordConnection(handleInfo.handle, sub.first, true, sub.second)) {
+            continue;
+        }
         // notify the publication about its subscriber
         ActionMessage m(CMD_ADD_SUBSCRIBER);
         m.setSource(sub.first);
@@ -2440,6 +2524,9 @@ void CoreBroker::disconnectBroker(BasicBrokerInfo& brk)
 {
     markAsDisconnected(brk.global_id);
     checkInFlightQueries(brk.global_id);
+    if (brk._core && !coreTrafficCounts.empty()) {
+        closeDirectRoutes(brk.global_id);
+    }
     if (brokerState < broker_state_t::operating) {
         if (isRootc) {
             ActionMessage dis(CMD_BROADCAST_DISCONNECT);
@@ -2595,7 +2682,7 @@ std::string CoreBroker::generateQueryAnswer(const std::string& request, bool for
     if ((request == "queries") || (request == "available_queries")) {
         return "[\"isinit\",\"isconnected\",\"name\",\"identifier\",\"address\",\"queries\",\"address\",\"counts\",\"summary\",\"federates\",\"brokers\",\"inputs\",\"endpoints\","
                "\"publications\",\"filters\",\"federate_map\",\"dependency_graph\",\"data_flow_graph\",\"dependencies\",\"dependson\",\"dependents\","
-               "\"current_time\",\"current_state\",\"global_state\",\"status\",\"global_time\",\"version\",\"version_all\",\"exists\",\"global_flush\"]";
+               "\"current_time\",\"current_state\",\"global_state\",\"status\",\"global_time\",\"version\",\"version_all\",\"exists\",\"global_flush\",\"command_counts\"]";
     }
     if (request == "address") {
         return std::string{"\""} + getAddress() + '"';
@@ -2631,6 +2718,16 @@ std::string CoreBroker::generateQueryAnswer(const std::string& request, bool for
         base["handles"] = static_cast<int>(handles.size());
         return generateJsonString(base);
     }
+    if (request == "command_counts") {
+        Json::Value base;
+        base["name"] = getIdentifier();
+        base["id"] = global_broker_id_local.baseValue();
+        base["received"] = static_cast<Json::UInt64>(currentMessageCounter());
+        base["processed"] = static_cast<Json::UInt64>(processedCommandCounter());
+        base["superseded"] = static_cast<Json::UInt64>(supersededMessageCounter());
+        base["log_dropped"] = static_cast<Json::UInt64>(droppedLogMessageCounter());
+        return generateJsonString(base);
+    }
     if (request == "summary") {
         return generateFederationSummary();
     }
@@ -2684,11 +2781,17 @@ std::string CoreBroker::generateQueryAnswer(const std::string& request, bool for
     auto mi = mapIndex.find(std::string(request));
     if (mi != mapIndex.end()) {
         auto index = mi->second.first;
-        if (isValidIndex(index, mapBuilders) && !mi->second.second) {
+        const bool incremental = isIncrementalMap(index);
+        const bool reset = mi->second.second && !incremental;
+        if (isValidIndex(index, mapBuilders) && !reset) {
             auto& builder = std::get<0>(mapBuilders[index]);
             if (builder.isCompleted()) {
                 auto center = generateMapObjectCounter();
                 if (center == builder.getCounterCode()) {
+                    if (incremental && !builder.isCurrent() &&
+                        refreshMapBuilder(request, index, force_ordering)) {
+                        return "#wait";
+                    }
                     return builder.generate();
                 }
                 builder.reset();
@@ -2698,9 +2801,9 @@ std::string CoreBroker::generateQueryAnswer(const std::string& request, bool for
             }
         }
 
-        initializeMapBuilder(request, index, mi->second.second, force_ordering);
+        initializeMapBuilder(request, index, reset, force_ordering);
         if (std::get<0>(mapBuilders[index]).isCompleted()) {
-            if (!mi->second.second) {
+            if (!reset) {
                 auto center = generateMapObjectCounter();
                 std::get<0>(mapBuilders[index]).setCounterCode(center);
             }
@@ -2824,6 +2927,9 @@ void CoreBroker::initializeMapBuilder(const std::string& request,
     queryReq.payload = request;
     queryReq.source_id = global_broker_id_local;
     queryReq.counter = index;  // indicating which processing to use
+    if (isIncrementalMap(index)) {
+        setActionFlag(queryReq, map_subscription_flag);
+    }
     bool hasCores = false;
     bool hasBrokers = false;
     for (const auto& broker : _brokers) {
@@ -2912,10 +3018,126 @@ void CoreBroker::initializeMapBuilder(const std::string& request,
     }
 }
 
+bool CoreBroker::refreshMapBuilder(const std::string& request,
+                                   std::uint16_t index,
+                                   bool force_ordering)
+{
+    auto& builder = std::get<0>(mapBuilders[index]);
+    ActionMessage queryReq(force_ordering ? CMD_BROKER_QUERY_ORDERED : CMD_BROKER_QUERY);
+    queryReq.payload = request;
+    queryReq.source_id = global_broker_id_local;
+    queryReq.counter = index;
+    setActionFlag(queryReq, map_subscription_flag);
+    for (const auto& component : builder.refreshComponents()) {
+        const auto* brk = getBrokerById(GlobalBrokerId(component.second));
+        if (brk == nullptr) {
+            builder.addComponent("#invalid", component.first);
+            continue;
+        }
+        queryReq.messageID = component.first;
+        queryReq.dest_id = brk->global_id;
+        transmit(brk->route, queryReq);
+    }
+    return !builder.isCompleted();
+}
+
+bool CoreBroker::isIncrementalMap(std::uint16_t index) const
+{
+    switch (index) {
+        case federate_map:
+        case current_time_map:
+        case dependency_graph:
+        case data_flow_graph:
+            return incrementalMaps || mapSubscriptions.find(index) != mapSubscriptions.end();
+        default:
+            return false;
+    }
+}
+
+void CoreBroker::addMapSubscription(const ActionMessage& query)
+{
+    ActionMessage notice(CMD_MAP_UPDATE);
+    notice.source_id = global_broker_id_local;
+    notice.dest_id = query.source_id;
+    notice.messageID = query.messageID;
+    notice.counter = query.counter;
+    mapSubscriptions[query.counter] = std::make_pair(std::move(notice), false);
+}
+
+void CoreBroker::checkMapSubscriptions(const ActionMessage& command)
+{
+    std::uint32_t mask{0U};
+    switch (command.action()) {
+        case CMD_REG_FED:
+        case CMD_FED_ACK:
+        case CMD_REG_BROKER:
+        case CMD_BROKER_ACK:
+        case CMD_INIT_GRANT:
+        case CMD_DISCONNECT:
+        case CMD_DISCONNECT_FED:
+        case CMD_DISCONNECT_CORE:
+        case CMD_DISCONNECT_BROKER:
+            mask = (1U << federate_map) | (1U << current_time_map) | (1U << dependency_graph) |
+                (1U << data_flow_graph);
+            break;
+        case CMD_ADD_DEPENDENCY:
+        case CMD_REMOVE_DEPENDENCY:
+        case CMD_ADD_DEPENDENT:
+        case CMD_REMOVE_DEPENDENT:
+        case CMD_ADD_INTERDEPENDENCY:
+        case CMD_REMOVE_INTERDEPENDENCY:
+            // the broker is only part of the dependency graph through its own dependencies
+            if (command.dest_id == global_broker_id_local) {
+                mask = (1U << dependency_graph);
+            }
+            break;
+        default:
+            // time and interface changes are reported by the cores where they occur
+            return;
+    }
+    for (std::uint16_t index = federate_map; index <= data_flow_graph; ++index) {
+        if ((mask & (1U << index)) == 0U) {
+            continue;
+        }
+        if (isValidIndex(index, mapBuilders)) {
+            auto& builder = std::get<0>(mapBuilders[index]);
+            if (builder.isCompleted()) {
+                builder.reset();
+            }
+        }
+        sendMapUpdate(index);
+    }
+}
+
+void CoreBroker::processMapUpdate(const ActionMessage& notice)
+{
+    if (notice.dest_id != global_broker_id_local) {
+        routeMessage(notice);
+        return;
+    }
+    if (isValidIndex(notice.counter, mapBuilders)) {
+        std::get<0>(mapBuilders[notice.counter])
+            .invalidateComponent(notice.messageID, notice.source_id.baseValue());
+    }
+    sendMapUpdate(notice.counter);
+}
+
+void CoreBroker::sendMapUpdate(std::uint16_t index)
+{
+    auto sub = mapSubscriptions.find(index);
+    if (sub != mapSubscriptions.end() && !sub->second.second) {
+        sub->second.second = true;
+        transmit(parent_route_id, sub->second.first);
+    }
+}
+
 void CoreBroker::processLocalQuery(const ActionMessage& m)
 {
     bool force_ordered =
         (m.action() == CMD_QUERY_ORDERED || m.action() == CMD_BROKER_QUERY_ORDERED);
+    if (checkActionFlag(m, map_subscription_flag)) {
+        addMapSubscription(m);
+    }
     ActionMessage queryRep(force_ordered ? CMD_QUERY_REPLY_ORDERED : CMD_QUERY_REPLY);
     queryRep.source_id = global_broker_id_local;
     queryRep.dest_id = m.source_id;
@@ -3175,6 +3397,8 @@ void CoreBroker::processLocalCommandInstruction(ActionMessage& m)
         m.setString(targetStringLoc, m.getString(sourceStringLoc));
         m.setString(sourceStringLoc, getIdentifier());
         addActionMessage(m);
+    } else if (cmd.compare(0, 12, "direct_route") == 0) {
+        requestDirectRoute(m.source_id, gmlc::utilities::stringOps::trim(cmd.substr(12)));
     } else {
         LOG_WARNING(global_broker_id_local,
                     getIdentifier(),
@@ -3182,6 +3406,412 @@ void CoreBroker::processLocalCommandInstruction(ActionMessage& m)
     }
 }
 
+std::shared_ptr<Broker> CoreBroker::generateSubBroker(const std::string& /*name*/,
+                                                      const std::string& /*configureString*/)
+{
+    return nullptr;
+}
+
+bool CoreBroker::redirectToSubBroker(const ActionMessage& command)
+{
+    if (subBrokers.empty() || subBrokerCoreCount >= autoSplitThreshold) {
+        std::string config = "--broker=" + getAddress();
+        if (!brokerKey.empty()) {
+            config.append(" --brokerkey=");
+            config.append(brokerKey);
+        }
+        if (cutThrough) {
+            config.append(" --cut_through");
+        }
+        auto name = fmt::format("{}_sub{}", getIdentifier(), subBrokers.size() + 1);
+        std::shared_ptr<Broker> subBroker;
+        try {
+            subBroker = generateSubBroker(name, config);
+        }
+        catch (const std::exception& e) {
+            LOG_WARNING(global_broker_id_local,
+                        getIdentifier(),
+                        fmt::format("unable to generate sub-broker {}: {}", name, e.what()));
+        }
+        if (!subBroker) {
+            // don't try again, all further cores connect directly
+            autoSplitThreshold = 0;
+            return false;
+        }
+        LOG_CONNECTIONS(global_broker_id_local,
+                        getIdentifier(),
+                        fmt::format("generated sub-broker {} at {}", name, subBroker->getAddress()));
+        subBrokers.push_back(std::move(subBroker));
+        subBrokerCoreCount = 0;
+    }
+    ++subBrokerCoreCount;
+    route_id newroute{routeCount++};
+    addRoute(newroute, command.getExtraData(), command.getString(targetStringLoc));
+    ActionMessage redirect(CMD_BROKER_REDIRECT);
+    redirect.source_id = global_broker_id_local;
+    redirect.name(command.name());
+    redirect.payload = subBrokers.back()->getAddress();
+    transmit(newroute, redirect);
+    removeRoute(newroute);
+    LOG_CONNECTIONS(global_broker_id_local,
+                    getIdentifier(),
+                    fmt::format("redirecting core {} to {}",
+                                command.name(),
+                                subBrokers.back()->getIdentifier()));
+    return true;
+}
+
+/** generate a key for the traffic count between a pair of cores*/
+static std::uint64_t corePairKey(GlobalBrokerId sourceCore, GlobalBrokerId destCore)
+{
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(sourceCore.baseValue()))
+            << 32U) |
+        static_cast<std::uint32_t>(destCore.baseValue());
+}
+
+const BasicBrokerInfo* CoreBroker::getLocalCore(GlobalFederateId federateId) const
+{
+    auto fed = _federates.find(federateId);
+    if (fed == _federates.end()) {
+        return nullptr;
+    }
+    auto brk = _brokers.find(fed->parent);
+    if (brk == _brokers.end() || !brk->_core || brk->_nonLocal || brk->routeInfo.empty()) {
+        return nullptr;
+    }
+    return &(*brk);
+}
+
+void CoreBroker::checkDirectRouteTraffic(const ActionMessage& command)
+{
+    const auto* sourceCore = getLocalCore(command.source_id);
+    if (sourceCore == nullptr) {
+        return;
+    }
+    const auto* destCore = getLocalCore(command.dest_id);
+    if (destCore == nullptr || destCore == sourceCore) {
+        return;
+    }
+    auto& count = coreTrafficCounts[corePairKey(sourceCore->global_id, destCore->global_id)];
+    // a negative count indicates the route has already been established
+    if (count < 0) {
+        return;
+    }
+    if (++count >= directRouteThreshold) {
+        count = -1;
+        establishDirectRoute(*sourceCore, *destCore);
+    }
+}
+
+void CoreBroker::enableCutThrough()
+{
+    // counting traffic for direct routes and tracing messages requires seeing all the data
+    if (!cutThrough || directRouteThreshold > 0 || isDumpLogging() ||
+        maxLogLevel.load() >= HELICS_LOG_LEVEL_TRACE) {
+        return;
+    }
+    cutThroughActive = true;
+    setCutThroughRoutes(routing_table, !isRootc);
+    LOG_CONNECTIONS(global_broker_id_local,
+                    getIdentifier(),
+                    fmt::format("forwarding data messages for {} federates without processing",
+                                routing_table.size()));
+}
+
+void CoreBroker::refreshCutThroughRoutes()
+{
+    if (cutThroughActive) {
+        setCutThroughRoutes(routing_table, !isRootc);
+    }
+}
+
+void CoreBroker::checkConnectionCacheFederate(const std::string& name)
+{
+    if (connectionCacheFile.empty()) {
+        return;
+    }
+    if (!connectionCacheLoaded) {
+        connectionCacheLoaded = true;
+        try {
+            cachedGraph.load(connectionCacheFile);
+            // this only confirms the expected federate count,  the federate names are verified
+            // as the federates register
+            useConnectionCache =
+                (cachedGraph.storedHash() == cachedGraph.configurationHash(minFederateCount));
+            LOG_CONNECTIONS(global_broker_id_local,
+                            getIdentifier(),
+                            useConnectionCache ?
+                                fmt::format("loaded {} cached connections from {}",
+                                            cachedGraph.connectionCount(),
+                                            connectionCacheFile) :
+                                fmt::format("the connection graph in {} is from a different "
+                                            "configuration",
+                                            connectionCacheFile));
+        }
+        catch (const std::invalid_argument&) {
+            // there is no usable graph from a previous launch so everything is matched by name
+            cachedGraph.clear();
+        }
+    }
+    currentGraph.addFederate(name);
+    if (useConnectionCache && !cachedGraph.hasFederate(name)) {
+        useConnectionCache = false;
+        LOG_CONNECTIONS(global_broker_id_local,
+                        getIdentifier(),
+                        fmt::format("federate {} is not in the cached connection graph", name));
+    }
+    // once all the expected federates have registered their names must match the cached ones
+    if (useConnectionCache &&
+        currentGraph.federateCount() == static_cast<std::size_t>(minFederateCount) &&
+        currentGraph.configurationHash(minFederateCount) != cachedGraph.storedHash()) {
+        useConnectionCache = false;
+        LOG_CONNECTIONS(global_broker_id_local,
+                        getIdentifier(),
+                        "the registered federates do not match the cached connection graph");
+    }
+}
+
+ConnectionGraph::InterfaceInfo
+    CoreBroker::graphInterfaceInfo(const BasicHandleInfo& handleInfo) const
+{
+    ConnectionGraph::InterfaceInfo info;
+    auto fed = _federates.find(handleInfo.getFederateId());
+    if (fed != _federates.end()) {
+        info.federate = fed->name;
+    }
+    info.kind = handleInfo.handleType;
+    info.type = handleInfo.type;
+    info.units = handleInfo.units;
+    return info;
+}
+
+void CoreBroker::recordInterface(const BasicHandleInfo& handleInfo)
+{
+    if (connectionCacheFile.empty()) {
+        return;
+    }
+    currentGraph.addInterface(handleInfo.key, graphInterfaceInfo(handleInfo));
+}
+
+bool CoreBroker::recordConnection(GlobalHandle pub,
+                                  GlobalHandle input,
+                                  bool declaredByInput,
+                                  std::uint16_t flags)
+{
+    // connections made while pre-resolving are recorded when they are requested
+    if (!isRootc || connectionCacheFile.empty() || connectionBatch != nullptr) {
+        return false;
+    }
+    const auto* pubInfo = handles.findHandle(pub);
+    const auto* inputInfo = handles.findHandle(input);
+    if (pubInfo == nullptr || inputInfo == nullptr) {
+        return false;
+    }
+    currentGraph.addConnection(pubInfo->key, inputInfo->key, declaredByInput, flags);
+    auto fnd = preResolvedConnections.find(std::make_pair(pub, input));
+    if (fnd == preResolvedConnections.end()) {
+        return false;
+    }
+    auto cachedFlags = fnd->second;
+    preResolvedConnections.erase(fnd);
+    if (cachedFlags == flags) {
+        return true;
+    }
+    // the request differs from the cached connection so remove it and connect normally
+    ActionMessage rem(CMD_REMOVE_SUBSCRIBER);
+    rem.setSource(input);
+    rem.setDestination(pub);
+    routeMessage(rem);
+    rem.setAction(CMD_REMOVE_PUBLICATION);
+    rem.swapSourceDest();
+    routeMessage(rem);
+    return false;
+}
+
+void CoreBroker::preResolveConnections(const BasicHandleInfo& handleInfo)
+{
+    if (!useConnectionCache || brokerState >= broker_state_t::operating ||
+        !cachedGraph.matches(handleInfo.key, graphInterfaceInfo(handleInfo))) {
+        return;
+    }
+    auto connectable = [this](const BasicHandleInfo& iface) {
+        auto fed = _federates.find(iface.getFederateId());
+        return (fed != _federates.end() && fed->state < connection_state::error);
+    };
+    if (!connectable(handleInfo)) {
+        return;
+    }
+    const bool isPublication = (handleInfo.handleType == InterfaceType::PUBLICATION);
+    std::map<route_id, ActionMessage> batch;
+    connectionBatch = &batch;
+    for (const auto* conn : cachedGraph.connectionsOf(handleInfo.handleType, handleInfo.key)) {
+        const auto& partnerName = isPublication ? conn->input : conn->publication;
+        const auto* partner = isPublication ? handles.getInput(partnerName) :
+                                              handles.getPublication(partnerName);
+        if (partner == nullptr || !connectable(*partner) ||
+            !cachedGraph.matches(partnerName, graphInterfaceInfo(*partner))) {
+            continue;
+        }
+        const auto& pub = isPublication ? handleInfo : *partner;
+        const auto& input = isPublication ? *partner : handleInfo;
+        // interfaces on the same branch are connected below the root so the request never
+        // reaches it to confirm the connection
+        if (getRoute(pub.getFederateId()) == getRoute(input.getFederateId())) {
+            continue;
+        }
+        auto key = std::make_pair(pub.handle, input.handle);
+        if (currentGraph.hasConnection(pub.key, input.key) ||
+            preResolvedConnections.find(key) != preResolvedConnections.end()) {
+            continue;
+        }
+        // make the connection as if the request had arrived
+        ActionMessage link(conn->declaredByInput ? CMD_ADD_NAMED_PUBLICATION : CMD_ADD_NAMED_INPUT);
+        link.name(conn->declaredByInput ? pub.key : input.key);
+        link.setSource(conn->declaredByInput ? input.handle : pub.handle);
+        link.flags = conn->flags;
+        checkForNamedInterface(link);
+        preResolvedConnections.emplace(key, conn->flags);
+    }
+    connectionBatch = nullptr;
+    for (auto& notices : batch) {
+        transmit(notices.first, std::move(notices.second));
+    }
+}
+
+void CoreBroker::routeConnectionMessage(ActionMessage& cmd)
+{
+    if (connectionBatch == nullptr) {
+        routeMessage(cmd);
+        return;
+    }
+    auto route = getRoute(cmd.dest_id);
+    auto& package = (*connectionBatch)[route];
+    if (package.action() != CMD_MULTI_MESSAGE) {
+        package = ActionMessage(CMD_MULTI_MESSAGE);
+        package.source_id = global_broker_id_local;
+    }
+    if (appendMessage(package, cmd) < 0) {
+        transmit(route, std::move(package));
+        package = ActionMessage(CMD_MULTI_MESSAGE);
+        package.source_id = global_broker_id_local;
+        appendMessage(package, cmd);
+    }
+}
+
+void CoreBroker::finalizeConnectionCache()
+{
+    if (connectionCacheFile.empty()) {
+        return;
+    }
+    // cached connections that no federate asked for are no longer part of the configuration
+    for (const auto& conn : preResolvedConnections) {
+        ActionMessage rem(CMD_REMOVE_SUBSCRIBER);
+        rem.setSource(conn.first.second);
+        rem.setDestination(conn.first.first);
+        routeMessage(rem);
+        rem.setAction(CMD_REMOVE_PUBLICATION);
+        rem.swapSourceDest();
+        routeMessage(rem);
+    }
+    if (!preResolvedConnections.empty()) {
+        LOG_CONNECTIONS(global_broker_id_local,
+                        getIdentifier(),
+                        fmt::format("removed {} cached connections that were not requested",
+                                    preResolvedConnections.size()));
+        preResolvedConnections.clear();
+    }
+    cachedGraph.clear();
+    useConnectionCache = false;
+    try {
+        currentGraph.save(connectionCacheFile, minFederateCount);
+    }
+    catch (const std::invalid_argument& ia) {
+        LOG_WARNING(global_broker_id_local, getIdentifier(), ia.what());
+    }
+}
+
+void CoreBroker::establishDirectRoute(const BasicBrokerInfo& sourceCore,
+                                      const BasicBrokerInfo& destCore)
+{
+    Json::Value routeInfo;
+    routeInfo["address"] = destCore.routeInfo;
+    routeInfo["federates"] = Json::arrayValue;
+    for (const auto& fed : _federates) {
+        if (fed.parent == destCore.global_id) {
+            routeInfo["federates"].append(fed.global_id.baseValue());
+        }
+    }
+    routeInfo["endpoints"] = Json::arrayValue;
+    for (const auto& handle : handles) {
+        if (handle.handleType == InterfaceType::ENDPOINT &&
+            getLocalCore(handle.getFederateId()) == &destCore) {
+            routeInfo["endpoints"].append(handle.key);
+        }
+    }
+    ActionMessage route(CMD_SEND_ROUTE);
+    route.source_id = global_broker_id_local;
+    route.dest_id = sourceCore.global_id;
+    route.setExtraData(destCore.global_id.baseValue());
+    route.payload = generateJsonString(routeInfo);
+    LOG_CONNECTIONS(global_broker_id_local,
+                    getIdentifier(),
+                    fmt::format("requesting direct route from {} to {}",
+                                sourceCore.name,
+                                destCore.name));
+    transmit(sourceCore.route, std::move(route));
+}
+
+void CoreBroker::closeDirectRoutes(GlobalBrokerId coreId)
+{
+    for (auto count = coreTrafficCounts.begin(); count != coreTrafficCounts.end();) {
+        GlobalBrokerId sourceCore(static_cast<std::int32_t>(count->first >> 32U));
+        GlobalBrokerId destCore(static_cast<std::int32_t>(count->first & 0xFFFFFFFFU));
+        if (sourceCore != coreId && destCore != coreId) {
+            ++count;
+            continue;
+        }
+        if (count->second < 0 && destCore == coreId) {
+            auto brk = _brokers.find(sourceCore);
+            if (brk != _brokers.end() && brk->state < connection_state::disconnected) {
+                ActionMessage close(CMD_CLOSE_ROUTE);
+                close.source_id = global_broker_id_local;
+                close.dest_id = sourceCore;
+                close.setExtraData(coreId.baseValue());
+                transmit(brk->route, std::move(close));
+            }
+        }
+        count = coreTrafficCounts.erase(count);
+    }
+}
+
+void CoreBroker::requestDirectRoute(GlobalFederateId requester, const std::string& target)
+{
+    const auto* sourceCore = getLocalCore(requester);
+    auto fed = _federates.find(target);
+    const auto* destCore = (fed != _federates.end()) ? getLocalCore(fed->global_id) : nullptr;
+    if (sourceCore == nullptr || destCore == nullptr) {
+        LOG_WARNING(global_broker_id_local,
+                    getIdentifier(),
+                    fmt::format("unable to create a direct route to {}, the federates are not "
+                                "connected through cores of this broker",
+                                target));
+        return;
+    }
+    if (sourceCore == destCore) {
+        return;
+    }
+    // a requested route carries traffic in both directions
+    for (const auto& corePair : {std::make_pair(sourceCore, destCore),
+                                 std::make_pair(destCore, sourceCore)}) {
+        auto& count = coreTrafficCounts[corePairKey(corePair.first->global_id,
+                                                    corePair.second->global_id)];
+        if (count >= 0) {
+            count = -1;
+            establishDirectRoute(*corePair.first, *corePair.second);
+        }
+    }
+}
+
 void CoreBroker::processCommandInstruction(ActionMessage& m)
 {
     if (m.dest_id == global_broker_id_local) {
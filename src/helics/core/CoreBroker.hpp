@@ -11,6 +11,8 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "BasicHandleInfo.hpp"
 #include "Broker.hpp"
 #include "BrokerBase.hpp"
+#include "ConnectionGraph.hpp"
+#include "DenseIdTable.hpp"
 #include "HandleManager.hpp"
 #include "TimeDependencies.hpp"
 #include "UnknownHandleManager.hpp"
@@ -111,8 +113,8 @@ class CoreBroker: public Broker, public BrokerBase {
         delayedDependencies;  //!< set of dependencies that need to be created on init
     std::unordered_map<GlobalFederateId, LocalFederateId>
         global_id_translation;  //!< map to translate global ids to local ones
-    std::unordered_map<GlobalFederateId, route_id>
-        routing_table;  //!< map for external routes  <global federate id, route id>
+    GlobalIdTable<route_id>
+        routing_table;  //!< table of external routes  <global federate id, route id>
     std::unordered_map<std::string, route_id>
         knownExternalEndpoints;  //!< external map for all known external endpoints with names and
                                  //!< route
@@ -122,6 +124,24 @@ class CoreBroker: public Broker, public BrokerBase {
     gmlc::concurrency::DelayedObjects<std::string> activeQueries;  //!< holder for active queries
     /// holder for the query map builder information
     std::vector<std::tuple<JsonMapBuilder, std::vector<ActionMessage>, bool>> mapBuilders;
+    /// change notices for the maps subscribed by the parent broker <index, <notice, sent>>
+    std::map<std::uint16_t, std::pair<ActionMessage, bool>> mapSubscriptions;
+    /// indicator that the maps are maintained from change notices instead of rebuilt per query
+    bool incrementalMaps{false};
+    /// indicator that the comms forward data messages to known routes without processing
+    bool cutThrough{false};
+    /// indicator that the comms have been given the routes for forwarding
+    bool cutThroughActive{false};
+    /// file the root broker saves the connection graph to and loads it from on a later launch
+    std::string connectionCacheFile;
+    ConnectionGraph cachedGraph;  //!< the connection graph loaded from the cache file
+    ConnectionGraph currentGraph;  //!< the connection graph of the running federation
+    bool connectionCacheLoaded{false};  //!< the cache file has been checked
+    bool useConnectionCache{false};  //!< the cached graph matches the federation configuration
+    /// connections made from the cached graph before being requested <<publication, input>, flags>
+    std::map<std::pair<GlobalHandle, GlobalHandle>, std::uint16_t> preResolvedConnections;
+    /// connection notices collected for each route while connecting from the cached graph
+    std::map<route_id, ActionMessage>* connectionBatch{nullptr};
 
     std::vector<ActionMessage> earlyMessages;  //!< list of messages that came before connection
     gmlc::concurrency::TriggerVariable disconnection;  //!< controller for the disconnection process
@@ -130,6 +150,16 @@ class CoreBroker: public Broker, public BrokerBase {
     std::atomic<uint16_t> nextAirLock{0};  //!< the index of the next airlock to use
     std::array<gmlc::containers::AirLock<std::any>, 3>
         dataAirlocks;  //!< airlocks for updating filter operators and other functions
+    int32_t directRouteThreshold{
+        0};  //!< the number of data messages between two cores that triggers a direct route
+    std::unordered_map<std::uint64_t, int32_t>
+        coreTrafficCounts;  //!< the number of data messages routed between pairs of local cores
+    int32_t autoSplitThreshold{0};  //!< the number of cores connected directly to the broker
+                                    //!< before new cores are redirected to sub-brokers
+    int32_t localCoreCount{0};  //!< the number of cores connected directly to the broker
+    int32_t subBrokerCoreCount{0};  //!< the number of cores redirected to the newest sub-broker
+    std::vector<std::shared_ptr<Broker>>
+        subBrokers;  //!< brokers generated to take on new cores once the fan-in limit is reached
   private:
     /** function that processes all the messages
     @param command -- the message to process
@@ -144,6 +174,47 @@ class CoreBroker: public Broker, public BrokerBase {
 
     /** process configure commands for the broker*/
     void processBrokerConfigureCommands(ActionMessage& cmd);
+    /** count a data message routed between two local cores and instruct the source core to open a
+    direct route if the traffic threshold is reached*/
+    void checkDirectRouteTraffic(const ActionMessage& command);
+    /** get the information for the local core a federate is connected through
+    @return nullptr if the federate is not connected through a core directly attached to this broker
+    */
+    const BasicBrokerInfo* getLocalCore(GlobalFederateId federateId) const;
+    /** instruct a core to open a direct route to another core for the federates and endpoints of
+    the destination core*/
+    void establishDirectRoute(const BasicBrokerInfo& sourceCore, const BasicBrokerInfo& destCore);
+    /** instruct the cores with a direct route to a disconnecting core to remove the route*/
+    void closeDirectRoutes(GlobalBrokerId coreId);
+    /** process a request from a federate for a direct route to the core of another federate*/
+    void requestDirectRoute(GlobalFederateId requester, const std::string& target);
+    /** give the comms the routes for forwarding data messages without processing them if the
+    broker has no need to inspect the data*/
+    void enableCutThrough();
+    /** update the forwarding routes of the comms after a change to the routing table*/
+    void refreshCutThroughRoutes();
+    /** redirect a registering core to a sub-broker, generating a new sub-broker if needed
+    @return true if the core was redirected*/
+    bool redirectToSubBroker(const ActionMessage& command);
+    /** add a federate to the connection graph and check it against the cached graph*/
+    void checkConnectionCacheFederate(const std::string& name);
+    /** get the description of an interface used in the connection graph*/
+    ConnectionGraph::InterfaceInfo graphInterfaceInfo(const BasicHandleInfo& handleInfo) const;
+    /** add an interface to the connection graph*/
+    void recordInterface(const BasicHandleInfo& handleInfo);
+    /** add a data connection to the connection graph
+    @return true if the connection was already made from the cached graph*/
+    bool recordConnection(GlobalHandle pub,
+                          GlobalHandle input,
+                          bool declaredByInput,
+                          std::uint16_t flags);
+    /** connect a newly registered publication or input to the registered interfaces it was
+    connected to in the cached graph*/
+    void preResolveConnections(const BasicHandleInfo& handleInfo);
+    /** route a connection notice or add it to the current batch of notices*/
+    void routeConnectionMessage(ActionMessage& cmd);
+    /** remove cached connections that were never requested and save the connection graph*/
+    void finalizeConnectionCache();
 
     gmlc::containers::SimpleQueue<ActionMessage>
         delayTransmitQueue;  //!< FIFO queue for transmissions to the root that need to be delayed
@@ -252,11 +323,19 @@ class CoreBroker: public Broker, public BrokerBase {
     @param rid the identification of the route
     */
     virtual void removeRoute(route_id rid) = 0;
+    /** generate and connect a broker of the same type as this one to act as a sub-broker
+    @param name the name of the new broker
+    @param configureString the configuration string for the new broker
+    @return a pointer to the new broker or nullptr if the broker type does not support generating
+    sub-brokers*/
+    virtual std::shared_ptr<Broker> generateSubBroker(const std::string& name,
+                                                      const std::string& configureString);
 
   public:
     /**default constructor
-    @param setAsRootBroker  set to true to indicate this object is a root broker*/
-    explicit CoreBroker(bool setAsRootBroker = false) noexcept;
+    @param setAsRootBroker  set to true to indicate this object is a root broker
+    @param disableQueue set to true to process the queued commands without a processing thread*/
+    explicit CoreBroker(bool setAsRootBroker = false, bool disableQueue = false) noexcept;
     /** constructor to set the name of the broker*/
     explicit CoreBroker(const std::string& broker_name);
     /** destructor*/
@@ -361,6 +440,19 @@ class CoreBroker: public Broker, public BrokerBase {
                               std::uint16_t index,
                               bool reset,
                               bool force_ordering);
+    /** request updated information from the children whose part of a map has changed
+    @return true if the map is waiting on responses*/
+    bool refreshMapBuilder(const std::string& request, std::uint16_t index, bool force_ordering);
+    /** check if a map is maintained from change notices sent by the children*/
+    bool isIncrementalMap(std::uint16_t index) const;
+    /** record a map query from the parent broker as a subscription for change notices*/
+    void addMapSubscription(const ActionMessage& query);
+    /** check if a command changes the information of this broker in any subscribed maps*/
+    void checkMapSubscriptions(const ActionMessage& command);
+    /** process a change notice from a child broker or core*/
+    void processMapUpdate(const ActionMessage& notice);
+    /** notify the parent broker that the information for a subscribed map has changed*/
+    void sendMapUpdate(std::uint16_t index);
 
     /** send an error code to all direct cores*/
     void sendErrorToImmediateBrokers(int error_code);
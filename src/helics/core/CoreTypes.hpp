@@ -54,6 +54,7 @@ enum class CoreType : int {
     HTTP = HELICS_CORE_TYPE_HTTP,  //!< core/broker using web traffic
     WEBSOCKET = HELICS_CORE_TYPE_WEBSOCKET,  //!< core/broker using web sockets
     INPROC = HELICS_CORE_TYPE_INPROC,  //!< core/broker using a stripped down in process core type
+    ROOT = HELICS_CORE_TYPE_ROOT,  //!< in process core acting as the root with no separate broker
     NULLCORE = HELICS_CORE_TYPE_NULL,  //!< explicit core type that doesn't exist
     UNRECOGNIZED = 22,  //!< unknown
     MULTI = 45  //!< use the multi-broker
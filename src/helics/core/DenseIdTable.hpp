@@ -0,0 +1,203 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "global_federate_id.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace helics {
+/** table of values indexed by an identifier that is assigned sequentially from a base value
+@details identifiers within a window above the base index a flat vector directly, any other
+identifiers are stored in a fallback map*/
+template<class ValueType>
+class DenseIndexTable {
+  public:
+    /** the default number of identifiers above the base stored in the flat vector*/
+    static constexpr int32_t defaultWindow{1 << 16};
+    /** default constructor stores identifiers starting from 0 in the flat vector*/
+    DenseIndexTable() = default;
+    /** construct with a base identifier
+    @param base the first identifier stored in the flat vector
+    @param window the maximum number of identifiers stored in the flat vector*/
+    explicit DenseIndexTable(int32_t base, int32_t window = defaultWindow):
+        baseId(base), windowSize(window)
+    {
+    }
+    /** find the value for an identifier
+    @return a pointer to the value or nullptr if the identifier is not in the table*/
+    ValueType* find(int32_t id)
+    {
+        auto index = denseIndex(id);
+        if (index >= 0) {
+            return (index < static_cast<int64_t>(dense.size()) && dense[index]) ? &(*dense[index]) :
+                                                                                  nullptr;
+        }
+        auto fnd = sparse.find(id);
+        return (fnd != sparse.end()) ? &(fnd->second) : nullptr;
+    }
+    /** find the value for an identifier
+    @return a pointer to the value or nullptr if the identifier is not in the table*/
+    const ValueType* find(int32_t id) const
+    {
+        auto index = denseIndex(id);
+        if (index >= 0) {
+            return (index < static_cast<int64_t>(dense.size()) && dense[index]) ? &(*dense[index]) :
+                                                                                  nullptr;
+        }
+        auto fnd = sparse.find(id);
+        return (fnd != sparse.end()) ? &(fnd->second) : nullptr;
+    }
+    /** add a value if the identifier is not already in the table
+    @return true if the value was added*/
+    bool emplace(int32_t id, ValueType value)
+    {
+        if (find(id) != nullptr) {
+            return false;
+        }
+        slot(id) = std::move(value);
+        return true;
+    }
+    /** get a reference to the value of an identifier,  adding a default value if needed*/
+    ValueType& operator[](int32_t id)
+    {
+        auto* val = find(id);
+        return (val != nullptr) ? *val : slot(id);
+    }
+    /** remove an identifier from the table
+    @return true if the identifier was in the table*/
+    bool erase(int32_t id)
+    {
+        auto index = denseIndex(id);
+        if (index >= 0) {
+            if (index < static_cast<int64_t>(dense.size()) && dense[index]) {
+                dense[index].reset();
+                --count;
+                return true;
+            }
+            return false;
+        }
+        if (sparse.erase(id) > 0) {
+            --count;
+            return true;
+        }
+        return false;
+    }
+    /** remove all the values*/
+    void clear()
+    {
+        dense.clear();
+        sparse.clear();
+        count = 0;
+    }
+    /** get the number of values in the table*/
+    std::size_t size() const { return count; }
+    /** check if the table is empty*/
+    bool empty() const { return (count == 0); }
+    /** call a function with each identifier and value in the table*/
+    template<class Callable>
+    void forEach(Callable&& func) const
+    {
+        for (std::size_t ii = 0; ii < dense.size(); ++ii) {
+            if (dense[ii]) {
+                func(static_cast<int32_t>(baseId + static_cast<int64_t>(ii)), *dense[ii]);
+            }
+        }
+        for (const auto& val : sparse) {
+            func(val.first, val.second);
+        }
+    }
+
+  private:
+    /** get the index in the flat vector of an identifier or -1 if it is outside the window*/
+    int64_t denseIndex(int32_t id) const
+    {
+        auto index = static_cast<int64_t>(id) - baseId;
+        return (index >= 0 && index < windowSize) ? index : -1;
+    }
+    /** get the storage for a new identifier*/
+    ValueType& slot(int32_t id)
+    {
+        ++count;
+        auto index = denseIndex(id);
+        if (index < 0) {
+            return sparse[id];
+        }
+        if (index >= static_cast<int64_t>(dense.size())) {
+            dense.resize(static_cast<std::size_t>(index) + 1);
+        }
+        dense[index].emplace();
+        return *dense[index];
+    }
+
+    std::vector<std::optional<ValueType>> dense;  //!< the values of identifiers in the window
+    std::unordered_map<int32_t, ValueType> sparse;  //!< the values of identifiers outside it
+    int64_t baseId{0};  //!< the identifier stored at the start of the flat vector
+    int64_t windowSize{defaultWindow};  //!< the maximum size of the flat vector
+    std::size_t count{0};  //!< the number of values in the table
+};
+
+/** table of values indexed by global federate and broker ids
+@details federate and broker ids each index a flat vector from their respective bases*/
+template<class ValueType>
+class GlobalIdTable {
+  public:
+    /** find the value for an id
+    @return a pointer to the value or nullptr if the id is not in the table*/
+    ValueType* find(GlobalFederateId id) { return table(id).find(id.baseValue()); }
+    /** find the value for an id
+    @return a pointer to the value or nullptr if the id is not in the table*/
+    const ValueType* find(GlobalFederateId id) const { return table(id).find(id.baseValue()); }
+    /** add a value if the id is not already in the table
+    @return true if the value was added*/
+    bool emplace(GlobalFederateId id, ValueType value)
+    {
+        return table(id).emplace(id.baseValue(), std::move(value));
+    }
+    /** get a reference to the value of an id,  adding a default value if needed*/
+    ValueType& operator[](GlobalFederateId id) { return table(id)[id.baseValue()]; }
+    /** remove an id from the table
+    @return true if the id was in the table*/
+    bool erase(GlobalFederateId id) { return table(id).erase(id.baseValue()); }
+    /** remove all the values*/
+    void clear()
+    {
+        federates.clear();
+        brokers.clear();
+    }
+    /** get the number of values in the table*/
+    std::size_t size() const { return federates.size() + brokers.size(); }
+    /** check if the table is empty*/
+    bool empty() const { return federates.empty() && brokers.empty(); }
+    /** call a function with each id and value in the table*/
+    template<class Callable>
+    void forEach(Callable&& func) const
+    {
+        auto call = [&func](int32_t id, const ValueType& val) { func(GlobalFederateId(id), val); };
+        federates.forEach(call);
+        brokers.forEach(call);
+    }
+
+  private:
+    DenseIndexTable<ValueType>& table(GlobalFederateId id)
+    {
+        return id.isFederate() ? federates : brokers;
+    }
+    const DenseIndexTable<ValueType>& table(GlobalFederateId id) const
+    {
+        return id.isFederate() ? federates : brokers;
+    }
+
+    DenseIndexTable<ValueType> federates{gGlobalFederateIdShift};  //!< values for federate ids
+    /// values for broker ids,  the fixed ids of the parent and root broker are in the fallback
+    DenseIndexTable<ValueType> brokers{gGlobalBrokerIdShift};
+};
+}  // namespace helics
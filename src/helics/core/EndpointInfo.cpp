@@ -118,6 +118,22 @@ void EndpointInfo::addMessage(std::unique_ptr<Message> message)
     std::stable_sort(handle->begin(), handle->end(), msgSorter);
 }
 
+bool EndpointInfo::removeMessage(std::string_view originalSource, int32_t messageID)
+{
+    auto handle = message_queue.lock();
+    auto res = std::find_if(handle->begin(), handle->end(), [&](const auto& msg) {
+        return (msg->messageID == messageID) && (msg->original_source == originalSource);
+    });
+    if (res == handle->end()) {
+        return false;
+    }
+    if (std::distance(handle->begin(), res) < mAvailableMessages.load()) {
+        --mAvailableMessages;
+    }
+    handle->erase(res);
+    return true;
+}
+
 void EndpointInfo::clearQueue()
 {
     mAvailableMessages.store(0);
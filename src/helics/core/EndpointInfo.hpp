@@ -13,6 +13,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <deque>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -65,6 +66,12 @@ class EndpointInfo {
     int32_t queueSizeUpTo(Time maxTime) const;
     /** add a message to the queue*/
     void addMessage(std::unique_ptr<Message> message);
+    /** remove a message from the queue that has not yet been retrieved
+    @param originalSource the name of the endpoint that originally sent the message
+    @param messageID the identifier assigned to the message by the sending core
+    @return true if a matching message was found and removed
+    */
+    bool removeMessage(std::string_view originalSource, int32_t messageID);
     /** update current data not including data at the specified time
     @param newTime the time to move the subscription to
     @return true if the value has changed
@@ -0,0 +1,37 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "CoreTypes.hpp"
+#include "helicsTime.hpp"
+
+#include <string_view>
+#include <utility>
+
+namespace helics {
+/** interface for the operations of a federate driven by the core through callbacks
+@details a federate with an operator does not need a thread of its own,  the core runs the
+operations on a shared pool of worker threads as the grants for the federate arrive.  The
+operations must not call the blocking mode and time request functions of the federate*/
+class FederateOperator {
+  public:
+    virtual ~FederateOperator() = default;
+    /** called when the federate has entered initializing mode,  and again if entry to executing
+    mode was granted with an iteration
+    @return the iteration request used for entering executing mode*/
+    virtual IterationRequest initializeOperations() = 0;
+    /** called when the federate is granted executing mode or a time
+    @param newTime the granted time and the result of the request
+    @return the next time to request and the iteration request,  requesting Time::maxVal() without
+    iteration finalizes the federate*/
+    virtual std::pair<Time, IterationRequest> operate(iteration_time newTime) = 0;
+    /** called once the federate has finished*/
+    virtual void finalize() = 0;
+    /** called if the federate encounters an error,  no other operations are called afterwards*/
+    virtual void error_handler(int errorCode, std::string_view errorString) = 0;
+};
+}  // namespace helics
@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "CommonCore.hpp"
 #include "CoreFederateInfo.hpp"
 #include "EndpointInfo.hpp"
+#include "FederateOperator.hpp"
 #include "InputInfo.hpp"
 #include "PublicationInfo.hpp"
 #include "TimeCoordinator.hpp"
@@ -186,6 +187,23 @@ bool FederateState::checkAndSetValue(InterfaceHandle pub_id, const char* data, u
     return res;
 }
 
+bool FederateState::generatePublicationDelta(InterfaceHandle pub_id,
+                                            const char* data,
+                                            uint64_t len,
+                                            std::size_t subscriberCount,
+                                            SmallBuffer& delta)
+{
+    if (!delta_publications.load()) {
+        return false;
+    }
+    std::lock_guard<FederateState> plock(*this);
+    auto* pub = interfaceInformation.getPublication(pub_id);
+    if (pub == nullptr || !pub->transmit_deltas) {
+        return false;
+    }
+    return pub->generateDelta(data, len, subscriberCount, delta);
+}
+
 void FederateState::generateConfig(Json::Value& base) const
 {
     base["only_transmit_on_change"] = only_transmit_on_change;
@@ -200,6 +218,9 @@ void FederateState::generateConfig(Json::Value& base) const
     if (rt_lead > timeZero) {
         base["rt_lead"] = static_cast<double>(rt_lead);
     }
+    if (rt_spin > timeZero) {
+        base["rt_spin"] = static_cast<double>(rt_spin);
+    }
 }
 
 uint64_t FederateState::getQueueSize(InterfaceHandle id) const
@@ -221,7 +242,11 @@ std::unique_ptr<Message> FederateState::receive(InterfaceHandle id)
 {
     auto* epI = interfaceInformation.getEndpoint(id);
     if (epI != nullptr) {
-        return epI->getMessage(time_granted);
+        auto msg = epI->getMessage(time_granted);
+        if (msg && isSpeculating()) {
+            speculativeDeliveries.emplace_back(time_granted, id, std::make_unique<Message>(*msg));
+        }
+        return msg;
     }
     return nullptr;
 }
@@ -246,6 +271,11 @@ std::unique_ptr<Message> FederateState::receiveAny(InterfaceHandle& id)
     if (earliest_time <= time_granted) {
         auto result = endpointI->getMessage(time_granted);
         id = (result) ? endpointI->id.handle : InterfaceHandle{};
+        if (result && isSpeculating()) {
+            speculativeDeliveries.emplace_back(time_granted,
+                                               id,
+                                               std::make_unique<Message>(*result));
+        }
 
         return result;
     }
@@ -280,10 +310,23 @@ void FederateState::routeMessage(const ActionMessage& msg)
     }
 }
 
+void FederateState::sendTimeUpdateNotice()
+{
+    if (parent_ != nullptr && time_update_notice.exchange(false)) {
+        ActionMessage notice(CMD_MAP_UPDATE);
+        notice.source_id = global_id.load();
+        notice.dest_id = parent_->getGlobalId();
+        parent_->addActionMessage(std::move(notice));
+    }
+}
+
 void FederateState::addAction(const ActionMessage& action)
 {
     if (action.action() != CMD_IGNORE) {
         queue.push(action);
+        if (callbackBased.load() && !callbackScheduled.exchange(true)) {
+            callbackScheduler();
+        }
     }
 }
 
@@ -291,6 +334,9 @@ void FederateState::addAction(ActionMessage&& action)
 {
     if (action.action() != CMD_IGNORE) {
         queue.push(std::move(action));
+        if (callbackBased.load() && !callbackScheduled.exchange(true)) {
+            callbackScheduler();
+        }
     }
 }
 
@@ -466,36 +512,16 @@ IterationResult FederateState::enterExecutingMode(IterationRequest iterate, bool
         }
 
         auto ret = processQueue();
-        if (ret == MessageProcessingResult::NEXT_STEP) {
-            time_granted = timeZero;
-            allowed_send_time = timeCoord->allowedSendTime();
-        } else if (ret == MessageProcessingResult::ITERATING) {
-            time_granted = initializationTime;
-            allowed_send_time = initializationTime;
-        }
-        switch (iterate) {
-            case IterationRequest::FORCE_ITERATION:
-                fillEventVectorNextIteration(time_granted);
-                break;
-            case IterationRequest::ITERATE_IF_NEEDED:
-                if (ret == MessageProcessingResult::NEXT_STEP) {
-                    fillEventVectorUpTo(time_granted);
-                } else {
-                    fillEventVectorNextIteration(time_granted);
-                }
-                break;
-            case IterationRequest::NO_ITERATIONS:
-                fillEventVectorUpTo(time_granted);
-                break;
-        }
-
+        updateExecGrant(ret, iterate);
         unlock();
+        sendTimeUpdateNotice();
 #ifndef HELICS_DISABLE_ASIO
         if ((realtime) && (ret == MessageProcessingResult::NEXT_STEP)) {
             if (!mTimer) {
                 mTimer = std::make_shared<MessageTimer>(
                     [this](ActionMessage&& mess) { return this->addAction(std::move(mess)); });
             }
+            mTimer->setSpinWindow(rt_spin.to_ns());
             start_clock_time = std::chrono::steady_clock::now();
         }
 #endif
@@ -524,6 +550,33 @@ IterationResult FederateState::enterExecutingMode(IterationRequest iterate, bool
     return ret;
 }
 
+void FederateState::updateExecGrant(MessageProcessingResult ret, IterationRequest iterate)
+{
+    if (ret == MessageProcessingResult::NEXT_STEP) {
+        time_granted = timeZero;
+        time_committed = timeZero;
+        allowed_send_time = timeCoord->allowedSendTime();
+    } else if (ret == MessageProcessingResult::ITERATING) {
+        time_granted = initializationTime;
+        allowed_send_time = initializationTime;
+    }
+    switch (iterate) {
+        case IterationRequest::FORCE_ITERATION:
+            fillEventVectorNextIteration(time_granted);
+            break;
+        case IterationRequest::ITERATE_IF_NEEDED:
+            if (ret == MessageProcessingResult::NEXT_STEP) {
+                fillEventVectorUpTo(time_granted);
+            } else {
+                fillEventVectorNextIteration(time_granted);
+            }
+            break;
+        case IterationRequest::NO_ITERATIONS:
+            fillEventVectorUpTo(time_granted);
+            break;
+    }
+}
+
 std::vector<GlobalHandle> FederateState::getSubscribers(InterfaceHandle handle)
 {
     std::lock_guard<FederateState> fedlock(*this);
@@ -561,6 +614,11 @@ iteration_time FederateState::requestTime(Time nextTime, IterationRequest iterat
             addAction(treq);
             LOG_TRACE(timeCoord->printTimeStatus());
         }
+        if (optimistic && state == HELICS_EXECUTING) {
+            auto retTime = optimisticTimeRequest(nextTime);
+            unlock();
+            return retTime;
+        }
 
 // timeCoord->timeRequest (nextTime, iterate, nextValueTime (), nextMessageTime ());
 #ifndef HELICS_DISABLE_ASIO
@@ -589,38 +647,8 @@ iteration_time FederateState::requestTime(Time nextTime, IterationRequest iterat
         }
 #endif
         auto ret = processQueue();
-        if (ret == MessageProcessingResult::HALTED) {
-            time_granted = Time::maxVal();
-            allowed_send_time = Time::maxVal();
-            iterating = false;
-        } else {
-            time_granted = timeCoord->getGrantedTime();
-            allowed_send_time = timeCoord->allowedSendTime();
-            iterating = (ret == MessageProcessingResult::ITERATING);
-        }
-
+        updateTimeGrant(ret, nextTime, iterate);
         iteration_time retTime = {time_granted, static_cast<IterationResult>(ret)};
-        // now fill the event vector so external systems know what has been updated
-        switch (iterate) {
-            case IterationRequest::FORCE_ITERATION:
-                fillEventVectorNextIteration(time_granted);
-                break;
-            case IterationRequest::ITERATE_IF_NEEDED:
-                if (time_granted < nextTime || wait_for_current_time) {
-                    fillEventVectorNextIteration(time_granted);
-                } else {
-                    fillEventVectorUpTo(time_granted);
-                }
-                break;
-            case IterationRequest::NO_ITERATIONS:
-                if (time_granted < nextTime || wait_for_current_time) {
-                    fillEventVectorInclusive(time_granted);
-                } else {
-                    fillEventVectorUpTo(time_granted);
-                }
-
-                break;
-        }
 #ifndef HELICS_DISABLE_ASIO
         if (realtime) {
             if (rt_lag < Time::maxVal()) {
@@ -631,7 +659,9 @@ iteration_time FederateState::requestTime(Time nextTime, IterationRequest iterat
                 auto timegap = current_clock_time - start_clock_time;
                 if (time_granted - Time(timegap) > rt_lead) {
                     auto current_lead = (time_granted - rt_lead).to_ns() - timegap;
-                    if (current_lead > std::chrono::milliseconds(5)) {
+                    if (rt_spin > timeZero) {
+                        sleepUntilPrecise(current_clock_time + current_lead, rt_spin.to_ns());
+                    } else if (current_lead > std::chrono::milliseconds(5)) {
                         std::this_thread::sleep_for(current_lead);
                     }
                 }
@@ -640,6 +670,7 @@ iteration_time FederateState::requestTime(Time nextTime, IterationRequest iterat
 #endif
 
         unlock();
+        sendTimeUpdateNotice();
         if (retTime.grantedTime > nextTime && nextTime > lastTime &&
             retTime.grantedTime < Time::maxVal()) {
             if (!ignore_time_mismatch_warnings) {
@@ -663,6 +694,41 @@ iteration_time FederateState::requestTime(Time nextTime, IterationRequest iterat
     return {time_granted, ret};
 }
 
+void FederateState::updateTimeGrant(MessageProcessingResult ret,
+                                    Time nextTime,
+                                    IterationRequest iterate)
+{
+    if (ret == MessageProcessingResult::HALTED) {
+        time_granted = Time::maxVal();
+        allowed_send_time = Time::maxVal();
+        iterating = false;
+    } else {
+        time_granted = timeCoord->getGrantedTime();
+        allowed_send_time = timeCoord->allowedSendTime();
+        iterating = (ret == MessageProcessingResult::ITERATING);
+    }
+    // now fill the event vector so external systems know what has been updated
+    switch (iterate) {
+        case IterationRequest::FORCE_ITERATION:
+            fillEventVectorNextIteration(time_granted);
+            break;
+        case IterationRequest::ITERATE_IF_NEEDED:
+            if (time_granted < nextTime || wait_for_current_time) {
+                fillEventVectorNextIteration(time_granted);
+            } else {
+                fillEventVectorUpTo(time_granted);
+            }
+            break;
+        case IterationRequest::NO_ITERATIONS:
+            if (time_granted < nextTime || wait_for_current_time) {
+                fillEventVectorInclusive(time_granted);
+            } else {
+                fillEventVectorUpTo(time_granted);
+            }
+            break;
+    }
+}
+
 void FederateState::fillEventVectorUpTo(Time currentTime)
 {
     events.clear();
@@ -733,6 +799,19 @@ IterationResult FederateState::genericUnspecifiedQueueProcess()
 
 void FederateState::finalize()
 {
+    if (callbackBased.load()) {
+        if (callbackThread.load() == std::this_thread::get_id()) {
+            // called from an operator callback,  waiting here would block the worker that has to
+            // process the disconnect so the operator requests are dropped and the federate
+            // finishes after the callback returns
+            callbackStage = CallbackStage::FINALIZING;
+            return;
+        }
+        // the disconnect is processed by the callback workers
+        std::unique_lock<std::mutex> completeLock(callbackLock);
+        callbackCompletion.wait(completeLock, [this]() { return callbackComplete; });
+        return;
+    }
     if ((state == FederateStates::HELICS_FINISHED) || (state == FederateStates::HELICS_ERROR)) {
         return;
     }
@@ -745,6 +824,173 @@ void FederateState::finalize()
     }
 }
 
+bool FederateState::setCallbackOperator(std::shared_ptr<FederateOperator> fedOp,
+                                        std::function<void()> scheduler)
+{
+    std::lock_guard<FederateState> fedlock(*this);
+    if (realtime || optimistic || callbackBased.load()) {
+        return false;
+    }
+    fedOperator = std::move(fedOp);
+    callbackScheduler = std::move(scheduler);
+    callbackBased.store(true);
+    if (!queue.empty() && !callbackScheduled.exchange(true)) {
+        callbackScheduler();
+    }
+    return true;
+}
+
+void FederateState::callbackProcessing() noexcept
+{
+    enum class CallbackAction { NONE, INITIALIZE, OPERATE, FINALIZE, HANDLE_ERROR };
+    do {
+        auto action = CallbackAction::NONE;
+        iteration_time grant{timeZero, IterationResult::NEXT_STEP};
+        if (callbackStage == CallbackStage::COMPLETE) {
+            // messages arriving after the operator finished are discarded
+            while (queue.try_pop()) {
+                ;
+            }
+        } else {
+            std::lock_guard<FederateState> fedlock(*this);
+            auto ret = processMessages(false);
+            switch (ret) {
+                case MessageProcessingResult::ERROR_RESULT:
+                    action = CallbackAction::HANDLE_ERROR;
+                    break;
+                case MessageProcessingResult::HALTED:
+                    time_granted = Time::maxVal();
+                    allowed_send_time = Time::maxVal();
+                    iterating = false;
+                    action = CallbackAction::FINALIZE;
+                    break;
+                case MessageProcessingResult::NEXT_STEP:
+                case MessageProcessingResult::ITERATING:
+                    switch (callbackStage) {
+                        case CallbackStage::STARTUP:
+                            if (state == HELICS_INITIALIZING) {
+                                time_granted = initialTime;
+                                allowed_send_time = initialTime;
+                                action = CallbackAction::INITIALIZE;
+                            }
+                            break;
+                        case CallbackStage::EXEC_REQUESTED:
+                            updateExecGrant(ret, callbackIterate);
+                            action = (ret == MessageProcessingResult::ITERATING) ?
+                                CallbackAction::INITIALIZE :
+                                CallbackAction::OPERATE;
+                            break;
+                        case CallbackStage::TIME_REQUESTED:
+                            updateTimeGrant(ret, callbackRequestTime, callbackIterate);
+                            action = CallbackAction::OPERATE;
+                            break;
+                        default:
+                            break;
+                    }
+                    grant = {time_granted, static_cast<IterationResult>(ret)};
+                    break;
+                default:
+                    break;
+            }
+        }
+        // the operator callbacks run without the federate lock so they can use the federate
+        callbackThread.store(std::this_thread::get_id());
+        try {
+            switch (action) {
+                case CallbackAction::INITIALIZE:
+                    sendCallbackExecRequest(fedOperator->initializeOperations());
+                    break;
+                case CallbackAction::OPERATE: {
+                    sendTimeUpdateNotice();
+                    auto request = fedOperator->operate(grant);
+                    sendCallbackTimeRequest(request.first, request.second);
+                } break;
+                case CallbackAction::FINALIZE:
+                    fedOperator->finalize();
+                    completeCallbacks();
+                    break;
+                case CallbackAction::HANDLE_ERROR:
+                    fedOperator->error_handler(errorCode, errorString);
+                    completeCallbacks();
+                    break;
+                case CallbackAction::NONE:
+                    break;
+            }
+        }
+        catch (const std::exception& e) {
+            if (action == CallbackAction::FINALIZE || action == CallbackAction::HANDLE_ERROR) {
+                completeCallbacks();
+            } else {
+                // generate a local error so the operator error handler gets called
+                ActionMessage err(CMD_LOCAL_ERROR);
+                err.source_id = global_id.load();
+                err.messageID = defs::Errors::EXECUTION_FAILURE;
+                err.payload = e.what();
+                if (parent_ != nullptr) {
+                    parent_->addActionMessage(err);
+                }
+                queue.push(std::move(err));
+            }
+        }
+        callbackThread.store(std::thread::id{});
+        callbackScheduled.store(false);
+        // a message can arrive after the queue was emptied but before the flag was cleared
+    } while (!queue.empty() && !callbackScheduled.exchange(true));
+}
+
+void FederateState::sendCallbackExecRequest(IterationRequest iterate)
+{
+    if (callbackStage == CallbackStage::FINALIZING) {
+        // the operator finalized the federate in the callback
+        return;
+    }
+    callbackStage = CallbackStage::EXEC_REQUESTED;
+    callbackIterate = iterate;
+    // do an exec check to process previously received messages as the core does for other
+    // federates
+    queue.push(ActionMessage(CMD_EXEC_CHECK));
+    ActionMessage exec(CMD_EXEC_REQUEST);
+    exec.source_id = global_id.load();
+    exec.dest_id = exec.source_id;
+    setIterationFlags(exec, iterate);
+    setActionFlag(exec, indicator_flag);
+    parent_->addActionMessage(exec);
+}
+
+void FederateState::sendCallbackTimeRequest(Time nextTime, IterationRequest iterate)
+{
+    if (callbackStage == CallbackStage::FINALIZING) {
+        // the operator finalized the federate in the callback
+        return;
+    }
+    if (nextTime == Time::maxVal() && iterate == IterationRequest::NO_ITERATIONS) {
+        callbackStage = CallbackStage::FINALIZING;
+        ActionMessage bye(CMD_DISCONNECT);
+        bye.source_id = global_id.load();
+        bye.dest_id = bye.source_id;
+        parent_->addActionMessage(bye);
+        return;
+    }
+    callbackStage = CallbackStage::TIME_REQUESTED;
+    callbackRequestTime = nextTime;
+    callbackIterate = iterate;
+    ActionMessage treq(CMD_TIME_REQUEST);
+    treq.source_id = global_id.load();
+    treq.dest_id = treq.source_id;
+    treq.actionTime = nextTime;
+    setIterationFlags(treq, iterate);
+    setActionFlag(treq, indicator_flag);
+    parent_->addActionMessage(treq);
+}
+
+void FederateState::completeCallbacks()
+{
+    callbackStage = CallbackStage::COMPLETE;
+    std::lock_guard<std::mutex> completeLock(callbackLock);
+    callbackComplete = true;
+    callbackCompletion.notify_all();
+}
+
 const std::vector<InterfaceHandle> emptyHandles;
 
 const std::vector<InterfaceHandle>& FederateState::getEvents() const
@@ -818,6 +1064,11 @@ bool FederateState::messageShouldBeDelayed(const ActionMessage& cmd) const
 }
 
 MessageProcessingResult FederateState::processQueue() noexcept
+{
+    return processMessages(true);
+}
+
+MessageProcessingResult FederateState::processMessages(bool block) noexcept
 {
     if (state == HELICS_FINISHED) {
         return MessageProcessingResult::HALTED;
@@ -828,7 +1079,16 @@ MessageProcessingResult FederateState::processQueue() noexcept
     auto ret_code = processDelayQueue();
 
     while (!(returnableResult(ret_code))) {
-        auto cmd = queue.pop();
+        ActionMessage cmd;
+        if (block) {
+            cmd = queue.pop();
+        } else {
+            auto next = queue.try_pop();
+            if (!next) {
+                break;
+            }
+            cmd = std::move(*next);
+        }
         if (messageShouldBeDelayed(cmd)) {
             delayQueues[cmd.source_id].push_back(cmd);
             continue;
@@ -843,22 +1103,130 @@ MessageProcessingResult FederateState::processQueue() noexcept
         }
     }
     if (ret_code == MessageProcessingResult::ERROR_RESULT && state == HELICS_ERROR) {
-        if (!initError && !error_cmd) {
-            if (parent_ != nullptr) {
-                ActionMessage gError(CMD_LOCAL_ERROR);
-                if (terminate_on_error) {
-                    gError.setAction(CMD_GLOBAL_ERROR);
-                } else {
-                    timeCoord->localError();
-                }
-                gError.source_id = global_id.load();
-                gError.dest_id = parent_broker_id;
-                gError.messageID = errorCode;
-                gError.payload = errorString;
+        sendErrorNotification(initError, error_cmd);
+    }
+    if (initError) {
+        ret_code = MessageProcessingResult::ERROR_RESULT;
+    }
+    return ret_code;
+}
 
-                parent_->addActionMessage(std::move(gError));
+void FederateState::sendErrorNotification(bool initError, bool errorCommand)
+{
+    if (initError || errorCommand || parent_ == nullptr) {
+        return;
+    }
+    ActionMessage gError(CMD_LOCAL_ERROR);
+    if (terminate_on_error) {
+        gError.setAction(CMD_GLOBAL_ERROR);
+    } else {
+        timeCoord->localError();
+    }
+    gError.source_id = global_id.load();
+    gError.dest_id = parent_broker_id;
+    gError.messageID = errorCode;
+    gError.payload = errorString;
+
+    parent_->addActionMessage(std::move(gError));
+}
+
+iteration_time FederateState::optimisticTimeRequest(Time nextTime)
+{
+    if (nextTime <= time_granted) {
+        nextTime = timeCoord->getSpeculativeGrantTime(nextTime, time_granted);
+    }
+    optimistic_request = nextTime;
+    auto inputDelay = timeCoord->getTimeProperty(defs::Properties::INPUT_DELAY);
+    bool block{false};
+    while (true) {
+        auto ret = processOptimisticQueue(block);
+        if (ret == MessageProcessingResult::HALTED) {
+            time_granted = Time::maxVal();
+            allowed_send_time = Time::maxVal();
+            return {time_granted, IterationResult::HALTED};
+        }
+        if (ret == MessageProcessingResult::ERROR_RESULT) {
+            return {time_granted, IterationResult::ERROR_RESULT};
+        }
+        if (rollback_time <= time_granted) {
+            return rollback();
+        }
+        auto grantTime = nextTime;
+        auto eventTime = std::min(nextMessageTime(), nextValueTime());
+        if (eventTime > time_granted && eventTime < nextTime) {
+            grantTime = std::min(
+                nextTime, timeCoord->getSpeculativeGrantTime(eventTime + inputDelay, time_granted));
+        }
+        if (time_committed >= grantTime) {
+            return optimisticGrant(grantTime, nextTime);
+        }
+        // the coordinator committed past the federate so the federate must catch up to it
+        if (time_committed > time_granted) {
+            return optimisticGrant(time_committed, nextTime);
+        }
+        // the next event is granted speculatively, the requested time only once it is committed
+        if (grantTime < nextTime) {
+            LOG_TIMING(fmt::format("Speculatively Granting Time={}", grantTime));
+            return optimisticGrant(grantTime, nextTime);
+        }
+        block = true;
+    }
+}
+
+iteration_time FederateState::optimisticGrant(Time grantTime, Time nextTime)
+{
+    time_granted = grantTime;
+    allowed_send_time = grantTime + timeCoord->getTimeProperty(defs::Properties::OUTPUT_DELAY);
+    if (time_granted < nextTime) {
+        fillEventVectorInclusive(time_granted);
+    } else {
+        fillEventVectorUpTo(time_granted);
+    }
+    return {time_granted, IterationResult::NEXT_STEP};
+}
+
+MessageProcessingResult FederateState::processOptimisticQueue(bool block)
+{
+    if (state == HELICS_FINISHED) {
+        return MessageProcessingResult::HALTED;
+    }
+    auto initError = (state == HELICS_ERROR);
+    bool error_cmd{false};
+    auto ret_code = processDelayQueue();
+    if (ret_code == MessageProcessingResult::NEXT_STEP) {
+        commitOptimisticTime();
+        ret_code = MessageProcessingResult::CONTINUE_PROCESSING;
+    }
+    while (!returnableResult(ret_code)) {
+        ActionMessage cmd;
+        if (block) {
+            cmd = queue.pop();
+            block = false;
+        } else {
+            auto next = queue.try_pop();
+            if (!next) {
+                break;
             }
+            cmd = std::move(*next);
+        }
+        if (messageShouldBeDelayed(cmd)) {
+            delayQueues[cmd.source_id].push_back(cmd);
+            continue;
+        }
+        ret_code = processActionMessage(cmd);
+        if (ret_code == MessageProcessingResult::DELAY_MESSAGE) {
+            delayQueues[static_cast<GlobalFederateId>(cmd.source_id)].push_back(cmd);
+        }
+        if (ret_code == MessageProcessingResult::ERROR_RESULT && cmd.action() == CMD_GLOBAL_ERROR) {
+            error_cmd = true;
         }
+        if (ret_code == MessageProcessingResult::NEXT_STEP) {
+            commitOptimisticTime();
+            ret_code = MessageProcessingResult::CONTINUE_PROCESSING;
+        }
+    }
+    if (ret_code == MessageProcessingResult::ERROR_RESULT && state == HELICS_ERROR) {
+        sendErrorNotification(initError, error_cmd);
     }
     if (initError) {
         ret_code = MessageProcessingResult::ERROR_RESULT;
@@ -866,6 +1234,159 @@ MessageProcessingResult FederateState::processQueue() noexcept
     return ret_code;
 }
 
+void FederateState::commitOptimisticTime()
+{
+    time_committed = timeCoord->getGrantedTime();
+    LOG_TIMING(fmt::format("Committed Time={}", time_committed));
+    // nothing at or before the committed time can be rolled back
+    auto sendEnd = std::partition(speculativeSends.begin(),
+                                  speculativeSends.end(),
+                                  [this](const auto& send) { return send.first > time_committed; });
+    speculativeSends.erase(sendEnd, speculativeSends.end());
+    auto deliveryEnd = std::partition(speculativeDeliveries.begin(),
+                                      speculativeDeliveries.end(),
+                                      [this](const auto& delivery) {
+                                          return std::get<0>(delivery) > time_committed;
+                                      });
+    speculativeDeliveries.erase(deliveryEnd, speculativeDeliveries.end());
+    clearExpiredAntiMessages();
+    // keep the time coordinator working toward the requested time, unless it has committed past
+    // the federate in which case the federate must be granted the committed time first
+    if (time_committed <= time_granted && time_committed < optimistic_request) {
+        ActionMessage treq(CMD_TIME_REQUEST);
+        treq.source_id = global_id.load();
+        treq.dest_id = global_id.load();
+        treq.actionTime = optimistic_request;
+        setActionFlag(treq, indicator_flag);
+        addAction(std::move(treq));
+    }
+}
+
+iteration_time FederateState::rollback()
+{
+    auto rollbackTime = rollback_time;
+    rollback_time = Time::maxVal();
+    // messages consumed in the rolled back steps that are earlier than the rollback time move the
+    // rollback back to them, so everything returned to the endpoints is after the new grant
+    bool adjusted{true};
+    while (adjusted) {
+        adjusted = false;
+        for (const auto& delivery : speculativeDeliveries) {
+            const auto& msg = std::get<2>(delivery);
+            if (std::get<0>(delivery) >= rollbackTime && msg && msg->time < rollbackTime &&
+                msg->time > time_committed) {
+                rollbackTime = msg->time;
+                adjusted = true;
+            }
+        }
+    }
+    LOG_TIMING(fmt::format("Rolling back from {} to {}", time_granted, rollbackTime));
+    // retract any messages sent during the rolled back steps
+    for (auto& send : speculativeSends) {
+        if (send.first >= rollbackTime && parent_ != nullptr) {
+            parent_->addActionMessage(std::move(send.second));
+        }
+    }
+    speculativeSends.erase(std::remove_if(speculativeSends.begin(),
+                                          speculativeSends.end(),
+                                          [rollbackTime](const auto& send) {
+                                              return send.first >= rollbackTime;
+                                          }),
+                           speculativeSends.end());
+    // return the messages consumed in the rolled back steps to the endpoints
+    Time redeliveryTime = Time::maxVal();
+    for (auto& delivery : speculativeDeliveries) {
+        if (std::get<0>(delivery) < rollbackTime) {
+            continue;
+        }
+        auto& msg = std::get<2>(delivery);
+        auto* epi = interfaceInformation.getEndpoint(std::get<1>(delivery));
+        if (epi != nullptr && msg) {
+            redeliveryTime = std::min(redeliveryTime, msg->time);
+            epi->addMessage(std::move(msg));
+        }
+    }
+    speculativeDeliveries.erase(std::remove_if(speculativeDeliveries.begin(),
+                                               speculativeDeliveries.end(),
+                                               [rollbackTime](const auto& delivery) {
+                                                   return std::get<0>(delivery) >= rollbackTime;
+                                               }),
+                                speculativeDeliveries.end());
+    if (redeliveryTime < Time::maxVal()) {
+        timeCoord->updateMessageTime(redeliveryTime, !timeGranted_mode);
+    }
+    ++rollbackCount;
+    time_granted = rollbackTime;
+    allowed_send_time = rollbackTime + timeCoord->getTimeProperty(defs::Properties::OUTPUT_DELAY);
+    fillEventVectorInclusive(time_granted);
+    return {time_granted, IterationResult::NEXT_STEP};
+}
+
+void FederateState::recordSpeculativeSend(const ActionMessage& message)
+{
+    ActionMessage anti(message);
+    anti.setAction(CMD_ANTI_MESSAGE);
+    anti.payload.clear();
+    speculativeSends.emplace_back(time_granted, std::move(anti));
+}
+
+void FederateState::recordSpeculativeSend(
+    const ActionMessage& message,
+    const std::vector<std::pair<GlobalHandle, std::string_view>>& targets)
+{
+    for (const auto& target : targets) {
+        ActionMessage anti(message);
+        anti.setAction(CMD_ANTI_MESSAGE);
+        anti.payload.clear();
+        anti.setDestination(target.first);
+        anti.setString(targetStringLoc, target.second);
+        speculativeSends.emplace_back(time_granted, std::move(anti));
+    }
+}
+
+void FederateState::processAntiMessage(const ActionMessage& cmd)
+{
+    const auto& source = cmd.getString(origSourceStringLoc);
+    auto* epi = interfaceInformation.getEndpoint(cmd.dest_handle);
+    if (epi != nullptr && epi->removeMessage(source, cmd.messageID)) {
+        return;
+    }
+    auto delivered = std::find_if(speculativeDeliveries.begin(),
+                                  speculativeDeliveries.end(),
+                                  [&source, &cmd](const auto& delivery) {
+                                      const auto& msg = std::get<2>(delivery);
+                                      return msg && msg->messageID == cmd.messageID &&
+                                          msg->original_source == source;
+                                  });
+    if (delivered != speculativeDeliveries.end()) {
+        rollback_time = std::min(rollback_time, std::get<0>(*delivered));
+        speculativeDeliveries.erase(delivered);
+        return;
+    }
+    if (!optimistic && cmd.actionTime <= time_granted) {
+        LOG_WARNING(fmt::format("message {} retracted after it was received",
+                                prettyPrintString(cmd)));
+        return;
+    }
+    pendingAntiMessages.emplace_back(cmd.actionTime, source, cmd.messageID);
+}
+
+void FederateState::clearExpiredAntiMessages()
+{
+    if (pendingAntiMessages.empty()) {
+        return;
+    }
+    // every message earlier than the committed time has arrived, so an anti-message still waiting
+    // for one was sent to an endpoint the message never reached
+    auto committed = committedTime();
+    pendingAntiMessages.erase(std::remove_if(pendingAntiMessages.begin(),
+                                             pendingAntiMessages.end(),
+                                             [committed](const auto& anti) {
+                                                 return std::get<0>(anti) < committed;
+                                             }),
+                              pendingAntiMessages.end());
+}
+
 MessageProcessingResult FederateState::processActionMessage(ActionMessage& cmd)
 {
     LOG_TRACE(fmt::format("processing command {}", prettyPrintString(cmd)));
@@ -880,7 +1401,13 @@ MessageProcessingResult FederateState::processActionMessage(ActionMessage& cmd)
                     IterationRequest::FORCE_ITERATION :
                     IterationRequest::ITERATE_IF_NEEDED;
             }
-            timeCoord->timeRequest(cmd.actionTime, iterate, nextValueTime(), nextMessageTime());
+            auto requestedTime = cmd.actionTime;
+            if (optimistic) {
+                // optimistic federates do not iterate and request through to the latest request
+                iterate = IterationRequest::NO_ITERATIONS;
+                requestedTime = std::max(requestedTime, optimistic_request);
+            }
+            timeCoord->timeRequest(requestedTime, iterate, nextValueTime(), nextMessageTime());
             timeGranted_mode = false;
             auto ret = processDelayQueue();
             if (returnableResult(ret)) {
@@ -941,9 +1468,10 @@ MessageProcessingResult FederateState::processActionMessage(ActionMessage& cmd)
             addFederateToDelay(GlobalFederateId(cmd.source_id));
             return MessageProcessingResult::DELAY_MESSAGE;
         default:
-            if (timeGranted_mode) {
+            if (timeGranted_mode && !(optimistic && state == HELICS_EXECUTING)) {
                 time_granted = timeCoord->getGrantedTime();
                 allowed_send_time = timeCoord->allowedSendTime();
+                clearExpiredAntiMessages();
                 if (cmd.action() == CMD_FORCE_TIME_GRANT) {
                     if (!ignore_time_mismatch_warnings) {
                         LOG_WARNING(fmt::format("forced Granted Time={}", time_granted));
@@ -1006,8 +1534,11 @@ MessageProcessingResult FederateState::processActionMessage(ActionMessage& cmd)
                 if (!timeGranted_mode) {
                     auto ret = timeCoord->checkTimeGrant();
                     if (returnableResult(ret)) {
-                        time_granted = timeCoord->getGrantedTime();
-                        allowed_send_time = timeCoord->allowedSendTime();
+                        if (!optimistic) {
+                            time_granted = timeCoord->getGrantedTime();
+                            allowed_send_time = timeCoord->allowedSendTime();
+                            clearExpiredAntiMessages();
+                        }
                         timeGranted_mode = true;
                         return ret;
                     }
@@ -1028,7 +1559,24 @@ MessageProcessingResult FederateState::processActionMessage(ActionMessage& cmd)
                     timeCoord->updateMessageTime(cmd.actionTime, !timeGranted_mode);
                 }
                 LOG_DATA(fmt::format("receive_message {}", prettyPrintString(cmd)));
-                if (cmd.actionTime < time_granted) {
+                if (!pendingAntiMessages.empty()) {
+                    const auto& source = cmd.getString(origSourceStringLoc);
+                    auto anti = std::find_if(pendingAntiMessages.begin(),
+                                             pendingAntiMessages.end(),
+                                             [&source, &cmd](const auto& pending) {
+                                                 return std::get<2>(pending) == cmd.messageID &&
+                                                     std::get<1>(pending) == source;
+                                             });
+                    if (anti != pendingAntiMessages.end()) {
+                        pendingAntiMessages.erase(anti);
+                        break;
+                    }
+                }
+                if (optimistic && cmd.actionTime > time_committed &&
+                    cmd.actionTime < time_granted) {
+                    // a straggler message requires a rollback
+                    rollback_time = std::min(rollback_time, cmd.actionTime);
+                } else if (cmd.actionTime < time_granted) {
                     LOG_WARNING(
                         fmt::format("received message {} at time({}) earlier than granted time({})",
                                     prettyPrintString(cmd),
@@ -1038,6 +1586,10 @@ MessageProcessingResult FederateState::processActionMessage(ActionMessage& cmd)
                 epi->addMessage(createMessageFromCommand(std::move(cmd)));
             }
         } break;
+        case CMD_ANTI_MESSAGE:
+            LOG_DATA(fmt::format("receive anti_message {}", prettyPrintString(cmd)));
+            processAntiMessage(cmd);
+            break;
         case CMD_PUB: {
             auto* subI = interfaceInformation.getInput(InterfaceHandle(cmd.dest_handle));
             if (subI == nullptr) {
@@ -1045,11 +1597,23 @@ MessageProcessingResult FederateState::processActionMessage(ActionMessage& cmd)
             }
             for (auto& src : subI->input_sources) {
                 if ((cmd.source_id == src.fed_id) && (cmd.source_handle == src.handle)) {
-                    subI->addData(src,
-                                  cmd.actionTime,
-                                  cmd.counter,
-                                  std::make_shared<const SmallBuffer>(std::move(cmd.payload)));
-                    if (!subI->not_interruptible) {
+                    if (checkActionFlag(cmd, delta_data_flag)) {
+                        if (!subI->addDeltaData(src, cmd.actionTime, cmd.counter, cmd.payload)) {
+                            LOG_WARNING(fmt::format("unable to apply value delta from {}",
+                                                    subI->getSourceName(src)));
+                            break;
+                        }
+                    } else {
+                        subI->addData(src,
+                                      cmd.actionTime,
+                                      cmd.counter,
+                                      std::make_shared<const SmallBuffer>(std::move(cmd.payload)));
+                    }
+                    // with convergence detection a value for the current time that is not a
+                    // change does not make an iterative time request iterate again
+                    const bool converged = detect_convergence && cmd.actionTime <= time_granted &&
+                        !subI->lastValueChanged();
+                    if (!subI->not_interruptible && !converged) {
                         timeCoord->updateValueTime(cmd.actionTime, !timeGranted_mode);
                         LOG_TRACE(timeCoord->printTimeStatus());
                     }
@@ -1243,6 +1807,10 @@ void FederateState::setInterfaceProperty(const ActionMessage& cmd)
                                                             checkActionFlag(cmd, indicator_flag) ?
                                                                 cmd.getExtraDestData() :
                                                                 0);
+            if (used && cmd.messageID == defs::Options::TRANSMIT_DELTAS &&
+                checkActionFlag(cmd, indicator_flag)) {
+                delta_publications.store(true);
+            }
             if (!used) {
                 auto* pub = interfaceInformation.getPublication(cmd.dest_handle);
                 if (pub != nullptr) {
@@ -1291,6 +1859,9 @@ void FederateState::setProperty(int timeProperty, Time propertyVal)
             rt_lag = propertyVal;
             rt_lead = propertyVal;
             break;
+        case defs::Properties::RT_SPIN:
+            rt_spin = propertyVal;
+            break;
         default:
             timeCoord->setProperty(timeProperty, propertyVal);
             break;
@@ -1316,6 +1887,9 @@ void FederateState::setProperty(int intProperty, int propertyVal)
             rt_lag = helics::Time(static_cast<double>(propertyVal));
             rt_lead = rt_lag;
             break;
+        case defs::Properties::RT_SPIN:
+            rt_spin = helics::Time(static_cast<double>(propertyVal));
+            break;
         default:
             timeCoord->setProperty(intProperty, propertyVal);
     }
@@ -1355,6 +1929,12 @@ void FederateState::setOptionFlag(int optionFlag, bool value)
                 realtime = false;
             }
 
+            break;
+        case defs::Flags::ROLLBACK:
+            // the speculative state can't be unwound once the federate is executing
+            if (state < HELICS_EXECUTING) {
+                optimistic = value;
+            }
             break;
         case defs::Flags::SOURCE_ONLY:
             if (state == HELICS_CREATED) {
@@ -1375,6 +1955,9 @@ void FederateState::setOptionFlag(int optionFlag, bool value)
         case defs::Flags::IGNORE_TIME_MISMATCH_WARNINGS:
             ignore_time_mismatch_warnings = value;
             break;
+        case defs::Flags::DETECT_CONVERGENCE:
+            detect_convergence = value;
+            break;
         case defs::Flags::WAIT_FOR_CURRENT_TIME_UPDATE:
             // this flag is needed in both locations
             wait_for_current_time = value;
@@ -1411,6 +1994,8 @@ Time FederateState::getTimeProperty(int timeProperty) const
             return rt_lag;
         case defs::Properties::RT_LEAD:
             return rt_lead;
+        case defs::Properties::RT_SPIN:
+            return rt_spin;
         default:
             return timeCoord->getTimeProperty(timeProperty);
     }
@@ -1428,6 +2013,10 @@ bool FederateState::getOptionFlag(int optionFlag) const
             return interfaceInformation.getChangeUpdateFlag();
         case defs::Flags::REALTIME:
             return realtime;
+        case defs::Flags::ROLLBACK:
+            return optimistic;
+        case defs::Flags::DETECT_CONVERGENCE:
+            return detect_convergence;
         case defs::Flags::OBSERVER:
             return observer;
         case defs::Flags::SOURCE_ONLY:
@@ -1730,6 +2319,10 @@ std::string FederateState::processQueryActual(std::string_view query) const
         base["input"] = inputCount();
         base["endpoints"] = endpointCount();
         base["granted_time"] = static_cast<double>(grantedTime());
+        if (optimistic) {
+            base["committed_time"] = static_cast<double>(time_committed);
+            base["rollbacks"] = rollbackCount;
+        }
         return generateJsonString(base);
     }
     if (query == "global_state") {
@@ -1781,6 +2374,10 @@ std::string FederateState::processQueryActual(std::string_view query) const
         base["parent"] = parent_->getGlobalId().baseValue();
         base["granted_time"] = static_cast<double>(timeCoord->getGrantedTime());
         base["send_time"] = static_cast<double>(timeCoord->allowedSendTime());
+        if (optimistic) {
+            base["speculative_time"] = static_cast<double>(time_granted);
+            base["rollbacks"] = rollbackCount;
+        }
         return generateJsonString(base);
     }
     if (query == "dependency_graph") {
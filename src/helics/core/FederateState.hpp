@@ -17,11 +17,15 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <deque>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -32,6 +36,7 @@ class EndpointInfo;
 class FilterInfo;
 class CommonCore;
 class CoreFederateInfo;
+class FederateOperator;
 
 class TimeCoordinator;
 class MessageTimer;
@@ -64,6 +69,9 @@ class FederateState {
     bool only_transmit_on_change{false};  //!< flag indicating that values should only be
                                           //!< transmitted if different than previous values
     bool realtime{false};  //!< flag indicating that the federate runs in real time
+    bool optimistic{false};  //!< flag indicating that the federate may advance speculatively
+    bool detect_convergence{
+        false};  //!< flag indicating that unchanged values should not trigger iterations
     bool observer{false};  //!< flag indicating the federate is an observer only
     bool source_only{false};  //!< flag indicating the federate is a source_only
     bool ignore_time_mismatch_warnings{
@@ -77,6 +85,10 @@ class FederateState {
 
   public:
     std::atomic<bool> init_transmitted{false};  //!< the initialization request has been transmitted
+    std::atomic<bool> delta_publications{
+        false};  //!< flag indicating that at least one publication may transmit deltas
+    /// flag indicating the core has requested a notice the next time the granted time changes
+    std::atomic<bool> time_update_notice{false};
   private:
     bool wait_for_current_time{
         false};  //!< flag indicating that the federate should delay for the current time
@@ -87,6 +99,7 @@ class FederateState {
         start_clock_time;  //!< time the initialization mode started for real time capture
     Time rt_lag{timeZero};  //!< max lag for the rt control
     Time rt_lead{timeZero};  //!< min lag for the realtime control
+    Time rt_spin{timeZero};  //!< period before a realtime deadline to spin instead of sleep
     int32_t realTimeTimerIndex{-1};  //!< the timer index for the real time timer;
   public:
     std::atomic<bool> init_requested{
@@ -119,7 +132,39 @@ class FederateState {
     std::vector<GlobalFederateId> delayedFederates;  //!< list of federates to delay messages from
     Time time_granted{startupTime};  //!< the most recent granted time;
     Time allowed_send_time{startupTime};  //!< the next time a message can be sent;
+    Time time_committed{startupTime};  //!< the time granted by the time coordinator for an
+                                       //!< optimistic federate, nothing prior can be rolled back
+    Time optimistic_request{startupTime};  //!< the last time requested by an optimistic federate
+    Time rollback_time{Time::maxVal()};  //!< the earliest time a rollback is required to
+    int32_t rollbackCount{0};  //!< the number of rollbacks executed by an optimistic federate
+    /// anti-messages for messages sent during speculative steps along with the step time
+    std::vector<std::pair<Time, ActionMessage>> speculativeSends;
+    /// copies of messages consumed during speculative steps along with the step time
+    std::vector<std::tuple<Time, InterfaceHandle, std::unique_ptr<Message>>>
+        speculativeDeliveries;
+    /// anti-messages that arrived before the message they retract along with the message time
+    std::vector<std::tuple<Time, std::string, int32_t>> pendingAntiMessages;
     mutable std::atomic_flag processing = ATOMIC_FLAG_INIT;  //!< the federate is processing
+    /** the stages of a federate driven by a federate operator*/
+    enum class CallbackStage : std::uint8_t {
+        STARTUP,  //!< waiting for the initializing mode grant
+        EXEC_REQUESTED,  //!< waiting for the executing mode grant
+        TIME_REQUESTED,  //!< waiting for a time grant
+        FINALIZING,  //!< waiting for the disconnect to complete
+        COMPLETE  //!< the operator has finished
+    };
+    std::shared_ptr<FederateOperator> fedOperator;  //!< the operator for a callback federate
+    std::function<void()> callbackScheduler;  //!< schedules callbackProcessing on a worker
+    std::atomic<bool> callbackBased{false};  //!< the federate is driven by a federate operator
+    std::atomic<bool> callbackScheduled{false};  //!< callback processing is pending or running
+    /// the worker thread currently executing the operator callbacks
+    std::atomic<std::thread::id> callbackThread{};
+    CallbackStage callbackStage{CallbackStage::STARTUP};  //!< the current callback stage
+    Time callbackRequestTime{timeZero};  //!< the last time requested by the operator
+    IterationRequest callbackIterate{IterationRequest::NO_ITERATIONS};  //!< the last iteration
+    bool callbackComplete{false};  //!< the operator has finished, guarded by callbackLock
+    std::mutex callbackLock;  //!< lock for the completion of the operator
+    std::condition_variable callbackCompletion;  //!< notification of the operator completion
   private:
     /** a logging function for logging or printing messages*/
     std::function<void(int, std::string_view, std::string_view)>
@@ -258,6 +303,10 @@ class FederateState {
     @return a convergence state value with an indicator of return reason and state of convergence
     */
     MessageProcessingResult processQueue() noexcept;
+    /** process the federate queue until a returnable event
+    @param block set to false to return CONTINUE_PROCESSING once the queue is empty instead of
+    waiting for more messages*/
+    MessageProcessingResult processMessages(bool block) noexcept;
 
     /** process the federate delayed Message queue until a returnable event or it is empty
     @details processQueue will process messages until one of 3 things occur
@@ -273,6 +322,34 @@ class FederateState {
     @return a convergence state value with an indicator of return reason and state of convergence
     */
     MessageProcessingResult processActionMessage(ActionMessage& cmd);
+    /** notify the parent of a local error generated while processing the queue*/
+    void sendErrorNotification(bool initError, bool errorCommand);
+    /** process a time request for an optimistic federate
+    @details grants are made speculatively to the next pending event, the grants from the time
+    coordinator become commit points that can no longer be rolled back
+    */
+    iteration_time optimisticTimeRequest(Time nextTime);
+    /** grant a time to an optimistic federate*/
+    iteration_time optimisticGrant(Time grantTime, Time nextTime);
+    /** process any message in the queue without blocking
+    @return the last returnable result or CONTINUE_PROCESSING if none*/
+    MessageProcessingResult processOptimisticQueue(bool block);
+    /** handle a commit (time grant) from the time coordinator for an optimistic federate*/
+    void commitOptimisticTime();
+    /** roll the federate back to rollback_time and retract messages sent after it*/
+    iteration_time rollback();
+    /** process an anti-message retracting a previously sent message*/
+    void processAntiMessage(const ActionMessage& cmd);
+    /** update the granted time and events after a request to enter executing mode*/
+    void updateExecGrant(MessageProcessingResult ret, IterationRequest iterate);
+    /** update the granted time and events after a time request*/
+    void updateTimeGrant(MessageProcessingResult ret, Time nextTime, IterationRequest iterate);
+    /** send the request for executing mode generated by a federate operator*/
+    void sendCallbackExecRequest(IterationRequest iterate);
+    /** send the time request or disconnect generated by a federate operator*/
+    void sendCallbackTimeRequest(Time nextTime, IterationRequest iterate);
+    /** mark the federate operator as finished and release any waiting finalize call*/
+    void completeCallbacks();
     /** fill event list
     @param currentTime the time of the update
     */
@@ -299,6 +376,19 @@ class FederateState {
     Time grantedTime() const { return time_granted; }
     /** get allowable message time*/
     Time nextAllowedSendTime() const { return allowed_send_time; }
+    /** get the time that can no longer be rolled back for an optimistic federate*/
+    Time committedTime() const { return (optimistic) ? time_committed : time_granted; }
+    /** check if the federate may advance speculatively*/
+    bool isOptimistic() const { return optimistic; }
+    /** check if the federate is currently executing a speculative time step*/
+    bool isSpeculating() const { return optimistic && time_granted > time_committed; }
+    /** drop anti-messages for message times the federate can no longer receive*/
+    void clearExpiredAntiMessages();
+    /** record a message sent in a speculative time step so it can be retracted on a rollback*/
+    void recordSpeculativeSend(const ActionMessage& message);
+    /** record a message sent to a set of targets in a speculative time step*/
+    void recordSpeculativeSend(const ActionMessage& message,
+                               const std::vector<std::pair<GlobalHandle, std::string_view>>& targets);
     /**get a reference to the handles of subscriptions with value updates
      */
     const std::vector<InterfaceHandle>& getEvents() const;
@@ -349,8 +439,22 @@ class FederateState {
     with no specific end in mind
     */
     IterationResult genericUnspecifiedQueueProcess();
-    /** function to process the queue until a disconnect_fed_ack is received*/
+    /** function to process the queue until a disconnect_fed_ack is received
+    @details for a callback federate this waits for the operator to finish instead,  if called
+    from one of the operator callbacks it returns immediately and the federate finishes once the
+    callback returns*/
     void finalize();
+    /** set an operator to drive the federate through callbacks
+    @param fedOp the operator executing the federate operations
+    @param scheduler function scheduling a call to callbackProcessing on a worker thread
+    @return false if the federate configuration does not support callback operation*/
+    bool setCallbackOperator(std::shared_ptr<FederateOperator> fedOp,
+                             std::function<void()> scheduler);
+    /** check if the federate is driven by a federate operator*/
+    bool isCallbackBased() const { return callbackBased.load(); }
+    /** process the available messages of a callback federate and execute the operator callbacks
+    @details called on a worker thread when messages arrive for the federate*/
+    void callbackProcessing() noexcept;
 
     /** add an action message to the queue*/
     void addAction(const ActionMessage& action);
@@ -394,9 +498,24 @@ class FederateState {
     @return true if it should be published, false if not
     */
     bool checkAndSetValue(InterfaceHandle pub_id, const char* data, uint64_t len);
+    /** generate a delta for a publication value if the publication is configured to transmit deltas
+    @param pub_id the handle of the publication
+    @param data the raw data to transmit
+    @param len the length of the data
+    @param subscriberCount the number of subscribers the value will be sent to
+    @param delta the buffer to store the delta in
+    @return true if the delta should be transmitted in place of the full value
+    */
+    bool generatePublicationDelta(InterfaceHandle pub_id,
+                                  const char* data,
+                                  uint64_t len,
+                                  std::size_t subscriberCount,
+                                  SmallBuffer& delta);
 
     /** route a message either forward to parent or add to queue*/
     void routeMessage(const ActionMessage& msg);
+    /** notify the parent core of a time grant if a notice was requested*/
+    void sendTimeUpdateNotice();
     /** create an interface*/
     void createInterface(InterfaceType htype,
                          InterfaceHandle handle,
@@ -10,6 +10,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "BasicHandleInfo.hpp"
 #include "HandleManager.hpp"
 #include "TimeCoordinatorProcessing.hpp"
+#include "WorkerPool.hpp"
 #include "coreTypeOperations.hpp"
 #include "flagOperations.hpp"
 #include "helicsVersion.hpp"
@@ -35,6 +36,8 @@ FilterFederate::FilterFederate(GlobalFederateId fedID,
 
 FilterFederate::~FilterFederate()
 {
+    // finish any filter operations in progress before the callbacks are removed
+    workers.reset();
     mHandles = {nullptr};
     current_state = {HELICS_CREATED};
     /// map of all local filters
@@ -59,6 +62,15 @@ FilterFederate::~FilterFederate()
     filters.clear();
 }
 
+void FilterFederate::setWorkerThreads(int threads)
+{
+    if (threads > 0) {
+        workers = std::make_unique<WorkerPool>(threads);
+    } else {
+        workers.reset();
+    }
+}
+
 void FilterFederate::routeMessage(const ActionMessage& msg)
 {
     if (mSendMessage) {
@@ -196,7 +208,10 @@ void FilterFederate::processFilterReturn(ActionMessage& cmd)
                 mSendMessage(unblock);
             }
             clearTimeReturn(messID);
+            return;
         }
+        // the result comes back from the filter so restore the original source
+        cmd.setSource(handle->handle);
         auto* filtFunc = getFilterCoordinator(handle->getInterfaceHandle());
         if (filtFunc->hasSourceFilters) {
             for (auto ii = static_cast<size_t>(cmd.counter) + 1;
@@ -208,6 +223,11 @@ void FilterFederate::processFilterReturn(ActionMessage& cmd)
                     continue;
                 }
                 if (filt->core_id == mFedID) {
+                    if (workers) {
+                        // the time block stays in place until the worker returns the result
+                        dispatchSourceFilter(filt, std::move(cmd), handle, ii);
+                        return;
+                    }
                     // deal with local source filters
                     auto tempMessage = createMessageFromCommand(std::move(cmd));
                     tempMessage = filt->filterOp->process(std::move(tempMessage));
@@ -248,6 +268,12 @@ void FilterFederate::processFilterReturn(ActionMessage& cmd)
         }
         ongoingFilterProcesses[fid_index].erase(messID);
         clearTimeReturn(messID);
+        if (cmd.action() == CMD_FILTER_RESULT) {
+            // all the filters are complete so send the message on to its destination
+            cmd.setAction(CMD_SEND_MESSAGE);
+            cmd.dest_id = parent_broker_id;
+            cmd.dest_handle = InterfaceHandle();
+        }
         mDeliverMessage(cmd);
         if (ongoingFilterProcesses[fid_index].empty()) {
             ActionMessage unblock(CMD_TIME_UNBLOCK);
@@ -276,6 +302,17 @@ void FilterFederate::processDestFilterReturn(ActionMessage& command)
                 mSendMessage(removeTimeBlock);
                 return;
             }
+            if (command.getString(targetStringLoc) != handle->key) {
+                // the filter rerouted the message so start the delivery process over
+                command.setAction(CMD_SEND_MESSAGE);
+                command.dest_id = parent_broker_id;
+                command.dest_handle = InterfaceHandle();
+                mDeliverMessage(command);
+                ActionMessage removeTimeBlock(CMD_TIME_UNBLOCK, mCoreID, handle->getFederateId());
+                removeTimeBlock.messageID = messID;
+                mSendMessage(removeTimeBlock);
+                return;
+            }
             auto* filtFunc = getFilterCoordinator(handle->getInterfaceHandle());
 
             if (!filtFunc->cloningDestFilters.empty()) {
@@ -317,6 +354,20 @@ ActionMessage& FilterFederate::processMessage(ActionMessage& command, const Basi
                             mDeliverMessage(cmd);
                         }
                     }
+                } else if (workers) {
+                    // block time advancement until the worker returns the filtered message
+                    auto fed_id = handle->getFederateId();
+                    if (ongoingFilterProcesses[fed_id.baseValue()].empty()) {
+                        ActionMessage block(CMD_TIME_BLOCK);
+                        block.dest_id = mCoreID;
+                        block.source_id = fed_id;
+                        mSendMessage(block);
+                    }
+                    ongoingFilterProcesses[fed_id.baseValue()].insert(command.messageID);
+                    addTimeReturn(command.messageID, command.actionTime);
+                    dispatchSourceFilter(filt, std::move(command), handle, ii);
+                    command = CMD_IGNORE;
+                    return command;
                 } else {
                     // deal with local source filters
                     auto tempMessage = createMessageFromCommand(std::move(command));
@@ -392,7 +443,10 @@ bool FilterFederate::destinationProcessMessage(ActionMessage& command,
                     return false;
                 }
                 // the filter is part of this core
-
+                if (workers && ffunc->destFilter->filterOp) {
+                    dispatchDestinationFilter(ffunc->destFilter, std::move(command), handle);
+                    return false;
+                }
                 if (ffunc->destFilter->filterOp) {
                     auto tempMessage = createMessageFromCommand(std::move(command));
                     auto odest = tempMessage->dest;
@@ -458,6 +512,89 @@ void FilterFederate::runCloningDestinationFilters(const FilterCoordinator* ffunc
     }
 }
 
+void FilterFederate::dispatchSourceFilter(const FilterInfo* filt,
+                                          ActionMessage&& command,
+                                          const BasicHandleInfo* handle,
+                                          std::size_t index)
+{
+    auto mid = command.messageID;
+    auto endpoint = handle->handle;
+    auto filterHandle = filt->handle;
+    workers->post(endpoint.handle.baseValue(),
+                  [this,
+                   op = filt->filterOp,
+                   cmd = std::move(command),
+                   mid,
+                   endpoint,
+                   filterHandle,
+                   index]() mutable {
+                      std::unique_ptr<Message> result;
+                      try {
+                          result = op->process(createMessageFromCommand(std::move(cmd)));
+                      }
+                      catch (const std::exception& e) {
+                          mLogger(HELICS_LOG_LEVEL_ERROR,
+                                  mName,
+                                  std::string("filter operation failed: ") + e.what());
+                      }
+                      ActionMessage ret(CMD_NULL_MESSAGE);
+                      if (result) {
+                          ret = ActionMessage(std::move(result));
+                          ret.setAction(CMD_FILTER_RESULT);
+                      }
+                      ret.messageID = mid;
+                      ret.counter = static_cast<uint16_t>(index);
+                      ret.setDestination(endpoint);
+                      ret.source_id = mFedID;
+                      ret.source_handle = filterHandle;
+                      mQueueMessageMove(std::move(ret));
+                  });
+}
+
+void FilterFederate::dispatchDestinationFilter(const FilterInfo* filt,
+                                               ActionMessage&& command,
+                                               const BasicHandleInfo* handle)
+{
+    // block the federate time advancement until the result is returned
+    auto fed_id = handle->getFederateId();
+    ActionMessage tblock(CMD_TIME_BLOCK, mCoreID, fed_id);
+    auto mid = ++messageCounter;
+    tblock.messageID = mid;
+    mSendMessage(tblock);
+    ongoingDestFilterProcesses[fed_id.baseValue()].emplace(mid);
+    addTimeReturn(mid, command.actionTime);
+
+    auto endpoint = handle->handle;
+    auto filterHandle = filt->handle;
+    workers->post(endpoint.handle.baseValue(),
+                  [this,
+                   op = filt->filterOp,
+                   cmd = std::move(command),
+                   mid,
+                   endpoint,
+                   filterHandle]() mutable {
+                      std::unique_ptr<Message> result;
+                      try {
+                          result = op->process(createMessageFromCommand(std::move(cmd)));
+                      }
+                      catch (const std::exception& e) {
+                          mLogger(HELICS_LOG_LEVEL_ERROR,
+                                  mName,
+                                  std::string("filter operation failed: ") + e.what());
+                      }
+                      ActionMessage ret(CMD_NULL_DEST_MESSAGE);
+                      if (result) {
+                          ret = ActionMessage(std::move(result));
+                          ret.setAction(CMD_DEST_FILTER_RESULT);
+                      }
+                      ret.messageID = mid;
+                      ret.setDestination(endpoint);
+                      ret.source_id = mFedID;
+                      ret.source_handle = filterHandle;
+                      mQueueMessageMove(std::move(ret));
+                  });
+}
+
 void FilterFederate::addTimeReturn(int32_t id, Time TimeVal)
 {
     timeBlockProcesses.emplace_back(id, TimeVal);
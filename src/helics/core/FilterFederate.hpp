@@ -29,6 +29,7 @@ namespace helics {
 class HandleManager;
 class ActionMessage;
 class BasicHandleInfo;
+class WorkerPool;
 
 class FilterFederate {
   private:
@@ -63,6 +64,8 @@ class FilterFederate {
     std::atomic<int32_t> messageCounter{54};
     /// storage for all the filters
     gmlc::containers::MappedPointerVector<FilterInfo, GlobalHandle> filters;
+    /// worker threads for executing local filter operators,  null if filters run inline
+    std::unique_ptr<WorkerPool> workers;
     // bool hasTiming{false};
 
   public:
@@ -121,6 +124,9 @@ class FilterFederate {
     void addFilteredEndpoint(Json::Value& block, GlobalFederateId fed) const;
 
     void setHandleManager(HandleManager* handles) { mHandles = handles; }
+    /** run local non-cloning filter operators on a set of worker threads instead of the core loop
+    @param threads the number of worker threads, 0 to execute the operators inline*/
+    void setWorkerThreads(int threads);
 
     std::string query(const std::string& queryStr) const;
     /** check if the filter federate has active time dependencies other than parent*/
@@ -138,6 +144,17 @@ class FilterFederate {
     void runCloningDestinationFilters(const FilterCoordinator* filt,
                                       const BasicHandleInfo* handle,
                                       const ActionMessage& command) const;
+    /** execute a local source filter on a worker thread,  the result is returned through
+    processFilterReturn*/
+    void dispatchSourceFilter(const FilterInfo* filt,
+                              ActionMessage&& command,
+                              const BasicHandleInfo* handle,
+                              std::size_t index);
+    /** execute a local destination filter on a worker thread,  the result is returned through
+    processDestFilterReturn*/
+    void dispatchDestinationFilter(const FilterInfo* filt,
+                                   ActionMessage&& command,
+                                   const BasicHandleInfo* handle);
     void addTimeReturn(int32_t id, Time TimeVal);
     void clearTimeReturn(int32_t id);
 };
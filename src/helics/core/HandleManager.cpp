@@ -10,6 +10,9 @@ SPDX-License-Identifier: BSD-3-Clause
 // TODO(PT): move the flags out of actionMessage
 
 namespace helics {
+/// the span of handle ids after the first handle of a federate stored in a flat vector
+static constexpr int32_t handleWindow{4096};
+
 BasicHandleInfo& HandleManager::addHandle(GlobalFederateId fed_id,
                                           InterfaceType what,
                                           const std::string& key,
@@ -46,14 +49,15 @@ void HandleManager::addHandle(const BasicHandleInfo& otherHandle)
 
 void HandleManager::removeHandle(GlobalHandle handle)
 {
-    auto key = static_cast<uint64_t>(handle);
-    auto fnd = unique_ids.find(key);
-    if (fnd == unique_ids.end()) {
+    auto* fedHandles = unique_ids.find(handle.fed_id);
+    const auto* fnd = (fedHandles != nullptr) ? fedHandles->find(handle.handle.baseValue()) :
+                                                nullptr;
+    if (fnd == nullptr) {
         return;
     }
-    auto index = fnd->second;
+    auto index = *fnd;
     auto& info = handles[index];
-    unique_ids.erase(fnd);
+    fedHandles->erase(handle.handle.baseValue());
     if (!info.key.empty()) {
         switch (info.handleType) {
             case InterfaceType::ENDPOINT:
@@ -129,20 +133,24 @@ const BasicHandleInfo* HandleManager::getHandleInfo(InterfaceHandle handle) cons
 
 BasicHandleInfo* HandleManager::findHandle(GlobalHandle fed_id)
 {
-    auto key = static_cast<uint64_t>(fed_id);
-    auto fnd = unique_ids.find(key);
-    if (fnd != unique_ids.end()) {
-        return &handles[fnd->second];
+    const auto* fedHandles = unique_ids.find(fed_id.fed_id);
+    if (fedHandles != nullptr) {
+        const auto* fnd = fedHandles->find(fed_id.handle.baseValue());
+        if (fnd != nullptr) {
+            return &handles[*fnd];
+        }
     }
     return nullptr;
 }
 
 const BasicHandleInfo* HandleManager::findHandle(GlobalHandle fed_id) const
 {
-    auto key = static_cast<uint64_t>(fed_id);
-    auto fnd = unique_ids.find(key);
-    if (fnd != unique_ids.end()) {
-        return &handles[fnd->second];
+    const auto* fedHandles = unique_ids.find(fed_id.fed_id);
+    if (fedHandles != nullptr) {
+        const auto* fnd = fedHandles->find(fed_id.handle.baseValue());
+        if (fnd != nullptr) {
+            return &handles[*fnd];
+        }
     }
     return nullptr;
 }
@@ -351,8 +359,15 @@ void HandleManager::addSearchFields(const BasicHandleInfo& handle, int32_t index
         default:
             break;
     }
-    // generate a key of the fed and handle
-    unique_ids.emplace(static_cast<uint64_t>(handle.handle), index);
+    // index the handle by federate and handle id
+    auto* fedHandles = unique_ids.find(handle.handle.fed_id);
+    if (fedHandles == nullptr) {
+        unique_ids.emplace(handle.handle.fed_id,
+                           DenseIndexTable<int32_t>(handle.handle.handle.baseValue(),
+                                                    handleWindow));
+        fedHandles = unique_ids.find(handle.handle.fed_id);
+    }
+    fedHandles->emplace(handle.handle.handle.baseValue(), index);
 }
 
 std::string HandleManager::generateName(InterfaceType what) const
@@ -7,6 +7,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #pragma once
 #include "BasicHandleInfo.hpp"
 #include "Core.hpp"
+#include "DenseIdTable.hpp"
 #include "helicsTime.hpp"
 
 #include <deque>
@@ -34,7 +35,9 @@ class HandleManager {
         endpoints;  //!< map of all local endpoints
     std::unordered_map<std::string_view, InterfaceHandle> inputs;  //!< map of all local endpoints
     std::unordered_map<std::string_view, InterfaceHandle> filters;  //!< map of all local endpoints
-    std::unordered_map<std::uint64_t, int32_t> unique_ids;  //!< map of identifiers
+    /// the index of each handle in a table for each federate,  the handles of a federate are
+    /// mostly created in sequence so they are stored in a flat vector starting from the first one
+    GlobalIdTable<DenseIndexTable<int32_t>> unique_ids;
   public:
     /** default constructor*/
     HandleManager() = default;
@@ -7,6 +7,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "InputInfo.hpp"
 
 #include "../common/JsonGeneration.hpp"
+#include "deltaEncoding.hpp"
 #include "units/units/units.hpp"
 
 #include <algorithm>
@@ -87,6 +88,7 @@ void InputInfo::addData(GlobalHandle source_id,
 {
     int index;
     bool found = false;
+    last_added_index = -1;
     for (index = 0; index < static_cast<int>(input_sources.size()); ++index) {
         if (input_sources[index] == source_id) {
             if (valueTime > deactivated[index]) {
@@ -99,6 +101,10 @@ void InputInfo::addData(GlobalHandle source_id,
     if (!found) {
         return;
     }
+    // the replaced value is kept so a change can be checked for on demand
+    replaced_value = std::move(last_received[index]);
+    last_received[index] = data;
+    last_added_index = index;
     if ((data_queues[index].empty()) || (valueTime > data_queues[index].back().time)) {
         data_queues[index].emplace_back(valueTime, iteration, std::move(data));
     } else {
@@ -111,6 +117,43 @@ void InputInfo::addData(GlobalHandle source_id,
     }
 }
 
+bool InputInfo::addDeltaData(GlobalHandle source_id,
+                             Time valueTime,
+                             unsigned int iteration,
+                             const SmallBuffer& delta)
+{
+    for (std::size_t index = 0; index < input_sources.size(); ++index) {
+        if (input_sources[index] == source_id) {
+            const auto& base = last_received[index];
+            if (!base) {
+                return false;
+            }
+            auto value = std::make_shared<SmallBuffer>();
+            if (!applyDataDelta(base->to_string(), delta.to_string(), *value)) {
+                return false;
+            }
+            addData(source_id, valueTime, iteration, std::move(value));
+            return true;
+        }
+    }
+    return false;
+}
+
+bool InputInfo::lastValueChanged() const
+{
+    if (last_added_index < 0) {
+        return false;
+    }
+    const auto& current = last_received[last_added_index];
+    if (!replaced_value || !current) {
+        return true;
+    }
+    if (changeDetector) {
+        return changeDetector(*replaced_value, *current);
+    }
+    return (*replaced_value != *current);
+}
+
 bool InputInfo::addSource(GlobalHandle newSource,
                           const std::string& sourceName,
                           const std::string& stype,
@@ -128,6 +171,7 @@ bool InputInfo::addSource(GlobalHandle newSource,
     source_info.emplace_back(sourceName, stype, sunits);
     data_queues.resize(input_sources.size());
     current_data.resize(input_sources.size());
+    last_received.resize(input_sources.size());
     current_data_time.resize(input_sources.size(), {Time::minVal(), 0});
     deactivated.push_back(Time::maxVal());
     has_target = true;
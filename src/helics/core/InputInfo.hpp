@@ -8,6 +8,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "basic_CoreTypes.hpp"
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -85,8 +86,17 @@ class InputInfo {
     std::vector<Time> deactivated;  //!< indicator that the source has been deactivated
     std::vector<sourceInformation> source_info;  //!< the name,type,units of the sources
     std::vector<int32_t> priority_sources;  //!< the list of priority inputs;
+    /** comparison of the previous and new value from a source returning true if the new value is
+    a change,  if empty the values are compared byte by byte*/
+    std::function<bool(const SmallBuffer&, const SmallBuffer&)> changeDetector;
+
   private:
     std::vector<std::vector<dataRecord>> data_queues;  //!< queue of the data
+    std::vector<std::shared_ptr<const SmallBuffer>>
+        last_received;  //!< the most recent value received from each source used as a delta base
+    std::shared_ptr<const SmallBuffer>
+        replaced_value;  //!< the value from the same source replaced by the last added value
+    int32_t last_added_index{-1};  //!< the source index of the last added value
 
   public:
     /** get all the current data*/
@@ -100,6 +110,18 @@ class InputInfo {
                  Time valueTime,
                  unsigned int iteration,
                  std::shared_ptr<const SmallBuffer> data);
+    /** reconstruct a data block from a delta against the previous value from the same source and
+    add it into the queue
+    @return false if the delta could not be applied
+    */
+    bool addDeltaData(GlobalHandle source_id,
+                      Time valueTime,
+                      unsigned int iteration,
+                      const SmallBuffer& delta);
+    /** check if the most recently added value is a change from the previous value of its source
+    @details uses the changeDetector if one is set,  a value from a source with no previous value is
+    always a change*/
+    bool lastValueChanged() const;
 
     /** update current data not including data at the specified time
     @param newTime the time to move the subscription to
@@ -8,6 +8,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "../common/JsonProcessingFunctions.hpp"
 #include "../common/fmt_format.h"
+#include "deltaEncoding.hpp"
 #include "helics_definitions.hpp"
 
 #include <sstream>
@@ -187,6 +188,14 @@ bool InterfaceInfo::setPublicationProperty(InterfaceHandle id, int32_t option, i
         case defs::Options::BUFFER_DATA:
             pub->buffer_data = bvalue;
             break;
+        case defs::Options::TRANSMIT_DELTAS:
+            pub->transmit_deltas = bvalue;
+            pub->keyframe_interval = (value > 1) ? value : defaultDeltaKeyframeInterval;
+            pub->keyframe_required = true;
+            if (!bvalue) {
+                pub->last_transmitted.clear();
+            }
+            break;
         case defs::Options::CONNECTIONS:
             pub->required_connections = value;
             break;
@@ -286,6 +295,8 @@ int32_t InterfaceInfo::getPublicationProperty(InterfaceHandle id, int32_t option
         case defs::Options::BUFFER_DATA:
             flagval = pub->buffer_data;
             break;
+        case defs::Options::TRANSMIT_DELTAS:
+            return (pub->transmit_deltas) ? pub->keyframe_interval : 0;
         case defs::Options::CONNECTIONS:
             return static_cast<int32_t>(pub->subscribers.size());
         default:
@@ -7,28 +7,311 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "MessageTimer.hpp"
 
+#include "TimingWheel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <iostream>
+#include <mutex>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace helics {
-MessageTimer::MessageTimer(std::function<void(ActionMessage&&)> sFunction):
-    sendFunction(std::move(sFunction)), contextPtr(AsioContextManager::getContextPointer()),
-    loopHandle(contextPtr->startContextLoop())
-{
-}
+/** the storage and wheel for the timers of a MessageTimer*/
+struct MessageTimer::TimerState {
+    using time_type = MessageTimer::time_type;
+    /** the storage for a single timer*/
+    struct TimerSlot {
+        ActionMessage message;  //!< the message to send on expiration
+        time_type expiration;  //!< the time the message should be sent
+        uint32_t generation{0};  //!< incremented whenever the scheduled expiration changes
+        bool active{false};  //!< the timer is scheduled in the wheel
+        bool inUse{false};  //!< the slot is assigned to a timer
+    };
 
-static void processTimerCallback(std::shared_ptr<MessageTimer> mtimer,
-                                 int32_t index,
-                                 const std::error_code& ec)
+    explicit TimerState(std::function<void(ActionMessage&&)> sFunction):
+        wheel(std::chrono::steady_clock::now(), std::chrono::milliseconds(1)),
+        sendFunction(std::move(sFunction))
+    {
+    }
+    /** check if an index refers to an assigned timer, the lock must be held*/
+    bool validIndex(int32_t index) const
+    {
+        return (index >= 0) && (index < static_cast<int32_t>(slots.size())) &&
+            slots[index].inUse;
+    }
+    /** place a slot in the wheel with a new expiration, the lock must be held
+    @return true if the next expiration of the wheel moved earlier*/
+    bool schedule(int32_t index, time_type expirationTime)
+    {
+        auto& slot = slots[index];
+        auto previous = wheel.nextExpiration();
+        ++slot.generation;
+        slot.expiration = expirationTime;
+        slot.active = true;
+        wheel.schedule(index, slot.generation, expirationTime);
+        nextExpiration.store(wheel.nextExpiration());
+        return expirationTime < previous;
+    }
+    /** send the messages of the timers that have expired, called from the driver thread*/
+    void processExpired(time_type now);
+    /** stop sending messages
+    @param fromDriver the call is made from the driver thread*/
+    void halt(bool fromDriver);
+
+    mutable std::mutex timerLock;  //!< lock protecting the timer slots and wheel
+    std::vector<TimerSlot> slots;  //!< the timer storage
+    std::vector<int32_t> freeSlots;  //!< indices of released slots available for reuse
+    TimingWheel wheel;  //!< the wheel of scheduled expirations
+    const std::function<void(ActionMessage&&)>
+        sendFunction;  //!< the callback to use when sending a message
+    std::vector<TimingWheel::Entry> expired;  //!< storage for the expired wheel entries
+    std::condition_variable sendComplete;  //!< signal that the driver finished sending messages
+    std::atomic<time_type> nextExpiration{time_type::max()};  //!< the next wheel expiration
+    std::atomic<std::chrono::nanoseconds> spinWindow{
+        std::chrono::nanoseconds(0)};  //!< the period before an expiration to spin
+    std::atomic<bool> halting{false};  //!< the owner is being destroyed
+    bool sending{false};  //!< the driver thread is sending messages
+};
+
+/** set on the driver thread so timers destroyed from within a send function can be detected*/
+static thread_local bool inDriverThread{false};
+
+/** the driver thread servicing the wheels of all the message timers of a process
+@details the thread is started when a timer is scheduled and is stopped and joined when the last
+message timer is destroyed*/
+class MessageTimer::TimerDriver {
+  public:
+    TimerDriver() = default;
+    TimerDriver(const TimerDriver&) = delete;
+    TimerDriver& operator=(const TimerDriver&) = delete;
+    /** join a driver thread that stopped itself from within a send function*/
+    ~TimerDriver()
+    {
+        if (stoppedThread.joinable()) {
+            if (stoppedThread.get_id() == std::this_thread::get_id()) {
+                // the last reference was released by the driver thread itself
+                stoppedThread.detach();
+            } else {
+                stoppedThread.join();
+            }
+        }
+    }
+    /** get the driver for the process*/
+    static std::shared_ptr<TimerDriver> instance()
+    {
+        static std::shared_ptr<TimerDriver> driver = std::make_shared<TimerDriver>();
+        return driver;
+    }
+    /** add the storage of a message timer to the driver*/
+    void addTimer(const std::shared_ptr<TimerState>& timer)
+    {
+        std::lock_guard<std::mutex> lock(driverLock);
+        timers.push_back(timer);
+        ++timerCount;
+    }
+    /** remove a destroyed message timer,  the last one stops and joins the driver thread*/
+    void removeTimer()
+    {
+        std::thread finished;
+        {
+            std::lock_guard<std::mutex> lock(driverLock);
+            --timerCount;
+            timers.erase(std::remove_if(timers.begin(),
+                                        timers.end(),
+                                        [](const auto& timer) { return timer.expired(); }),
+                         timers.end());
+            driverWake.notify_all();
+            if (timerCount > 0 || !running) {
+                return;
+            }
+            running = false;
+            ++generation;
+            finished = std::move(driverThread);
+        }
+        joinThread(std::move(finished));
+    }
+    /** wake the driver after a change to the schedule,  starting the driver thread if needed*/
+    void notify()
+    {
+        std::thread finished;
+        {
+            std::lock_guard<std::mutex> lock(driverLock);
+            if (!running) {
+                running = true;
+                finished = std::move(stoppedThread);
+                // the driver outlives the thread since the thread is joined before it is destroyed
+                driverThread = std::thread(
+                    [this, threadGeneration = ++generation] { loop(threadGeneration); });
+            }
+            driverWake.notify_all();
+        }
+        joinThread(std::move(finished));
+    }
+    /** wake a running driver to pick up a changed setting*/
+    void wake()
+    {
+        std::lock_guard<std::mutex> lock(driverLock);
+        driverWake.notify_all();
+    }
+    /** check if the calling thread is the driver thread*/
+    static bool onDriverThread() { return inDriverThread; }
+
+  private:
+    /** the loop executed by the driver thread until its generation is stopped*/
+    void loop(std::uint64_t threadGeneration);
+    /** join a stopped driver thread
+    @details a driver thread stopped from within one of its own send functions cannot join itself,
+    so it is kept until the next driver thread starts or the driver is destroyed*/
+    void joinThread(std::thread thread)
+    {
+        if (!thread.joinable()) {
+            return;
+        }
+        if (thread.get_id() != std::this_thread::get_id()) {
+            thread.join();
+            return;
+        }
+        std::thread previous;
+        {
+            std::lock_guard<std::mutex> lock(driverLock);
+            previous = std::exchange(stoppedThread, std::move(thread));
+        }
+        if (previous.joinable()) {
+            previous.join();
+        }
+    }
+
+    mutable std::mutex driverLock;  //!< lock protecting the list of timers and thread state
+    std::condition_variable driverWake;  //!< signal to the driver the schedule has changed
+    std::vector<std::weak_ptr<TimerState>> timers;  //!< the storage of the active message timers
+    std::thread driverThread;  //!< the running driver thread
+    std::thread stoppedThread;  //!< a driver thread that stopped itself and is not yet joined
+    std::size_t timerCount{0};  //!< the number of message timers using the driver
+    std::uint64_t generation{0};  //!< incremented whenever a driver thread is started or stopped
+    bool running{false};  //!< a driver thread is running
+};
+
+void MessageTimer::TimerState::processExpired(time_type now)
 {
-    if (ec != asio::error::operation_aborted) {
+    std::unique_lock<std::mutex> lock(timerLock);
+    if (halting.load()) {
+        return;
+    }
+    std::vector<ActionMessage> ready;
+    wheel.advance(now, expired);
+    for (const auto& entry : expired) {
+        auto& slot = slots[entry.index];
+        if (!slot.active || slot.generation != entry.generation) {
+            continue;
+        }
+        slot.active = false;
+        if (slot.message.action() != CMD_IGNORE) {
+            ready.push_back(std::move(slot.message));
+            slot.message.setAction(CMD_IGNORE);
+        }
+    }
+    expired.clear();
+    nextExpiration.store(wheel.nextExpiration());
+    if (ready.empty()) {
+        return;
+    }
+    sending = true;
+    lock.unlock();  // don't keep a lock while calling a callback
+    for (auto& message : ready) {
+        // the send function may destroy the owner of the timer
+        if (halting.load()) {
+            break;
+        }
         try {
-            mtimer->sendMessage(index);
+            sendFunction(std::move(message));
         }
         catch (std::exception& e) {
             std::cerr << "exception caught from sendMessage:" << e.what() << std::endl;
         }
     }
+    lock.lock();
+    sending = false;
+    lock.unlock();
+    sendComplete.notify_all();
+}
+
+void MessageTimer::TimerState::halt(bool fromDriver)
+{
+    std::unique_lock<std::mutex> lock(timerLock);
+    halting.store(true);
+    nextExpiration.store(time_type::max());
+    if (!fromDriver) {
+        sendComplete.wait(lock, [this] { return !sending; });
+    }
+}
+
+void MessageTimer::TimerDriver::loop(std::uint64_t threadGeneration)
+{
+    inDriverThread = true;
+    std::vector<std::shared_ptr<TimerState>> due;
+    std::unique_lock<std::mutex> lock(driverLock);
+    while (threadGeneration == generation) {
+        auto now = std::chrono::steady_clock::now();
+        auto next = time_type::max();
+        std::chrono::nanoseconds spin{0};
+        for (auto timer = timers.begin(); timer != timers.end();) {
+            auto state = timer->lock();
+            if (!state) {
+                timer = timers.erase(timer);
+                continue;
+            }
+            auto expiration = state->nextExpiration.load();
+            if (expiration <= now) {
+                due.push_back(std::move(state));
+            } else if (expiration < next) {
+                next = expiration;
+                spin = state->spinWindow.load();
+            }
+            ++timer;
+        }
+        if (!due.empty()) {
+            lock.unlock();
+            for (auto& state : due) {
+                state->processExpired(now);
+            }
+            // release the storage of any timer destroyed while sending outside the lock
+            due.clear();
+            lock.lock();
+            continue;
+        }
+        if (next == time_type::max()) {
+            driverWake.wait(lock);
+            continue;
+        }
+        if (now < next - spin) {
+            driverWake.wait_until(lock, next - spin);
+            continue;
+        }
+        // inside the spin window so stay on the cpu rather than rely on the scheduler
+        lock.unlock();
+        while (std::chrono::steady_clock::now() < next) {
+            std::this_thread::yield();
+        }
+        lock.lock();
+    }
+}
+
+MessageTimer::MessageTimer(std::function<void(ActionMessage&&)> sFunction):
+    state(std::make_shared<TimerState>(std::move(sFunction))), driver(TimerDriver::instance())
+{
+    driver->addTimer(state);
+}
+
+MessageTimer::~MessageTimer()
+{
+    // if called from within the send function the driver still holds the state so it stays valid
+    state->halt(driver->onDriverThread());
+    state.reset();
+    driver->removeTimer();
 }
 
 int32_t MessageTimer::addTimerFromNow(std::chrono::nanoseconds time, ActionMessage mess)
@@ -38,94 +321,113 @@ int32_t MessageTimer::addTimerFromNow(std::chrono::nanoseconds time, ActionMessa
 
 int32_t MessageTimer::addTimer(time_type expirationTime, ActionMessage mess)
 {
-    // these two calls need to be before the lock
-    auto timer = std::make_shared<asio::steady_timer>(contextPtr->getBaseContext());
-    timer->expires_at(expirationTime);
-
-    std::unique_lock<std::mutex> lock(timerLock);
-
-    auto index = static_cast<int32_t>(timers.size());
-    auto timerCallback = [ptr = shared_from_this(), index](const std::error_code& ec) {
-        processTimerCallback(ptr, index, ec);
-    };
-    buffers.push_back(std::move(mess));
-    expirationTimes.push_back(expirationTime);
-    timers.push_back(std::move(timer));
+    std::unique_lock<std::mutex> lock(state->timerLock);
+    int32_t index;
+    if (!state->freeSlots.empty()) {
+        index = state->freeSlots.back();
+        state->freeSlots.pop_back();
+    } else {
+        index = static_cast<int32_t>(state->slots.size());
+        state->slots.emplace_back();
+    }
+    auto& slot = state->slots[index];
+    slot.message = std::move(mess);
+    slot.inUse = true;
     if (expirationTime > std::chrono::steady_clock::now()) {
-        timers.back()->async_wait(timerCallback);
+        auto wake = state->schedule(index, expirationTime);
+        lock.unlock();
+        if (wake) {
+            driver->notify();
+        }
     } else {
+        slot.expiration = expirationTime;
+        slot.active = false;
         lock.unlock();
-        timerCallback(std::error_code{});
+        sendMessage(index);
     }
-
     return index;
 }
 
 void MessageTimer::cancelTimer(int32_t index)
 {
-    std::lock_guard<std::mutex> lock(timerLock);
-    if ((index >= 0) && (index < static_cast<int32_t>(timers.size()))) {
-        buffers[index].setAction(CMD_IGNORE);
-        timers[index]->cancel();
+    std::lock_guard<std::mutex> lock(state->timerLock);
+    if (state->validIndex(index)) {
+        auto& slot = state->slots[index];
+        slot.message.setAction(CMD_IGNORE);
+        if (slot.active) {
+            // the entry in the wheel becomes stale and is discarded when it expires
+            ++slot.generation;
+            slot.active = false;
+        }
     }
 }
 
 void MessageTimer::cancelAll()
 {
-    std::lock_guard<std::mutex> lock(timerLock);
-    for (auto& buf : buffers) {
-        buf.setAction(CMD_IGNORE);
+    std::lock_guard<std::mutex> lock(state->timerLock);
+    for (auto& slot : state->slots) {
+        slot.message.setAction(CMD_IGNORE);
+        if (slot.active) {
+            ++slot.generation;
+            slot.active = false;
+        }
     }
-    for (auto& tmr : timers) {
-        tmr->cancel();
+    state->wheel.clear();
+    state->nextExpiration.store(time_type::max());
+}
+
+void MessageTimer::releaseTimer(int32_t index)
+{
+    std::lock_guard<std::mutex> lock(state->timerLock);
+    if (state->validIndex(index)) {
+        auto& slot = state->slots[index];
+        slot.message.setAction(CMD_IGNORE);
+        ++slot.generation;
+        slot.active = false;
+        slot.inUse = false;
+        state->freeSlots.push_back(index);
     }
 }
 
 void MessageTimer::updateTimer(int32_t timerIndex, time_type expirationTime, ActionMessage mess)
 {
-    std::lock_guard<std::mutex> lock(timerLock);
-    if ((timerIndex >= 0) && (timerIndex < static_cast<int32_t>(timers.size()))) {
-        timers[timerIndex]->expires_at(expirationTime);
-        expirationTimes[timerIndex] = expirationTime;
-        buffers[timerIndex] = std::move(mess);
-
-        auto timerCallback = [ptr = shared_from_this(), timerIndex](const std::error_code& ec) {
-            processTimerCallback(ptr, timerIndex, ec);
-        };
-
-        timers[timerIndex]->async_wait(timerCallback);
+    std::unique_lock<std::mutex> lock(state->timerLock);
+    if (state->validIndex(timerIndex)) {
+        state->slots[timerIndex].message = std::move(mess);
+        auto wake = state->schedule(timerIndex, expirationTime);
+        lock.unlock();
+        if (wake) {
+            driver->notify();
+        }
     }
 }
 
 bool MessageTimer::addTimeToTimer(int32_t timerIndex, std::chrono::nanoseconds time)
 {
-    std::lock_guard<std::mutex> lock(timerLock);
-    if ((timerIndex >= 0) && (timerIndex < static_cast<int32_t>(timers.size()))) {
-        auto newTime = timers[timerIndex]->expires_at() + time;
-        timers[timerIndex]->expires_at(newTime);
-        auto timerCallback = [ptr = shared_from_this(), timerIndex](const std::error_code& ec) {
-            processTimerCallback(ptr, timerIndex, ec);
-        };
-        expirationTimes[timerIndex] = newTime;
-        auto ret = (buffers[timerIndex].action() != CMD_IGNORE);
-        timers[timerIndex]->async_wait(timerCallback);
-        return ret;
+    std::unique_lock<std::mutex> lock(state->timerLock);
+    if (state->validIndex(timerIndex)) {
+        auto wake = state->schedule(timerIndex, state->slots[timerIndex].expiration + time);
+        bool valid = (state->slots[timerIndex].message.action() != CMD_IGNORE);
+        lock.unlock();
+        if (wake) {
+            driver->notify();
+        }
+        return valid;
     }
     return false;
 }
 
 bool MessageTimer::updateTimer(int32_t timerIndex, time_type expirationTime)
 {
-    std::lock_guard<std::mutex> lock(timerLock);
-    if ((timerIndex >= 0) && (timerIndex < static_cast<int32_t>(timers.size()))) {
-        timers[timerIndex]->expires_at(expirationTime);
-        auto timerCallback = [ptr = shared_from_this(), timerIndex](const std::error_code& ec) {
-            processTimerCallback(ptr, timerIndex, ec);
-        };
-        expirationTimes[timerIndex] = expirationTime;
-        auto ret = (buffers[timerIndex].action() != CMD_IGNORE);
-        timers[timerIndex]->async_wait(timerCallback);
-        return ret;
+    std::unique_lock<std::mutex> lock(state->timerLock);
+    if (state->validIndex(timerIndex)) {
+        auto wake = state->schedule(timerIndex, expirationTime);
+        bool valid = (state->slots[timerIndex].message.action() != CMD_IGNORE);
+        lock.unlock();
+        if (wake) {
+            driver->notify();
+        }
+        return valid;
     }
     return false;
 }
@@ -133,25 +435,54 @@ bool MessageTimer::updateTimer(int32_t timerIndex, time_type expirationTime)
 /** update the message associated with a timer*/
 void MessageTimer::updateMessage(int32_t timerIndex, ActionMessage mess)
 {
-    std::lock_guard<std::mutex> lock(timerLock);
-    if ((timerIndex >= 0) && (timerIndex < static_cast<int32_t>(timers.size()))) {
-        buffers[timerIndex] = std::move(mess);
+    std::lock_guard<std::mutex> lock(state->timerLock);
+    if (state->validIndex(timerIndex)) {
+        state->slots[timerIndex].message = std::move(mess);
     }
 }
 
 void MessageTimer::sendMessage(int32_t timerIndex)
 {
-    std::unique_lock<std::mutex> lock(timerLock);
-    if ((timerIndex >= 0) && (timerIndex < static_cast<int32_t>(timers.size()))) {
-        if (std::chrono::steady_clock::now() >= expirationTimes[timerIndex]) {
-            if (buffers[timerIndex].action() != CMD_IGNORE) {
-                ActionMessage buf = std::move(buffers[timerIndex]);
-                buffers[timerIndex].setAction(CMD_IGNORE);  // clear out the action
+    std::unique_lock<std::mutex> lock(state->timerLock);
+    if (state->validIndex(timerIndex)) {
+        auto& slot = state->slots[timerIndex];
+        if (std::chrono::steady_clock::now() >= slot.expiration) {
+            if (slot.message.action() != CMD_IGNORE) {
+                ActionMessage buf = std::move(slot.message);
+                slot.message.setAction(CMD_IGNORE);  // clear out the action
                 lock.unlock();  // don't keep a lock while calling a callback
-                sendFunction(std::move(buf));
+                state->sendFunction(std::move(buf));
             }
         }
     }
 }
 
+void MessageTimer::setSpinWindow(std::chrono::nanoseconds window)
+{
+    state->spinWindow.store((window.count() > 0) ? window : std::chrono::nanoseconds(0));
+    driver->wake();
+}
+
+std::size_t MessageTimer::slotCount() const
+{
+    std::lock_guard<std::mutex> lock(state->timerLock);
+    return state->slots.size();
+}
+
+void sleepUntilPrecise(std::chrono::steady_clock::time_point deadline,
+                       std::chrono::nanoseconds spinWindow)
+{
+    if (spinWindow.count() <= 0) {
+        std::this_thread::sleep_until(deadline);
+        return;
+    }
+    auto wake = deadline - spinWindow;
+    if (std::chrono::steady_clock::now() < wake) {
+        std::this_thread::sleep_until(wake);
+    }
+    while (std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+}
+
 }  // namespace helics
@@ -6,21 +6,26 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 
-#include "../common/AsioContextManager.h"
 #include "ActionMessage.hpp"
 
-#include <asio/steady_timer.hpp>
+#include <chrono>
+#include <functional>
 #include <memory>
-#include <mutex>
-#include <vector>
 
 namespace helics {
 /** class containing a message timer for sending messages at particular points in time
- */
-class MessageTimer: public std::enable_shared_from_this<MessageTimer> {
+@details timers are held in a hierarchical timing wheel,  the storage for timers that have been
+released is reused by later timers.  The wheels of all the message timers in a process are serviced
+by a single driver thread*/
+class MessageTimer {
   public:
     using time_type = decltype(std::chrono::steady_clock::now());
     explicit MessageTimer(std::function<void(ActionMessage&&)> sFunction);
+    /** destructor waits for any message being sent by the driver thread unless called from
+    within the send function*/
+    ~MessageTimer();
+    MessageTimer(const MessageTimer&) = delete;
+    MessageTimer& operator=(const MessageTimer&) = delete;
     /** add a timer and message to the queue
     @return an index for referencing the timer in the future*/
     int32_t addTimerFromNow(std::chrono::nanoseconds time, ActionMessage mess);
@@ -31,6 +36,8 @@ class MessageTimer: public std::enable_shared_from_this<MessageTimer> {
     void cancelTimer(int32_t index);
     /** cancel all timers*/
     void cancelAll();
+    /** cancel a timer and allow its index to be reused by a later call to addTimer*/
+    void releaseTimer(int32_t index);
     /** update the message time of a timer and its message*/
     void updateTimer(int32_t timerIndex, time_type expirationTime, ActionMessage mess);
     /** update the message time of a timer keeping its message the same
@@ -45,17 +52,23 @@ class MessageTimer: public std::enable_shared_from_this<MessageTimer> {
     void updateMessage(int32_t timerIndex, ActionMessage mess);
     /** execute the send function associated with a message*/
     void sendMessage(int32_t timerIndex);
+    /** set the period before an expiration in which the driver spins instead of sleeping
+    @details a non-zero window trades cpu usage for more precise delivery of messages*/
+    void setSpinWindow(std::chrono::nanoseconds window);
+    /** get the number of timer slots that have been allocated*/
+    std::size_t slotCount() const;
 
   private:
-    std::mutex timerLock;  //!< lock protecting the timer buffers
-    std::vector<ActionMessage> buffers;
-    std::vector<time_type> expirationTimes;
-    const std::function<void(ActionMessage&&)>
-        sendFunction;  //!< the callback to use when sending a message
-    std::vector<std::shared_ptr<asio::steady_timer>> timers;
-    std::shared_ptr<AsioContextManager>
-        contextPtr;  //!< context manager to for handling real time operations
-    decltype(contextPtr->startContextLoop())
-        loopHandle;  //!< loop controller for async real time operations
+    struct TimerState;
+    class TimerDriver;
+    /// the timer storage, shared with the driver thread while it is sending messages
+    std::shared_ptr<TimerState> state;
+    std::shared_ptr<TimerDriver> driver;  //!< the driver shared by all the timers of a process
 };
+
+/** wait until a particular time
+@details sleeps until the spin window before the deadline then yields until the deadline,  a zero
+window is a plain sleep*/
+void sleepUntilPrecise(std::chrono::steady_clock::time_point deadline,
+                       std::chrono::nanoseconds spinWindow);
 }  // namespace helics
@@ -7,6 +7,8 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "PublicationInfo.hpp"
 
+#include "deltaEncoding.hpp"
+
 #include <algorithm>
 #include <string_view>
 
@@ -20,6 +22,24 @@ bool PublicationInfo::CheckSetValue(const char* dataToCheck, uint64_t len)
     return false;
 }
 
+bool PublicationInfo::generateDelta(const char* dataToSend,
+                                    uint64_t len,
+                                    std::size_t subscriberCount,
+                                    SmallBuffer& delta)
+{
+    bool useDelta{false};
+    // a changed set of subscribers means some receiver may not have the base value
+    if (!keyframe_required && subscriberCount == delta_subscriber_count &&
+        deltas_since_keyframe < keyframe_interval) {
+        useDelta = generateDataDelta(last_transmitted, std::string_view(dataToSend, len), delta);
+    }
+    deltas_since_keyframe = (useDelta) ? deltas_since_keyframe + 1 : 0;
+    keyframe_required = false;
+    delta_subscriber_count = subscriberCount;
+    last_transmitted.assign(dataToSend, len);
+    return useDelta;
+}
+
 bool PublicationInfo::addSubscriber(GlobalHandle newSubscriber)
 {
     for (const auto& sub : subscribers) {
@@ -28,6 +48,7 @@ bool PublicationInfo::addSubscriber(GlobalHandle newSubscriber)
         }
     }
     subscribers.push_back(newSubscriber);
+    keyframe_required = true;
     return true;
 }
 
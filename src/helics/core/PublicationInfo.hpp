@@ -6,6 +6,7 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 
+#include "SmallBuffer.hpp"
 #include "global_federate_id.hpp"
 
 #include <cstdint>
@@ -36,8 +37,25 @@ class PublicationInfo {
     bool required{false};  //!< indicator that it is required to be output someplace
     bool buffer_data{false};  //!< indicator that the publication should buffer data
     int32_t required_connections{0};  //!< the number of required connections 0 is no requirement
+    bool transmit_deltas{false};  //!< indicator that the publication should transmit deltas
+    bool keyframe_required{true};  //!< indicator that the next value must be transmitted in full
+    int32_t keyframe_interval{0};  //!< the number of deltas to transmit between full values
+    int32_t deltas_since_keyframe{0};  //!< the number of deltas transmitted since a full value
+    std::size_t delta_subscriber_count{0};  //!< the number of subscribers at the last transmission
+    std::string last_transmitted;  //!< the most recently transmitted value used as the delta base
     /** check the value if it is the same as the most recent data and if changed, store it*/
     bool CheckSetValue(const char* dataToCheck, uint64_t len);
+    /** generate a delta of a value against the most recently transmitted value
+    @param dataToSend the new value
+    @param len the length of the value
+    @param subscriberCount the number of subscribers the value will be transmitted to
+    @param delta the buffer to store the delta in
+    @return true if the delta should be transmitted,  false if the full value should be
+    */
+    bool generateDelta(const char* dataToSend,
+                       uint64_t len,
+                       std::size_t subscriberCount,
+                       SmallBuffer& delta);
     /** add a new subscriber to the publication
 @return true if the subscriber was added false if duplicate
 */
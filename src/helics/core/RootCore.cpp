@@ -0,0 +1,129 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "RootCore.hpp"
+
+#include "CoreBroker.hpp"
+#include "fmt/format.h"
+
+#include <string>
+#include <utility>
+
+namespace helics {
+/** the root broker logic executed without a processing thread
+@details messages for the core are placed directly in the core action queue*/
+class RootCore::RootBroker final: public CoreBroker {
+  public:
+    explicit RootBroker(RootCore* core) noexcept: CoreBroker(true, true), rootCore(core) {}
+    /** process a command and everything generated from it*/
+    void process(ActionMessage&& command)
+    {
+        addActionMessage(std::move(command));
+        processQueuedCommands();
+    }
+    /** process the commands generated outside of the processing of a message*/
+    void processPending() { processQueuedCommands(); }
+
+    virtual std::string generateLocalAddressString() const override { return getIdentifier(); }
+
+  protected:
+    virtual void transmit(route_id rid, const ActionMessage& cmd) override
+    {
+        // the root has no parent and the core is the only connection
+        if (rid != parent_route_id) {
+            rootCore->addActionMessage(cmd);
+        }
+    }
+    virtual void transmit(route_id rid, ActionMessage&& cmd) override
+    {
+        if (rid != parent_route_id) {
+            rootCore->addActionMessage(std::move(cmd));
+        }
+    }
+    virtual void addRoute(route_id /*rid*/,
+                          int /*interfaceId*/,
+                          const std::string& /*routeInfo*/) override
+    {
+    }
+    virtual void removeRoute(route_id /*rid*/) override {}
+    virtual bool tryReconnect() override { return false; }
+
+  private:
+    virtual bool brokerConnect() override { return true; }
+    virtual void brokerDisconnect() override {}
+
+    RootCore* rootCore;  //!< the core receiving the messages from the root
+};
+
+RootCore::RootCore() noexcept = default;
+
+RootCore::RootCore(const std::string& coreName): CommonCore(coreName) {}
+
+RootCore::~RootCore()
+{
+    haltOperations = true;
+    // the core thread must be finished before the root it transmits to is removed
+    joinAllThreads();
+    std::lock_guard<std::mutex> lock(rootLock);
+    root.reset();
+}
+
+std::string RootCore::generateLocalAddressString() const
+{
+    return getIdentifier();
+}
+
+bool RootCore::brokerConnect()
+{
+    std::lock_guard<std::mutex> lock(rootLock);
+    if (!root) {
+        root = std::make_unique<RootBroker>(this);
+        root->setLoggerFunction(
+            [this](int level, std::string_view name, std::string_view message) {
+                sendToLogger(parent_broker_id, level, name, message);
+            });
+        root->setIdentifier(getIdentifier() + "_root");
+        root->configure(fmt::format("--federates={} --max_iterations={}",
+                                    minFederateCount,
+                                    maxIterationCount));
+        root->setLogLevels(consoleLogLevel, fileLogLevel);
+    }
+    if (!root->connect()) {
+        return false;
+    }
+    root->processPending();
+    return true;
+}
+
+void RootCore::brokerDisconnect()
+{
+    // the root disconnects itself once the core disconnect message is processed
+}
+
+bool RootCore::tryReconnect()
+{
+    return false;
+}
+
+void RootCore::transmit(route_id /*rid*/, const ActionMessage& cmd)
+{
+    transmit(parent_route_id, ActionMessage(cmd));
+}
+
+void RootCore::transmit(route_id /*rid*/, ActionMessage&& cmd)
+{
+    // the root is the only connection of the core so all messages go to it
+    std::lock_guard<std::mutex> lock(rootLock);
+    if (root) {
+        root->process(std::move(cmd));
+    }
+}
+
+void RootCore::addRoute(route_id /*rid*/, int /*interfaceId*/, const std::string& /*routeInfo*/) {}
+
+void RootCore::removeRoute(route_id /*rid*/) {}
+
+}  // namespace helics
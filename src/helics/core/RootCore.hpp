@@ -0,0 +1,48 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "CommonCore.hpp"
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace helics {
+/** a core acting as the root of the federation itself
+@details the name resolution, time coordination and root queries normally handled by a separate
+broker are executed directly on the thread transmitting the message to the root,  so there is no
+broker object, processing thread, or communication layer between the core and the root.  All the
+federates of the federation must use the same core*/
+class RootCore final: public CommonCore {
+  public:
+    /** default constructor*/
+    RootCore() noexcept;
+    /** construct from a core name*/
+    explicit RootCore(const std::string& coreName);
+    /** destructor*/
+    ~RootCore();
+
+    virtual std::string generateLocalAddressString() const override;
+
+  protected:
+    virtual void transmit(route_id rid, const ActionMessage& cmd) override;
+    virtual void transmit(route_id rid, ActionMessage&& cmd) override;
+    virtual void addRoute(route_id rid, int interfaceId, const std::string& routeInfo) override;
+    virtual void removeRoute(route_id rid) override;
+    virtual bool tryReconnect() override;
+
+  private:
+    class RootBroker;
+    virtual bool brokerConnect() override;
+    virtual void brokerDisconnect() override;
+
+    std::unique_ptr<RootBroker> root;  //!< the root of the federation
+    std::mutex rootLock;  //!< lock serializing the processing of the root
+};
+
+}  // namespace helics
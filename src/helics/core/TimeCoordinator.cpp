@@ -385,6 +385,18 @@ Time TimeCoordinator::generateAllowedTime(Time testTime) const
     return testTime;
 }
 
+Time TimeCoordinator::getSpeculativeGrantTime(Time testTime, Time speculativeTime) const
+{
+    auto step = std::max(info.timeDelta, info.period);
+    if (speculativeTime >= Time::maxVal() - step) {
+        return Time::maxVal();
+    }
+    if (testTime < speculativeTime + step) {
+        testTime = speculativeTime + step;
+    }
+    return generateAllowedTime(testTime);
+}
+
 void TimeCoordinator::updateMessageTime(Time messageUpdateTime, bool allowRequestSend)
 {
     if (!executionMode)  // updates before exec mode
@@ -123,6 +123,13 @@ class TimeCoordinator {
     Time getGrantedTime() const { return time_granted; }
     /** get the current granted time*/
     Time allowedSendTime() const { return time_granted + info.outputDelay; }
+    /** get the time an optimistic federate could speculatively advance to
+    @details the time is aligned with the period and time delta the same way a granted time would be
+    but ignores the dependencies, it is never less than the next step after speculativeTime
+    @param testTime the desired time
+    @param speculativeTime the current speculative time of the federate
+    */
+    Time getSpeculativeGrantTime(Time testTime, Time speculativeTime) const;
     /** get a list of actual dependencies*/
     std::vector<GlobalFederateId> getDependencies() const;
     /** get a reference to the dependents vector*/
@@ -0,0 +1,157 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "TimingWheel.hpp"
+
+#include <algorithm>
+
+namespace helics {
+TimingWheel::TimingWheel(time_type startTime, std::chrono::nanoseconds tickSize):
+    start(startTime), tick((tickSize.count() > 0) ? tickSize : std::chrono::nanoseconds(1))
+{
+}
+
+std::uint64_t TimingWheel::tickOf(time_type time) const
+{
+    if (time <= start) {
+        return 0;
+    }
+    return static_cast<std::uint64_t>((time - start) / tick);
+}
+
+TimingWheel::time_type TimingWheel::tickTime(std::uint64_t tickCount) const
+{
+    return start + tick * static_cast<std::int64_t>(tickCount);
+}
+
+void TimingWheel::schedule(std::int32_t index, std::uint32_t generation, time_type expiration)
+{
+    insert(Entry{tickOf(expiration), expiration, index, generation});
+    ++entryCount;
+}
+
+void TimingWheel::insert(const Entry& entry)
+{
+    auto entryTick = (std::max)(entry.tick, currentTick);
+    for (int level = 0; level < levelCount; ++level) {
+        auto shift = levelBits * level;
+        if ((entryTick >> shift) - (currentTick >> shift) < slotCount) {
+            levels[level][(entryTick >> shift) & slotMask].push_back(entry);
+            ++levelCounts[level];
+            return;
+        }
+    }
+    overflow.push_back(entry);
+}
+
+void TimingWheel::cascade()
+{
+    for (int level = levelCount - 1; level > 0; --level) {
+        auto shift = levelBits * level;
+        if ((currentTick & ((std::uint64_t{1} << shift) - 1)) != 0) {
+            continue;
+        }
+        if (level == levelCount - 1 && !overflow.empty()) {
+            scratch.swap(overflow);
+            for (const auto& entry : scratch) {
+                insert(entry);
+            }
+            scratch.clear();
+        }
+        auto& bucket = levels[level][(currentTick >> shift) & slotMask];
+        if (!bucket.empty()) {
+            levelCounts[level] -= bucket.size();
+            scratch.swap(bucket);
+            for (const auto& entry : scratch) {
+                insert(entry);
+            }
+            scratch.clear();
+        }
+    }
+}
+
+std::uint64_t TimingWheel::nextBoundary() const
+{
+    // ticks before the next boundary of the lowest occupied level have nothing to process
+    int level{0};
+    while (level < levelCount - 1 && levelCounts[level] == 0) {
+        ++level;
+    }
+    auto shift = levelBits * level;
+    return ((currentTick >> shift) + 1) << shift;
+}
+
+void TimingWheel::advance(time_type now, std::vector<Entry>& expired)
+{
+    auto nowTick = tickOf(now);
+    while (true) {
+        auto& bucket = levels[0][currentTick & slotMask];
+        if (!bucket.empty()) {
+            auto split =
+                std::partition(bucket.begin(), bucket.end(), [now](const Entry& entry) {
+                    return entry.expiration > now;
+                });
+            auto count = static_cast<std::size_t>(bucket.end() - split);
+            expired.insert(expired.end(), split, bucket.end());
+            bucket.erase(split, bucket.end());
+            levelCounts[0] -= count;
+            entryCount -= count;
+        }
+        if (currentTick >= nowTick) {
+            break;
+        }
+        if (entryCount == 0) {
+            currentTick = nowTick;
+            break;
+        }
+        auto next = nextBoundary();
+        if (next > nowTick) {
+            currentTick = nowTick;
+        } else {
+            currentTick = next;
+            cascade();
+        }
+    }
+}
+
+TimingWheel::time_type TimingWheel::nextExpiration() const
+{
+    if (entryCount == 0) {
+        return time_type::max();
+    }
+    if (levelCounts[0] > 0) {
+        auto blockEnd = ((currentTick >> levelBits) + 1) << levelBits;
+        for (auto tickIndex = currentTick; tickIndex < blockEnd; ++tickIndex) {
+            const auto& bucket = levels[0][tickIndex & slotMask];
+            if (!bucket.empty()) {
+                auto first = std::min_element(bucket.begin(),
+                                              bucket.end(),
+                                              [](const Entry& entry1, const Entry& entry2) {
+                                                  return entry1.expiration < entry2.expiration;
+                                              });
+                return first->expiration;
+            }
+        }
+        return tickTime(blockEnd);
+    }
+    // the upper levels are redistributed at the next boundary
+    return tickTime(nextBoundary());
+}
+
+void TimingWheel::clear()
+{
+    for (auto& level : levels) {
+        for (auto& bucket : level) {
+            bucket.clear();
+        }
+    }
+    overflow.clear();
+    levelCounts.fill(0);
+    entryCount = 0;
+}
+
+}  // namespace helics
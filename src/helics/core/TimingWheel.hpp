@@ -0,0 +1,76 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace helics {
+/** a hierarchical timing wheel for locating timers that have expired
+@details entries are stored in four levels of 64 buckets with each level covering 64 times the span
+of the level below,  entries beyond the span of the top level are held in an overflow list until
+they come into range.  Entries carry an index and generation supplied by the user,  entries are
+never removed when a timer is changed so the user must check the generation of expired entries and
+discard any that are stale*/
+class TimingWheel {
+  public:
+    using time_type = std::chrono::steady_clock::time_point;
+    /** an entry in the wheel*/
+    struct Entry {
+        std::uint64_t tick{0};  //!< the tick the entry expires in
+        time_type expiration;  //!< the expiration time of the entry
+        std::int32_t index{0};  //!< the user index of the timer
+        std::uint32_t generation{0};  //!< the user generation of the timer
+    };
+    /** construct the wheel
+    @param startTime the time of tick 0
+    @param tickSize the resolution of the buckets*/
+    TimingWheel(time_type startTime, std::chrono::nanoseconds tickSize);
+    /** add an entry to the wheel*/
+    void schedule(std::int32_t index, std::uint32_t generation, time_type expiration);
+    /** remove all entries that expire at or before a given time
+    @param now the current time
+    @param expired a vector the removed entries are appended to*/
+    void advance(time_type now, std::vector<Entry>& expired);
+    /** get the time the wheel next needs to be advanced
+    @details this is the earliest expiration in the current block of buckets of the lowest level or
+    the next point the upper levels are redistributed if those are empty,  time_type::max() if
+    there are no entries*/
+    time_type nextExpiration() const;
+    /** get the number of entries in the wheel*/
+    std::size_t size() const { return entryCount; }
+    /** remove all the entries*/
+    void clear();
+
+  private:
+    static constexpr int levelBits{6};
+    static constexpr std::uint64_t slotCount{1U << levelBits};
+    static constexpr std::uint64_t slotMask{slotCount - 1};
+    static constexpr int levelCount{4};
+    /** get the tick containing a time*/
+    std::uint64_t tickOf(time_type time) const;
+    /** get the start time of a tick*/
+    time_type tickTime(std::uint64_t tick) const;
+    /** place an entry in the appropriate bucket*/
+    void insert(const Entry& entry);
+    /** redistribute the upper level buckets as the current tick crosses their boundaries*/
+    void cascade();
+    /** get the next tick at which entries need to be processed or redistributed*/
+    std::uint64_t nextBoundary() const;
+
+    time_type start;  //!< the time of tick 0
+    std::chrono::nanoseconds tick;  //!< the duration of a tick
+    std::uint64_t currentTick{0};  //!< all entries from earlier ticks have been removed
+    std::size_t entryCount{0};  //!< the number of entries in the wheel
+    std::array<std::array<std::vector<Entry>, slotCount>, levelCount> levels;  //!< the buckets
+    std::array<std::size_t, levelCount> levelCounts{};  //!< the number of entries in each level
+    std::vector<Entry> overflow;  //!< entries beyond the span of the top level
+    std::vector<Entry> scratch;  //!< storage for entries being redistributed
+};
+}  // namespace helics
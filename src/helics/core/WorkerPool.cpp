@@ -0,0 +1,49 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "WorkerPool.hpp"
+
+#include <utility>
+
+namespace helics {
+WorkerPool::WorkerPool(int threadCount)
+{
+    auto count = (threadCount > 0) ? static_cast<std::size_t>(threadCount) : std::size_t{1};
+    workers.reserve(count);
+    for (std::size_t ii = 0; ii < count; ++ii) {
+        auto worker = std::make_unique<Worker>();
+        auto* queue = &(worker->tasks);
+        worker->thread = std::thread([queue]() {
+            while (true) {
+                auto task = queue->pop();
+                // an empty task is the signal to halt
+                if (!task) {
+                    break;
+                }
+                task();
+            }
+        });
+        workers.push_back(std::move(worker));
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    for (auto& worker : workers) {
+        worker->tasks.push(std::function<void()>{});
+    }
+    for (auto& worker : workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+void WorkerPool::post(std::size_t key, std::function<void()> task)
+{
+    workers[key % workers.size()]->tasks.push(std::move(task));
+}
+}  // namespace helics
@@ -0,0 +1,46 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "gmlc/containers/BlockingQueue.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace helics {
+/** a fixed set of worker threads for executing filter operators and callback federates off the
+core processing loop
+@details each worker has its own queue and tasks are assigned to a worker by a key,  so all
+tasks posted with the same key are executed in the order they were posted*/
+class WorkerPool {
+  public:
+    /** construct the pool
+    @param threadCount the number of worker threads to start, at least one is always started*/
+    explicit WorkerPool(int threadCount);
+    /** destructor finishes any queued tasks then joins the worker threads*/
+    ~WorkerPool();
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+    /** post a task for execution
+    @param key tasks with the same key are executed sequentially on the same worker
+    @param task the operation to execute*/
+    void post(std::size_t key, std::function<void()> task);
+    /** get the number of worker threads*/
+    std::size_t size() const { return workers.size(); }
+
+  private:
+    /** a thread and the queue of tasks it executes*/
+    struct Worker {
+        gmlc::containers::BlockingQueue<std::function<void()>> tasks;  //!< the pending tasks
+        std::thread thread;  //!< the thread executing the tasks
+    };
+    std::vector<std::unique_ptr<Worker>> workers;  //!< the worker threads
+};
+}  // namespace helics
@@ -44,6 +44,8 @@ namespace core {
                 return "nng_";
             case CoreType::INPROC:
                 return "inproc_";
+            case CoreType::ROOT:
+                return "root_";
             case CoreType::WEBSOCKET:
                 return "websocket_";
             case CoreType::NULLCORE:
@@ -98,6 +100,9 @@ namespace core {
         {"websocket", CoreType::WEBSOCKET},
         {"web", CoreType::WEBSOCKET},
         {"inproc", CoreType::INPROC},
+        {"root", CoreType::ROOT},
+        {"rootcore", CoreType::ROOT},
+        {"root_core", CoreType::ROOT},
         {"nng", CoreType::NNG},
         {"null", CoreType::NULLCORE},
         {"nullcore", CoreType::NULLCORE},
@@ -238,6 +243,9 @@ namespace core {
             case CoreType::INPROC:
                 available = inproc_availability;
                 break;
+            case CoreType::ROOT:  // the root core has no external dependencies
+                available = true;
+                break;
             case CoreType::HTTP:
             case CoreType::WEBSOCKET:
             case CoreType::NULLCORE:
@@ -0,0 +1,114 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "deltaEncoding.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace helics {
+/** the granularity of the comparison*/
+static constexpr std::size_t blockSize{8};
+/** the delta header contains the base length and the value length*/
+static constexpr std::size_t headerSize{8};
+/** each run contains an offset and a length*/
+static constexpr std::size_t runHeaderSize{8};
+/** values smaller than this are always transmitted in full*/
+static constexpr std::size_t minimumDeltaValueSize{64};
+
+static void writeLength(std::byte* loc, std::size_t value)
+{
+    auto val = static_cast<std::uint32_t>(value);
+    loc[0] = static_cast<std::byte>((val >> 24U) & 0xFFU);
+    loc[1] = static_cast<std::byte>((val >> 16U) & 0xFFU);
+    loc[2] = static_cast<std::byte>((val >> 8U) & 0xFFU);
+    loc[3] = static_cast<std::byte>(val & 0xFFU);
+}
+
+static std::size_t readLength(const char* loc)
+{
+    const auto* bytes = reinterpret_cast<const unsigned char*>(loc);
+    return (static_cast<std::size_t>(bytes[0]) << 24U) |
+        (static_cast<std::size_t>(bytes[1]) << 16U) | (static_cast<std::size_t>(bytes[2]) << 8U) |
+        static_cast<std::size_t>(bytes[3]);
+}
+
+bool generateDataDelta(std::string_view base, std::string_view data, SmallBuffer& delta)
+{
+    if (base.size() != data.size() || data.size() < minimumDeltaValueSize ||
+        data.size() > std::numeric_limits<std::uint32_t>::max()) {
+        return false;
+    }
+    // a delta larger than half the value is not worth the reconstruction
+    const std::size_t limit = data.size() / 2;
+    delta.reserve(limit);
+    delta.resize(headerSize);
+    writeLength(delta.data(), base.size());
+    writeLength(delta.data() + 4, data.size());
+
+    std::size_t runStart{0};
+    std::size_t runEnd{0};
+    bool inRun{false};
+    auto flushRun = [&]() {
+        auto loc = delta.size();
+        auto runLength = runEnd - runStart;
+        if (loc + runHeaderSize + runLength > limit) {
+            return false;
+        }
+        delta.resize(loc + runHeaderSize + runLength);
+        writeLength(delta.data() + loc, runStart);
+        writeLength(delta.data() + loc + 4, runLength);
+        std::memcpy(delta.data() + loc + runHeaderSize, data.data() + runStart, runLength);
+        return true;
+    };
+    for (std::size_t offset = 0; offset < data.size(); offset += blockSize) {
+        auto len = (std::min)(blockSize, data.size() - offset);
+        if (std::memcmp(base.data() + offset, data.data() + offset, len) == 0) {
+            continue;
+        }
+        // a gap of a single block costs the same as a new run header so merge it
+        if (inRun && offset <= runEnd + blockSize) {
+            runEnd = offset + len;
+            continue;
+        }
+        if (inRun && !flushRun()) {
+            return false;
+        }
+        runStart = offset;
+        runEnd = offset + len;
+        inRun = true;
+    }
+    return (inRun) ? flushRun() : true;
+}
+
+bool applyDataDelta(std::string_view base, std::string_view delta, SmallBuffer& result)
+{
+    if (delta.size() < headerSize || readLength(delta.data()) != base.size()) {
+        return false;
+    }
+    auto valueSize = readLength(delta.data() + 4);
+    if (valueSize != base.size()) {
+        return false;
+    }
+    result.assign(base.data(), base.size());
+    std::size_t loc{headerSize};
+    while (loc < delta.size()) {
+        if (loc + runHeaderSize > delta.size()) {
+            return false;
+        }
+        auto offset = readLength(delta.data() + loc);
+        auto runLength = readLength(delta.data() + loc + 4);
+        loc += runHeaderSize;
+        if (loc + runLength > delta.size() || offset + runLength > valueSize) {
+            return false;
+        }
+        std::memcpy(result.data() + offset, delta.data() + loc, runLength);
+        loc += runLength;
+    }
+    return true;
+}
+}  // namespace helics
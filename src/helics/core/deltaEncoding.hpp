@@ -0,0 +1,41 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "SmallBuffer.hpp"
+
+#include <cstdint>
+#include <string_view>
+
+/** @file
+functions for generating and applying byte level deltas between successive values of a
+publication
+*/
+namespace helics {
+/** the default number of deltas transmitted between full values of a publication*/
+constexpr int32_t defaultDeltaKeyframeInterval{50};
+
+/** generate a delta containing the changed regions between two values of the same size
+@details the values are compared in 8 byte blocks and each run of changed blocks is stored with
+its offset,  nearly adjacent runs are merged
+@param base the value the receiver is known to have
+@param data the new value
+@param delta the buffer to store the delta in
+@return true if a delta was generated,  false if the delta would not be sufficiently smaller than
+the full value and the full value should be transmitted instead
+*/
+bool generateDataDelta(std::string_view base, std::string_view data, SmallBuffer& delta);
+
+/** reconstruct a value from a previous value and a delta
+@param base the value the delta was generated against
+@param delta the delta generated by generateDataDelta
+@param result the buffer to store the reconstructed value in
+@return true if the value was reconstructed,  false if the delta does not match the base or is
+malformed
+*/
+bool applyDataDelta(std::string_view base, std::string_view delta, SmallBuffer& result);
+}  // namespace helics
@@ -51,6 +51,9 @@ constexpr uint16_t non_counting_flag = nameless_interface_flag;
 constexpr uint16_t targetted_flag =
     extra_flag2;  //!< overload of extra_flag2 indicating an endpoint is targeted
 
+/// overload of extra_flag2 indicating a publication payload is a delta from the previous value
+constexpr uint16_t delta_data_flag = extra_flag2;
+
 constexpr uint16_t filter_processing_required_flag =
     extra_flag1;  // overload of extra_flag1 indicating that the message requires processing for
                   // filters yet
@@ -58,6 +61,9 @@ constexpr uint16_t filter_processing_required_flag =
 /// overload of extra_flag1 to indicate the request is from a non-granting federate
 constexpr uint16_t non_granting_flag = extra_flag1;
 
+/// overload of extra_flag1 indicating the parent wants notices when the queried map changes
+constexpr uint16_t map_subscription_flag = extra_flag1;
+
 /** template function to set a flag in an object containing a flags field
 @tparam FlagContainer an object with a .flags field
 @tparam FlagIndex a type that can be used as part of a shift to index into a flag object
@@ -54,6 +54,8 @@ namespace defs {
         FORWARD_COMPUTE = HELICS_FLAG_FORWARD_COMPUTE,
         /** flag indicating that a federate needs to run in real time*/
         REALTIME = HELICS_FLAG_REALTIME,
+        /** flag indicating that unchanged values should not trigger iterations*/
+        DETECT_CONVERGENCE = HELICS_FLAG_DETECT_CONVERGENCE,
         /** flag indicating that the federate will only interact on a single thread*/
         SINGLE_THREAD_FEDERATE = HELICS_FLAG_SINGLE_THREAD_FEDERATE,
         /** used to delay a core from entering initialization mode even if it would otherwise be
@@ -118,6 +120,7 @@ namespace defs {
         RT_LAG = HELICS_PROPERTY_TIME_RT_LAG,
         RT_LEAD = HELICS_PROPERTY_TIME_RT_LEAD,
         RT_TOLERANCE = HELICS_PROPERTY_TIME_RT_TOLERANCE,
+        RT_SPIN = HELICS_PROPERTY_TIME_RT_SPIN,
         INPUT_DELAY = HELICS_PROPERTY_TIME_INPUT_DELAY,
         OUTPUT_DELAY = HELICS_PROPERTY_TIME_OUTPUT_DELAY,
         MAX_ITERATIONS = HELICS_PROPERTY_INT_MAX_ITERATIONS,
@@ -134,6 +137,7 @@ namespace defs {
         MULTIPLE_CONNECTIONS_ALLOWED = HELICS_HANDLE_OPTION_MULTIPLE_CONNECTIONS_ALLOWED,
         HANDLE_ONLY_TRANSMIT_ON_CHANGE = HELICS_HANDLE_OPTION_ONLY_TRANSMIT_ON_CHANGE,
         HANDLE_ONLY_UPDATE_ON_CHANGE = HELICS_HANDLE_OPTION_ONLY_UPDATE_ON_CHANGE,
+        TRANSMIT_DELTAS = HELICS_HANDLE_OPTION_TRANSMIT_DELTAS,
         BUFFER_DATA = HELICS_HANDLE_OPTION_BUFFER_DATA,
         IGNORE_INTERRUPTS = HELICS_HANDLE_OPTION_IGNORE_INTERRUPTS,
         STRICT_TYPE_CHECKING = HELICS_HANDLE_OPTION_STRICT_TYPE_CHECKING,
@@ -75,8 +75,13 @@ enum LogLevels : int {
             if (maxLogLevel >= LogLevels::TRACE) {                                                 \
                 sendToLogger(id, LogLevels::TRACE, ident, message);                                \
             }
+#        define LOG_TRACE_COMMAND(id, ident, prefix, command, showDest)                            \
+            if (maxLogLevel >= LogLevels::TRACE) {                                                 \
+                logCommand(id, LogLevels::TRACE, ident, prefix, command, showDest);                \
+            }
 #    else
 #        define LOG_TRACE(id, ident, message)
+#        define LOG_TRACE_COMMAND(id, ident, prefix, command, showDest)
 #    endif
 #else
 #    define LOG_SUMMARY(id, ident, message)
@@ -85,4 +90,5 @@ enum LogLevels : int {
 #    define LOG_TIMING(id, ident, message)
 #    define LOG_DATA_MESSAGES(id, ident, message)
 #    define LOG_TRACE(id, ident, message)
+#    define LOG_TRACE_COMMAND(id, ident, prefix, command, showDest)
 #endif
@@ -52,6 +52,9 @@ typedef enum {
                                      memory it is pretty similar to the test core but stripped from
                                      the "test" components*/
     HELICS_CORE_TYPE_INPROC = 18,
+    /** an in process core acting as the root of the federation itself with no separate broker,
+       all federates must use the same core*/
+    HELICS_CORE_TYPE_ROOT = 19,
     /** an explicit core type that is recognized but explicitly doesn't
                                   exist, for testing and a few other assorted reasons*/
     HELICS_CORE_TYPE_NULL = 66
@@ -118,6 +121,10 @@ typedef enum {
     HELICS_FLAG_FORWARD_COMPUTE = 14,
     /** flag indicating that a federate needs to run in real time*/
     HELICS_FLAG_REALTIME = 16,
+    /** flag indicating that values received during an iteration that are not a change from the
+       previous value of the source should not trigger another iteration,  so iterative time
+       requests return NEXT_STEP once the federation has converged*/
+    HELICS_FLAG_DETECT_CONVERGENCE = 20,
     /** flag indicating that the federate will only interact on a single thread*/
     HELICS_FLAG_SINGLE_THREAD_FEDERATE = 27,
     /** used to not display warnings on mismatched requested times*/
@@ -231,6 +238,9 @@ typedef enum {
     /** the property controlling real time tolerance for a federate sets both rt_lag and
        rt_lead*/
     HELICS_PROPERTY_TIME_RT_TOLERANCE = 145,
+    /** the property controlling the period before a real time deadline in which a federate spins
+       instead of sleeping for more precise pacing, 0 disables spinning*/
+    HELICS_PROPERTY_TIME_RT_SPIN = 146,
     /** the property controlling input delay for a federate*/
     HELICS_PROPERTY_TIME_INPUT_DELAY = 148,
     /** the property controlling output delay for a federate*/
@@ -293,6 +303,10 @@ typedef enum {
     HELICS_HANDLE_OPTION_ONLY_TRANSMIT_ON_CHANGE = 452,
     /** specify that an interface will only update if the value has actually changed*/
     HELICS_HANDLE_OPTION_ONLY_UPDATE_ON_CHANGE = 454,
+    /** specify that a publication will transmit only the changed portions of its value between
+       periodic full values, a value greater than 1 sets the number of deltas between full values
+       (only applicable to publications)*/
+    HELICS_HANDLE_OPTION_TRANSMIT_DELTAS = 457,
     /** specify that an interface does not participate in determining time interrupts*/
     HELICS_HANDLE_OPTION_IGNORE_INTERRUPTS = 475,
     /** specify the multi-input processing method for inputs*/
@@ -7,6 +7,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #pragma once
 #include "helics/core/ActionMessage.hpp"
+#include "helics/core/DenseIdTable.hpp"
 
 #include <atomic>
 #include <memory>
@@ -48,6 +49,9 @@ class CommsBroker: public BrokerT {
     virtual void addRoute(route_id rid, int interfaceId, const std::string& routeInfo) override;
 
     virtual void removeRoute(route_id rid) override;
+
+    virtual void setCutThroughRoutes(const GlobalIdTable<route_id>& routes,
+                                     bool forwardUnknown) override;
     /** get a pointer to the comms object*/
     COMMS* getCommsObjectPointer();
 };
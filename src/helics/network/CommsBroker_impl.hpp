@@ -119,6 +119,13 @@ void CommsBroker<COMMS, BrokerT>::removeRoute(route_id rid)
     comms->removeRoute(rid);
 }
 
+template<class COMMS, class BrokerT>
+void CommsBroker<COMMS, BrokerT>::setCutThroughRoutes(const GlobalIdTable<route_id>& routes,
+                                                      bool forwardUnknown)
+{
+    comms->setCutThroughRoutes(routes, forwardUnknown);
+}
+
 template<class COMMS, class BrokerT>
 COMMS* CommsBroker<COMMS, BrokerT>::getCommsObjectPointer()
 {
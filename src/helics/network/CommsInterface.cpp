@@ -157,8 +157,24 @@ void CommsInterface::propertyUnLock()
     operating.compare_exchange_strong(exp, false);
 }
 
+bool CommsInterface::checkParentRoute(route_id& rid, const ActionMessage& cmd)
+{
+    if (rid == parent_route_id) {
+        rid = parentRoute.load();
+        return false;
+    }
+    if (rid == control_route && cmd.messageID == NEW_PARENT_ROUTE && isProtocolCommand(cmd)) {
+        parentRoute = route_id{cmd.getExtraData()};
+        return true;
+    }
+    return false;
+}
+
 void CommsInterface::transmit(route_id rid, const ActionMessage& cmd)
 {
+    if (checkParentRoute(rid, cmd)) {
+        return;
+    }
     if (isPriorityCommand(cmd)) {
         txQueue.emplacePriority(rid, cmd);
     } else {
@@ -168,6 +184,9 @@ void CommsInterface::transmit(route_id rid, const ActionMessage& cmd)
 
 void CommsInterface::transmit(route_id rid, ActionMessage&& cmd)
 {
+    if (checkParentRoute(rid, cmd)) {
+        return;
+    }
     if (isPriorityCommand(cmd)) {
         txQueue.emplacePriority(rid, std::move(cmd));
     } else {
@@ -192,6 +211,46 @@ void CommsInterface::removeRoute(route_id rid)
     transmit(control_route, rt);
 }
 
+void CommsInterface::setCutThroughRoutes(const GlobalIdTable<route_id>& routes, bool forwardUnknown)
+{
+    auto relay = relayRoutes.lock();
+    *relay = routes;
+    forwardUnknownRoutes = forwardUnknown;
+    cutThrough = !routes.empty();
+}
+
+std::size_t CommsInterface::relayMessage(const void* data, std::size_t size)
+{
+    if (!cutThrough.load(std::memory_order_relaxed)) {
+        return 0;
+    }
+    SerializedRoutingInfo info;
+    if (!readRoutingInfo(static_cast<const std::byte*>(data), size, info)) {
+        return 0;
+    }
+    // anything other than data with a known destination needs processing by the broker
+    if (info.action != CMD_PUB && info.action != CMD_SEND_MESSAGE) {
+        return 0;
+    }
+    if (info.dest_id == parent_broker_id) {
+        return 0;
+    }
+    route_id rid;
+    {
+        auto relay = relayRoutes.lock_shared();
+        const auto* route = relay->find(info.dest_id);
+        if (route != nullptr) {
+            rid = *route;
+        } else if (forwardUnknownRoutes) {
+            rid = parent_route_id;
+        } else {
+            return 0;
+        }
+    }
+    transmit(rid, createRelayCommand(info));
+    return info.frameSize;
+}
+
 void CommsInterface::setTxStatus(connection_status txStatus)
 {
     if (tx_status == txStatus) {
@@ -281,6 +340,9 @@ bool CommsInterface::connect()
     }
     if (!singleThread) {
         queue_watcher = std::thread([this] {
+            if (!applyThreadPlacement(threadPlacement)) {
+                logWarning("unable to set the processor affinity or priority of the receiver");
+            }
             try {
                 queue_rx_function();
             }
@@ -292,6 +354,9 @@ bool CommsInterface::connect()
     }
 
     queue_transmitter = std::thread([this] {
+        if (!applyThreadPlacement(threadPlacement)) {
+            logWarning("unable to set the processor affinity or priority of the transmitter");
+        }
         try {
             queue_tx_function();
         }
@@ -521,6 +586,14 @@ void CommsInterface::setTimeout(std::chrono::milliseconds timeOut)
     }
 }
 
+void CommsInterface::setThreadPlacement(const ThreadPlacement& placement)
+{
+    if (propertyLock()) {
+        threadPlacement = placement;
+        propertyUnLock();
+    }
+}
+
 void CommsInterface::setServerMode(bool serverActive)
 {
     if (propertyLock()) {
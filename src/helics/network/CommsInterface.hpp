@@ -6,11 +6,14 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 
+#include "../common/GuardedTypes.hpp"
+#include "../common/ThreadPlacement.hpp"
 #include "NetworkBrokerData.hpp"
 #include "gmlc/concurrency/TriggerVariable.hpp"
 #include "gmlc/concurrency/TripWire.hpp"
 #include "gmlc/containers/BlockingPriorityQueue.hpp"
 #include "helics/core/ActionMessage.hpp"
+#include "helics/core/DenseIdTable.hpp"
 
 #include <functional>
 #include <memory>
@@ -53,6 +56,12 @@ class CommsInterface {
     void addRoute(route_id rid, const std::string& routeInfo);
     /** remove a route from use*/
     void removeRoute(route_id rid);
+    /** set the routes used to forward data messages without passing them to the callback
+    @details publications and messages with a destination in the routes are transmitted in their
+    serialized form as soon as they are received
+    @param routes the route to each known federate,  an empty table disables forwarding
+    @param forwardUnknown set to true to forward messages for unknown federates to the parent*/
+    void setCutThroughRoutes(const GlobalIdTable<route_id>& routes, bool forwardUnknown);
     /** connect the commsInterface
     @return true if the connection was successful false otherwise
     */
@@ -89,6 +98,9 @@ class CommsInterface {
     virtual void setFlag(const std::string& flag, bool val);
     /** enable or disable the server mode for the comms*/
     void setServerMode(bool serverActive);
+    /** set the processors and priority of the transmit and receive threads
+    @details must be called before connect*/
+    void setThreadPlacement(const ThreadPlacement& placement);
 
     /** generate a log message as a warning*/
     void logWarning(const std::string& message) const;
@@ -128,6 +140,8 @@ class CommsInterface {
     gmlc::concurrency::TriggerVariable txTrigger;
     std::atomic<bool> operating{false};  //!< the comms interface is in startup mode
     const bool singleThread{false};  //!< specify that the interface should operate a single thread
+    std::atomic<route_id> parentRoute{
+        parent_route_id};  //!< the route used for messages sent to the parent broker
 
   protected:
     bool serverMode = true;  //!< some comms have a server mode and non-server mode
@@ -152,7 +166,11 @@ class CommsInterface {
   private:
     std::thread queue_transmitter;  //!< single thread for sending data
     std::thread queue_watcher;  //!< thread monitoring the receive queue
+    ThreadPlacement threadPlacement;  //!< processors and priority of the comms threads
     std::mutex threadSyncLock;  //!< lock to handle thread operations
+    /** redirect messages for the parent broker and process changes to the parent route
+    @return true if the message was a parent route update and should not be transmitted*/
+    bool checkParentRoute(route_id& rid, const ActionMessage& cmd);
     virtual void queue_rx_function() = 0;  //!< the functional loop for the receive queue
     virtual void queue_tx_function() = 0;  //!< the loop for transmitting data
     virtual void closeTransmitter();  //!< function to instruct the transmitter loop to close
@@ -172,10 +190,19 @@ class CommsInterface {
     void join_tx_rx_thread();
     /** get the generated randomID for this comm interface*/
     const std::string& getRandomID() const { return randomID; }
+    /** forward a received data message to its destination route without deserializing it
+    @param data the serialized or packetized message
+    @param size the number of bytes available
+    @return the number of bytes used if the message was forwarded, 0 if it needs processing*/
+    std::size_t relayMessage(const void* data, std::size_t size);
 
   private:
     gmlc::concurrency::TripWireDetector
         tripDetector;  //!< try to detect if everything is shutting down
+    std::atomic<bool> cutThrough{false};  //!< data messages are forwarded without processing
+    bool forwardUnknownRoutes{false};  //!< forward data for unknown federates to the parent
+    /// the routes for forwarding data messages
+    shared_guarded<GlobalIdTable<route_id>> relayRoutes;
 };
 
 namespace CommFactory {
@@ -6,6 +6,7 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 
+#include "../core/BrokerFactory.hpp"
 #include "../core/CoreTypes.hpp"
 #include "../core/helicsCLI11.hpp"
 #include "NetworkBroker.hpp"
@@ -76,6 +77,7 @@ bool NetworkBroker<COMMS, baseline, tcode>::brokerConnect()
     CommsBroker<COMMS, CoreBroker>::comms->setName(CoreBroker::getIdentifier());
     CommsBroker<COMMS, CoreBroker>::comms->loadNetworkInfo(netInfo);
     CommsBroker<COMMS, CoreBroker>::comms->setTimeout(BrokerBase::networkTimeout.to_ms());
+    CommsBroker<COMMS, CoreBroker>::comms->setThreadPlacement(BrokerBase::commsPlacement);
 
     auto res = CommsBroker<COMMS, CoreBroker>::comms->connect();
     if (res) {
@@ -120,4 +122,12 @@ std::string NetworkBroker<COMMS, baseline, tcode>::generateLocalAddressString()
     return add;
 }
 
+template<class COMMS, InterfaceTypes baseline, int tcode>
+std::shared_ptr<Broker>
+    NetworkBroker<COMMS, baseline, tcode>::generateSubBroker(const std::string& name,
+                                                             const std::string& configureString)
+{
+    return BrokerFactory::create(static_cast<CoreType>(tcode), name, configureString);
+}
+
 }  // namespace helics
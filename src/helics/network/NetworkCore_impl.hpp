@@ -54,6 +54,7 @@ bool NetworkCore<COMMS, baseline>::brokerConnect()
     CommsBroker<COMMS, CommonCore>::comms->setName(CommonCore::getIdentifier());
     CommsBroker<COMMS, CommonCore>::comms->loadNetworkInfo(netInfo);
     CommsBroker<COMMS, CommonCore>::comms->setTimeout(BrokerBase::networkTimeout.to_ms());
+    CommsBroker<COMMS, CommonCore>::comms->setThreadPlacement(BrokerBase::commsPlacement);
     // comms->setMessageSize(maxMessageSize, maxMessageCount);
     auto res = CommsBroker<COMMS, CommonCore>::comms->connect();
     if (res) {
@@ -9,6 +9,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "../core/BrokerFactory.hpp"
 #include "../core/CoreFactory.hpp"
+#include "../core/RootCore.hpp"
 #include "CommsInterface.hpp"
 #include "helics/helics-config.h"
 
@@ -146,6 +147,9 @@ static auto testcomm =
 
 #endif
 
+static auto rootc =
+    CoreFactory::addCoreType<RootCore>("root", static_cast<int>(CoreType::ROOT));
+
 bool loadCores()
 {
     return true;
@@ -65,6 +65,7 @@ namespace mpi {
         }
 
         comms->setName(getIdentifier());
+        comms->setThreadPlacement(commsPlacement);
 
         return comms->connect();
     }
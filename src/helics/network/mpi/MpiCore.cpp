@@ -62,6 +62,7 @@ namespace mpi {
         comms->setBrokerAddress(brokerAddress);
 
         comms->setName(getIdentifier());
+        comms->setThreadPlacement(commsPlacement);
 
         return comms->connect();
     }
@@ -70,6 +70,11 @@ namespace tcp {
     {
         size_t used_total = 0;
         while (used_total < bytes_received) {
+            auto relayed = relayMessage(data + used_total, bytes_received - used_total);
+            if (relayed > 0) {
+                used_total += relayed;
+                continue;
+            }
             ActionMessage m;
             auto used = m.depacketize(reinterpret_cast<const std::byte*>(data) + used_total,
                                       bytes_received - used_total);
@@ -442,6 +447,15 @@ namespace tcp {
                                          "::" + se.what());
                             }
                         }
+                        // fall back to the broker path if a direct route fails
+                        if (hasBroker && !isDisconnectCommand(cmd)) {
+                            routes.erase(rt_find);
+                            try {
+                                brokerConnection->send(cmd.packetize());
+                            }
+                            catch (const std::system_error&) {
+                            }
+                        }
                     }
                 } else {
                     if (hasBroker) {
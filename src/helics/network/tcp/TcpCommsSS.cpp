@@ -88,6 +88,11 @@ namespace tcp {
     {
         size_t used_total = 0;
         while (used_total < bytes_received) {
+            auto relayed = relayMessage(data + used_total, bytes_received - used_total);
+            if (relayed > 0) {
+                used_total += relayed;
+                continue;
+            }
             ActionMessage m;
             auto used = m.depacketize(reinterpret_cast<const std::byte*>(data) + used_total,
                                       bytes_received - used_total);
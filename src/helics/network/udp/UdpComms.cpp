@@ -137,6 +137,9 @@ namespace udp {
                     break;
                 }
             }
+            if (relayMessage(data.data(), len) > 0) {
+                continue;
+            }
             ActionMessage M(reinterpret_cast<std::byte*>(data.data()), len);
             if (!isValidCommand(M)) {
                 logWarning("invalid command received udp");
@@ -48,5 +48,11 @@ namespace zeromq {
         return NetworkBroker::brokerConnect();
     }
 
+    std::shared_ptr<Broker> ZmqBrokerSS::generateSubBroker(const std::string& name,
+                                                           const std::string& configureString)
+    {
+        return BrokerFactory::create(CoreType::ZMQ_SS, name, configureString);
+    }
+
 }  // namespace zeromq
 }  // namespace helics
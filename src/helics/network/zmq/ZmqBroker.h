@@ -7,6 +7,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #pragma once
 #include "../NetworkBroker.hpp"
 
+#include <memory>
 #include <string>
 namespace helics {
 namespace zeromq {
@@ -36,6 +37,9 @@ namespace zeromq {
 
       private:
         virtual bool brokerConnect() override;
+        virtual std::shared_ptr<Broker>
+            generateSubBroker(const std::string& name,
+                              const std::string& configureString) override;
     };
 
 }  // namespace zeromq
@@ -24,6 +24,9 @@ SPDX-License-Identifier: BSD-3-Clause
 
 namespace helics {
 namespace zeromq {
+    /// time in milliseconds a send on a direct route waits for the connection before giving up
+    static constexpr int routeSendTimeout{500};
+
     void ZmqComms::loadNetworkInfo(const NetworkBrokerData& netInfo)
     {
         NetworkCommsInterface::loadNetworkInfo(netInfo);
@@ -64,6 +67,9 @@ namespace zeromq {
                 return (-1);
             }
         }
+        if (relayMessage(msg.data(), msg.size()) > 0) {
+            return 0;
+        }
         ActionMessage M(static_cast<std::byte*>(msg.data()), msg.size());
         if (!isValidCommand(M)) {
             logError("invalid command received");
@@ -459,6 +465,12 @@ namespace zeromq {
 
                                 auto zsock = zmq::socket_t(ctx->getContext(), ZMQ_PUSH);
                                 zsock.setsockopt(ZMQ_LINGER, 100);
+                                if (hasBroker) {
+                                    // only queue on a live connection so a send to a peer that
+                                    // is gone times out and can go through the broker instead
+                                    zsock.setsockopt(ZMQ_IMMEDIATE, 1);
+                                    zsock.setsockopt(ZMQ_SNDTIMEO, routeSendTimeout);
+                                }
                                 zsock.connect(makePortAddress(interfaceAndPort.first,
                                                               interfaceAndPort.second));
                                 routes.emplace(route_id{cmd.getExtraData()}, std::move(zsock));
@@ -508,7 +520,24 @@ namespace zeromq {
             } else {
                 auto rt_find = routes.find(rid);
                 if (rt_find != routes.end()) {
-                    rt_find->second.send(zmq::const_buffer(buffer.data(), buffer.size()));
+                    bool sent{false};
+                    try {
+                        sent = rt_find->second
+                                   .send(zmq::const_buffer(buffer.data(), buffer.size()))
+                                   .has_value();
+                    }
+                    catch (const zmq::error_t& ze) {
+                        if (!isDisconnectCommand(cmd)) {
+                            logError(std::string("rt send ") + std::to_string(rid.baseValue()) +
+                                     "::" + ze.what());
+                        }
+                    }
+                    // fall back to the broker path if a direct route fails
+                    if (!sent && hasBroker && !isDisconnectCommand(cmd)) {
+                        routes.erase(rt_find);
+                        brokerPushSocket.send(zmq::const_buffer(buffer.data(), buffer.size()),
+                                              zmq::send_flags::none);
+                    }
                 } else {
                     if (hasBroker) {
                         brokerPushSocket.send(zmq::const_buffer(buffer.data(), buffer.size()));
@@ -82,6 +82,9 @@ namespace zeromq {
                 return (-1);
             }
         }
+        if (relayMessage(msg.data(), msg.size()) > 0) {
+            return 0;
+        }
         ActionMessage M(static_cast<std::byte*>(msg.data()), msg.size());
 
         if (!isValidCommand(M)) {
@@ -336,6 +339,9 @@ namespace zeromq {
         if (!hasBroker) {
             brokerConnection.close();
             setTxStatus(connection_status::connected);
+        } else if (serverMode) {
+            // report sends to a peer that is gone so they can go through the broker instead
+            brokerSocket.setsockopt(ZMQ_ROUTER_MANDATORY, 1);
         }
         // setTxStatus(connection_status::connected);
 
@@ -401,12 +407,27 @@ namespace zeromq {
                         if (rt_find != routes.end()) {
                             std::string route_name = rt_find->second;
                             std::string empty;
-                            // Need to first send identity and empty string
-                            brokerSocket.send(route_name, zmq::send_flags::sndmore);
-                            brokerSocket.send(empty, zmq::send_flags::sndmore);
-                            // Send the actual data
-                            brokerSocket.send(zmq::const_buffer(buffer.data(), buffer.size()),
-                                              zmq::send_flags::dontwait);
+                            try {
+                                // Need to first send identity and empty string
+                                brokerSocket.send(route_name, zmq::send_flags::sndmore);
+                                brokerSocket.send(empty, zmq::send_flags::sndmore);
+                                // Send the actual data
+                                brokerSocket.send(zmq::const_buffer(buffer.data(), buffer.size()),
+                                                  zmq::send_flags::dontwait);
+                            }
+                            catch (const zmq::error_t& ze) {
+                                if (!isDisconnectCommand(cmd)) {
+                                    logError(std::string("rt send ") +
+                                             std::to_string(rid.baseValue()) + "::" + ze.what());
+                                }
+                                // fall back to the broker path if a direct route fails
+                                if (hasBroker && !isDisconnectCommand(cmd)) {
+                                    routes.erase(rt_find);
+                                    brokerConnection.send(zmq::const_buffer(buffer.data(),
+                                                                            buffer.size()),
+                                                          zmq::send_flags::dontwait);
+                                }
+                            }
                         } else {
                             if (hasBroker) {
                                 brokerConnection.send(zmq::const_buffer(buffer.data(),
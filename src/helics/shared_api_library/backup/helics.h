@@ -257,6 +257,9 @@ typedef enum {
     /** the property controlling real time tolerance for a federate sets both rt_lag and
        rt_lead*/
     HELICS_PROPERTY_TIME_RT_TOLERANCE = 145,
+    /** the property controlling the period before a real time deadline in which a federate spins
+       instead of sleeping for more precise pacing, 0 disables spinning*/
+    HELICS_PROPERTY_TIME_RT_SPIN = 146,
     /** the property controlling input delay for a federate*/
     HELICS_PROPERTY_TIME_INPUT_DELAY = 148,
     /** the property controlling output delay for a federate*/
@@ -319,6 +322,10 @@ typedef enum {
     HELICS_HANDLE_OPTION_ONLY_TRANSMIT_ON_CHANGE = 452,
     /** specify that an interface will only update if the value has actually changed*/
     HELICS_HANDLE_OPTION_ONLY_UPDATE_ON_CHANGE = 454,
+    /** specify that a publication will transmit only the changed portions of its value between
+       periodic full values, a value greater than 1 sets the number of deltas between full values
+       (only applicable to publications)*/
+    HELICS_HANDLE_OPTION_TRANSMIT_DELTAS = 457,
     /** specify that an interface does not participate in determining time interrupts*/
     HELICS_HANDLE_OPTION_IGNORE_INTERRUPTS = 475,
     /** specify the multi-input processing method for inputs*/
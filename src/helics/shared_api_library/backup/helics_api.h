@@ -109,6 +109,7 @@ typedef enum {
     HELICS_PROPERTY_TIME_RT_LAG = 143,
     HELICS_PROPERTY_TIME_RT_LEAD = 144,
     HELICS_PROPERTY_TIME_RT_TOLERANCE = 145,
+    HELICS_PROPERTY_TIME_RT_SPIN = 146,
     HELICS_PROPERTY_TIME_INPUT_DELAY = 148,
     HELICS_PROPERTY_TIME_OUTPUT_DELAY = 150,
     HELICS_PROPERTY_INT_MAX_ITERATIONS = 259,
@@ -139,6 +140,7 @@ typedef enum {
     HELICS_HANDLE_OPTION_IGNORE_UNIT_MISMATCH = 447,
     HELICS_HANDLE_OPTION_ONLY_TRANSMIT_ON_CHANGE = 452,
     HELICS_HANDLE_OPTION_ONLY_UPDATE_ON_CHANGE = 454,
+    HELICS_HANDLE_OPTION_TRANSMIT_DELTAS = 457,
     HELICS_HANDLE_OPTION_IGNORE_INTERRUPTS = 475,
     HELICS_HANDLE_OPTION_MULTI_INPUT_HANDLING_METHOD = 507,
     HELICS_HANDLE_OPTION_INPUT_PRIORITY_LOCATION = 510,
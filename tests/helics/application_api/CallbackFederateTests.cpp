@@ -0,0 +1,232 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/CallbackFederate.hpp"
+#include "helics/application_api/Endpoints.hpp"
+#include "helics/application_api/Inputs.hpp"
+#include "helics/application_api/Publications.hpp"
+#include "helics/core/core-exceptions.hpp"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define CORE_TYPE_TO_TEST helics::CoreType::TEST
+
+TEST(callback_federate_tests, single_federate)
+{
+    helics::FederateInfo fi(CORE_TYPE_TO_TEST);
+    fi.coreName = "cb_core_single";
+    fi.coreInitString = "-f 1 --autobroker";
+
+    auto fed = std::make_shared<helics::CallbackFederate>("cbfed", fi);
+    std::vector<helics::Time> grants;
+    int initCount{0};
+    bool finalized{false};
+    fed->setInitializeCallback([&initCount]() {
+        ++initCount;
+        return helics::IterationRequest::NO_ITERATIONS;
+    });
+    fed->setStepCallback([&grants](helics::Time granted) {
+        grants.push_back(granted);
+        return (granted < 3.0) ? granted + 1.0 : helics::Time::maxVal();
+    });
+    fed->setFinalizeCallback([&finalized]() { finalized = true; });
+
+    fed->enterInitializingMode();
+    fed->waitForCompletion();
+    EXPECT_TRUE(fed->isCompleted());
+    EXPECT_EQ(initCount, 1);
+    ASSERT_EQ(grants.size(), 4U);
+    EXPECT_EQ(grants.front(), helics::timeZero);
+    EXPECT_EQ(grants.back(), 3.0);
+    EXPECT_TRUE(finalized);
+    EXPECT_THROW(fed->enterInitializingMode(), helics::InvalidFunctionCall);
+    fed->finalize();
+    EXPECT_TRUE(fed->getCurrentMode() == helics::Federate::Modes::FINALIZE);
+}
+
+TEST(callback_federate_tests, value_exchange)
+{
+    helics::FederateInfo fi(CORE_TYPE_TO_TEST);
+    fi.coreName = "cb_core_values";
+    fi.coreInitString = "-f 2 --autobroker";
+
+    auto sender = std::make_shared<helics::CallbackFederate>("sender", fi);
+    auto receiver = std::make_shared<helics::CallbackFederate>("receiver", fi);
+    auto& pub = sender->registerGlobalPublication<double>("cb_value");
+    auto& sub = receiver->registerSubscription("cb_value");
+
+    sender->setStepCallback([&pub](helics::Time granted) {
+        if (granted >= 5.0) {
+            return helics::Time::maxVal();
+        }
+        pub.publish(static_cast<double>(granted));
+        return granted + 1.0;
+    });
+    std::vector<double> values;
+    receiver->setStepCallback([&sub, &values](helics::Time granted) {
+        if (sub.isUpdated()) {
+            values.push_back(sub.getValue<double>());
+        }
+        return (granted < 5.0) ? granted + 1.0 : helics::Time::maxVal();
+    });
+
+    sender->enterInitializingMode();
+    receiver->enterInitializingMode();
+    sender->waitForCompletion();
+    receiver->waitForCompletion();
+    ASSERT_FALSE(values.empty());
+    EXPECT_DOUBLE_EQ(values.back(), 4.0);
+    EXPECT_EQ(receiver->getCurrentTime(), 5.0);
+    sender->finalize();
+    receiver->finalize();
+}
+
+TEST(callback_federate_tests, step_error)
+{
+    helics::FederateInfo fi(CORE_TYPE_TO_TEST);
+    fi.coreName = "cb_core_error";
+    fi.coreInitString = "-f 1 --autobroker";
+
+    auto fed = std::make_shared<helics::CallbackFederate>("cbfed_error", fi);
+    std::atomic<int> errorCode{0};
+    bool finalized{false};
+    fed->setStepCallback([](helics::Time granted) -> helics::Time {
+        if (granted >= 2.0) {
+            throw(std::runtime_error("step failure"));
+        }
+        return granted + 1.0;
+    });
+    fed->setFinalizeCallback([&finalized]() { finalized = true; });
+    fed->setErrorCallback([&errorCode](int code, std::string_view /*message*/) {
+        errorCode.store(code);
+    });
+
+    fed->enterInitializingMode();
+    fed->waitForCompletion();
+    EXPECT_NE(errorCode.load(), 0);
+    EXPECT_FALSE(finalized);
+    EXPECT_TRUE(fed->getCurrentMode() == helics::Federate::Modes::ERROR_STATE);
+}
+
+TEST(callback_federate_tests, init_iteration)
+{
+    helics::FederateInfo fi(CORE_TYPE_TO_TEST);
+    fi.coreName = "cb_core_iteration";
+    fi.coreInitString = "-f 2 --autobroker";
+
+    auto sender = std::make_shared<helics::CallbackFederate>("sender", fi);
+    auto receiver = std::make_shared<helics::CallbackFederate>("receiver", fi);
+    auto& pub = sender->registerGlobalPublication<double>("cb_init_value");
+    auto& sub = receiver->registerSubscription("cb_init_value");
+
+    // the value published in initializing mode makes the receiver iterate once
+    sender->setInitializeCallback([&pub]() {
+        pub.publish(2.5);
+        return helics::IterationRequest::NO_ITERATIONS;
+    });
+    sender->setStepCallback([](helics::Time /*granted*/) { return helics::Time::maxVal(); });
+    int initCount{0};
+    double initValue{0.0};
+    receiver->setInitializeCallback([&]() {
+        ++initCount;
+        if (sub.isUpdated()) {
+            initValue = sub.getValue<double>();
+        }
+        return helics::IterationRequest::ITERATE_IF_NEEDED;
+    });
+    std::vector<helics::Time> grants;
+    receiver->setStepCallback([&grants](helics::Time granted) {
+        grants.push_back(granted);
+        return helics::Time::maxVal();
+    });
+
+    sender->enterInitializingMode();
+    receiver->enterInitializingMode();
+    sender->waitForCompletion();
+    receiver->waitForCompletion();
+    EXPECT_EQ(initCount, 2);
+    EXPECT_DOUBLE_EQ(initValue, 2.5);
+    ASSERT_EQ(grants.size(), 1U);
+    EXPECT_EQ(grants.front(), helics::timeZero);
+    sender->finalize();
+    receiver->finalize();
+}
+
+TEST(callback_federate_tests, endpoint_messages)
+{
+    helics::FederateInfo fi(CORE_TYPE_TO_TEST);
+    fi.coreName = "cb_core_messages";
+    fi.coreInitString = "-f 2 --autobroker";
+
+    auto sender = std::make_shared<helics::CallbackFederate>("sender", fi);
+    auto receiver = std::make_shared<helics::CallbackFederate>("receiver", fi);
+    auto& ept1 = sender->registerGlobalEndpoint("cb_ept1");
+    auto& ept2 = receiver->registerGlobalEndpoint("cb_ept2");
+
+    sender->setStepCallback([&ept1](helics::Time granted) {
+        if (granted >= 5.0) {
+            return helics::Time::maxVal();
+        }
+        ept1.sendTo(std::to_string(static_cast<int>(static_cast<double>(granted))), "cb_ept2");
+        return granted + 1.0;
+    });
+    std::vector<std::string> messages;
+    std::vector<helics::Time> messageTimes;
+    receiver->setStepCallback([&](helics::Time granted) {
+        while (ept2.hasMessage()) {
+            auto message = ept2.getMessage();
+            messages.emplace_back(message->to_string());
+            messageTimes.push_back(message->time);
+            EXPECT_EQ(message->source, "cb_ept1");
+        }
+        return (granted < 5.0) ? granted + 1.0 : helics::Time::maxVal();
+    });
+
+    sender->enterInitializingMode();
+    receiver->enterInitializingMode();
+    sender->waitForCompletion();
+    receiver->waitForCompletion();
+    EXPECT_EQ(messages, (std::vector<std::string>{"0", "1", "2", "3", "4"}));
+    ASSERT_EQ(messageTimes.size(), 5U);
+    EXPECT_EQ(messageTimes.back(), 4.0);
+    sender->finalize();
+    receiver->finalize();
+}
+
+TEST(callback_federate_tests, finalize_in_callback)
+{
+    helics::FederateInfo fi(CORE_TYPE_TO_TEST);
+    fi.coreName = "cb_core_finalize";
+    fi.coreInitString = "-f 1 --autobroker";
+
+    auto fed = std::make_shared<helics::CallbackFederate>("cbfed_finalize", fi);
+    auto* fedPtr = fed.get();
+    std::vector<helics::Time> grants;
+    bool finalized{false};
+    // finalizing from the step callback must not wait on the worker running the callback
+    fed->setStepCallback([fedPtr, &grants](helics::Time granted) {
+        grants.push_back(granted);
+        if (granted >= 2.0) {
+            fedPtr->finalize();
+        }
+        return granted + 1.0;
+    });
+    fed->setFinalizeCallback([&finalized]() { finalized = true; });
+
+    fed->enterInitializingMode();
+    fed->waitForCompletion();
+    EXPECT_TRUE(finalized);
+    ASSERT_EQ(grants.size(), 3U);
+    EXPECT_EQ(grants.back(), 2.0);
+    EXPECT_TRUE(fed->getCurrentMode() == helics::Federate::Modes::FINALIZE);
+    fed->finalize();
+}
@@ -9,14 +9,18 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/application_api/CoreApp.hpp"
 #include "helics/application_api/Endpoints.hpp"
 #include "helics/application_api/Publications.hpp"
+#include "helics/common/JsonProcessingFunctions.hpp"
 #include "helics/core/BrokerFactory.hpp"
 #include "helics/core/Core.hpp"
 #include "helics/core/CoreFactory.hpp"
 #include "helics/core/core-exceptions.hpp"
 #include "testFixtures.hpp"
 
+#include <chrono>
+#include <cstdio>
 #include <future>
 #include <gtest/gtest.h>
+#include <thread>
 
 class combofed_single_type_tests:
     public ::testing::TestWithParam<const char*>,
@@ -311,6 +315,148 @@ INSTANTIATE_TEST_SUITE_P(combofed_tests,
                          combofed_file_load_tests,
                          ::testing::ValuesIn(combo_config_files));
 
+TEST(comboFederate, manifest_load)
+{
+    const std::string manifestFile{"example_combo_fed.hifm"};
+    helics::generateInterfaceManifest(std::string(TEST_DIR) + "example_combo_fed.json",
+                                      manifestFile);
+
+    auto cr = helics::CoreFactory::create(helics::CoreType::TEST, "--name=mfm --autobroker");
+    helics::FederateInfo fi(helics::CoreType::TEST);
+    fi.setProperty(HELICS_PROPERTY_INT_LOG_LEVEL, HELICS_LOG_LEVEL_ERROR);
+    helics::CombinationFederate cFed("comboFed", cr, fi);
+    cFed.registerInterfaces(manifestFile);
+
+    EXPECT_EQ(cFed.getEndpointCount(), 2);
+    auto& id = cFed.getEndpoint("ept1");
+    EXPECT_EQ(id.getExtractionType(), "genmessage");
+    EXPECT_TRUE(cFed.getEndpoint("ept2").isValid());
+
+    EXPECT_EQ(cFed.getInputCount(), 2);
+    EXPECT_EQ(cFed.getPublicationCount(), 2);
+    EXPECT_EQ(cFed.getPublication("pub1").getUnits(), "m");
+    EXPECT_TRUE(!cFed.getPublication(1).getInfo().empty());
+    EXPECT_TRUE(cFed.getInput("pubshortcut").isValid());
+    cFed.finalize();
+    cr.reset();
+    std::remove(manifestFile.c_str());
+}
+
+TEST(comboFederate, manifest_invalid)
+{
+    EXPECT_THROW(helics::generateInterfaceManifest("{\"publications\":[{\"key\":", "bad.hifm"),
+                 helics::InvalidParameter);
+}
+
+class combofed_direct_route_tests: public ::testing::Test, public FederateTestFixture {
+};
+
+/** count the direct routes of the core of a federate that are in use*/
+static int activeDirectRoutes(const std::shared_ptr<helics::CombinationFederate>& fed)
+{
+    auto val = loadJsonStr(fed->query("core", "direct_routes"));
+    int active{0};
+    for (const auto& route : val["routes"]) {
+        if (route["active"].asBool()) {
+            ++active;
+        }
+    }
+    return active;
+}
+
+/** wait for the number of direct routes of the core of a federate in use to reach a count*/
+static bool waitForDirectRoutes(const std::shared_ptr<helics::CombinationFederate>& fed, int count)
+{
+    for (int ii = 0; ii < 100; ++ii) {
+        if (activeDirectRoutes(fed) == count) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    return false;
+}
+
+/** check that data continues to flow correctly after the broker switches the cores to a direct
+ * route*/
+TEST_F(combofed_direct_route_tests, direct_route_transfer)
+{
+    extraBrokerArgs = "--direct_route_threshold=2";
+    SetupTest<helics::CombinationFederate>("test_2", 2);
+    auto cFed1 = GetFederateAs<helics::CombinationFederate>(0);
+    auto cFed2 = GetFederateAs<helics::CombinationFederate>(1);
+
+    auto& pub = cFed1->registerGlobalPublication<int>("pub1");
+    auto& sub = cFed2->registerSubscription("pub1");
+    auto& ept1 = cFed1->registerGlobalEndpoint("ept1");
+    auto& ept2 = cFed2->registerGlobalEndpoint("ept2");
+
+    cFed1->enterExecutingModeAsync();
+    cFed2->enterExecutingMode();
+    cFed1->enterExecutingModeComplete();
+
+    for (int ii = 1; ii <= 10; ++ii) {
+        pub.publish(ii);
+        ept1.sendTo(std::to_string(ii), "ept2");
+        ept2.sendTo(std::to_string(-ii), "ept1");
+        cFed1->requestTimeAsync(ii);
+        auto gtime = cFed2->requestTime(ii);
+        EXPECT_EQ(cFed1->requestTimeComplete(), static_cast<double>(ii));
+        EXPECT_EQ(gtime, static_cast<double>(ii));
+        EXPECT_EQ(sub.getValue<int>(), ii);
+        ASSERT_TRUE(ept2.hasMessage());
+        EXPECT_EQ(ept2.getMessage()->to_string(), std::to_string(ii));
+        ASSERT_TRUE(ept1.hasMessage());
+        EXPECT_EQ(ept1.getMessage()->to_string(), std::to_string(-ii));
+    }
+    // the traffic in each direction passed the threshold so both cores use a direct route
+    EXPECT_EQ(activeDirectRoutes(cFed1), 1);
+    EXPECT_EQ(activeDirectRoutes(cFed2), 1);
+    cFed1->finalize();
+    cFed2->finalize();
+}
+
+/** check that a time grant coordinated through the broker never overtakes the data sent before it
+ * on a direct route and that the route is removed when the other core disconnects*/
+TEST_F(combofed_direct_route_tests, direct_route_grant_race)
+{
+    SetupTest<helics::CombinationFederate>("test_2", 2);
+    auto cFed1 = GetFederateAs<helics::CombinationFederate>(0);
+    auto cFed2 = GetFederateAs<helics::CombinationFederate>(1);
+
+    auto& pub = cFed1->registerGlobalPublication<int>("pub1");
+    auto& sub = cFed2->registerSubscription("pub1");
+    // endpoints make the cores depend on the broker for time coordination
+    auto& ept1 = cFed1->registerGlobalEndpoint("ept1");
+    auto& ept2 = cFed2->registerGlobalEndpoint("ept2");
+
+    cFed1->enterExecutingModeAsync();
+    cFed2->enterExecutingMode();
+    cFed1->enterExecutingModeComplete();
+
+    cFed1->sendCommand("broker", "direct_route " + cFed2->getName());
+    ASSERT_TRUE(waitForDirectRoutes(cFed1, 1));
+
+    constexpr int burst{50};
+    for (int ii = 1; ii <= 10; ++ii) {
+        for (int jj = 0; jj < burst; ++jj) {
+            ept1.sendTo(std::to_string(jj), "ept2");
+        }
+        pub.publish(ii);
+        cFed1->requestTimeAsync(ii);
+        auto gtime = cFed2->requestTime(ii);
+        EXPECT_EQ(gtime, static_cast<double>(ii));
+        EXPECT_EQ(sub.getValue<int>(), ii);
+        EXPECT_EQ(ept2.pendingMessagesCount(), static_cast<std::uint64_t>(burst));
+        while (ept2.hasMessage()) {
+            ept2.getMessage();
+        }
+        EXPECT_EQ(cFed1->requestTimeComplete(), static_cast<double>(ii));
+    }
+    cFed2->finalize();
+    EXPECT_TRUE(waitForDirectRoutes(cFed1, 0));
+    cFed1->finalize();
+}
+
 TEST(comboFederate, constructor2)
 {
     auto cr = helics::CoreFactory::create(helics::CoreType::TEST, "--name=mf --autobroker");
@@ -9,6 +9,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/application_api/Filters.hpp"
 #include "helics/application_api/MessageFederate.hpp"
 #include "helics/application_api/MessageOperators.hpp"
+#include "helics/core/core-exceptions.hpp"
 #include "testFixtures.hpp"
 
 #include <future>
@@ -606,3 +607,61 @@ TEST_P(filter_type_tests, test_filter_info_field_ci_skip)
 }
 
 INSTANTIATE_TEST_SUITE_P(filter_tests, filter_type_tests, ::testing::ValuesIn(CoreTypes));
+
+TEST(filter_operation_tests, reroute_conditions)
+{
+    helics::RerouteFilterOperation reroute;
+    reroute.setString("newdestination", "new_${dest}");
+    reroute.setString("condition", "^end");
+    reroute.setString("condition", "pt[0-9]$");
+    reroute.setString("condition", "literal");
+    EXPECT_THROW(reroute.setString("condition", "bad[regex"), helics::InvalidParameter);
+    auto op = reroute.getOperator();
+
+    auto process = [&op](const std::string& dest) {
+        auto mess = std::make_unique<helics::Message>();
+        mess->source = "src";
+        mess->dest = dest;
+        return op->process(std::move(mess))->dest;
+    };
+    EXPECT_EQ(process("endpt"), "new_endpt");
+    EXPECT_EQ(process("port3"), "new_port3");
+    EXPECT_EQ(process("a_literal_name"), "new_a_literal_name");
+    EXPECT_EQ(process("other"), "other");
+    // repeated destinations use the cached decisions
+    EXPECT_EQ(process("endpt"), "new_endpt");
+    EXPECT_EQ(process("other"), "other");
+    reroute.setString("condition", "oth");
+    EXPECT_EQ(process("other"), "new_other");
+}
+
+TEST(filter_operation_tests, firewall_rules)
+{
+    helics::FirewallFilterOperation firewall;
+    auto op = firewall.getOperator();
+    auto pass = [&op](const std::string& src, const std::string& dest, const std::string& data) {
+        auto mess = std::make_unique<helics::Message>();
+        mess->source = src;
+        mess->dest = dest;
+        mess->data = data;
+        return static_cast<bool>(op->process(std::move(mess)));
+    };
+    // no rules everything passes
+    EXPECT_TRUE(pass("src1", "dest1", "data"));
+
+    firewall.setString("block", "source:^bad");
+    EXPECT_FALSE(pass("bad_src", "dest1", "data"));
+    EXPECT_TRUE(pass("src1", "dest1", "data"));
+
+    firewall.setString("allow", "dest:^dest[0-9]$");
+    EXPECT_TRUE(pass("src1", "dest1", "data"));
+    EXPECT_FALSE(pass("src1", "other", "data"));
+    EXPECT_FALSE(pass("bad_src", "dest2", "data"));
+
+    firewall.setString("block", "data:secret");
+    EXPECT_FALSE(pass("src1", "dest1", "top secret data"));
+    EXPECT_TRUE(pass("src1", "dest1", "public data"));
+
+    EXPECT_THROW(firewall.setString("allow", "dest:bad[regex"), helics::InvalidParameter);
+    EXPECT_THROW(firewall.setString("unknown", "value"), helics::InvalidParameter);
+}
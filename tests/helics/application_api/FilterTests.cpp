@@ -608,6 +608,60 @@ TEST_P(filter_single_type_test, message_filter_function_two_stage_broker_filter_
     EXPECT_TRUE(res);
 }
 
+/** test source and destination filters executing on the core filter worker threads*/
+TEST_F(filter_tests, message_filter_function_threads)
+{
+    extraCoreArgs = "--filter_threads=2";
+    auto broker = AddBroker("test", 2);
+    AddFederates<helics::MessageFederate>("test", 2, broker, 1.0, "filter");
+
+    auto fFed = GetFederateAs<helics::MessageFederate>(0);
+    auto mFed = GetFederateAs<helics::MessageFederate>(1);
+
+    auto& p1 = mFed->registerGlobalEndpoint("port1");
+    auto& p2 = mFed->registerGlobalEndpoint("port2");
+
+    auto& f1 = fFed->registerFilter("filter1");
+    f1.addSourceTarget("port1");
+    auto timeOperator = std::make_shared<helics::MessageTimeOperator>();
+    timeOperator->setTimeFunction([](helics::Time time_in) { return time_in + 2.5; });
+    fFed->setFilterOperator(f1, timeOperator);
+
+    auto& f2 = fFed->registerFilter("filter2");
+    f2.addDestinationTarget("port2");
+    auto op = std::make_shared<helics::CustomMessageOperator>();
+    op->setMessageFunction([](std::unique_ptr<helics::Message> m) {
+        m->data.append("bb");
+        return m;
+    });
+    f2.setOperator(op);
+
+    fFed->enterExecutingModeAsync();
+    mFed->enterExecutingMode();
+    fFed->enterExecutingModeComplete();
+
+    for (int ii = 0; ii < 10; ++ii) {
+        p1.sendTo(std::string(10, static_cast<char>('a' + ii)), "port2");
+    }
+
+    fFed->requestTimeAsync(3.0);
+    auto retTime = mFed->requestTime(3.0);
+    EXPECT_LE(retTime, 3.0);
+    EXPECT_EQ(mFed->pendingMessagesCount(p2), 10U);
+    // messages from a single endpoint must retain their order through the filters
+    for (int ii = 0; ii < 10; ++ii) {
+        auto m2 = mFed->getMessage(p2);
+        ASSERT_TRUE(m2);
+        EXPECT_EQ(m2->source, "port1");
+        EXPECT_EQ(m2->time, 2.5);
+        EXPECT_EQ(m2->data.to_string(), std::string(10, static_cast<char>('a' + ii)) + "bb");
+    }
+    mFed->finalizeAsync();
+    fFed->requestTimeComplete();
+    fFed->finalize();
+    mFed->finalizeComplete();
+}
+
 TEST_F(filter_tests, message_filter_function_two_stage_brokerApp_filter_link)
 {
     auto broker = AddBroker("test", 3);
@@ -142,6 +142,47 @@ TEST(logging_tests, check_log_message)
     EXPECT_TRUE(found);
 }
 
+TEST(logging_tests, async_logging)
+{
+    helics::FederateInfo fi(CORE_TYPE_TO_TEST);
+    fi.coreInitString = "--autobroker --async_logging";
+    fi.setProperty(helics::defs::Properties::LOG_LEVEL, HELICS_LOG_LEVEL_SUMMARY);
+
+    auto Fed = std::make_shared<helics::Federate>("test1", fi);
+    auto cr = Fed->getCorePointer();
+    gmlc::libguarded::guarded<std::vector<std::pair<int, std::string>>> mlog;
+    cr->setLoggingCallback(helics::gLocalCoreId,
+                           [&mlog](int level,
+                                   std::string_view /*unused*/,
+                                   std::string_view message) {
+                               mlog.lock()->emplace_back(level, message);
+                           });
+
+    Fed->enterExecutingMode();
+    for (int ii = 0; ii < 100; ++ii) {
+        Fed->logInfoMessage("async MEXAGE " + std::to_string(ii));
+    }
+    Fed->requestNextStep();
+    auto counts = cr->query("core", "command_counts", HELICS_QUERY_MODE_FAST);
+    EXPECT_NE(counts.find("log_dropped"), std::string::npos);
+    Fed->finalize();
+    cr->waitForDisconnect();
+    Fed.reset();
+    cr.reset();
+    // destroying the core writes out anything remaining in the logging queue
+    helics::cleanupHelicsLibrary();
+
+    auto llock = mlog.lock();
+    int next{0};
+    for (auto& m : llock) {
+        if (m.second.find("async MEXAGE") != std::string::npos) {
+            EXPECT_EQ(m.second, "async MEXAGE " + std::to_string(next));
+            ++next;
+        }
+    }
+    EXPECT_EQ(next, 100);
+}
+
 TEST(logging_tests, check_log_message_functions)
 {
     helics::FederateInfo fi(CORE_TYPE_TO_TEST);
@@ -573,6 +573,235 @@ TEST_F(mfed_tests, send_message1)
     mFed1->finalize();
 }
 
+TEST_F(mfed_tests, optimistic_send_message)
+{
+    SetupTest<helics::MessageFederate>("test", 1);
+    auto mFed1 = GetFederateAs<helics::MessageFederate>(0);
+    mFed1->setFlagOption(HELICS_FLAG_ROLLBACK);
+    EXPECT_TRUE(mFed1->getFlagOption(HELICS_FLAG_ROLLBACK));
+
+    auto& ep1 = mFed1->registerGlobalEndpoint("ep1");
+    auto& ep2 = mFed1->registerGlobalEndpoint("ep2");
+
+    std::vector<helics::Time> checkpoints;
+    int restoreCount{0};
+    mFed1->setOptimisticCallbacks([&checkpoints](helics::Time t) { checkpoints.push_back(t); },
+                                  [&restoreCount](helics::Time /*t*/) { ++restoreCount; });
+
+    const std::string message1{"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"};
+    mFed1->enterExecutingMode();
+
+    ep1.sendToAt(message1.c_str(), 31, "ep2", 1.7);
+
+    auto res = mFed1->requestTime(2.0);
+    EXPECT_EQ(res, 1.7);
+    auto m1 = ep2.getMessage();
+    ASSERT_TRUE(m1);
+    EXPECT_EQ(m1->data.size(), 31U);
+
+    res = mFed1->requestTime(2.0);
+    EXPECT_EQ(res, 2.0);
+    // with no other federates nothing can cause a rollback
+    EXPECT_EQ(mFed1->getCorePointer()->getCommittedTime(mFed1->getID()), 2.0);
+    ASSERT_EQ(checkpoints.size(), 2U);
+    EXPECT_EQ(checkpoints.back(), 2.0);
+    EXPECT_EQ(restoreCount, 0);
+
+    mFed1->finalize();
+}
+
+TEST_F(mfed_tests, optimistic_rollback)
+{
+    SetupTest<helics::MessageFederate>("test", 2);
+    auto optFed = GetFederateAs<helics::MessageFederate>(0);
+    auto conFed = GetFederateAs<helics::MessageFederate>(1);
+    optFed->setFlagOption(HELICS_FLAG_ROLLBACK);
+
+    auto& optEpt = optFed->registerGlobalEndpoint("opt");
+    auto& conEpt = conFed->registerGlobalEndpoint("con");
+
+    std::vector<helics::Time> restores;
+    optFed->setOptimisticCallbacks([](helics::Time /*t*/) {},
+                                   [&restores](helics::Time t) { restores.push_back(t); });
+
+    optFed->enterExecutingModeAsync();
+    conFed->enterExecutingMode();
+    optFed->enterExecutingModeComplete();
+
+    conEpt.sendToAt("first", "opt", 5.0);
+    // the conservative federate is still at time 0 so the grant of the message time is speculative
+    auto res = optFed->requestTime(10.0);
+    EXPECT_EQ(res, 5.0);
+    EXPECT_LT(optFed->getCorePointer()->getCommittedTime(optFed->getID()), 5.0);
+    // leave the message in the endpoint so the rollback must requeue it
+    EXPECT_EQ(optEpt.pendingMessagesCount(), 1U);
+    optEpt.sendTo("speculative", "con");
+
+    // a message earlier than the speculative grant forces a rollback to its time
+    conEpt.sendToAt("straggler", "opt", 3.0);
+    res = optFed->requestTime(10.0);
+    EXPECT_EQ(res, 3.0);
+    ASSERT_EQ(restores.size(), 1U);
+    EXPECT_EQ(restores.front(), 3.0);
+    ASSERT_EQ(optEpt.pendingMessagesCount(), 1U);
+    EXPECT_EQ(optEpt.getMessage()->to_string(), "straggler");
+
+    // the message consumed in the rolled back step is delivered again at its own time
+    res = optFed->requestTime(10.0);
+    EXPECT_EQ(res, 5.0);
+    ASSERT_EQ(optEpt.pendingMessagesCount(), 1U);
+    EXPECT_EQ(optEpt.getMessage()->to_string(), "first");
+
+    // an ordered core query returns once the core has forwarded the retraction
+    optFed->getCorePointer()->query("core", "federates", HELICS_QUERY_MODE_ORDERED);
+    optFed->requestTimeAsync(10.0);
+    helics::Time conTime = helics::timeZero;
+    while (conTime < 10.0) {
+        conTime = conFed->requestTime(10.0);
+        EXPECT_FALSE(conEpt.hasMessage());
+    }
+    EXPECT_EQ(optFed->requestTimeComplete(), 10.0);
+    EXPECT_EQ(optFed->getCorePointer()->getCommittedTime(optFed->getID()), 10.0);
+    EXPECT_EQ(restores.size(), 1U);
+
+    optFed->finalize();
+    conFed->finalize();
+}
+
+TEST_F(mfed_tests, optimistic_anti_message_before_message)
+{
+    SetupTest<helics::MessageFederate>("test", 2);
+    auto optFed = GetFederateAs<helics::MessageFederate>(0);
+    auto conFed = GetFederateAs<helics::MessageFederate>(1);
+    optFed->setFlagOption(HELICS_FLAG_ROLLBACK);
+
+    auto& optEpt = optFed->registerGlobalEndpoint("opt");
+    auto& conEpt = conFed->registerGlobalEndpoint("con");
+    // the delay holds the speculative message in the filter while the retraction skips filters
+    auto filt =
+        helics::make_filter(helics::FilterTypes::DELAY, optFed->getCorePointer().get(), "odelay");
+    filt->addSourceTarget("opt");
+    filt->set("delay", 0.5);
+
+    optFed->setOptimisticCallbacks([](helics::Time /*t*/) {}, [](helics::Time /*t*/) {});
+
+    optFed->enterExecutingModeAsync();
+    conFed->enterExecutingMode();
+    optFed->enterExecutingModeComplete();
+
+    conEpt.sendToAt("first", "opt", 5.0);
+    auto res = optFed->requestTime(10.0);
+    EXPECT_EQ(res, 5.0);
+    optEpt.sendTo("speculative", "con");
+
+    conEpt.sendToAt("straggler", "opt", 3.0);
+    res = optFed->requestTime(10.0);
+    EXPECT_EQ(res, 3.0);
+
+    optFed->getCorePointer()->query("core", "federates", HELICS_QUERY_MODE_ORDERED);
+    optFed->requestTimeAsync(10.0);
+    helics::Time conTime = helics::timeZero;
+    while (conTime < 10.0) {
+        conTime = conFed->requestTime(10.0);
+        // the delayed message arrives after its retraction and must be discarded
+        EXPECT_FALSE(conEpt.hasMessage());
+    }
+    optFed->requestTimeComplete();
+
+    optFed->finalize();
+    conFed->finalize();
+}
+
+TEST_F(mfed_tests, optimistic_anti_message_source_reroute)
+{
+    SetupTest<helics::MessageFederate>("test", 2);
+    auto optFed = GetFederateAs<helics::MessageFederate>(0);
+    auto conFed = GetFederateAs<helics::MessageFederate>(1);
+    optFed->setFlagOption(HELICS_FLAG_ROLLBACK);
+
+    auto& optEpt = optFed->registerGlobalEndpoint("opt");
+    auto& conEpt = conFed->registerGlobalEndpoint("con");
+    auto& rerouteEpt = conFed->registerGlobalEndpoint("con_reroute");
+    // the retraction must follow the speculative message to the endpoint the filter chose
+    auto filt =
+        helics::make_filter(helics::FilterTypes::REROUTE, optFed->getCorePointer().get(), "orr");
+    filt->addSourceTarget("opt");
+    filt->setString("newdestination", "con_reroute");
+
+    optFed->setOptimisticCallbacks([](helics::Time /*t*/) {}, [](helics::Time /*t*/) {});
+
+    optFed->enterExecutingModeAsync();
+    conFed->enterExecutingMode();
+    optFed->enterExecutingModeComplete();
+
+    conEpt.sendToAt("first", "opt", 5.0);
+    auto res = optFed->requestTime(10.0);
+    EXPECT_EQ(res, 5.0);
+    optEpt.sendTo("speculative", "con");
+
+    conEpt.sendToAt("straggler", "opt", 3.0);
+    res = optFed->requestTime(10.0);
+    EXPECT_EQ(res, 3.0);
+
+    optFed->getCorePointer()->query("core", "federates", HELICS_QUERY_MODE_ORDERED);
+    optFed->requestTimeAsync(10.0);
+    helics::Time conTime = helics::timeZero;
+    while (conTime < 10.0) {
+        conTime = conFed->requestTime(10.0);
+        EXPECT_FALSE(conEpt.hasMessage());
+        EXPECT_FALSE(rerouteEpt.hasMessage());
+    }
+    optFed->requestTimeComplete();
+
+    optFed->finalize();
+    conFed->finalize();
+}
+
+TEST_F(mfed_tests, optimistic_anti_message_destination_reroute)
+{
+    SetupTest<helics::MessageFederate>("test", 2);
+    auto optFed = GetFederateAs<helics::MessageFederate>(0);
+    auto conFed = GetFederateAs<helics::MessageFederate>(1);
+    optFed->setFlagOption(HELICS_FLAG_ROLLBACK);
+
+    auto& optEpt = optFed->registerGlobalEndpoint("opt");
+    auto& conEpt = conFed->registerGlobalEndpoint("con");
+    auto& rerouteEpt = conFed->registerGlobalEndpoint("con_reroute");
+    auto filt =
+        helics::make_filter(helics::FilterTypes::REROUTE, conFed->getCorePointer().get(), "crr");
+    filt->addDestinationTarget("con");
+    filt->setString("newdestination", "con_reroute");
+
+    optFed->setOptimisticCallbacks([](helics::Time /*t*/) {}, [](helics::Time /*t*/) {});
+
+    optFed->enterExecutingModeAsync();
+    conFed->enterExecutingMode();
+    optFed->enterExecutingModeComplete();
+
+    conEpt.sendToAt("first", "opt", 5.0);
+    auto res = optFed->requestTime(10.0);
+    EXPECT_EQ(res, 5.0);
+    // the destination filter on the conservative endpoint sends the message elsewhere
+    optEpt.sendTo("speculative", "con");
+
+    conEpt.sendToAt("straggler", "opt", 3.0);
+    res = optFed->requestTime(10.0);
+    EXPECT_EQ(res, 3.0);
+
+    optFed->getCorePointer()->query("core", "federates", HELICS_QUERY_MODE_ORDERED);
+    optFed->requestTimeAsync(10.0);
+    helics::Time conTime = helics::timeZero;
+    while (conTime < 10.0) {
+        conTime = conFed->requestTime(10.0);
+        EXPECT_FALSE(conEpt.hasMessage());
+        EXPECT_FALSE(rerouteEpt.hasMessage());
+    }
+    optFed->requestTimeComplete();
+
+    optFed->finalize();
+    conFed->finalize();
+}
+
 TEST(messageFederate, constructor1)
 {
     helics::MessageFederate mf1("fed1", "--coretype=test --autobroker --corename=mfc");
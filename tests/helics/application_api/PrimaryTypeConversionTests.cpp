@@ -263,3 +263,89 @@ TEST(type_conversion_tests, bool_conversion_tests)
     EXPECT_TRUE(checkTypeConversion1(std::complex<double>{0.0, 1.0}, val));
     EXPECT_TRUE(checkTypeConversion1(std::complex<double>{0.0, -0.5}, val));
 }
+
+template<class X>
+bool checkKernelConversion(const SmallBuffer& data, DataType sourceType)
+{
+    auto kernel = std::get<ConversionKernel<X>>(getConversionKernels(sourceType));
+    if (kernel == nullptr) {
+        return false;
+    }
+    X v1{};
+    X v2{};
+    kernel(data_view(data), v1);
+    valueExtract(data_view(data), sourceType, v2);
+    return (v1 == v2);
+}
+
+static bool checkAllKernelConversions(const SmallBuffer& data, DataType sourceType)
+{
+    return checkKernelConversion<double>(data, sourceType) &&
+        checkKernelConversion<int64_t>(data, sourceType) &&
+        checkKernelConversion<std::string>(data, sourceType) &&
+        checkKernelConversion<std::complex<double>>(data, sourceType) &&
+        checkKernelConversion<std::vector<double>>(data, sourceType) &&
+        checkKernelConversion<std::vector<std::complex<double>>>(data, sourceType) &&
+        checkKernelConversion<NamedPoint>(data, sourceType) &&
+        checkKernelConversion<bool>(data, sourceType) &&
+        checkKernelConversion<Time>(data, sourceType);
+}
+
+TEST(type_conversion_tests, conversion_kernel_tests)
+{
+    EXPECT_TRUE(checkAllKernelConversions(ValueConverter<double>::convert(-15.212),
+                                          DataType::HELICS_DOUBLE));
+    EXPECT_TRUE(checkAllKernelConversions(ValueConverter<int64_t>::convert(int64_t{-15}),
+                                          DataType::HELICS_INT));
+    EXPECT_TRUE(checkAllKernelConversions(ValueConverter<std::string>::convert("45.786"s),
+                                          DataType::HELICS_STRING));
+    EXPECT_TRUE(checkAllKernelConversions(ValueConverter<std::string>::convert("1e3"s),
+                                          DataType::HELICS_STRING));
+    EXPECT_TRUE(checkAllKernelConversions(ValueConverter<std::string>::convert("-4.1+2.2j"s),
+                                          DataType::HELICS_STRING));
+    EXPECT_TRUE(checkAllKernelConversions(ValueConverter<std::complex<double>>::convert({3.0, 4.0}),
+                                          DataType::HELICS_COMPLEX));
+    EXPECT_TRUE(
+        checkAllKernelConversions(ValueConverter<std::vector<double>>::convert({3.0, 4.0, -2.0}),
+                                  DataType::HELICS_VECTOR));
+    EXPECT_TRUE(checkAllKernelConversions(
+        ValueConverter<std::vector<std::complex<double>>>::convert({{3.0, 4.0}, {1.0, -1.0}}),
+        DataType::HELICS_COMPLEX_VECTOR));
+    EXPECT_TRUE(checkAllKernelConversions(ValueConverter<NamedPoint>::convert({"point", 4.5}),
+                                          DataType::HELICS_NAMED_POINT));
+    EXPECT_TRUE(checkAllKernelConversions(ValueConverter<std::string>::convert("1"s),
+                                          DataType::HELICS_BOOL));
+    EXPECT_TRUE(checkAllKernelConversions(ValueConverter<int64_t>::convert(int64_t{1250000000}),
+                                          DataType::HELICS_TIME));
+
+    EXPECT_EQ(std::get<ConversionKernel<double>>(getConversionKernels(DataType::HELICS_ANY)),
+              nullptr);
+    EXPECT_EQ(std::get<ConversionKernel<double>>(getConversionKernels(DataType::HELICS_CUSTOM)),
+              nullptr);
+    EXPECT_EQ(std::get<ConversionKernel<double>>(getConversionKernels(DataType::HELICS_MULTI)),
+              nullptr);
+}
+
+TEST(type_conversion_tests, plain_number_string_tests)
+{
+    EXPECT_EQ(getDoubleFromString("45.786"), 45.786);
+    EXPECT_EQ(getDoubleFromString("-1.5e-3"), -1.5e-3);
+    EXPECT_EQ(getDoubleFromString(" 12.5"), 12.5);
+    EXPECT_EQ(getComplexFromString("19"), std::complex<double>(19.0, 0.0));
+}
+
+TEST(type_conversion_tests, string_vector_extraction)
+{
+    auto block = ValueConverter<std::vector<std::string>>::convert({"1", "2", "3"});
+    data_view dv(block);
+    std::string str;
+    valueExtract(dv, DataType::HELICS_STRING, str);
+    EXPECT_EQ(str.front(), '[');
+    // the string based conversions use the JSON form of the vector
+    std::vector<double> vec;
+    valueExtract(dv, DataType::HELICS_STRING, vec);
+    EXPECT_EQ(vec.size(), 3U);
+    NamedPoint np;
+    valueExtract(dv, DataType::HELICS_STRING, np);
+    EXPECT_TRUE(np.name.empty());
+}
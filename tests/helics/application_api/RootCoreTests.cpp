@@ -0,0 +1,81 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/CombinationFederate.hpp"
+#include "helics/application_api/Endpoints.hpp"
+#include "helics/application_api/Inputs.hpp"
+#include "helics/application_api/Publications.hpp"
+#include "helics/core/Core.hpp"
+#include "helics/core/CoreFactory.hpp"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+TEST(root_core_tests, value_message_exchange)
+{
+    helics::FederateInfo fi(helics::CoreType::ROOT);
+    fi.coreName = "root_core_exchange";
+    fi.coreInitString = "-f 2";
+
+    auto cFed1 = std::make_shared<helics::CombinationFederate>("rfed1", fi);
+    auto cFed2 = std::make_shared<helics::CombinationFederate>("rfed2", fi);
+
+    auto& pub = cFed1->registerGlobalPublication<int>("rpub1");
+    auto& sub = cFed2->registerSubscription("rpub1");
+    auto& ept1 = cFed1->registerGlobalEndpoint("rept1");
+    auto& ept2 = cFed2->registerGlobalEndpoint("rept2");
+
+    cFed1->enterExecutingModeAsync();
+    cFed2->enterExecutingMode();
+    cFed1->enterExecutingModeComplete();
+
+    for (int ii = 1; ii <= 10; ++ii) {
+        pub.publish(ii);
+        ept1.sendTo(std::to_string(ii), "rept2");
+        ept2.sendTo(std::to_string(-ii), "rept1");
+        cFed1->requestTimeAsync(ii);
+        auto gtime = cFed2->requestTime(ii);
+        EXPECT_EQ(cFed1->requestTimeComplete(), static_cast<double>(ii));
+        EXPECT_EQ(gtime, static_cast<double>(ii));
+        EXPECT_EQ(sub.getValue<int>(), ii);
+        ASSERT_TRUE(ept2.hasMessage());
+        EXPECT_EQ(ept2.getMessage()->to_string(), std::to_string(ii));
+        ASSERT_TRUE(ept1.hasMessage());
+        EXPECT_EQ(ept1.getMessage()->to_string(), std::to_string(-ii));
+    }
+    cFed1->finalize();
+    cFed2->finalize();
+}
+
+TEST(root_core_tests, root_queries)
+{
+    helics::FederateInfo fi(helics::CoreType::ROOT);
+    fi.coreName = "root_core_queries";
+    fi.coreInitString = "-f 2";
+
+    auto cFed1 = std::make_shared<helics::CombinationFederate>("rqfed1", fi);
+    auto cFed2 = std::make_shared<helics::CombinationFederate>("rqfed2", fi);
+    cFed1->registerGlobalPublication<double>("rqpub");
+    cFed2->registerSubscription("rqpub");
+
+    cFed1->enterInitializingModeAsync();
+    cFed2->enterInitializingMode();
+    cFed1->enterInitializingModeComplete();
+
+    auto res = cFed1->query("root", "federates");
+    EXPECT_NE(res.find("rqfed1"), std::string::npos);
+    EXPECT_NE(res.find("rqfed2"), std::string::npos);
+    res = cFed2->query("root", "publications");
+    EXPECT_NE(res.find("rqpub"), std::string::npos);
+
+    auto cr = cFed1->getCorePointer();
+    cFed1->finalize();
+    cFed2->finalize();
+    EXPECT_TRUE(cr->waitForDisconnect(std::chrono::milliseconds(500)));
+}
@@ -129,6 +129,60 @@ TEST(valueConverter_tests, vector_string)
     EXPECT_TRUE(val3 == test2);
 }
 
+/** string vectors are stored in binary but still convert to and from JSON strings*/
+TEST(valueConverter_tests, vector_string_json)
+{
+    using vecstr = std::vector<std::string>;
+    using converter = helics::ValueConverter<vecstr>;
+
+    vecstr testValue1 = {"test1", "test45", "", "quote\"d"};
+    auto dv = converter::convert(testValue1);
+    EXPECT_EQ(dv.size(), 8U + 4U * 4U + 5U + 6U + 7U);
+    EXPECT_EQ(helics::detail::detectType(dv.data()), helics::DataType::HELICS_STRING);
+
+    auto str = helics::ValueConverter<std::string>::interpret(dv);
+    EXPECT_EQ(str.front(), '[');
+    auto jsonBlock = helics::ValueConverter<std::string>::convert(str);
+    auto val = converter::interpret(jsonBlock);
+    EXPECT_TRUE(val == testValue1);
+
+    auto plainBlock = helics::ValueConverter<std::string>::convert("not_json");
+    val = converter::interpret(plainBlock);
+    ASSERT_EQ(val.size(), 1U);
+    EXPECT_EQ(val[0], "not_json");
+
+    val = converter::interpret(converter::convert(vecstr{}));
+    EXPECT_TRUE(val.empty());
+}
+
+/** string vector blocks are only read within the size of the block*/
+TEST(valueConverter_tests, vector_string_bounded)
+{
+    using vecstr = std::vector<std::string>;
+    using converter = helics::ValueConverter<vecstr>;
+
+    auto dv = converter::convert(vecstr{"first", "second", "third"});
+    // cut off part of the last string
+    std::string str;
+    helics::detail::convertFromBinary(dv.data(), dv.size() - 2, str);
+    auto val = converter::interpret(helics::ValueConverter<std::string>::convert(str));
+    ASSERT_EQ(val.size(), 2U);
+    EXPECT_EQ(val[1], "second");
+
+    std::string storage;
+    auto view = helics::detail::readStringView(dv.data(), dv.size(), storage);
+    EXPECT_EQ(view.front(), '[');
+    EXPECT_EQ(view, storage);
+
+    auto plain = helics::ValueConverter<std::string>::convert("plain"s);
+    view = helics::detail::readStringView(plain.data(), plain.size(), storage);
+    EXPECT_EQ(view, "plain");
+    view = helics::detail::readStringView(plain.data(), plain.size() - 2, storage);
+    EXPECT_EQ(view, "pla");
+    view = helics::detail::readStringView(plain.data(), 4, storage);
+    EXPECT_TRUE(view.empty());
+}
+
 /** check that the converters do actually throw on invalid sizes*/
 TEST(valueConverter_tests, errors)
 {
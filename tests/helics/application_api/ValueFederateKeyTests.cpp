@@ -1085,3 +1085,34 @@ TEST_F(valuefed_tests, empty_get_complex)
 
     vFed1->finalize();
 }
+
+TEST_F(valuefed_tests, transmit_deltas_vector)
+{
+    SetupTest<helics::ValueFederate>("test", 2);
+    auto vFed1 = GetFederateAs<helics::ValueFederate>(0);
+    auto vFed2 = GetFederateAs<helics::ValueFederate>(1);
+
+    auto& pub = vFed1->registerGlobalPublication<std::vector<double>>("pub1");
+    pub.setOption(helics::defs::Options::TRANSMIT_DELTAS, 3);
+    EXPECT_EQ(pub.getOption(helics::defs::Options::TRANSMIT_DELTAS), 3);
+    auto& sub = vFed2->registerSubscription("pub1");
+
+    vFed1->enterExecutingModeAsync();
+    vFed2->enterExecutingMode();
+    vFed1->enterExecutingModeComplete();
+
+    std::vector<double> data(10000, 1.0);
+    for (int ii = 1; ii <= 8; ++ii) {
+        data[ii * 997] = static_cast<double>(ii);
+        data.back() = -static_cast<double>(ii);
+        pub.publish(data);
+        vFed1->requestTimeAsync(ii);
+        auto gtime = vFed2->requestTime(ii);
+        vFed1->requestTimeComplete();
+        EXPECT_EQ(gtime, static_cast<double>(ii));
+        ASSERT_TRUE(sub.isUpdated());
+        EXPECT_EQ(sub.getValue<std::vector<double>>(), data);
+    }
+    vFed1->finalize();
+    vFed2->finalize();
+}
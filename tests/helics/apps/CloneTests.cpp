@@ -21,6 +21,8 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include <cstdio>
 #include <future>
+#include <string>
+#include <vector>
 
 TEST(clone_tests, simple_clone_test_pub)
 {
@@ -223,6 +225,80 @@ TEST(clone_tests, simple_clone_test_combo)
     ghc::filesystem::remove("combsave.json");
 }
 
+TEST(clone_tests, async_clone_test_combo)
+{
+    helics::FederateInfo fi(helics::CoreType::TEST);
+    fi.coreName = "clone_core_async";
+    fi.setProperty(HELICS_PROPERTY_TIME_PERIOD, 1.0);
+    fi.coreInitString = "-f 2 --autobroker";
+    helics::apps::Clone c1("c1", fi);
+    c1.setFederateToClone("block1");
+    // a small buffer so the federate thread has to wait on the writer
+    c1.enableAsyncCapture(2);
+
+    helics::CombinationFederate mfed("block1", fi);
+    auto& ept = mfed.registerGlobalEndpoint("ept1", "etype");
+    auto& ept2 = mfed.registerGlobalEndpoint("ept3");
+    helics::Publication pub1(helics::GLOBAL, &mfed, "pub1", helics::DataType::HELICS_DOUBLE);
+    auto& pub2 = mfed.registerPublication("pub2", "double", "m");
+
+    auto fut = std::async(std::launch::async, [&c1]() { c1.runTo(12); });
+    mfed.enterExecutingMode();
+    for (int ii = 1; ii <= 10; ++ii) {
+        auto retTime = mfed.requestTime(ii);
+        EXPECT_EQ(retTime, static_cast<double>(ii));
+        ept.sendTo("message", "ept3");
+        ept2.sendTo("reply", "ept1");
+        pub1.publish(1.5 * ii);
+        pub2.publish(2.5 * ii);
+    }
+    mfed.finalize();
+    fut.get();
+    c1.finalize();
+
+    EXPECT_EQ(c1.droppedCaptureCount(), 0U);
+    EXPECT_EQ(c1.messageCount(), 20U);
+    ASSERT_EQ(c1.pointCount(), 20U);
+    // the last two points are the values of both publications at time 10
+    auto val1 = c1.getValue(18);
+    auto val2 = c1.getValue(19);
+    EXPECT_NE(val1.first, val2.first);
+    EXPECT_DOUBLE_EQ(std::stod(val1.second) + std::stod(val2.second), 40.0);
+    EXPECT_TRUE(c1.getMessage(19));
+}
+
+TEST(clone_tests, async_clone_test_drop)
+{
+    helics::FederateInfo fi(helics::CoreType::TEST);
+    fi.coreName = "clone_core_async_drop";
+    fi.coreInitString = "-f 2 --autobroker";
+    helics::apps::Clone c1("c1", fi);
+    c1.setFederateToClone("block1");
+    c1.enableAsyncCapture(2, true);
+
+    helics::ValueFederate vfed("block1", fi);
+    std::vector<helics::Publication> pubs;
+    for (int ii = 0; ii < 8; ++ii) {
+        pubs.emplace_back(
+            helics::GLOBAL, &vfed, "dpub" + std::to_string(ii), helics::DataType::HELICS_DOUBLE);
+    }
+    auto fut = std::async(std::launch::async, [&c1]() { c1.runTo(12); });
+    vfed.enterExecutingMode();
+    for (int ii = 1; ii <= 10; ++ii) {
+        auto retTime = vfed.requestTime(ii);
+        EXPECT_EQ(retTime, static_cast<double>(ii));
+        for (auto& pub : pubs) {
+            pub.publish(static_cast<double>(ii));
+        }
+    }
+    vfed.finalize();
+    fut.get();
+    c1.finalize();
+    // every captured value is either stored or counted as dropped, the producer never waits
+    EXPECT_EQ(c1.pointCount() + c1.droppedCaptureCount(), 80U);
+    EXPECT_EQ(c1.stalledCaptureCount(), 0U);
+}
+
 TEST(clone_tests, simple_clone_test_sub)
 {
     helics::FederateInfo fi(helics::CoreType::TEST);
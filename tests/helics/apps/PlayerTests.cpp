@@ -13,6 +13,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/apps/BrokerApp.hpp"
 #include "helics/apps/Player.hpp"
 
+#include <fstream>
 #include <future>
 
 TEST(player_tests, simple_player_test)
@@ -242,6 +243,54 @@ TEST_P(player_file_tests, test_files)
     fut.get();
 }
 
+TEST_P(player_file_tests, test_files_streaming)
+{
+    static char indx = 'a';
+    helics::FederateInfo fi(helics::CoreType::TEST);
+    fi.coreName = std::string("pcore5s") + GetParam();
+    fi.coreName.push_back(indx++);
+    fi.coreInitString = "-f 2 --autobroker";
+    helics::apps::Player play1("player1", fi);
+    // use a small buffer so the file is parsed in several blocks
+    play1.setStreaming(true, 2);
+    play1.loadFile(std::string(TEST_DIR) + GetParam());
+
+    helics::ValueFederate vfed("block1", fi);
+    auto& sub1 = vfed.registerSubscription("pub1");
+    auto& sub2 = vfed.registerSubscription("pub2");
+    auto fut = std::async(std::launch::async, [&play1]() { play1.run(); });
+    vfed.enterExecutingMode();
+    auto val = sub1.getValue<double>();
+    EXPECT_EQ(val, 0.3);
+
+    auto retTime = vfed.requestTime(5);
+    EXPECT_EQ(retTime, 1.0);
+    val = sub1.getValue<double>();
+    EXPECT_EQ(val, 0.5);
+    val = sub2.getValue<double>();
+    EXPECT_DOUBLE_EQ(val, 0.4);
+
+    retTime = vfed.requestTime(5);
+    EXPECT_EQ(retTime, 2.0);
+    val = sub1.getValue<double>();
+    EXPECT_EQ(val, 0.7);
+    val = sub2.getValue<double>();
+    EXPECT_EQ(val, 0.6);
+
+    retTime = vfed.requestTime(5);
+    EXPECT_EQ(retTime, 3.0);
+    val = sub1.getValue<double>();
+    EXPECT_EQ(val, 0.8);
+    val = sub2.getValue<double>();
+    EXPECT_EQ(val, 0.9);
+
+    retTime = vfed.requestTime(5);
+    EXPECT_EQ(retTime, 5.0);
+    vfed.finalize();
+    fut.get();
+    EXPECT_EQ(play1.publicationCount(), 2U);
+}
+
 TEST(player_tests, simple_player_mlinecomment)
 {
     static char indx = 'a';
@@ -641,6 +690,63 @@ INSTANTIATE_TEST_SUITE_P(player_tests,
                          player_message_file_tests,
                          ::testing::ValuesIn(simple_message_files));
 
+TEST(player_tests, stream_unordered_sections)
+{
+    // each pass over the keys forms a separate time ordered section of the file
+    const std::string fileName = "stream_sections.player";
+    {
+        std::ofstream out(fileName);
+        for (int pass = 0; pass < 3; ++pass) {
+            for (int ii = 1; ii <= 4; ++ii) {
+                out << (ii * 3 - pass) << " spub d " << (ii * 3 - pass) << '\n';
+            }
+        }
+    }
+    helics::FederateInfo fi(helics::CoreType::TEST);
+    fi.coreName = "pcore_stream_sections";
+    fi.coreInitString = "-f 2 --autobroker";
+    helics::apps::Player play1("player1", fi);
+    play1.setStreaming(true, 2);
+    play1.loadFile(fileName);
+    EXPECT_TRUE(play1.isStreamed());
+    EXPECT_EQ(play1.pointCount(), 12U);
+
+    helics::ValueFederate vfed("block1", fi);
+    auto& sub1 = vfed.registerSubscription("spub");
+    auto fut = std::async(std::launch::async, [&play1]() { play1.run(); });
+    vfed.enterExecutingMode();
+    for (int ii = 1; ii <= 12; ++ii) {
+        auto retTime = vfed.requestTime(20);
+        EXPECT_EQ(retTime, static_cast<double>(ii));
+        EXPECT_EQ(sub1.getValue<double>(), static_cast<double>(ii));
+    }
+    vfed.finalize();
+    fut.get();
+    std::remove(fileName.c_str());
+}
+
+TEST(player_tests, stream_too_many_sections)
+{
+    // a file in reverse time order has a section per line so it is loaded completely
+    const std::string fileName = "stream_reversed.player";
+    {
+        std::ofstream out(fileName);
+        for (int ii = 1100; ii > 0; --ii) {
+            out << ii << " rpub d " << ii << '\n';
+        }
+    }
+    helics::FederateInfo fi(helics::CoreType::TEST);
+    fi.coreName = "pcore_stream_reversed";
+    fi.coreInitString = "-f 1 --autobroker";
+    helics::apps::Player play1("player1", fi);
+    play1.setStreaming(true, 2);
+    play1.loadFile(fileName);
+    EXPECT_FALSE(play1.isStreamed());
+    EXPECT_EQ(play1.pointCount(), 1100U);
+    play1.finalize();
+    std::remove(fileName.c_str());
+}
+
 TEST(player_tests, player_test_help)
 {
     std::vector<std::string> args{"--quiet", "--version"};
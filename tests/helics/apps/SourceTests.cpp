@@ -191,6 +191,75 @@ TEST(source_tests, sine_source_test)
     fut.get();
 }
 
+TEST(source_tests, sine_source_block_test)
+{
+    helics::FederateInfo fi(helics::CoreType::TEST);
+    fi.coreType = helics::CoreType::TEST;
+    fi.coreName = "score-sine-block";
+    fi.coreInitString = "-f 2 --autobroker";
+    helics::apps::Source src1("player1", fi);
+    src1.setBlockGeneration(true);
+
+    auto gen = src1.getGenerator(src1.addSignalGenerator("sine1", "sine"));
+    ASSERT_TRUE(gen);
+    gen->set("freq", 0.5);
+    gen->set("amplitude", 1.0);
+    gen = src1.getGenerator(src1.addSignalGenerator("sine2", "sine"));
+    ASSERT_TRUE(gen);
+    gen->set("freq", 0.5);
+    gen->set("amplitude", 2.0);
+    gen = src1.getGenerator(src1.addSignalGenerator("ramp", "ramp"));
+    ASSERT_TRUE(gen);
+    gen->set("ramp", 0.5);
+
+    src1.addPublication("pub1", "sine1", helics::DataType::HELICS_DOUBLE, 0.5);
+    src1.addPublication("pub2", "sine2", helics::DataType::HELICS_DOUBLE, 0.5);
+    src1.addPublication("pub3", "ramp", helics::DataType::HELICS_DOUBLE, 0.5);
+    // shares a generator with pub2
+    src1.addPublication("pub4", "sine2", helics::DataType::HELICS_DOUBLE, 1.0);
+    src1.setStartTime("pub1", 1.0);
+    src1.setStartTime("pub2", 1.0);
+    src1.setStartTime("pub3", 1.0);
+    src1.setStartTime("pub4", 1.0);
+    helics::ValueFederate vfed("block1", fi);
+    auto& sub1 = vfed.registerSubscription("pub1");
+    auto& sub2 = vfed.registerSubscription("pub2");
+    auto& sub3 = vfed.registerSubscription("pub3");
+    auto& sub4 = vfed.registerSubscription("pub4");
+    auto fut = std::async(std::launch::async, [&src1]() {
+        src1.runTo(5);
+        src1.finalize();
+    });
+    vfed.enterExecutingMode();
+    auto retTime = vfed.requestTime(5);
+    EXPECT_EQ(retTime, 1.0);
+    EXPECT_NEAR(sub1.getValue<double>(), 0.0, 1e-12);
+    EXPECT_NEAR(sub2.getValue<double>(), 0.0, 1e-12);
+    EXPECT_DOUBLE_EQ(sub3.getValue<double>(), 0.5);
+    EXPECT_NEAR(sub4.getValue<double>(), 0.0, 1e-12);
+
+    retTime = vfed.requestTime(5);
+    EXPECT_EQ(retTime, 1.5);
+    EXPECT_DOUBLE_EQ(sub1.getValue<double>(), -1.0);
+    EXPECT_DOUBLE_EQ(sub2.getValue<double>(), -2.0);
+    EXPECT_DOUBLE_EQ(sub3.getValue<double>(), 0.75);
+    EXPECT_FALSE(sub4.isUpdated());
+
+    retTime = vfed.requestTime(5);
+    EXPECT_EQ(retTime, 2.0);
+    EXPECT_NEAR(sub1.getValue<double>(), 0.0, 1e-12);
+    EXPECT_NEAR(sub2.getValue<double>(), 0.0, 1e-12);
+    EXPECT_DOUBLE_EQ(sub3.getValue<double>(), 1.0);
+    EXPECT_NEAR(sub4.getValue<double>(), 0.0, 1e-12);
+
+    retTime = vfed.requestTime(5);
+    EXPECT_EQ(retTime, 2.5);
+    EXPECT_DOUBLE_EQ(sub1.getValue<double>(), 1.0);
+    EXPECT_DOUBLE_EQ(sub2.getValue<double>(), 2.0);
+    vfed.finalize();
+    fut.get();
+}
+
 TEST(source_tests, simple_source_test_file)
 {
     helics::FederateInfo fi(helics::CoreType::TEST);
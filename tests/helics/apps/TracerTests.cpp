@@ -69,6 +69,45 @@ TEST(tracer_tests, simple_tracer_test)
     trace1.finalize();
 }
 
+TEST(tracer_tests, async_capture_tracer_test)
+{
+    std::atomic<double> lastVal{-1e49};
+    std::atomic<double> lastTime{0.0};
+    std::atomic<int> count{0};
+    auto cb = [&lastVal, &lastTime, &count](helics::Time tm,
+                                            const std::string& /*unused*/,
+                                            const std::string& newval) {
+        lastTime = static_cast<double>(tm);
+        lastVal = std::stod(newval);
+        ++count;
+    };
+    helics::FederateInfo fi(helics::CoreType::TEST);
+    fi.coreName = "tcore-async-tracer";
+    fi.coreInitString = "-f 2 --autobroker";
+    helics::apps::Tracer trace1("trace1", fi);
+
+    trace1.addSubscription("pub1");
+    trace1.setValueCallback(cb);
+    trace1.enableAsyncCapture(4);
+    helics::ValueFederate vfed("block1", fi);
+    helics::Publication pub1(helics::GLOBAL, &vfed, "pub1", helics::DataType::HELICS_DOUBLE);
+    auto fut = std::async(std::launch::async, [&trace1]() { trace1.runTo(12); });
+    vfed.enterExecutingMode();
+    for (int ii = 1; ii <= 10; ++ii) {
+        auto retTime = vfed.requestTime(ii);
+        EXPECT_EQ(retTime, static_cast<double>(ii));
+        pub1.publish(1.5 * ii);
+    }
+    vfed.finalize();
+    fut.get();
+    // all the captured values are processed before runTo returns
+    EXPECT_EQ(count.load(), 10);
+    EXPECT_DOUBLE_EQ(lastTime.load(), 10.0);
+    EXPECT_DOUBLE_EQ(lastVal.load(), 15.0);
+    EXPECT_EQ(trace1.droppedCaptureCount(), 0U);
+    trace1.finalize();
+}
+
 TEST(tracer_tests, tracer_test_message)
 {
     gmlc::libguarded::guarded<std::unique_ptr<helics::Message>> mguard;
@@ -0,0 +1,123 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/common/InterfaceConfigReader.hpp"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace helics;
+
+/** collect the keys of the elements of a section*/
+static std::vector<std::string> sectionKeys(const InterfaceConfigReader& config,
+                                            std::string_view section)
+{
+    std::vector<std::string> keys;
+    config.forEachElement(section, [&keys](const Json::Value& element) {
+        keys.push_back(element["key"].asString());
+    });
+    return keys;
+}
+
+TEST(interface_config_reader, basic_sections)
+{
+    InterfaceConfigReader config(
+        R"({"name":"fed1","publications":[{"key":"pub1","type":"double"},{"key":"pub2"}],)"
+        R"("endpoints":[],"period":0.5})");
+    EXPECT_FALSE(config.isManifest());
+    EXPECT_TRUE(config.isMember("name"));
+    EXPECT_TRUE(config.isMember("endpoints"));
+    EXPECT_FALSE(config.isMember("inputs"));
+    EXPECT_EQ(sectionKeys(config, "publications"), (std::vector<std::string>{"pub1", "pub2"}));
+    EXPECT_EQ(config.forEachElement("endpoints", [](const Json::Value& /*element*/) {}), 0U);
+    EXPECT_EQ(config.forEachElement("inputs", [](const Json::Value& /*element*/) {}), 0U);
+    // scalar members have no elements
+    EXPECT_EQ(config.forEachElement("period", [](const Json::Value& /*element*/) {}), 0U);
+
+    auto doc = config.getDocumentWithout({"publications", "endpoints"});
+    EXPECT_EQ(doc["name"].asString(), "fed1");
+    EXPECT_DOUBLE_EQ(doc["period"].asDouble(), 0.5);
+    EXPECT_FALSE(doc.isMember("publications"));
+    EXPECT_FALSE(doc.isMember("endpoints"));
+
+    auto sub = config.getSubDocument({"publications", "inputs"});
+    EXPECT_EQ(sub["publications"].size(), 2U);
+    EXPECT_FALSE(sub.isMember("inputs"));
+}
+
+TEST(interface_config_reader, comments)
+{
+    InterfaceConfigReader config(R"(// leading comment
+{
+    /* block comment before a key */ "name": "fed1", // trailing comment
+    "inputs": [
+        {"key": "in1"}, /* comment between elements */
+        // comment on its own line
+        {"key": "in2" /* comment inside an element */}
+    ],
+    "period": 1 /* comment between a value and a separator */ ,
+    "note": "text with // and /* that are not comments */"
+}
+/* trailing comment */)");
+    EXPECT_TRUE(config.isMember("name"));
+    EXPECT_TRUE(config.isMember("period"));
+    EXPECT_EQ(sectionKeys(config, "inputs"), (std::vector<std::string>{"in1", "in2"}));
+    auto doc = config.getSubDocument({"name", "note", "period"});
+    EXPECT_EQ(doc["name"].asString(), "fed1");
+    EXPECT_EQ(doc["note"].asString(), "text with // and /* that are not comments */");
+    EXPECT_EQ(doc["period"].asInt(), 1);
+}
+
+TEST(interface_config_reader, escaped_strings)
+{
+    // escaped quotes and brackets in values must not end the string or the element early
+    InterfaceConfigReader config(
+        R"({"info":"a \"quoted\" } ] value","endpoints":[{"key":"ept\"1","info":"[{"},)"
+        R"({"key":"ept\\2"}]})");
+    EXPECT_EQ(sectionKeys(config, "endpoints"), (std::vector<std::string>{"ept\"1", "ept\\2"}));
+    EXPECT_EQ(config.getSubDocument({"info"})["info"].asString(), "a \"quoted\" } ] value");
+}
+
+TEST(interface_config_reader, escaped_keys)
+{
+    // escaped top level keys are handled by the full parser
+    InterfaceConfigReader config(
+        R"({"na\"me":"fed1","publications":[{"key":"pub1"},{"key":"pub2"}]})");
+    EXPECT_TRUE(config.isMember("na\"me"));
+    EXPECT_TRUE(config.isMember("publications"));
+    EXPECT_EQ(sectionKeys(config, "publications"), (std::vector<std::string>{"pub1", "pub2"}));
+    auto doc = config.getDocumentWithout({"publications"});
+    EXPECT_EQ(doc["na\"me"].asString(), "fed1");
+    EXPECT_FALSE(doc.isMember("publications"));
+}
+
+TEST(interface_config_reader, object_sections)
+{
+    // the elements of an object valued section are the values of its members
+    InterfaceConfigReader config(
+        R"({"publications":{"p1":{"key":"pub1","type":"double"},"p2":{"key":"pub2"}},)"
+        R"("subscriptions":{"s1":{"key":"pub1"}}})");
+    EXPECT_EQ(sectionKeys(config, "publications"), (std::vector<std::string>{"pub1", "pub2"}));
+    EXPECT_EQ(sectionKeys(config, "subscriptions"), (std::vector<std::string>{"pub1"}));
+    auto sub = config.getSubDocument({"publications"});
+    ASSERT_TRUE(sub["publications"].isObject());
+    EXPECT_EQ(sub["publications"]["p1"]["type"].asString(), "double");
+}
+
+TEST(interface_config_reader, fallback)
+{
+    // an unterminated comment stops the scanner and the full parser reports the error
+    EXPECT_THROW(InterfaceConfigReader(R"({"name":"fed1" /* unterminated)"),
+                 std::invalid_argument);
+    EXPECT_THROW(InterfaceConfigReader(R"({"name":"fed1","publications":[{"key":"pub1"})"),
+                 std::invalid_argument);
+    // elements are parsed when they are read so an invalid element is reported then
+    InterfaceConfigReader config(R"({"name":"fed1","publications":[{"key":"pub1"},{"key":}]})");
+    EXPECT_THROW(sectionKeys(config, "publications"), std::invalid_argument);
+}
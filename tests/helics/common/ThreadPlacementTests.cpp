@@ -0,0 +1,71 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include <gtest/gtest.h>
+
+/** these test cases test the thread placement functions
+ */
+
+#include "helics/common/ThreadPlacement.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+#ifdef __linux__
+#    include <pthread.h>
+#    include <sched.h>
+#endif
+
+using namespace helics;
+
+TEST(thread_placement_tests, parse_cpu_set)
+{
+    EXPECT_TRUE(parseCpuSet("").empty());
+    EXPECT_EQ(parseCpuSet("3"), std::vector<int>({3}));
+    EXPECT_EQ(parseCpuSet("0-3,8"), std::vector<int>({0, 1, 2, 3, 8}));
+    EXPECT_EQ(parseCpuSet("8, 2-3 ,2"), std::vector<int>({2, 3, 8}));
+}
+
+TEST(thread_placement_tests, parse_invalid)
+{
+    EXPECT_THROW(parseCpuSet("a"), std::invalid_argument);
+    EXPECT_THROW(parseCpuSet("3-1"), std::invalid_argument);
+    EXPECT_THROW(parseCpuSet("1,"), std::invalid_argument);
+    EXPECT_THROW(parseCpuSet("1-"), std::invalid_argument);
+    EXPECT_THROW(parseCpuSet("-1"), std::invalid_argument);
+    EXPECT_THROW(parseCpuSet("1;2"), std::invalid_argument);
+}
+
+TEST(thread_placement_tests, empty_placement)
+{
+    ThreadPlacement placement;
+    EXPECT_TRUE(placement.empty());
+    EXPECT_TRUE(applyThreadPlacement(placement));
+    placement.priority = 5;
+    EXPECT_FALSE(placement.empty());
+}
+
+#ifdef __linux__
+TEST(thread_placement_tests, apply_affinity)
+{
+    cpu_set_t original;
+    ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(original), &original), 0);
+    if (CPU_ISSET(0, &original) == 0) {
+        GTEST_SKIP_("processor 0 is not available to this process");
+    }
+    ThreadPlacement placement;
+    placement.cpus = {0};
+    EXPECT_TRUE(applyThreadPlacement(placement));
+
+    cpu_set_t applied;
+    ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(applied), &applied), 0);
+    EXPECT_EQ(CPU_COUNT(&applied), 1);
+    EXPECT_NE(CPU_ISSET(0, &applied), 0);
+    // restore the original processors so the other tests are not confined to one processor
+    pthread_setaffinity_np(pthread_self(), sizeof(original), &original);
+}
+#endif
@@ -409,3 +409,67 @@ TEST(ActionMessage_tests, check_packetization)
     EXPECT_EQ(cmd.flags, cmd2.flags);
     EXPECT_TRUE(cmd.getStringData() == cmd2.getStringData());
 }
+
+TEST(ActionMessage_tests, routing_info)
+{
+    helics::ActionMessage cmd(helics::CMD_SEND_MESSAGE);
+    cmd.source_id = GlobalFederateId(1);
+    cmd.source_handle = InterfaceHandle(2);
+    cmd.dest_id = GlobalFederateId(23);
+    cmd.dest_handle = InterfaceHandle(25);
+    cmd.payload = "this is a string that is sufficiently long";
+    cmd.setStringData("target", "source");
+
+    helics::SerializedRoutingInfo info;
+    auto cmdString = cmd.to_string();
+    EXPECT_TRUE(readRoutingInfo(reinterpret_cast<std::byte*>(cmdString.data()),
+                                cmdString.size(),
+                                info));
+    EXPECT_EQ(info.action, helics::CMD_SEND_MESSAGE);
+    EXPECT_EQ(info.dest_id, cmd.dest_id);
+    EXPECT_EQ(info.dest_handle, cmd.dest_handle);
+    EXPECT_EQ(info.bodySize, cmdString.size());
+    EXPECT_EQ(info.frameSize, cmdString.size());
+
+    auto packet = cmd.packetize();
+    // a second message in the buffer should not be included in the frame
+    packet.append(cmdString);
+    EXPECT_TRUE(
+        readRoutingInfo(reinterpret_cast<std::byte*>(packet.data()), packet.size(), info));
+    EXPECT_EQ(info.action, helics::CMD_SEND_MESSAGE);
+    EXPECT_EQ(info.dest_id, cmd.dest_id);
+    EXPECT_EQ(info.bodySize, cmdString.size());
+    EXPECT_EQ(info.frameSize, packet.size() - cmdString.size());
+
+    // an incomplete packet cannot be read
+    EXPECT_FALSE(readRoutingInfo(reinterpret_cast<std::byte*>(packet.data()), 20, info));
+    EXPECT_FALSE(readRoutingInfo(reinterpret_cast<std::byte*>(cmdString.data()), 30, info));
+}
+
+TEST(ActionMessage_tests, relay_serialization)
+{
+    helics::ActionMessage cmd(helics::CMD_PUB);
+    cmd.source_id = GlobalFederateId(1);
+    cmd.source_handle = InterfaceHandle(2);
+    cmd.dest_id = GlobalFederateId(23);
+    cmd.dest_handle = InterfaceHandle(25);
+    cmd.actionTime = 45.7;
+    cmd.payload = "published value";
+    auto packet = cmd.packetize();
+
+    helics::SerializedRoutingInfo info;
+    ASSERT_TRUE(readRoutingInfo(reinterpret_cast<std::byte*>(packet.data()), packet.size(), info));
+    auto relay = createRelayCommand(info);
+    EXPECT_EQ(relay.action(), helics::CMD_RELAY);
+    EXPECT_EQ(relay.dest_id, cmd.dest_id);
+    // the relay should serialize to exactly the original message
+    EXPECT_EQ(relay.packetize(), packet);
+    EXPECT_EQ(relay.to_string(), cmd.to_string());
+
+    helics::ActionMessage cmd2(relay.to_string());
+    EXPECT_EQ(cmd2.action(), helics::CMD_PUB);
+    EXPECT_EQ(cmd2.actionTime, cmd.actionTime);
+    EXPECT_EQ(cmd2.source_handle, cmd.source_handle);
+    EXPECT_EQ(cmd2.dest_handle, cmd.dest_handle);
+    EXPECT_EQ(cmd2.payload, cmd.payload);
+}
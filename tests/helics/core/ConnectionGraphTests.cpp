@@ -0,0 +1,122 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "helics/core/ConnectionGraph.hpp"
+
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+using helics::ConnectionGraph;
+using helics::InterfaceType;
+
+static ConnectionGraph makeGraph()
+{
+    ConnectionGraph graph;
+    graph.addFederate("fedA");
+    graph.addFederate("fedB");
+    graph.addInterface("pub1", {"fedA", InterfaceType::PUBLICATION, "double", "V"});
+    graph.addInterface("in1", {"fedB", InterfaceType::INPUT, "double", "kV"});
+    graph.addInterface("in2", {"fedB", InterfaceType::INPUT, "", ""});
+    graph.addInterface("ept", {"fedB", InterfaceType::ENDPOINT, "", ""});
+    graph.addConnection("pub1", "in1", true, 0);
+    graph.addConnection("pub1", "in2", false, 4);
+    return graph;
+}
+
+TEST(connectionGraph_tests, connections)
+{
+    auto graph = makeGraph();
+    EXPECT_FALSE(graph.addConnection("pub1", "in1", false, 0));
+    EXPECT_FALSE(graph.addConnection("", "in1", true, 0));
+    EXPECT_EQ(graph.connectionCount(), 2U);
+    EXPECT_TRUE(graph.hasConnection("pub1", "in2"));
+    EXPECT_FALSE(graph.hasConnection("in2", "pub1"));
+
+    EXPECT_EQ(graph.connectionsOf(InterfaceType::PUBLICATION, "pub1").size(), 2U);
+    auto inputConnections = graph.connectionsOf(InterfaceType::INPUT, "in2");
+    ASSERT_EQ(inputConnections.size(), 1U);
+    EXPECT_EQ(inputConnections[0]->publication, "pub1");
+    EXPECT_FALSE(inputConnections[0]->declaredByInput);
+    EXPECT_EQ(inputConnections[0]->flags, 4);
+    EXPECT_TRUE(graph.connectionsOf(InterfaceType::ENDPOINT, "ept").empty());
+
+    EXPECT_TRUE(graph.matches("in1", {"fedB", InterfaceType::INPUT, "double", "kV"}));
+    EXPECT_FALSE(graph.matches("in1", {"fedB", InterfaceType::INPUT, "double", "V"}));
+    EXPECT_FALSE(graph.matches("in1", {"fedA", InterfaceType::INPUT, "double", "kV"}));
+    EXPECT_FALSE(graph.matches("in3", {"fedB", InterfaceType::INPUT, "double", "kV"}));
+}
+
+TEST(connectionGraph_tests, shared_names)
+{
+    // publications and inputs have separate name spaces
+    ConnectionGraph graph;
+    graph.addInterface("value", {"fedA", InterfaceType::PUBLICATION, "double", ""});
+    graph.addInterface("value", {"fedB", InterfaceType::INPUT, "int", ""});
+    graph.addInterface("other", {"fedB", InterfaceType::INPUT, "double", ""});
+    graph.addConnection("value", "other", true, 0);
+
+    EXPECT_TRUE(graph.matches("value", {"fedA", InterfaceType::PUBLICATION, "double", ""}));
+    EXPECT_TRUE(graph.matches("value", {"fedB", InterfaceType::INPUT, "int", ""}));
+    ASSERT_NE(graph.findInterface(InterfaceType::INPUT, "value"), nullptr);
+    EXPECT_EQ(graph.findInterface(InterfaceType::INPUT, "value")->federate, "fedB");
+    EXPECT_EQ(graph.findInterface(InterfaceType::ENDPOINT, "value"), nullptr);
+
+    EXPECT_EQ(graph.connectionsOf(InterfaceType::PUBLICATION, "value").size(), 1U);
+    EXPECT_TRUE(graph.connectionsOf(InterfaceType::INPUT, "value").empty());
+    EXPECT_TRUE(graph.connectionsOf(InterfaceType::PUBLICATION, "other").empty());
+    EXPECT_EQ(graph.connectionsOf(InterfaceType::INPUT, "other").size(), 1U);
+}
+
+TEST(connectionGraph_tests, configuration_hash)
+{
+    auto graph = makeGraph();
+    ConnectionGraph reordered;
+    reordered.addFederate("fedB");
+    reordered.addFederate("fedA");
+    EXPECT_EQ(graph.configurationHash(2), reordered.configurationHash(2));
+    EXPECT_NE(graph.configurationHash(2), graph.configurationHash(3));
+    reordered.addFederate("fedC");
+    EXPECT_NE(graph.configurationHash(2), reordered.configurationHash(2));
+}
+
+TEST(connectionGraph_tests, save_load)
+{
+    const std::string fileName{"connection_graph_test.json"};
+    auto graph = makeGraph();
+    graph.save(fileName, 2);
+
+    ConnectionGraph loaded;
+    loaded.load(fileName);
+    std::remove(fileName.c_str());
+    EXPECT_EQ(loaded.storedHash(), graph.configurationHash(2));
+    EXPECT_EQ(loaded.configurationHash(2), loaded.storedHash());
+    EXPECT_TRUE(loaded.hasFederate("fedA"));
+    EXPECT_TRUE(loaded.hasFederate("fedB"));
+    EXPECT_EQ(loaded.connectionCount(), 2U);
+    EXPECT_TRUE(loaded.matches("pub1", {"fedA", InterfaceType::PUBLICATION, "double", "V"}));
+    EXPECT_TRUE(loaded.matches("ept", {"fedB", InterfaceType::ENDPOINT, "", ""}));
+    auto conns = loaded.connectionsOf(InterfaceType::INPUT, "in2");
+    ASSERT_EQ(conns.size(), 1U);
+    EXPECT_FALSE(conns[0]->declaredByInput);
+    EXPECT_EQ(conns[0]->flags, 4);
+}
+
+TEST(connectionGraph_tests, load_invalid)
+{
+    ConnectionGraph graph;
+    EXPECT_THROW(graph.load("not_a_connection_graph_file.json"), std::invalid_argument);
+
+    const std::string fileName{"connection_graph_invalid.json"};
+    {
+        std::ofstream out(fileName);
+        out << R"({"version":1, "federates":[{"name":3}]})";
+    }
+    EXPECT_THROW(graph.load(fileName), std::invalid_argument);
+    std::remove(fileName.c_str());
+    EXPECT_TRUE(graph.empty());
+}
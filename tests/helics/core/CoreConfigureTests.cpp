@@ -6,8 +6,18 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #include "helics/core/CommonCore.hpp"
 #include "helics/core/CoreFactory.hpp"
+#include "helics/core/helics_definitions.hpp"
+#include "helics/network/test/TestCore.h"
 
 #include "gtest/gtest.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#    include <sched.h>
+#endif
 
 TEST(CoreConfig, test1)
 {
@@ -52,3 +62,30 @@ TEST(CoreConfig, getFlagTests)
     EXPECT_TRUE(cr->getFlagOption(helics::gLocalCoreId, HELICS_FLAG_DUMPLOG));
     cr->disconnect();
 }
+
+#ifdef __linux__
+TEST(CoreConfig, processing_cpus)
+{
+    cpu_set_t available;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(available), &available), 0);
+    if (CPU_ISSET(0, &available) == 0) {
+        GTEST_SKIP_("processor 0 is not available to this process");
+    }
+    auto cr = std::make_shared<helics::testcore::TestCore>("processing_cpus_core");
+    std::mutex logLock;
+    std::vector<std::string> warnings;
+    // the logger is set before configuring since the placement is applied during configuration
+    cr->setLoggerFunction([&logLock, &warnings](int level,
+                                                std::string_view /*identifier*/,
+                                                std::string_view message) {
+        if (level <= HELICS_LOG_LEVEL_WARNING) {
+            std::lock_guard<std::mutex> lock(logLock);
+            warnings.emplace_back(message);
+        }
+    });
+    cr->configure("--processing_cpus=0");
+    cr->disconnect();
+    std::lock_guard<std::mutex> lock(logLock);
+    EXPECT_TRUE(warnings.empty()) << warnings.front();
+}
+#endif
@@ -59,6 +59,20 @@ TEST(CoreFactory_tests, TestCore_test)
     core->disconnect();
     core = nullptr;
 }
+TEST(CoreFactory_tests, RootCore_test)
+{
+    EXPECT_EQ(helics::core::isCoreTypeAvailable(helics::CoreType::ROOT), true);
+    EXPECT_EQ(helics::core::coreTypeFromString("root"), helics::CoreType::ROOT);
+
+    auto core = helics::CoreFactory::create(helics::CoreType::ROOT, "");
+    ASSERT_TRUE(core);
+    EXPECT_TRUE(core->connect());
+    EXPECT_TRUE(core->isConnected());
+    core->disconnect();
+    EXPECT_FALSE(core->isConnected());
+    core = nullptr;
+}
+
 #ifdef ENABLE_IPC_CORE
 TEST(CoreFactory_tests, InterprocessCore_test)
 {
@@ -0,0 +1,87 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "helics/core/DenseIdTable.hpp"
+
+#include "gtest/gtest.h"
+#include <map>
+
+using helics::DenseIndexTable;
+using helics::GlobalFederateId;
+using helics::GlobalIdTable;
+using helics::route_id;
+
+TEST(denseIdTable_tests, dense_and_sparse)
+{
+    DenseIndexTable<int> table(100, 10);
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.find(100), nullptr);
+    EXPECT_TRUE(table.emplace(100, 1));
+    EXPECT_TRUE(table.emplace(109, 2));
+    // outside the window on either side
+    EXPECT_TRUE(table.emplace(110, 3));
+    EXPECT_TRUE(table.emplace(-4, 4));
+    EXPECT_FALSE(table.emplace(100, 5));
+    EXPECT_EQ(table.size(), 4U);
+
+    ASSERT_NE(table.find(100), nullptr);
+    EXPECT_EQ(*table.find(100), 1);
+    EXPECT_EQ(*table.find(109), 2);
+    EXPECT_EQ(*table.find(110), 3);
+    EXPECT_EQ(*table.find(-4), 4);
+    EXPECT_EQ(table.find(105), nullptr);
+
+    table[105] = 6;
+    table[110] = 7;
+    EXPECT_EQ(*table.find(105), 6);
+    EXPECT_EQ(*table.find(110), 7);
+    EXPECT_EQ(table.size(), 5U);
+
+    EXPECT_TRUE(table.erase(105));
+    EXPECT_FALSE(table.erase(105));
+    EXPECT_TRUE(table.erase(-4));
+    EXPECT_EQ(table.find(105), nullptr);
+    EXPECT_EQ(table.find(-4), nullptr);
+    EXPECT_EQ(table.size(), 3U);
+
+    table.clear();
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.find(100), nullptr);
+}
+
+TEST(denseIdTable_tests, global_ids)
+{
+    GlobalIdTable<route_id> table;
+    const GlobalFederateId fed1(helics::gGlobalFederateIdShift);
+    const GlobalFederateId fed2(helics::gGlobalFederateIdShift + 12);
+    const GlobalFederateId broker1(helics::gGlobalBrokerIdShift + 3);
+
+    table.emplace(fed1, route_id(1));
+    table.emplace(fed2, route_id(2));
+    table[broker1] = route_id(3);
+    table[helics::parent_broker_id] = route_id(4);
+    table[helics::root_broker_id] = route_id(5);
+    EXPECT_EQ(table.size(), 5U);
+
+    EXPECT_EQ(*table.find(fed1), route_id(1));
+    EXPECT_EQ(*table.find(fed2), route_id(2));
+    EXPECT_EQ(*table.find(broker1), route_id(3));
+    EXPECT_EQ(*table.find(helics::parent_broker_id), route_id(4));
+    EXPECT_EQ(*table.find(helics::root_broker_id), route_id(5));
+    EXPECT_EQ(table.find(GlobalFederateId(helics::gGlobalFederateIdShift + 1)), nullptr);
+    EXPECT_EQ(table.find(GlobalFederateId{}), nullptr);
+
+    std::map<GlobalFederateId, route_id> contents;
+    table.forEach([&contents](GlobalFederateId id, route_id rid) { contents.emplace(id, rid); });
+    EXPECT_EQ(contents.size(), 5U);
+    EXPECT_EQ(contents[fed2], route_id(2));
+    EXPECT_EQ(contents[helics::parent_broker_id], route_id(4));
+
+    EXPECT_TRUE(table.erase(fed2));
+    EXPECT_EQ(table.find(fed2), nullptr);
+    table.clear();
+    EXPECT_TRUE(table.empty());
+}
@@ -8,6 +8,8 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/core/EndpointInfo.hpp"
 #include "helics/core/FilterInfo.hpp"
 #include "helics/core/InputInfo.hpp"
+#include "helics/core/PublicationInfo.hpp"
+#include "helics/core/deltaEncoding.hpp"
 
 #include "gtest/gtest.h"
 
@@ -332,3 +334,85 @@ TEST(InfoClass_tests, inputinfo_test)
     ret_data = subI.getData(0);
     EXPECT_EQ(ret_data->to_string(), "time one");
 }
+
+TEST(InfoClass_tests, publication_delta_test)
+{
+    helics::PublicationInfo pubI(helics::GlobalHandle(helics::GlobalFederateId(5),
+                                                      helics::InterfaceHandle(45)),
+                                 "pub",
+                                 "type",
+                                 "units");
+    pubI.transmit_deltas = true;
+    pubI.keyframe_interval = 2;
+
+    helics::InputInfo subI(helics::GlobalHandle(helics::GlobalFederateId(6),
+                                                helics::InterfaceHandle(13)),
+                           "key",
+                           "type",
+                           "units");
+    subI.addSource(pubI.id, "pub", "type", std::string());
+
+    std::string value(1000, 'a');
+    helics::SmallBuffer delta;
+    // no base value so a delta cannot be applied
+    EXPECT_FALSE(subI.addDeltaData(pubI.id, helics::timeZero, 0, helics::SmallBuffer(value)));
+    // the first value is always transmitted in full
+    EXPECT_FALSE(pubI.generateDelta(value.data(), value.size(), 1, delta));
+    subI.addData(pubI.id, helics::timeZero, 0, std::make_shared<helics::SmallBuffer>(value));
+
+    for (int ii = 1; ii <= 2; ++ii) {
+        value[ii * 100] = 'b';
+        ASSERT_TRUE(pubI.generateDelta(value.data(), value.size(), 1, delta));
+        EXPECT_LT(delta.size(), 100U);
+        EXPECT_TRUE(subI.addDeltaData(pubI.id, ii, 0, delta));
+        subI.updateTimeInclusive(ii);
+        EXPECT_EQ(subI.getData(0)->to_string(), value);
+    }
+    value[300] = 'c';
+    // keyframe interval has been reached
+    EXPECT_FALSE(pubI.generateDelta(value.data(), value.size(), 1, delta));
+    value[400] = 'c';
+    EXPECT_TRUE(pubI.generateDelta(value.data(), value.size(), 1, delta));
+    // a new subscriber requires a full value
+    value[500] = 'c';
+    EXPECT_FALSE(pubI.generateDelta(value.data(), value.size(), 2, delta));
+    // a delta against a mismatched base is rejected
+    helics::SmallBuffer wrongBase(std::string(1001, 'a'));
+    helics::SmallBuffer result;
+    EXPECT_FALSE(helics::applyDataDelta(wrongBase.to_string(), delta.to_string(), result));
+}
+
+TEST(InfoClass_tests, input_change_detection_test)
+{
+    helics::InputInfo subI(helics::GlobalHandle(helics::GlobalFederateId(6),
+                                                helics::InterfaceHandle(13)),
+                           "key",
+                           "type",
+                           "units");
+    helics::GlobalHandle testHandle(helics::GlobalFederateId(5), helics::InterfaceHandle(45));
+    subI.addSource(testHandle, "", "double", std::string());
+    // nothing has been added
+    EXPECT_FALSE(subI.lastValueChanged());
+
+    subI.addData(testHandle, helics::timeZero, 0, std::make_shared<helics::SmallBuffer>("aaaa"));
+    // the first value from a source is always a change
+    EXPECT_TRUE(subI.lastValueChanged());
+    subI.addData(testHandle, helics::timeZero, 1, std::make_shared<helics::SmallBuffer>("aaaa"));
+    EXPECT_FALSE(subI.lastValueChanged());
+    subI.addData(testHandle, helics::timeZero, 2, std::make_shared<helics::SmallBuffer>("aaab"));
+    EXPECT_TRUE(subI.lastValueChanged());
+
+    // only a change in length counts with a custom detector
+    subI.changeDetector = [](const helics::SmallBuffer& prev, const helics::SmallBuffer& update) {
+        return prev.size() != update.size();
+    };
+    subI.addData(testHandle, helics::timeZero, 3, std::make_shared<helics::SmallBuffer>("abcd"));
+    EXPECT_FALSE(subI.lastValueChanged());
+    subI.addData(testHandle, helics::timeZero, 4, std::make_shared<helics::SmallBuffer>("abcde"));
+    EXPECT_TRUE(subI.lastValueChanged());
+
+    // values from an unknown source are not added
+    helics::GlobalHandle otherHandle(helics::GlobalFederateId(7), helics::InterfaceHandle(45));
+    subI.addData(otherHandle, helics::timeZero, 5, std::make_shared<helics::SmallBuffer>("a"));
+    EXPECT_FALSE(subI.lastValueChanged());
+}
@@ -8,23 +8,16 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/core/MessageTimer.hpp"
 
 #include "gtest/gtest.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
 using namespace helics;
 
 using namespace std::literals::chrono_literals;
 
 TEST(messageTimer_tests, basic_test)
 {
-    auto contextPtr = AsioContextManager::getContextPointer();
-    auto loopHandle = contextPtr->startContextLoop();
-    if (!contextPtr->isRunning()) {
-        std::this_thread::sleep_for(600ms);
-    }
-    auto loopHandle2 = contextPtr->startContextLoop();
-    if (!contextPtr->isRunning()) {
-        std::this_thread::sleep_for(600ms);
-    }
-    // if this fails there is a separate error path that this doesn't account for
-    EXPECT_TRUE(contextPtr->isRunning());
     gmlc::libguarded::atomic_guarded<ActionMessage> M;
     auto cback = [&M](ActionMessage&& m) { M = std::move(m); };
     auto mtimer = std::make_shared<MessageTimer>(cback);
@@ -258,3 +251,119 @@ TEST(messageTimer_tests_ci_skip, basic_test_updatemessage2)
     localLock.lock();
     EXPECT_TRUE(M.action() == CMD_BROKER_ACK);
 }
+
+TEST(messageTimer_tests, slot_reuse)
+{
+    std::atomic<int> count{0};
+    auto cback = [&](ActionMessage&& /*m*/) { ++count; };
+    auto mtimer = std::make_shared<MessageTimer>(cback);
+    auto index1 = mtimer->addTimerFromNow(10s, CMD_PROTOCOL);
+    auto index2 = mtimer->addTimerFromNow(10s, CMD_PROTOCOL);
+    EXPECT_NE(index1, index2);
+    mtimer->releaseTimer(index1);
+    auto index3 = mtimer->addTimerFromNow(10ms, CMD_PROTOCOL);
+    EXPECT_EQ(index3, index1);
+    EXPECT_EQ(mtimer->slotCount(), 2U);
+    // a released timer can no longer be modified
+    mtimer->releaseTimer(index2);
+    EXPECT_FALSE(mtimer->updateTimer(index2, std::chrono::steady_clock::now()));
+    std::this_thread::sleep_for(200ms);
+    EXPECT_EQ(count.load(), 1);
+}
+
+TEST(messageTimer_tests, spin_window)
+{
+    std::atomic<int> count{0};
+    auto cback = [&](ActionMessage&& /*m*/) { ++count; };
+    auto mtimer = std::make_shared<MessageTimer>(cback);
+    mtimer->setSpinWindow(2ms);
+    for (int ii = 0; ii < 10; ++ii) {
+        mtimer->addTimerFromNow(std::chrono::milliseconds(5 * ii + 5), CMD_PROTOCOL);
+    }
+    std::this_thread::sleep_for(300ms);
+    EXPECT_EQ(count.load(), 10);
+}
+
+TEST(messageTimer_tests, shared_driver)
+{
+    std::atomic<int> count1{0};
+    std::atomic<int> count2{0};
+    auto mtimer1 = std::make_shared<MessageTimer>([&](ActionMessage&& /*m*/) { ++count1; });
+    auto mtimer2 = std::make_shared<MessageTimer>([&](ActionMessage&& /*m*/) { ++count2; });
+    for (int ii = 0; ii < 5; ++ii) {
+        mtimer1->addTimerFromNow(std::chrono::milliseconds(10 * ii + 10), CMD_PROTOCOL);
+        mtimer2->addTimerFromNow(std::chrono::milliseconds(10 * ii + 15), CMD_PROTOCOL);
+    }
+    // a destroyed timer sends nothing more and does not affect the other timers
+    mtimer1->addTimerFromNow(100ms, CMD_PROTOCOL);
+    std::this_thread::sleep_for(80ms);
+    mtimer1.reset();
+    mtimer2->addTimerFromNow(20ms, CMD_PROTOCOL);
+    std::this_thread::sleep_for(200ms);
+    EXPECT_EQ(count1.load(), 5);
+    EXPECT_EQ(count2.load(), 6);
+}
+
+TEST(messageTimer_tests, destroy_from_callback)
+{
+    std::mutex tlock;
+    std::shared_ptr<MessageTimer> mtimer;
+    std::atomic<int> count{0};
+    auto cback = [&](ActionMessage&& /*m*/) {
+        ++count;
+        // release the last reference to the timer from within its own callback
+        std::shared_ptr<MessageTimer> local;
+        {
+            std::lock_guard<std::mutex> lock(tlock);
+            local = std::move(mtimer);
+        }
+        local.reset();
+    };
+    {
+        std::lock_guard<std::mutex> lock(tlock);
+        mtimer = std::make_shared<MessageTimer>(cback);
+        // both expire in the same pass of the driver,  the second must not be sent
+        auto expiration = std::chrono::steady_clock::now() + 20ms;
+        mtimer->addTimer(expiration, CMD_PROTOCOL);
+        mtimer->addTimer(expiration, CMD_PROTOCOL);
+    }
+    std::this_thread::sleep_for(200ms);
+    EXPECT_EQ(count.load(), 1);
+
+    // the driver keeps running for other timers
+    std::atomic<int> count2{0};
+    auto mtimer2 = std::make_shared<MessageTimer>([&](ActionMessage&& /*m*/) { ++count2; });
+    mtimer2->addTimerFromNow(10ms, CMD_PROTOCOL);
+    std::this_thread::sleep_for(100ms);
+    EXPECT_EQ(count2.load(), 1);
+}
+
+TEST(messageTimer_tests, destroy_waits_for_send)
+{
+    std::atomic<bool> inCallback{false};
+    std::atomic<bool> finished{false};
+    auto mtimer = std::make_shared<MessageTimer>([&](ActionMessage&& /*m*/) {
+        inCallback = true;
+        std::this_thread::sleep_for(100ms);
+        finished = true;
+    });
+    mtimer->addTimerFromNow(5ms, CMD_PROTOCOL);
+    while (!inCallback.load()) {
+        std::this_thread::yield();
+    }
+    mtimer.reset();
+    // the destructor returns only after the send function completes
+    EXPECT_TRUE(finished.load());
+}
+
+TEST(messageTimer_tests, driver_restart)
+{
+    // destroying the last timer joins the driver thread and the next timer starts a new one
+    for (int ii = 0; ii < 3; ++ii) {
+        std::atomic<int> count{0};
+        auto mtimer = std::make_shared<MessageTimer>([&](ActionMessage&& /*m*/) { ++count; });
+        mtimer->addTimerFromNow(5ms, CMD_PROTOCOL);
+        std::this_thread::sleep_for(100ms);
+        EXPECT_EQ(count.load(), 1);
+    }
+}
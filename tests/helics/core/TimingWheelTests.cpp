@@ -0,0 +1,116 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "helics/core/TimingWheel.hpp"
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace std::literals::chrono_literals;
+using helics::TimingWheel;
+
+TEST(timingWheel_tests, single_entry)
+{
+    auto start = std::chrono::steady_clock::now();
+    TimingWheel wheel(start, 1ms);
+    EXPECT_EQ(wheel.nextExpiration(), TimingWheel::time_type::max());
+    wheel.schedule(3, 1, start + 10500us);
+    EXPECT_EQ(wheel.size(), 1U);
+    EXPECT_EQ(wheel.nextExpiration(), start + 10500us);
+
+    std::vector<TimingWheel::Entry> expired;
+    wheel.advance(start + 10ms, expired);
+    EXPECT_TRUE(expired.empty());
+    wheel.advance(start + 10499us, expired);
+    EXPECT_TRUE(expired.empty());
+    wheel.advance(start + 10500us, expired);
+    ASSERT_EQ(expired.size(), 1U);
+    EXPECT_EQ(expired[0].index, 3);
+    EXPECT_EQ(expired[0].generation, 1U);
+    EXPECT_EQ(wheel.size(), 0U);
+}
+
+TEST(timingWheel_tests, past_entry)
+{
+    auto start = std::chrono::steady_clock::now();
+    TimingWheel wheel(start, 1ms);
+    std::vector<TimingWheel::Entry> expired;
+    wheel.advance(start + 200ms, expired);
+    wheel.schedule(1, 0, start + 5ms);
+    EXPECT_EQ(wheel.nextExpiration(), start + 5ms);
+    wheel.advance(start + 200ms, expired);
+    ASSERT_EQ(expired.size(), 1U);
+    EXPECT_EQ(expired[0].index, 1);
+}
+
+TEST(timingWheel_tests, upper_levels)
+{
+    auto start = std::chrono::steady_clock::now();
+    TimingWheel wheel(start, 1ms);
+    // one entry for each level and one in the overflow list
+    std::vector<std::chrono::milliseconds> delays{5ms,
+                                                  300ms,
+                                                  70s,
+                                                  std::chrono::milliseconds(20000000),
+                                                  std::chrono::milliseconds(2000000000)};
+    for (std::size_t ii = 0; ii < delays.size(); ++ii) {
+        wheel.schedule(static_cast<std::int32_t>(ii), 0, start + delays[ii]);
+    }
+    std::vector<TimingWheel::Entry> expired;
+    for (std::size_t ii = 0; ii < delays.size(); ++ii) {
+        wheel.advance(start + delays[ii] - 1us, expired);
+        EXPECT_EQ(expired.size(), ii);
+        wheel.advance(start + delays[ii], expired);
+        ASSERT_EQ(expired.size(), ii + 1);
+        EXPECT_EQ(expired.back().index, static_cast<std::int32_t>(ii));
+    }
+    EXPECT_EQ(wheel.size(), 0U);
+}
+
+TEST(timingWheel_tests, next_expiration_order)
+{
+    auto start = std::chrono::steady_clock::now();
+    TimingWheel wheel(start, 1ms);
+    wheel.schedule(0, 0, start + 500ms);
+    // the upper level is not examined until the next block of the lowest level
+    EXPECT_EQ(wheel.nextExpiration(), start + 64ms);
+    std::vector<TimingWheel::Entry> expired;
+    wheel.advance(start + 448ms, expired);
+    EXPECT_EQ(wheel.nextExpiration(), start + 500ms);
+    EXPECT_TRUE(expired.empty());
+}
+
+TEST(timingWheel_tests, random_order)
+{
+    auto start = std::chrono::steady_clock::now();
+    TimingWheel wheel(start, 1ms);
+    std::mt19937 gen(5);
+    std::uniform_int_distribution<std::int64_t> dist(0, 10000000);
+    std::vector<std::chrono::microseconds> delays;
+    for (int ii = 0; ii < 2000; ++ii) {
+        delays.emplace_back(dist(gen));
+        wheel.schedule(ii, 0, start + delays.back());
+    }
+    std::vector<TimingWheel::Entry> expired;
+    auto current = start;
+    while (wheel.size() > 0) {
+        current = wheel.nextExpiration();
+        auto count = expired.size();
+        wheel.advance(current, expired);
+        for (auto ii = count; ii < expired.size(); ++ii) {
+            EXPECT_EQ(expired[ii].expiration, start + delays[expired[ii].index]);
+            EXPECT_LE(expired[ii].expiration, current);
+        }
+    }
+    ASSERT_EQ(expired.size(), delays.size());
+    EXPECT_TRUE(std::is_sorted(expired.begin(),
+                               expired.end(),
+                               [](const auto& entry1, const auto& entry2) {
+                                   return entry1.expiration < entry2.expiration;
+                               }));
+}
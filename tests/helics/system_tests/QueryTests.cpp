@@ -13,9 +13,13 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/application_api/ValueFederate.hpp"
 #include "helics/application_api/queryFunctions.hpp"
 #include "helics/common/JsonProcessingFunctions.hpp"
+#include "helics/core/ActionMessage.hpp"
+#include "helics/core/CommonCore.hpp"
 #include "helics/core/helicsVersion.hpp"
 
 #include "gtest/gtest.h"
+#include <future>
+#include <string_view>
 #include <thread>
 
 struct query: public FederateTestFixture, public ::testing::Test {
@@ -268,6 +272,68 @@ TEST_F(query, global_time)
     helics::cleanupHelicsLibrary();
 }
 
+TEST_F(query, global_time_incremental)
+{
+    extraBrokerArgs = "--incremental_maps";
+    SetupTest<helics::ValueFederate>("test", 2);
+    auto vFed1 = GetFederateAs<helics::ValueFederate>(0);
+    auto vFed2 = GetFederateAs<helics::ValueFederate>(1);
+    auto core = vFed1->getCorePointer();
+
+    vFed1->enterExecutingModeAsync();
+    vFed2->enterExecutingMode();
+    vFed1->enterExecutingModeComplete();
+
+    auto res = core->query("root", "global_time", HELICS_QUERY_MODE_FAST);
+    auto val = loadJsonStr(res);
+    ASSERT_EQ(val["cores"].size(), 1U);
+    ASSERT_EQ(val["cores"][0]["federates"].size(), 2U);
+    EXPECT_EQ(val["cores"][0]["federates"][0]["granted_time"].asDouble(), 0.0);
+    // nothing has changed so the same map should be returned
+    EXPECT_EQ(core->query("root", "global_time", HELICS_QUERY_MODE_FAST), res);
+
+    vFed2->requestTimeAsync(1.0);
+    vFed1->requestTime(1.0);
+    vFed2->requestTimeComplete();
+
+    res = core->query("root", "global_time", HELICS_QUERY_MODE_FAST);
+    val = loadJsonStr(res);
+    ASSERT_EQ(val["cores"].size(), 1U);
+    ASSERT_EQ(val["cores"][0]["federates"].size(), 2U);
+    EXPECT_EQ(val["cores"][0]["federates"][0]["granted_time"].asDouble(), 1.0);
+    EXPECT_EQ(val["cores"][0]["federates"][1]["granted_time"].asDouble(), 1.0);
+
+    core = nullptr;
+    vFed1->finalize();
+    vFed2->finalize();
+    helics::cleanupHelicsLibrary();
+}
+
+TEST_F(query, dependency_graph_incremental)
+{
+    extraBrokerArgs = "--incremental_maps";
+    SetupTest<helics::ValueFederate>("test", 2);
+    auto vFed1 = GetFederateAs<helics::ValueFederate>(0);
+    auto vFed2 = GetFederateAs<helics::ValueFederate>(1);
+    vFed1->registerGlobalPublication<double>("test1");
+    auto core = vFed1->getCorePointer();
+    auto res1 = core->query("root", "dependency_graph", HELICS_QUERY_MODE_FAST);
+    EXPECT_EQ(core->query("root", "dependency_graph", HELICS_QUERY_MODE_FAST), res1);
+    vFed2->registerSubscription("test1");
+    vFed1->enterInitializingModeAsync();
+    vFed2->enterInitializingMode();
+    vFed1->enterInitializingModeComplete();
+    auto res2 = core->query("root", "dependency_graph", HELICS_QUERY_MODE_FAST);
+    EXPECT_NE(res1, res2);
+    auto val = loadJsonStr(res2);
+    ASSERT_EQ(val["cores"].size(), 1U);
+    EXPECT_EQ(val["cores"][0]["federates"].size(), 2U);
+    core = nullptr;
+    vFed1->finalize();
+    vFed2->finalize();
+    helics::cleanupHelicsLibrary();
+}
+
 TEST_F(query, current_time)
 {
     SetupTest<helics::MessageFederate>("test_3", 2);
@@ -341,6 +407,83 @@ TEST_F(query, version)
     mFed2->finalize();
 }
 
+TEST_F(query, command_counts)
+{
+    SetupTest<helics::MessageFederate>("test", 2);
+    auto mFed1 = GetFederateAs<helics::MessageFederate>(0);
+    auto mFed2 = GetFederateAs<helics::MessageFederate>(1);
+
+    mFed1->registerEndpoint("ept1");
+    mFed2->registerEndpoint("ept2");
+
+    mFed1->enterExecutingModeAsync();
+    mFed2->enterExecutingMode();
+    mFed1->enterExecutingModeComplete();
+
+    for (int ii = 1; ii <= 5; ++ii) {
+        mFed1->requestTimeAsync(ii);
+        mFed2->requestTime(ii);
+        mFed1->requestTimeComplete();
+    }
+    auto res = mFed1->query("root", "command_counts");
+    auto val = loadJsonStr(res);
+    EXPECT_GT(val["processed"].asUInt64(), 0U);
+    EXPECT_TRUE(val.isMember("superseded"));
+    EXPECT_LE(val["superseded"].asUInt64(), val["processed"].asUInt64());
+    res = mFed1->query("core", "command_counts");
+    val = loadJsonStr(res);
+    EXPECT_GT(val["processed"].asUInt64(), 0U);
+    mFed1->finalize();
+    mFed2->finalize();
+}
+
+TEST_F(query, command_counts_superseded)
+{
+    extraCoreArgs = "--coalesce";
+    SetupTest<helics::MessageFederate>("test", 1);
+    auto mFed1 = GetFederateAs<helics::MessageFederate>(0);
+    mFed1->registerEndpoint("ept1");
+    mFed1->enterExecutingMode();
+
+    auto core = std::dynamic_pointer_cast<helics::CommonCore>(mFed1->getCorePointer());
+    ASSERT_TRUE(core);
+    auto fedMap = loadJsonStr(mFed1->query("core", "federate_map"));
+    helics::GlobalFederateId fedId(fedMap["federates"][0]["id"].asInt());
+    auto before = loadJsonStr(mFed1->query("core", "command_counts"));
+
+    // hold the core processing thread in the logger so the time requests queue up behind it
+    std::promise<void> held;
+    std::promise<void> release;
+    auto releaseFuture = release.get_future();
+    core->setLoggingCallback(helics::gLocalCoreId,
+                             [&held, &releaseFuture](int /*level*/,
+                                                     std::string_view /*source*/,
+                                                     std::string_view message) {
+                                 if (message == "hold core") {
+                                     held.set_value();
+                                     releaseFuture.wait();
+                                 }
+                             });
+    core->logMessage(helics::gLocalCoreId, HELICS_LOG_LEVEL_ERROR, "hold core");
+    held.get_future().wait();
+
+    // time requests from a source that is not a dependency of the federate have no effect
+    helics::ActionMessage treq(helics::CMD_TIME_REQUEST);
+    treq.source_id = helics::GlobalFederateId(fedId.baseValue() + 1000);
+    treq.dest_id = fedId;
+    for (int ii = 1; ii <= 3; ++ii) {
+        treq.actionTime = ii;
+        core->addActionMessage(treq);
+    }
+    release.set_value();
+
+    auto val = loadJsonStr(mFed1->query("core", "command_counts"));
+    EXPECT_EQ(val["superseded"].asUInt64() - before["superseded"].asUInt64(), 2U);
+    EXPECT_LT(val["processed"].asUInt64(), val["received"].asUInt64());
+    core->setLoggingCallback(helics::gLocalCoreId, {});
+    mFed1->finalize();
+}
+
 TEST_F(query, exists)
 {
     SetupTest<helics::MessageFederate>("test_3", 2);
@@ -9,7 +9,9 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "gtest/gtest.h"
 #include <atomic>
+#include <chrono>
 #include <complex>
+#include <thread>
 
 /** these test cases test out the value converters
  */
@@ -206,6 +208,97 @@ TEST_F(iteration_tests, time_iteration_test)
     EXPECT_EQ(val2, val);
 }
 
+TEST_F(iteration_tests, time_iteration_convergence_detection)
+{
+    SetupTest<helics::ValueFederate>("test", 1);
+    auto vFed1 = GetFederateAs<helics::ValueFederate>(0);
+    // register the publications
+    auto& pubid = vFed1->registerGlobalPublication<double>("pub1");
+
+    auto& subid = vFed1->registerSubscription("pub1");
+    subid.setMinimumChange(0.5);
+    vFed1->setFlagOption(HELICS_FLAG_DETECT_CONVERGENCE);
+    EXPECT_TRUE(vFed1->getFlagOption(HELICS_FLAG_DETECT_CONVERGENCE));
+    vFed1->setProperty(HELICS_PROPERTY_TIME_PERIOD, 1.0);
+    vFed1->setProperty(HELICS_PROPERTY_TIME_DELTA, 1.0);
+    vFed1->enterExecutingMode();
+    pubid.publish(27.0);
+
+    // the first value is always a change
+    auto comp = vFed1->requestTimeIterative(1.0, helics::IterationRequest::ITERATE_IF_NEEDED);
+    EXPECT_TRUE(comp.state == helics::IterationResult::ITERATING);
+    EXPECT_EQ(comp.grantedTime, helics::timeZero);
+    EXPECT_EQ(subid.getValue<double>(), 27.0);
+
+    // a change within the tolerance of the input has converged
+    pubid.publish(27.2);
+    comp = vFed1->requestTimeIterative(1.0, helics::IterationRequest::ITERATE_IF_NEEDED);
+    EXPECT_TRUE(comp.state == helics::IterationResult::NEXT_STEP);
+    EXPECT_EQ(comp.grantedTime, 1.0);
+
+    // a change beyond the tolerance iterates
+    pubid.publish(29.0);
+    comp = vFed1->requestTimeIterative(2.0, helics::IterationRequest::ITERATE_IF_NEEDED);
+    EXPECT_TRUE(comp.state == helics::IterationResult::ITERATING);
+    EXPECT_EQ(comp.grantedTime, 1.0);
+    EXPECT_EQ(subid.getValue<double>(), 29.0);
+    vFed1->finalize();
+}
+
+TEST_F(iteration_tests, time_iteration_convergence_detection_2fed)
+{
+    SetupTest<helics::ValueFederate>("test", 2, 1.0);
+    auto vFed1 = GetFederateAs<helics::ValueFederate>(0);
+    auto vFed2 = GetFederateAs<helics::ValueFederate>(1);
+    auto& pub1 = vFed1->registerGlobalPublication<double>("pub1");
+    auto& pub2 = vFed2->registerGlobalPublication<double>("pub2");
+    auto& sub1 = vFed1->registerSubscription("pub2");
+    auto& sub2 = vFed2->registerSubscription("pub1");
+    sub1.setMinimumChange(0.5);
+    sub2.setMinimumChange(0.5);
+    vFed1->setFlagOption(HELICS_FLAG_DETECT_CONVERGENCE);
+    vFed2->setFlagOption(HELICS_FLAG_DETECT_CONVERGENCE);
+
+    vFed1->enterExecutingModeAsync();
+    vFed2->enterExecutingMode();
+    vFed1->enterExecutingModeComplete();
+
+    // the first values are always a change
+    pub1.publish(1.0);
+    pub2.publish(10.0);
+    vFed1->requestTimeIterativeAsync(1.0, helics::IterationRequest::ITERATE_IF_NEEDED);
+    auto comp2 = vFed2->requestTimeIterative(1.0, helics::IterationRequest::ITERATE_IF_NEEDED);
+    auto comp1 = vFed1->requestTimeIterativeComplete();
+    EXPECT_TRUE(comp1.state == helics::IterationResult::ITERATING);
+    EXPECT_TRUE(comp2.state == helics::IterationResult::ITERATING);
+    EXPECT_EQ(comp1.grantedTime, helics::timeZero);
+    EXPECT_EQ(comp2.grantedTime, helics::timeZero);
+
+    // vFed1 sees a change within its tolerance so it has converged but vFed2 has not
+    pub1.publish(2.0);
+    pub2.publish(10.1);
+    vFed1->requestTimeIterativeAsync(1.0, helics::IterationRequest::ITERATE_IF_NEEDED);
+    comp2 = vFed2->requestTimeIterative(1.0, helics::IterationRequest::ITERATE_IF_NEEDED);
+    EXPECT_TRUE(comp2.state == helics::IterationResult::ITERATING);
+    EXPECT_EQ(comp2.grantedTime, helics::timeZero);
+    EXPECT_DOUBLE_EQ(sub2.getValue<double>(), 2.0);
+    // vFed2 is still iterating at time 0 so vFed1 cannot be granted the next step
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(vFed1->isAsyncOperationCompleted());
+
+    // now both have converged
+    pub2.publish(10.2);
+    vFed2->requestTimeIterativeAsync(1.0, helics::IterationRequest::ITERATE_IF_NEEDED);
+    comp1 = vFed1->requestTimeIterativeComplete();
+    comp2 = vFed2->requestTimeIterativeComplete();
+    EXPECT_TRUE(comp1.state == helics::IterationResult::NEXT_STEP);
+    EXPECT_TRUE(comp2.state == helics::IterationResult::NEXT_STEP);
+    EXPECT_EQ(comp1.grantedTime, 1.0);
+    EXPECT_EQ(comp2.grantedTime, 1.0);
+    vFed1->finalize();
+    vFed2->finalize();
+}
+
 TEST_F(iteration_tests, time_iteration_test_2fed)
 {
     SetupTest<helics::ValueFederate>("test", 2, 1.0);
@@ -7,15 +7,194 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "../application_api/testFixtures.hpp"
 #include "helics/ValueFederates.hpp"
+#include "helics/application_api/CombinationFederate.hpp"
+#include "helics/common/JsonProcessingFunctions.hpp"
 #include "helics/helics-config.h"
 
 #include "gtest/gtest.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <gmlc/libguarded/guarded.hpp>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
 
 /** tests for some network options*/
 
 struct network_tests: public FederateTestFixture, public ::testing::Test {
 };
 
+/** test that cores beyond the fan-in limit are redirected to generated sub-brokers*/
+TEST_F(network_tests, test_auto_split)
+{
+    extraBrokerArgs = "--auto_split=2";
+    SetupTest<helics::ValueFederate>("test_2", 5, 1.0);
+    auto vFed1 = GetFederateAs<helics::ValueFederate>(0);
+    auto& pub = vFed1->registerGlobalPublication<double>("pub1");
+    std::vector<helics::Input*> inputs;
+    for (int ii = 1; ii < 5; ++ii) {
+        auto vFed = GetFederateAs<helics::ValueFederate>(ii);
+        inputs.push_back(&vFed->registerSubscription("pub1"));
+    }
+    for (int ii = 1; ii < 5; ++ii) {
+        GetFederateAs<helics::ValueFederate>(ii)->enterExecutingModeAsync();
+    }
+    vFed1->enterExecutingMode();
+    for (int ii = 1; ii < 5; ++ii) {
+        GetFederateAs<helics::ValueFederate>(ii)->enterExecutingModeComplete();
+    }
+    // 5 cores and 2 generated sub-brokers
+    auto counts = loadJsonStr(brokers[0]->query("root", "counts"));
+    EXPECT_EQ(counts["brokers"].asInt(), 7);
+
+    pub.publish(3.5);
+    for (int ii = 1; ii < 5; ++ii) {
+        GetFederateAs<helics::ValueFederate>(ii)->requestTimeAsync(1.0);
+    }
+    vFed1->requestTime(1.0);
+    for (int ii = 1; ii < 5; ++ii) {
+        GetFederateAs<helics::ValueFederate>(ii)->requestTimeComplete();
+        EXPECT_DOUBLE_EQ(inputs[ii - 1]->getValue<double>(), 3.5);
+    }
+    for (auto& fed : federates) {
+        fed->finalize();
+    }
+}
+
+/** test that a relaunched federation connects interfaces from the cached connection graph*/
+TEST_F(network_tests, test_connection_cache)
+{
+    const std::string cacheFile{"network_tests_connection_cache.json"};
+    std::remove(cacheFile.c_str());
+    extraBrokerArgs = std::string("--connection_cache=") + cacheFile;
+
+    // the first launch records the connection graph when the federation initializes
+    auto broker = AddBroker("test", 2);
+    AddFederates<helics::ValueFederate>("test_2", 2, broker, 1.0);
+    auto vFed1 = GetFederateAs<helics::ValueFederate>(0);
+    auto vFed2 = GetFederateAs<helics::ValueFederate>(1);
+    vFed1->registerGlobalPublication<double>("cc_pub1");
+    vFed1->registerGlobalPublication<double>("cc_pub2");
+    vFed1->registerGlobalPublication<double>("cc_pub3");
+    vFed2->registerGlobalInput<double>("cc_in1").addTarget("cc_pub1");
+    vFed2->registerGlobalInput<double>("cc_in2").addTarget("cc_pub2");
+    vFed2->registerGlobalInput<double>("cc_in3").addTarget("cc_pub3");
+    vFed1->enterExecutingModeAsync();
+    vFed2->enterExecutingMode();
+    vFed1->enterExecutingModeComplete();
+    vFed1->finalize();
+    vFed2->finalize();
+    EXPECT_TRUE(broker->waitForDisconnect(std::chrono::milliseconds(1000)));
+    EXPECT_TRUE(std::ifstream(cacheFile).good());
+    federates.clear();
+    brokers.clear();
+
+    // the relaunch connects from the cache,  in2 changes its flags and in3 no longer connects
+    broker = AddBroker("test", 2);
+    // the broker can outlive the test body so the log is shared with the callback
+    auto mlog = std::make_shared<gmlc::libguarded::guarded<std::vector<std::string>>>();
+    broker->setLoggingLevel(HELICS_LOG_LEVEL_CONNECTIONS);
+    broker->setLoggingCallback(
+        [mlog](int /*level*/, std::string_view /*unused*/, std::string_view message) {
+            mlog->lock()->emplace_back(message);
+        });
+    AddFederates<helics::ValueFederate>("test_2", 2, broker, 1.0);
+    vFed1 = GetFederateAs<helics::ValueFederate>(0);
+    vFed2 = GetFederateAs<helics::ValueFederate>(1);
+    auto& pub1 = vFed1->registerGlobalPublication<double>("cc_pub1");
+    auto& pub2 = vFed1->registerGlobalPublication<double>("cc_pub2");
+    auto& pub3 = vFed1->registerGlobalPublication<double>("cc_pub3");
+    auto& in1 = vFed2->registerGlobalInput<double>("cc_in1");
+    auto& in2 = vFed2->registerGlobalInput<double>("cc_in2");
+    auto& in3 = vFed2->registerGlobalInput<double>("cc_in3");
+    in1.addTarget("cc_pub1");
+    in2.setOption(helics::defs::Options::CONNECTION_OPTIONAL);
+    in2.addTarget("cc_pub2");
+    vFed1->enterExecutingModeAsync();
+    vFed2->enterExecutingMode();
+    vFed1->enterExecutingModeComplete();
+
+    pub1.publish(1.5);
+    pub2.publish(2.5);
+    pub3.publish(3.5);
+    vFed1->requestTimeAsync(1.0);
+    vFed2->requestTime(1.0);
+    vFed1->requestTimeComplete();
+    EXPECT_DOUBLE_EQ(in1.getValue<double>(), 1.5);
+    EXPECT_DOUBLE_EQ(in2.getValue<double>(), 2.5);
+    EXPECT_FALSE(in3.isUpdated());
+    vFed1->finalize();
+    vFed2->finalize();
+    EXPECT_TRUE(broker->waitForDisconnect(std::chrono::milliseconds(1000)));
+    std::remove(cacheFile.c_str());
+
+    auto hasMessage = [&mlog](const std::string& text) {
+        auto messages = mlog->lock();
+        for (const auto& message : *messages) {
+            if (message.find(text) != std::string::npos) {
+                return true;
+            }
+        }
+        return false;
+    };
+    EXPECT_TRUE(hasMessage("loaded 3 cached connections"));
+    EXPECT_TRUE(hasMessage("removed 1 cached connections that were not requested"));
+}
+
+/** test that the cache is not used when the registered federates differ from the cached ones*/
+TEST_F(network_tests, test_connection_cache_federate_names)
+{
+    const std::string cacheFile{"network_tests_connection_cache_names.json"};
+    std::remove(cacheFile.c_str());
+    extraBrokerArgs = std::string("--connection_cache=") + cacheFile;
+
+    // the first launch expects one federate but two register
+    auto broker = AddBroker("test", 1);
+    AddFederates<helics::ValueFederate>("test_2", 2, broker, 1.0);
+    auto vFed1 = GetFederateAs<helics::ValueFederate>(0);
+    auto vFed2 = GetFederateAs<helics::ValueFederate>(1);
+    vFed1->registerGlobalPublication<double>("ccn_pub1");
+    vFed2->registerGlobalInput<double>("ccn_in1").addTarget("ccn_pub1");
+    vFed1->enterExecutingModeAsync();
+    vFed2->enterExecutingMode();
+    vFed1->enterExecutingModeComplete();
+    vFed1->finalize();
+    vFed2->finalize();
+    EXPECT_TRUE(broker->waitForDisconnect(std::chrono::milliseconds(1000)));
+    federates.clear();
+    brokers.clear();
+
+    // the relaunch expects the same federate count but only one of the cached federates registers
+    broker = AddBroker("test", 1);
+    auto mlog = std::make_shared<gmlc::libguarded::guarded<std::vector<std::string>>>();
+    broker->setLoggingLevel(HELICS_LOG_LEVEL_CONNECTIONS);
+    broker->setLoggingCallback(
+        [mlog](int /*level*/, std::string_view /*unused*/, std::string_view message) {
+            mlog->lock()->emplace_back(message);
+        });
+    AddFederates<helics::ValueFederate>("test_2", 1, broker, 1.0);
+    vFed1 = GetFederateAs<helics::ValueFederate>(0);
+    vFed1->registerGlobalPublication<double>("ccn_pub1");
+    vFed1->enterExecutingMode();
+    vFed1->finalize();
+    EXPECT_TRUE(broker->waitForDisconnect(std::chrono::milliseconds(1000)));
+    std::remove(cacheFile.c_str());
+
+    auto hasMessage = [&mlog](const std::string& text) {
+        auto messages = mlog->lock();
+        for (const auto& message : *messages) {
+            if (message.find(text) != std::string::npos) {
+                return true;
+            }
+        }
+        return false;
+    };
+    EXPECT_TRUE(hasMessage("loaded 1 cached connections"));
+    EXPECT_TRUE(hasMessage("the registered federates do not match the cached connection graph"));
+}
+
 #ifdef ENABLE_TCP_CORE
 /** test simple creation and destruction*/
 TEST_F(network_tests, test_external_tcp)
@@ -67,6 +246,57 @@ TEST_F(network_tests, test_external_tcpss)
     vFed1->finalize();
 }
 
+/** test that forwarded data reaches federates behind sub-brokers and federates on the root broker*/
+TEST_F(network_tests, test_cut_through_tcp)
+{
+    extraBrokerArgs = "--cut_through";
+    // two federates each behind their own sub-broker and one on a core of the root broker
+    SetupTest<helics::CombinationFederate>("tcp_4", 2, 1.0);
+    AddFederates<helics::CombinationFederate>("tcp", 1, brokers[0], 1.0);
+    auto cFed1 = GetFederateAs<helics::CombinationFederate>(0);
+    auto cFed2 = GetFederateAs<helics::CombinationFederate>(1);
+    auto cFed3 = GetFederateAs<helics::CombinationFederate>(2);
+    ASSERT_TRUE(cFed1 && cFed2 && cFed3);
+
+    auto& pub = cFed1->registerGlobalPublication<double>("ct_pub");
+    auto& sub2 = cFed2->registerSubscription("ct_pub");
+    auto& sub3 = cFed3->registerSubscription("ct_pub");
+    auto& ept1 = cFed1->registerGlobalEndpoint("ct_ept1");
+    auto& ept2 = cFed2->registerGlobalEndpoint("ct_ept2");
+    auto& ept3 = cFed3->registerGlobalEndpoint("ct_ept3");
+
+    cFed1->enterExecutingModeAsync();
+    cFed2->enterExecutingModeAsync();
+    cFed3->enterExecutingMode();
+    cFed1->enterExecutingModeComplete();
+    cFed2->enterExecutingModeComplete();
+
+    for (int ii = 1; ii <= 5; ++ii) {
+        pub.publish(ii * 1.5);
+        // between sub-brokers, from a sub-broker to the root core, and from the root core back
+        ept1.sendTo(std::to_string(ii), "ct_ept2");
+        ept2.sendTo(std::to_string(ii + 10), "ct_ept3");
+        ept3.sendTo(std::to_string(ii + 20), "ct_ept1");
+        cFed1->requestTimeAsync(ii);
+        cFed2->requestTimeAsync(ii);
+        EXPECT_EQ(cFed3->requestTime(ii), static_cast<double>(ii));
+        EXPECT_EQ(cFed1->requestTimeComplete(), static_cast<double>(ii));
+        EXPECT_EQ(cFed2->requestTimeComplete(), static_cast<double>(ii));
+
+        EXPECT_DOUBLE_EQ(sub2.getValue<double>(), ii * 1.5);
+        EXPECT_DOUBLE_EQ(sub3.getValue<double>(), ii * 1.5);
+        ASSERT_TRUE(ept2.hasMessage());
+        EXPECT_EQ(ept2.getMessage()->to_string(), std::to_string(ii));
+        ASSERT_TRUE(ept3.hasMessage());
+        EXPECT_EQ(ept3.getMessage()->to_string(), std::to_string(ii + 10));
+        ASSERT_TRUE(ept1.hasMessage());
+        EXPECT_EQ(ept1.getMessage()->to_string(), std::to_string(ii + 20));
+    }
+    for (auto& fed : federates) {
+        fed->finalize();
+    }
+}
+
 TEST_F(network_tests, test_external_tcpss_ipv4)
 {
     extraBrokerArgs = "--ipv4";
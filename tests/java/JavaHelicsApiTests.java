@@ -1,3 +1,6 @@
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
 import java.util.ArrayList;
 import java.util.List;
 
@@ -22,7 +25,7 @@ public void helicsAssert(String errorMessage) {
     }
 
     public static void main(String[] args) {
-        JavaHelicsApiTests javaHelicsApiTests = new JavaHelicsApiTests(94);
+        JavaHelicsApiTests javaHelicsApiTests = new JavaHelicsApiTests(96);
         try {
             // General HELICS Functions
             double helicsTimeZero = helics.getHELICS_TIME_ZERO();
@@ -323,7 +326,7 @@ public static void main(String[] args) {
             helics.helicsInputSetDefaultNamedPoint(sub7, "hollow", 20.0);
             helics.helicsInputSetDefaultString(sub3, "default");
             double[] sub6Default = { 3.4, 90.9, 4.5 };
-            helics.helicsInputSetDefaultVector(sub6, sub6Default, 3);
+            helics.helicsInputSetDefaultVector(sub6, sub6Default);
             helics.helicsEndpointSubscribe(ep2, "fed1/pub3");
             helics.helicsFederateEnterInitializingModeAsync(fed1);
             int rs = helics.helicsFederateIsAsyncOperationCompleted(fed1);
@@ -412,7 +415,11 @@ public static void main(String[] args) {
             helics.helicsPublicationPublishNamedPoint(pub7, "Blah Blah", 20.0);
             helics.helicsPublicationPublishString(pub3, "Mayhem");
             double[] pub6Vector = { 4.5, 56.5 };
-            helics.helicsPublicationPublishVector(pub6, pub6Vector, 2);
+            helics.helicsPublicationPublishVector(pub6, pub6Vector);
+            DoubleBuffer pub6Buffer = ByteBuffer.allocateDirect(4 * Double.BYTES)
+                    .order(ByteOrder.nativeOrder()).asDoubleBuffer();
+            pub6Buffer.put(0, 4.5).put(1, 56.5);
+            helics.helicsPublicationPublishVectorDirect(pub6, pub6Buffer, 2);
             Thread.sleep(500);
             helics.helicsFederateRequestTimeAsync(fed1, 1.0);
 
@@ -572,6 +579,15 @@ public static void main(String[] args) {
             SWIGTYPE_p_double sub6Vector = null;
             int[] sub6ActualSize = new int[1];
             helics.helicsInputGetVector(sub6, sub6Vector, 6, sub6ActualSize);
+            DoubleBuffer sub6Buffer = ByteBuffer.allocateDirect(6 * Double.BYTES)
+                    .order(ByteOrder.nativeOrder()).asDoubleBuffer();
+            int sub6BufferCount = helics.helicsInputGetVectorDirect(sub6, sub6Buffer);
+            if (sub6BufferCount != 2) {
+                javaHelicsApiTests.helicsAssert("sub6BufferCount != 2");
+            }
+            if (sub6Buffer.get(0) != 4.5 || sub6Buffer.get(1) != 56.5) {
+                javaHelicsApiTests.helicsAssert("sub6Buffer != {4.5, 56.5}");
+            }
 
             helics.helicsFederateFinalize(fed1);
             helics.helicsFederateFinalize(fed2);